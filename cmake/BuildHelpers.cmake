@@ -127,6 +127,31 @@ function(nm_add_test target)
   add_dependencies(${TGT_MODULE_TEST} ${test_target})
 endfunction()
 
+# Benchmarks are built on demand and not registered with ctest
+function(nm_add_bench target)
+  if(TGT_TOOL_TEST)
+    set(bench_target "${TGT_TOOL_TEST}.${target}")
+  elseif(TGT_LIBRARY_TEST)
+    set(bench_target "${TGT_LIBRARY_TEST}.${target}")
+  else()
+    set(bench_target "${TGT_MODULE_TEST}.${target}")
+  endif()
+  string(REGEX REPLACE "^Test\\." "Bench." bench_target "${bench_target}")
+  set(TGT_BENCH "${bench_target}" PARENT_SCOPE)
+  add_executable(${bench_target}
+      EXCLUDE_FROM_ALL
+      ${target}.bench.cpp
+    )
+  target_link_libraries(${bench_target}
+      ${Boost_LIBRARIES}
+    )
+  target_compile_definitions(${bench_target}
+    PUBLIC
+      -DPROGRAM_NAME="Benchmarking"
+      -DPROGRAM_VERSION="Benchmarking"
+    )
+endfunction()
+
 # Install related helpers
 function(nm_install_bin target_file)
   target_compile_definitions(${target_file}
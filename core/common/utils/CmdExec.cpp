@@ -24,15 +24,54 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <csignal>
+
 #include <netmeld/core/utils/CmdExec.hpp>
+#include <netmeld/core/utils/SpawnExec.hpp>
 
 
 namespace netmeld::core::utils {
 
+  // Unnamed namespace to hide helper logic
+  namespace {
+    // Mirrors std::system(), the parent ignores SIGINT and SIGQUIT while it
+    // waits so an interactive interrupt only reaches the child
+    class IgnoreInteractiveSignals {
+      private:
+        struct sigaction oldInt;
+        struct sigaction oldQuit;
+
+      public:
+        IgnoreInteractiveSignals()
+        {
+          struct sigaction ignore {};
+          ignore.sa_handler = SIG_IGN;
+          sigemptyset(&ignore.sa_mask);
+          sigaction(SIGINT, &ignore, &oldInt);
+          sigaction(SIGQUIT, &ignore, &oldQuit);
+        }
+
+        ~IgnoreInteractiveSignals()
+        {
+          sigaction(SIGINT, &oldInt, nullptr);
+          sigaction(SIGQUIT, &oldQuit, nullptr);
+        }
+
+        IgnoreInteractiveSignals(const IgnoreInteractiveSignals&) = delete;
+        void operator=(const IgnoreInteractiveSignals&) = delete;
+    };
+  }
+
   bool
   isCmdAvailable(const std::string& _cmd)
   {
-    return (0 == cmdExec("type " + _cmd + " >/dev/null 2>/dev/null"));
+    auto result {
+      SpawnExec::shell("type " + _cmd)
+        .setStdout(SpawnStream::DISCARD)
+        .setStderr(SpawnStream::DISCARD)
+        .run()
+    };
+    return (0 == result.exitStatus);
   }
 
   int
@@ -50,49 +89,36 @@ namespace netmeld::core::utils {
   {
     LOG_DEBUG << _cmd << '\n';
 
-    auto exitStatus {std::system(_cmd.c_str())};
-    LOG_DEBUG << "Cmd raw return value: " << exitStatus << '\n';
-    if (WIFEXITED(exitStatus)) {
-      exitStatus = WEXITSTATUS(exitStatus);
-      if (255 == exitStatus) { exitStatus = -1; };
-    } else {
-      LOG_WARN << "Cmd possibly exited abnormally\n";
+    SpawnResult result;
+    {
+      IgnoreInteractiveSignals ignoreSignals;
+      result = SpawnExec::shell(_cmd).run();
     }
+    LOG_DEBUG << "Cmd raw return value: " << result.rawStatus << '\n';
+
+    auto exitStatus {result.exitStatus};
     if (-1 == exitStatus) { LOG_ERROR << "Failure: " << _cmd << '\n'; }
     if (0 != exitStatus)  { LOG_WARN << "Non-Zero: " << _cmd << '\n'; }
 
     return exitStatus;
   }
 
-  // Unnamed namespace to hide helper logic
-  namespace {
-    struct FileDeleter {
-      void operator()(FILE* file) const {
-        if (file) {
-          pclose(file);
-        }
-      }
-    };
-  }
-
   std::string
   cmdExecOut(const std::string& _cmd)
   {
     LOG_DEBUG << _cmd << '\n';
 
-    std::unique_ptr<FILE, FileDeleter> pipe(popen(_cmd.c_str(), "r"));
-    if (!pipe) {
+    auto result {
+      SpawnExec::shell(_cmd)
+        .setStdout(SpawnStream::CAPTURE)
+        .run()
+    };
+    if (-1 == result.rawStatus) {
       LOG_ERROR << "Failure: " << _cmd << '\n';
       return "";
     }
 
-    std::array<char, 128> buffer;
-    std::ostringstream oss;
-    while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
-      oss << buffer.data();
-    }
-
-    return oss.str();
+    return result.stdoutData;
   }
 
 }
@@ -0,0 +1,127 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+// Compares spawn latency and output capture of SpawnExec against the
+// std::system()/popen() approach cmdExec()/cmdExecOut() historically used.
+//
+// Usage: <bench> [iterations]
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+#include <netmeld/core/utils/SpawnExec.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  template<typename Func>
+  void
+  bench( const std::string& name, size_t iterations, Func&& func
+       , size_t opsPerIteration = 1
+       )
+  {
+    auto start {Clock::now()};
+    for (size_t i {0}; i < iterations; ++i) {
+      func();
+    }
+    auto elapsed {std::chrono::duration<double, std::micro>
+                    (Clock::now() - start).count()};
+
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed
+              << std::setprecision(1)
+              << (elapsed / (iterations * opsPerIteration))
+              << " us/op\n";
+  }
+
+  std::string
+  popenOut(const std::string& cmd)
+  {
+    std::unique_ptr<FILE, int(*)(FILE*)> pipe(popen(cmd.c_str(), "r"),
+                                               pclose);
+    std::array<char, 128> buffer;
+    std::ostringstream oss;
+    while (fgets(buffer.data(), buffer.size(), pipe.get()) != nullptr) {
+      oss << buffer.data();
+    }
+    return oss.str();
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  size_t iterations {(argc > 1) ? std::stoul(argv[1]) : 200};
+  const std::string bigOut {"yes netmeld | head -c 8388608"};
+
+  std::cout << "Iterations: " << iterations << "\n\n";
+
+  std::cout << "-- Spawn latency\n";
+  bench("std::system(\"true\")", iterations, [](){
+      return std::system("true");
+    });
+  bench("SpawnExec::shell(\"true\")", iterations, [](){
+      return nmcu::SpawnExec::shell("true").run();
+    });
+  bench("SpawnExec({\"true\"})", iterations, [](){
+      return nmcu::SpawnExec({"true"}).run();
+    });
+
+  std::cout << "\n-- Output capture (8 MiB)\n";
+  size_t bigIterations {std::max<size_t>(1, iterations / 20)};
+  bench("popen + fgets(128)", bigIterations, [&](){
+      return popenOut(bigOut);
+    });
+  bench("SpawnExec CAPTURE", bigIterations, [&](){
+      return nmcu::SpawnExec::shell(bigOut)
+               .setStdout(nmcu::SpawnStream::CAPTURE)
+               .run();
+    });
+  bench("SpawnExec CAPTURE (callback)", bigIterations, [&](){
+      size_t total {0};
+      return nmcu::SpawnExec::shell(bigOut)
+               .setStdout(nmcu::SpawnStream::CAPTURE,
+                          [&](std::string_view data){ total += data.size(); })
+               .run();
+    });
+
+  std::cout << "\n-- Concurrent (per child)\n";
+  bench("SpawnExecPool({\"true\"})", 1, [&](){
+      nmcu::SpawnExecPool pool;
+      for (size_t i {0}; i < iterations; ++i) {
+        pool.add(nmcu::SpawnExec({"true"}));
+      }
+      return pool.run();
+    }, iterations);
+
+  return 0;
+}
@@ -0,0 +1,520 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#include <algorithm>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+extern "C" {
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+}
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/core/utils/SpawnExec.hpp>
+
+extern char** environ;
+
+
+namespace netmeld::core::utils {
+
+  // Unnamed namespace to hide helper logic
+  namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // Interval to check on children that cannot be waited on via a pidfd
+    const std::chrono::milliseconds REAP_POLL_INTERVAL {10};
+
+    struct Child {
+      const SpawnExec*  exec      {nullptr};
+      size_t            index     {0};
+      pid_t             pid       {-1};
+      int               stdoutFd  {-1};
+      int               stderrFd  {-1};
+      int               pidFd     {-1};
+      bool              reaped    {false};
+      Clock::time_point deadline  {Clock::time_point::max()};
+    };
+
+    void
+    closeFd(int& fd)
+    {
+      if (-1 != fd) {
+        close(fd);
+        fd = -1;
+      }
+    }
+
+    void
+    logErrno(const std::string& what, int err, const SpawnExec& exec)
+    {
+      LOG_ERROR << what
+                << " (" << err << ": " << std::strerror(err) << ")"
+                << " for command: " << exec.toString()
+                << '\n';
+    }
+
+    int
+    openPidFd([[maybe_unused]] pid_t pid)
+    {
+#ifdef SYS_pidfd_open
+      return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+      return -1;
+#endif
+    }
+
+    // Sets up the child side of a stream, returning the pipe ends (if any)
+    bool
+    configureStream( posix_spawn_file_actions_t& actions, int targetFd
+                   , SpawnStream mode, int& readFd, int& writeFd
+                   , const SpawnExec& exec
+                   )
+    {
+      if (SpawnStream::CAPTURE == mode) {
+        int fds[2];
+        if (-1 == pipe2(fds, O_CLOEXEC)) {
+          logErrno("Pipe creation failure", errno, exec);
+          return false;
+        }
+        readFd  = fds[0];
+        writeFd = fds[1];
+#ifdef F_SETPIPE_SZ
+        // Larger pipes mean fewer wakeups for chatty children
+        if (exec.getBufferSize() > SpawnExec::DEFAULT_BUFFER_SIZE) {
+          fcntl(readFd, F_SETPIPE_SZ, static_cast<int>(exec.getBufferSize()));
+        }
+#endif
+        // dup2 in the child clears O_CLOEXEC on the target descriptor
+        posix_spawn_file_actions_adddup2(&actions, writeFd, targetFd);
+      } else if (SpawnStream::DISCARD == mode) {
+        posix_spawn_file_actions_addopen(&actions, targetFd, "/dev/null",
+                                         O_WRONLY, 0);
+      }
+      return true;
+    }
+
+    int
+    toExitStatus(int rawStatus)
+    {
+      int exitStatus {rawStatus};
+      if (WIFEXITED(rawStatus)) {
+        exitStatus = WEXITSTATUS(rawStatus);
+        if (255 == exitStatus) { exitStatus = -1; };
+      } else {
+        LOG_WARN << "Cmd possibly exited abnormally\n";
+      }
+      return exitStatus;
+    }
+
+    bool
+    startChild(Child& child, SpawnResult& result)
+    {
+      const auto& exec {*child.exec};
+      const auto& args {exec.getArgs()};
+      if (args.empty()) {
+        LOG_ERROR << "No args to execute\n";
+        return false;
+      }
+
+      posix_spawn_file_actions_t actions;
+      posix_spawn_file_actions_init(&actions);
+
+      int stdoutWriteFd {-1};
+      int stderrWriteFd {-1};
+      bool streamsOk {
+           configureStream(actions, STDOUT_FILENO, exec.getStdoutMode(),
+                           child.stdoutFd, stdoutWriteFd, exec)
+        && configureStream(actions, STDERR_FILENO, exec.getStderrMode(),
+                           child.stderrFd, stderrWriteFd, exec)
+      };
+
+      // Children start with default dispositions and an empty mask, even if
+      // the parent is ignoring or blocking things like SIGINT or SIGPIPE
+      posix_spawnattr_t attr;
+      posix_spawnattr_init(&attr);
+      sigset_t signals;
+      sigemptyset(&signals);
+      posix_spawnattr_setsigmask(&attr, &signals);
+      sigaddset(&signals, SIGINT);
+      sigaddset(&signals, SIGQUIT);
+      sigaddset(&signals, SIGPIPE);
+      sigaddset(&signals, SIGCHLD);
+      posix_spawnattr_setsigdefault(&attr, &signals);
+      short flags {POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF};
+      if (exec.getTimeout().count() > 0) {
+        // Own process group so a timeout can take out any grandchildren too
+        flags |= POSIX_SPAWN_SETPGROUP;
+        posix_spawnattr_setpgroup(&attr, 0);
+      }
+      posix_spawnattr_setflags(&attr, flags);
+
+      std::vector<char*> argv;
+      for (const auto& arg : args) {
+        // cppcheck-suppress useStlAlgorithm
+        argv.push_back(const_cast<char*>(arg.c_str()));
+      }
+      argv.push_back(nullptr);
+
+      int err {0};
+      if (streamsOk) {
+        err = posix_spawnp(&child.pid, args.at(0).c_str(), &actions, &attr,
+                           argv.data(), environ);
+      }
+
+      posix_spawnattr_destroy(&attr);
+      posix_spawn_file_actions_destroy(&actions);
+      closeFd(stdoutWriteFd);
+      closeFd(stderrWriteFd);
+
+      if (!streamsOk || 0 != err) {
+        if (0 != err) {
+          logErrno("Execution failure", err, exec);
+        }
+        closeFd(child.stdoutFd);
+        closeFd(child.stderrFd);
+        child.pid = -1;
+        result.exitStatus = -1;
+        return false;
+      }
+
+      for (int fd : {child.stdoutFd, child.stderrFd}) {
+        if (-1 != fd) {
+          fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        }
+      }
+      child.pidFd = openPidFd(child.pid);
+      if (exec.getTimeout().count() > 0) {
+        child.deadline = Clock::now() + exec.getTimeout();
+      }
+
+      return true;
+    }
+
+    // Drains what is currently available, closing the descriptor on EOF
+    void
+    readStream( int& fd, const SpawnCallback& callback, std::string& data
+              , std::vector<char>& buffer
+              )
+    {
+      while (-1 != fd) {
+        ssize_t count {read(fd, buffer.data(), buffer.size())};
+        if (count > 0) {
+          if (callback) {
+            callback(std::string_view(buffer.data(),
+                                      static_cast<size_t>(count)));
+          } else {
+            data.append(buffer.data(), static_cast<size_t>(count));
+          }
+        } else if (0 == count) {
+          closeFd(fd);
+        } else if (EINTR == errno) {
+          continue;
+        } else {
+          if (EAGAIN != errno && EWOULDBLOCK != errno) {
+            closeFd(fd);
+          }
+          break;
+        }
+      }
+    }
+
+    void
+    tryReap(Child& child, SpawnResult& result)
+    {
+      if (child.reaped) { return; }
+
+      int status {0};
+      pid_t pid {waitpid(child.pid, &status, WNOHANG)};
+      if (child.pid == pid) {
+        child.reaped      = true;
+        result.rawStatus  = status;
+        result.exitStatus = toExitStatus(status);
+        closeFd(child.pidFd);
+      } else if (-1 == pid && EINTR != errno) {
+        logErrno("Abnormal execution termination", errno, *child.exec);
+        child.reaped      = true;
+        result.exitStatus = -1;
+        closeFd(child.pidFd);
+      }
+    }
+
+    bool
+    isFinished(const Child& child)
+    {
+      return child.reaped && -1 == child.stdoutFd && -1 == child.stderrFd;
+    }
+  }
+
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  SpawnExec::SpawnExec(const std::vector<std::string>& _args) :
+    args(_args)
+  {}
+
+  SpawnExec
+  SpawnExec::shell(const std::string& _cmd)
+  {
+    return SpawnExec({"/bin/sh", "-c", _cmd});
+  }
+
+  SpawnExecPool::SpawnExecPool(size_t _maxConcurrent) :
+    maxConcurrent(_maxConcurrent)
+  {
+    if (0 == maxConcurrent) {
+      maxConcurrent = std::max(1U, std::thread::hardware_concurrency());
+    }
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  SpawnExec&
+  SpawnExec::setStdout(SpawnStream _mode, const SpawnCallback& _callback)
+  {
+    stdoutMode      = _mode;
+    stdoutCallback  = _callback;
+    return *this;
+  }
+
+  SpawnExec&
+  SpawnExec::setStderr(SpawnStream _mode, const SpawnCallback& _callback)
+  {
+    stderrMode      = _mode;
+    stderrCallback  = _callback;
+    return *this;
+  }
+
+  SpawnExec&
+  SpawnExec::setTimeout(std::chrono::milliseconds _timeout)
+  {
+    timeout = _timeout;
+    return *this;
+  }
+
+  SpawnExec&
+  SpawnExec::setBufferSize(size_t _bufferSize)
+  {
+    bufferSize = std::max<size_t>(1, _bufferSize);
+    return *this;
+  }
+
+  const std::vector<std::string>&
+  SpawnExec::getArgs() const
+  {
+    return args;
+  }
+
+  SpawnStream
+  SpawnExec::getStdoutMode() const
+  {
+    return stdoutMode;
+  }
+
+  SpawnStream
+  SpawnExec::getStderrMode() const
+  {
+    return stderrMode;
+  }
+
+  const SpawnCallback&
+  SpawnExec::getStdoutCallback() const
+  {
+    return stdoutCallback;
+  }
+
+  const SpawnCallback&
+  SpawnExec::getStderrCallback() const
+  {
+    return stderrCallback;
+  }
+
+  std::chrono::milliseconds
+  SpawnExec::getTimeout() const
+  {
+    return timeout;
+  }
+
+  size_t
+  SpawnExec::getBufferSize() const
+  {
+    return bufferSize;
+  }
+
+  SpawnResult
+  SpawnExec::run() const
+  {
+    SpawnExecPool pool {1};
+    pool.add(*this);
+    return pool.run().at(0);
+  }
+
+  std::string
+  SpawnExec::toString() const
+  {
+    std::ostringstream oss;
+    oss << '[';
+    bool first {true};
+    for (const auto& arg : args) {
+      if (!first) { oss << ", "; }
+      oss << arg;
+      first = false;
+    }
+    oss << ']';
+    return oss.str();
+  }
+
+  size_t
+  SpawnExecPool::add(const SpawnExec& _exec)
+  {
+    queued.push_back(_exec);
+    return queued.size() - 1;
+  }
+
+  size_t
+  SpawnExecPool::size() const
+  {
+    return queued.size();
+  }
+
+  std::vector<SpawnResult>
+  SpawnExecPool::run()
+  {
+    std::vector<SpawnResult> results(queued.size());
+    std::vector<Child>       running;
+    std::vector<pollfd>      pollFds;
+
+    size_t maxBufferSize {1};
+    for (const auto& exec : queued) {
+      maxBufferSize = std::max(maxBufferSize, exec.getBufferSize());
+    }
+    std::vector<char> buffer(maxBufferSize);
+
+    size_t next {0};
+    while (next < queued.size() || !running.empty()) {
+      // Top off the running set
+      while (running.size() < maxConcurrent && next < queued.size()) {
+        Child child;
+        child.exec  = &queued[next];
+        child.index = next;
+        LOG_DEBUG << "Spawning: " << child.exec->toString() << '\n';
+        if (startChild(child, results[next])) {
+          running.push_back(child);
+        }
+        ++next;
+      }
+      if (running.empty()) { continue; }
+
+      // Determine what to wait on and for how long
+      pollFds.clear();
+      auto now      {Clock::now()};
+      auto deadline {Clock::time_point::max()};
+      for (auto& child : running) {
+        for (int fd : {child.stdoutFd, child.stderrFd, child.pidFd}) {
+          if (-1 != fd) {
+            pollFds.push_back({fd, POLLIN, 0});
+          }
+        }
+        if (!child.reaped) {
+          if (-1 == child.pidFd) {
+            deadline = std::min(deadline, now + REAP_POLL_INTERVAL);
+          }
+          deadline = std::min(deadline, child.deadline);
+        }
+      }
+
+      int waitMs {-1};
+      if (Clock::time_point::max() != deadline) {
+        auto remaining {std::chrono::duration_cast<std::chrono::milliseconds>
+                          (deadline - now).count()};
+        waitMs = static_cast<int>(std::max<long>(0, remaining + 1));
+      }
+
+      if (-1 == poll(pollFds.data(), pollFds.size(), waitMs)
+          && EINTR != errno)
+      {
+        LOG_ERROR << "Poll failure"
+                  << " (" << errno << ": " << std::strerror(errno) << ")"
+                  << '\n';
+        break;
+      }
+
+      // Service output, timeouts, and exits
+      now = Clock::now();
+      for (auto& child : running) {
+        auto& result {results[child.index]};
+        const auto& exec {*child.exec};
+
+        readStream(child.stdoutFd, exec.getStdoutCallback(),
+                   result.stdoutData, buffer);
+        readStream(child.stderrFd, exec.getStderrCallback(),
+                   result.stderrData, buffer);
+
+        if (!child.reaped && now >= child.deadline) {
+          LOG_WARN << "Timeout, killing: " << exec.toString() << '\n';
+          kill(-child.pid, SIGKILL);
+          result.timedOut = true;
+          child.deadline  = Clock::time_point::max();
+        }
+
+        tryReap(child, result);
+
+        // Do not wait on descendants holding the pipes open after a timeout
+        if (child.reaped && result.timedOut) {
+          closeFd(child.stdoutFd);
+          closeFd(child.stderrFd);
+        }
+      }
+
+      std::erase_if(running, isFinished);
+    }
+
+    // Only reached on a poll failure, do not leave anything behind
+    for (auto& child : running) {
+      if (!child.reaped) {
+        kill(child.pid, SIGKILL);
+        waitpid(child.pid, nullptr, 0);
+      }
+      for (int* fd : {&child.stdoutFd, &child.stderrFd, &child.pidFd}) {
+        closeFd(*fd);
+      }
+      results[child.index].exitStatus = -1;
+    }
+
+    queued.clear();
+    return results;
+  }
+}
@@ -0,0 +1,158 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#ifndef SPAWN_EXEC_HPP
+#define SPAWN_EXEC_HPP
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace netmeld::core::utils {
+
+  // How a spawned child's stdout/stderr should be connected
+  enum class SpawnStream {
+    INHERIT = 0,  // share the parent's descriptor (the default)
+    CAPTURE,      // pipe back to the parent; to a callback or the result
+    DISCARD       // redirect to /dev/null
+  };
+
+  // Receives captured output as it arrives; the view is only valid for
+  // the duration of the call
+  using SpawnCallback = std::function<void(std::string_view)>;
+
+  struct SpawnResult {
+    // cmdExec() style status (i.e., -1 on failure or an exit code of 255)
+    int   exitStatus  {-1};
+    // Status as reported by waitpid()
+    int   rawStatus   {-1};
+    bool  timedOut    {false};
+
+    // Only populated for CAPTURE streams without a callback
+    std::string stdoutData;
+    std::string stderrData;
+  };
+
+  /*
+    Describes a single child process to be started via posix_spawn.
+
+    Arguments are passed directly to the program (found via PATH) unless
+    constructed through `shell()`, in which case `/bin/sh -c` is used.
+  */
+  class SpawnExec {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      std::vector<std::string>  args;
+
+      SpawnStream   stdoutMode  {SpawnStream::INHERIT};
+      SpawnStream   stderrMode  {SpawnStream::INHERIT};
+      SpawnCallback stdoutCallback;
+      SpawnCallback stderrCallback;
+
+      std::chrono::milliseconds timeout     {0};
+      size_t                    bufferSize  {DEFAULT_BUFFER_SIZE};
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+      static constexpr size_t DEFAULT_BUFFER_SIZE {64 * 1024};
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      SpawnExec() = delete;
+      explicit SpawnExec(const std::vector<std::string>&);
+
+      static SpawnExec shell(const std::string&);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      SpawnExec& setStdout(SpawnStream, const SpawnCallback& = nullptr);
+      SpawnExec& setStderr(SpawnStream, const SpawnCallback& = nullptr);
+      SpawnExec& setTimeout(std::chrono::milliseconds);
+      SpawnExec& setBufferSize(size_t);
+
+      const std::vector<std::string>& getArgs() const;
+      SpawnStream getStdoutMode() const;
+      SpawnStream getStderrMode() const;
+      const SpawnCallback& getStdoutCallback() const;
+      const SpawnCallback& getStderrCallback() const;
+      std::chrono::milliseconds getTimeout() const;
+      size_t getBufferSize() const;
+
+      SpawnResult run() const;
+
+      std::string toString() const;
+  };
+
+  /*
+    Runs many SpawnExec children concurrently from a single poll() based
+    event loop, bounded by a maximum number of simultaneous children.
+  */
+  class SpawnExecPool {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      std::vector<SpawnExec>  queued;
+      size_t                  maxConcurrent;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      // Zero means one child per hardware thread
+      explicit SpawnExecPool(size_t = 0);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      size_t add(const SpawnExec&);
+      size_t size() const;
+
+      // Results are returned in the order the children were added
+      std::vector<SpawnResult> run();
+  };
+}
+#endif // SPAWN_EXEC_HPP
@@ -0,0 +1,169 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include "SpawnExec.hpp"
+
+namespace nmcu = netmeld::core::utils;
+
+using std::chrono::milliseconds;
+
+BOOST_AUTO_TEST_CASE(testSpawnExecSingle)
+{
+  {
+    auto result {nmcu::SpawnExec({"true"}).run()};
+    BOOST_TEST(0 == result.exitStatus);
+    BOOST_TEST(!result.timedOut);
+  }
+  {
+    auto result {nmcu::SpawnExec({"false"}).run()};
+    BOOST_TEST(1 == result.exitStatus);
+  }
+  {
+    auto result {nmcu::SpawnExec::shell("exit 255").run()};
+    BOOST_TEST(-1 == result.exitStatus);
+  }
+  {
+    auto result {nmcu::SpawnExec({"/nonexistent/netmeld/cmd"}).run()};
+    BOOST_TEST(-1 == result.exitStatus);
+  }
+  {
+    // no shell, so no expansion or word splitting
+    auto result {
+      nmcu::SpawnExec({"echo", "$HOME", "a  b"})
+        .setStdout(nmcu::SpawnStream::CAPTURE)
+        .run()
+    };
+    BOOST_TEST(0 == result.exitStatus);
+    BOOST_TEST("$HOME a  b\n" == result.stdoutData);
+    BOOST_TEST(result.stderrData.empty());
+  }
+  {
+    auto result {
+      nmcu::SpawnExec::shell("echo out; echo err 1>&2")
+        .setStdout(nmcu::SpawnStream::DISCARD)
+        .setStderr(nmcu::SpawnStream::CAPTURE)
+        .run()
+    };
+    BOOST_TEST(result.stdoutData.empty());
+    BOOST_TEST("err\n" == result.stderrData);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSpawnExecStreaming)
+{
+  {
+    // small buffer forces multiple callbacks
+    std::string data;
+    size_t calls {0};
+    auto result {
+      nmcu::SpawnExec::shell("head -c 10000 /dev/zero")
+        .setBufferSize(1000)
+        .setStdout(nmcu::SpawnStream::CAPTURE,
+                   [&](std::string_view chunk) {
+                     data.append(chunk);
+                     ++calls;
+                   })
+        .run()
+    };
+    BOOST_TEST(0 == result.exitStatus);
+    BOOST_TEST(result.stdoutData.empty());
+    BOOST_TEST(10000 == data.size());
+    BOOST_TEST(10 <= calls);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSpawnExecTimeout)
+{
+  {
+    auto start {std::chrono::steady_clock::now()};
+    auto result {
+      nmcu::SpawnExec({"sleep", "10"})
+        .setTimeout(milliseconds(100))
+        .run()
+    };
+    auto elapsed {std::chrono::steady_clock::now() - start};
+    BOOST_TEST(result.timedOut);
+    BOOST_TEST(elapsed < std::chrono::seconds(5));
+  }
+  {
+    // grandchild holding the pipe open is also killed
+    auto result {
+      nmcu::SpawnExec::shell("sleep 10; echo done")
+        .setStdout(nmcu::SpawnStream::CAPTURE)
+        .setTimeout(milliseconds(100))
+        .run()
+    };
+    BOOST_TEST(result.timedOut);
+    BOOST_TEST(result.stdoutData.empty());
+  }
+  {
+    auto result {
+      nmcu::SpawnExec({"true"})
+        .setTimeout(milliseconds(5000))
+        .run()
+    };
+    BOOST_TEST(!result.timedOut);
+    BOOST_TEST(0 == result.exitStatus);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSpawnExecPool)
+{
+  {
+    nmcu::SpawnExecPool pool {4};
+    for (size_t i {0}; i < 16; ++i) {
+      pool.add(nmcu::SpawnExec::shell("echo " + std::to_string(i)
+                                      + "; exit " + std::to_string(i % 3))
+                 .setStdout(nmcu::SpawnStream::CAPTURE));
+    }
+    BOOST_TEST(16 == pool.size());
+
+    auto results {pool.run()};
+    BOOST_TEST_REQUIRE(16 == results.size());
+    for (size_t i {0}; i < results.size(); ++i) {
+      BOOST_TEST(std::to_string(i) + "\n" == results[i].stdoutData);
+      BOOST_TEST(static_cast<int>(i % 3) == results[i].exitStatus);
+    }
+    BOOST_TEST(0 == pool.size());
+  }
+  {
+    // concurrent, so total time is near the longest child not the sum
+    nmcu::SpawnExecPool pool {8};
+    for (size_t i {0}; i < 8; ++i) {
+      pool.add(nmcu::SpawnExec({"sleep", "0.3"}));
+    }
+    auto start {std::chrono::steady_clock::now()};
+    auto results {pool.run()};
+    auto elapsed {std::chrono::steady_clock::now() - start};
+    for (const auto& result : results) {
+      BOOST_TEST(0 == result.exitStatus);
+    }
+    BOOST_TEST(elapsed < std::chrono::milliseconds(2000));
+  }
+}
@@ -0,0 +1,364 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#include <map>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+
+#include <netmeld/datalake/handlers/DataEntryIndex.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+namespace netmeld::datalake::handlers {
+
+  // Unnamed namespace to hide helper logic
+  namespace {
+    const char FIELD_SEP {'\t'};
+
+    std::string
+    escape(const std::string& _value)
+    {
+      std::string escaped;
+      escaped.reserve(_value.size());
+      for (const char c : _value) {
+        switch (c) {
+          case '\\': escaped += "\\\\"; break;
+          case '\t': escaped += "\\t";  break;
+          case '\n': escaped += "\\n";  break;
+          default:   escaped += c;      break;
+        }
+      }
+      return escaped;
+    }
+
+    std::string
+    unescape(const std::string& _value)
+    {
+      std::string unescaped;
+      unescaped.reserve(_value.size());
+      for (size_t i {0}; i < _value.size(); ++i) {
+        if ('\\' == _value[i] && (i + 1) < _value.size()) {
+          ++i;
+          switch (_value[i]) {
+            case 't': unescaped += '\t'; break;
+            case 'n': unescaped += '\n'; break;
+            default:  unescaped += _value[i]; break;
+          }
+        } else {
+          unescaped += _value[i];
+        }
+      }
+      return unescaped;
+    }
+
+    std::vector<std::string>
+    split(const std::string& _line)
+    {
+      std::vector<std::string> fields;
+      size_t start {0};
+      for (size_t end; (end = _line.find(FIELD_SEP, start)) != std::string::npos;
+           start = end + 1)
+      {
+        fields.push_back(unescape(_line.substr(start, end - start)));
+      }
+      fields.push_back(unescape(_line.substr(start)));
+      return fields;
+    }
+
+    std::string
+    toIndexTime(const nmco::Time& _time)
+    {
+      return _time.toIsoString();
+    }
+
+    nmco::Time
+    fromIndexTime(const std::string& _value)
+    {
+      if ("infinity" == _value || "-infinity" == _value) {
+        return nmco::Time(_value);
+      }
+      return nmco::Time(pt::from_iso_string(_value));
+    }
+  }
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  DataEntryIndex::DataEntryIndex(const sfs::path& _indexPath) :
+    indexPath(_indexPath)
+  {}
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  bool
+  DataEntryIndex::isUnder(const std::string& _relPath,
+                          const std::string& _prefix)
+  {
+    if (_prefix.empty() || _relPath == _prefix) {
+      return true;
+    }
+    return _relPath.starts_with(_prefix)
+        && '/' == _relPath[_prefix.size()]
+        ;
+  }
+
+  void
+  DataEntryIndex::append(const std::string& _line) const
+  {
+    std::ofstream f {indexPath.string(), std::ios::out | std::ios::app};
+    f << _line << '\n';
+    if (!f) {
+      LOG_WARN << "Failed to update data lake index: " << indexPath << '\n';
+    }
+  }
+
+  void
+  DataEntryIndex::applyAdd(const std::string& _relPath,
+                           const std::string& _ingestTool,
+                           const std::string& _toolArgs,
+                           const std::string& _commit,
+                           const nmco::Time& _time)
+  {
+    records.push_back({_relPath, _ingestTool, _toolArgs, _commit, _time});
+  }
+
+  void
+  DataEntryIndex::applyRemove(const std::string& _relPath,
+                              const nmco::Time& _time)
+  {
+    const nmco::Time infinity {"infinity"};
+    for (auto& record : records) {
+      if (infinity == record.removed && isUnder(record.relPath, _relPath)) {
+        record.removed = _time;
+      }
+    }
+  }
+
+  bool
+  DataEntryIndex::exists() const
+  {
+    return sfs::exists(indexPath);
+  }
+
+  bool
+  DataEntryIndex::load()
+  {
+    clear();
+
+    std::ifstream f {indexPath.string()};
+    std::string line;
+    if (!std::getline(f, line) || FORMAT_HEADER != line) {
+      LOG_WARN << "Unknown or missing data lake index: " << indexPath << '\n';
+      return false;
+    }
+
+    size_t lineNumber {1};
+    while (std::getline(f, line)) {
+      ++lineNumber;
+      if (line.empty()) { continue; }
+
+      const auto& fields {split(line)};
+      try {
+        if ("A" == fields.at(0) && 6 == fields.size()) {
+          applyAdd(fields[2], fields[3], fields[4], fields[5],
+                   fromIndexTime(fields[1]));
+          continue;
+        }
+        if ("R" == fields.at(0) && 3 == fields.size()) {
+          applyRemove(fields[2], fromIndexTime(fields[1]));
+          continue;
+        }
+        if ("H" == fields.at(0) && 2 == fields.size()) {
+          head = fields[1];
+          continue;
+        }
+      } catch (std::exception& e) {
+        LOG_DEBUG << e.what() << '\n';
+      }
+      LOG_WARN << "Skipping malformed data lake index line "
+               << lineNumber << ": " << line << '\n';
+    }
+
+    LOG_DEBUG << "Loaded " << records.size() << " data lake index records\n";
+    return true;
+  }
+
+  void
+  DataEntryIndex::save() const
+  {
+    sfs::path tmpPath {indexPath};
+    tmpPath += ".tmp";
+
+    {
+      std::ofstream f {tmpPath.string(), std::ios::out | std::ios::trunc};
+      f << FORMAT_HEADER << '\n';
+
+      const nmco::Time infinity {"infinity"};
+      for (const auto& record : records) {
+        f << 'A'
+          << FIELD_SEP << toIndexTime(record.added)
+          << FIELD_SEP << escape(record.relPath)
+          << FIELD_SEP << escape(record.ingestTool)
+          << FIELD_SEP << escape(record.toolArgs)
+          << FIELD_SEP << escape(record.commit)
+          << '\n';
+        if (infinity != record.removed) {
+          f << 'R'
+            << FIELD_SEP << toIndexTime(record.removed)
+            << FIELD_SEP << escape(record.relPath)
+            << '\n';
+        }
+      }
+      if (!head.empty()) {
+        f << 'H' << FIELD_SEP << escape(head) << '\n';
+      }
+
+      if (!f) {
+        LOG_WARN << "Failed to write data lake index: " << tmpPath << '\n';
+        return;
+      }
+    }
+
+    sfs::rename(tmpPath, indexPath);
+  }
+
+  void
+  DataEntryIndex::clear()
+  {
+    records.clear();
+    head.clear();
+  }
+
+  void
+  DataEntryIndex::add(const std::string& _relPath,
+                      const std::string& _ingestTool,
+                      const std::string& _toolArgs,
+                      const std::string& _commit,
+                      const nmco::Time& _time)
+  {
+    applyAdd(_relPath, _ingestTool, _toolArgs, _commit, _time);
+
+    std::ostringstream oss;
+    oss << 'A'
+        << FIELD_SEP << toIndexTime(_time)
+        << FIELD_SEP << escape(_relPath)
+        << FIELD_SEP << escape(_ingestTool)
+        << FIELD_SEP << escape(_toolArgs)
+        << FIELD_SEP << escape(_commit)
+        ;
+    append(oss.str());
+  }
+
+  void
+  DataEntryIndex::remove(const std::string& _relPath, const nmco::Time& _time)
+  {
+    applyRemove(_relPath, _time);
+
+    std::ostringstream oss;
+    oss << 'R'
+        << FIELD_SEP << toIndexTime(_time)
+        << FIELD_SEP << escape(_relPath)
+        ;
+    append(oss.str());
+  }
+
+  void
+  DataEntryIndex::setHead(const std::string& _commit)
+  {
+    if (head == _commit) { return; }
+
+    head = _commit;
+    append(std::string("H") + FIELD_SEP + escape(head));
+  }
+
+  size_t
+  DataEntryIndex::size() const
+  {
+    return records.size();
+  }
+
+  const std::string&
+  DataEntryIndex::getHead() const
+  {
+    return head;
+  }
+
+  nmco::Time
+  DataEntryIndex::getFirstAdded() const
+  {
+    nmco::Time first {"infinity"};
+    for (const auto& record : records) {
+      first = std::min(first, record.added);
+    }
+    return first;
+  }
+
+  std::vector<nmdlo::DataEntry>
+  DataEntryIndex::getDataEntries(const sfs::path& _root,
+                                 const nmco::Time& _dts,
+                                 const RevisionResolver& _resolver) const
+  {
+    // Latest addition, per path, as of the target time and as of now
+    std::map<std::string, const Record*> latest;
+    std::map<std::string, const Record*> current;
+    const auto& track {
+      [](auto& _found, const Record& _record) {
+        if (nullptr == _found || _found->added <= _record.added) {
+          _found = &_record;
+        }
+      }};
+    for (const auto& record : records) {
+      track(current[record.relPath], record);
+      if (record.added <= _dts) {
+        track(latest[record.relPath], record);
+      }
+    }
+
+    const nmco::Time infinity {"infinity"};
+    std::vector<nmdlo::DataEntry> vde;
+    for (const auto& [relPath, record] : latest) {
+      if (record->removed <= _dts) { continue; }
+
+      // Only content still in place can be read from the working tree
+      sfs::path dataPath {_root/relPath};
+      if (_resolver
+          && (record != current.at(relPath) || infinity != record->removed))
+      {
+        dataPath = _resolver(relPath, record->commit);
+      }
+
+      nmdlo::DataEntry de;
+      de.setDeviceId(relPath.substr(0, relPath.find('/')));
+      de.setDataPath(dataPath.string());
+      de.setIngestTool(record->ingestTool);
+      de.setToolArgs(record->toolArgs);
+      vde.push_back(de);
+    }
+
+    return vde;
+  }
+}
@@ -0,0 +1,122 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#ifndef DATA_ENTRY_INDEX_HPP
+#define DATA_ENTRY_INDEX_HPP
+
+#include <functional>
+
+#include <netmeld/core/objects/Time.hpp>
+#include <netmeld/datalake/objects/DataEntry.hpp>
+
+namespace nmco  = netmeld::core::objects;
+namespace nmdlo = netmeld::datalake::objects;
+
+
+namespace netmeld::datalake::handlers {
+
+  /*
+    Persistent, append-only index of the data stored in a data lake.
+
+    Each stored item is tracked by its path relative to the data lake root
+    (i.e., `device_id/data_name`) along with its ingest data, the revision
+    which added it, and the times it was added and (if applicable) removed.
+    This allows listing and point in time queries to be answered without
+    walking or re-aligning the backing store.  The backing store revision the
+    index reflects is kept as its head, so a caller can detect (and replay)
+    changes made outside of the index.
+
+    On disk, the index is a versioned, tab separated, operation log which is
+    replayed on load.  Additions, removals, and head changes are appended.
+  */
+  class DataEntryIndex {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      struct Record {
+        std::string relPath;
+        std::string ingestTool;
+        std::string toolArgs;
+        std::string commit;
+        nmco::Time  added;
+        nmco::Time  removed {"infinity"};
+      };
+
+      const std::string FORMAT_HEADER {"# nmdl-index v2"};
+
+      sfs::path           indexPath;
+      std::vector<Record> records;
+      std::string         head;
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+      // Path to the content of a data lake path as of a prior revision
+      using RevisionResolver =
+        std::function<sfs::path(const std::string&, const std::string&)>;
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      DataEntryIndex() = delete;
+      explicit DataEntryIndex(const sfs::path&);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      void append(const std::string&) const;
+      void applyAdd(const std::string&, const std::string&,
+                    const std::string&, const std::string&,
+                    const nmco::Time&);
+      void applyRemove(const std::string&, const nmco::Time&);
+
+      static bool isUnder(const std::string&, const std::string&);
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      bool exists() const;
+      bool load();
+      void save() const;
+      void clear();
+
+      void add(const std::string&, const std::string&, const std::string&,
+               const std::string&, const nmco::Time& = {});
+      void remove(const std::string&, const nmco::Time& = {});
+      void setHead(const std::string&);
+
+      size_t size() const;
+      const std::string& getHead() const;
+      nmco::Time getFirstAdded() const;
+
+      std::vector<nmdlo::DataEntry>
+        getDataEntries(const sfs::path&, const nmco::Time& = {},
+                       const RevisionResolver& = {}) const;
+  };
+}
+#endif // DATA_ENTRY_INDEX_HPP
@@ -0,0 +1,209 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datalake/handlers/DataEntryIndex.hpp>
+
+namespace nmco  = netmeld::core::objects;
+namespace nmdlh = netmeld::datalake::handlers;
+
+
+namespace {
+  sfs::path
+  getTestIndexPath()
+  {
+    return sfs::temp_directory_path()/"nmdl-index-unit-test";
+  }
+
+  nmco::Time
+  at(const std::string& _time)
+  {
+    return nmco::Time(_time);
+  }
+
+  std::vector<std::string>
+  getPaths(const std::vector<nmdlo::DataEntry>& _vde)
+  {
+    std::vector<std::string> paths;
+    for (const auto& de : _vde) {
+      paths.push_back(de.getDeviceId() + "->" + de.getSaveName());
+    }
+    return paths;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPointInTime)
+{
+  const auto indexPath {getTestIndexPath()};
+  sfs::remove(indexPath);
+
+  nmdlh::DataEntryIndex index {indexPath};
+  index.save();
+
+  index.add("dev1/a.txt", "nmdb-import-a", "--x", "c1",
+            at("2024-01-01 00:00:00"));
+  index.add("dev1/b.txt", "", "", "c2", at("2024-01-02 00:00:00"));
+  index.add("dev2/c.txt", "nmdb-import-c", "", "c3",
+            at("2024-01-03 00:00:00"));
+  index.remove("dev1", at("2024-01-04 00:00:00"));
+  index.add("dev1/a.txt", "nmdb-import-a2", "", "c5",
+            at("2024-01-05 00:00:00"));
+
+  const sfs::path root {"/lake"};
+  {
+    const auto& vde {index.getDataEntries(root, at("2023-12-31 00:00:00"))};
+    BOOST_TEST(vde.empty());
+  }
+  {
+    const auto& vde {index.getDataEntries(root, at("2024-01-03 12:00:00"))};
+    std::vector<std::string> expected {
+      "dev1->a.txt", "dev1->b.txt", "dev2->c.txt"
+    };
+    BOOST_TEST(expected == getPaths(vde), boost::test_tools::per_element());
+    BOOST_TEST("nmdb-import-a" == vde.at(0).getIngestTool());
+    BOOST_TEST("--x" == vde.at(0).getToolArgs());
+    BOOST_TEST("/lake/dev1/a.txt" == vde.at(0).getDataPath());
+  }
+  {
+    const auto& vde {index.getDataEntries(root, at("2024-01-04 12:00:00"))};
+    std::vector<std::string> expected {"dev2->c.txt"};
+    BOOST_TEST(expected == getPaths(vde), boost::test_tools::per_element());
+  }
+  {
+    const auto& vde {index.getDataEntries(root)};
+    std::vector<std::string> expected {"dev1->a.txt", "dev2->c.txt"};
+    BOOST_TEST(expected == getPaths(vde), boost::test_tools::per_element());
+    BOOST_TEST("nmdb-import-a2" == vde.at(0).getIngestTool());
+  }
+
+  BOOST_TEST(at("2024-01-01 00:00:00") == index.getFirstAdded());
+
+  sfs::remove(indexPath);
+}
+
+BOOST_AUTO_TEST_CASE(testRevisionResolver)
+{
+  const auto indexPath {getTestIndexPath()};
+  sfs::remove(indexPath);
+
+  nmdlh::DataEntryIndex index {indexPath};
+  index.save();
+
+  index.add("dev1/a.txt", "", "", "c1", at("2024-01-01 00:00:00"));
+  index.add("dev1/b.txt", "", "", "c2", at("2024-01-02 00:00:00"));
+  index.add("dev2/c.txt", "", "", "c3", at("2024-01-03 00:00:00"));
+  index.add("dev1/a.txt", "", "", "c4", at("2024-01-04 00:00:00"));
+  index.remove("dev2", at("2024-01-05 00:00:00"));
+
+  const sfs::path root {"/lake"};
+  const auto& resolver {
+    [](const std::string& _relPath, const std::string& _commit) {
+      return sfs::path("/rev")/_commit/_relPath;
+    }};
+  std::vector<std::string> paths;
+  const auto& getDataPaths {
+    [&](const nmco::Time& _dts) {
+      paths.clear();
+      for (const auto& de : index.getDataEntries(root, _dts, resolver)) {
+        paths.push_back(de.getDataPath());
+      }
+    }};
+
+  // replaced and removed content resolves to its revision
+  getDataPaths(at("2024-01-03 12:00:00"));
+  {
+    std::vector<std::string> expected {
+      "/rev/c1/dev1/a.txt", "/lake/dev1/b.txt", "/rev/c3/dev2/c.txt"
+    };
+    BOOST_TEST(expected == paths, boost::test_tools::per_element());
+  }
+
+  // current content stays in the working tree
+  getDataPaths({});
+  {
+    std::vector<std::string> expected {
+      "/lake/dev1/a.txt", "/lake/dev1/b.txt"
+    };
+    BOOST_TEST(expected == paths, boost::test_tools::per_element());
+  }
+
+  sfs::remove(indexPath);
+}
+
+BOOST_AUTO_TEST_CASE(testPersistence)
+{
+  const auto indexPath {getTestIndexPath()};
+  sfs::remove(indexPath);
+
+  {
+    nmdlh::DataEntryIndex index {indexPath};
+    BOOST_TEST(!index.exists());
+    BOOST_TEST(!index.load());
+
+    index.save();
+    BOOST_TEST(index.exists());
+
+    // special characters survive the round trip
+    index.add("dev1/a.txt", "tool", "--a\t'b'\\n", "c1",
+              at("2024-01-01 00:00:00"));
+    index.add("dev1/b.txt", "tool", "", "c2", at("2024-01-02 00:00:00"));
+    index.add("dev11/c.txt", "tool", "", "c3", at("2024-01-02 00:00:00"));
+    index.remove("dev1/b.txt", at("2024-01-03 00:00:00"));
+    index.setHead("c4");
+  }
+  {
+    // appended operations are replayed
+    nmdlh::DataEntryIndex index {indexPath};
+    BOOST_TEST(index.load());
+    BOOST_TEST(3 == index.size());
+
+    const auto& vde {index.getDataEntries("/lake")};
+    std::vector<std::string> expected {"dev1->a.txt", "dev11->c.txt"};
+    BOOST_TEST(expected == getPaths(vde), boost::test_tools::per_element());
+    BOOST_TEST("--a\t'b'\\n" == vde.at(0).getToolArgs());
+    BOOST_TEST("c4" == index.getHead());
+
+    // remove is prefix aware, dev11 is not under dev1
+    index.remove("dev1", at("2024-01-04 00:00:00"));
+    index.setHead("c5");
+    index.save();
+  }
+  {
+    // save compacts the log, keeping the head
+    nmdlh::DataEntryIndex index {indexPath};
+    BOOST_TEST(index.load());
+    BOOST_TEST(3 == index.size());
+    BOOST_TEST("c5" == index.getHead());
+
+    const auto& vde {index.getDataEntries("/lake")};
+    std::vector<std::string> expected {"dev11->c.txt"};
+    BOOST_TEST(expected == getPaths(vde), boost::test_tools::per_element());
+  }
+
+  sfs::remove(indexPath);
+}
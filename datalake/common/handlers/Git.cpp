@@ -36,11 +36,25 @@ namespace nmcu  = netmeld::core::utils;
 
 namespace netmeld::datalake::handlers {
 
+  // Unnamed namespace to hide helper logic
+  namespace {
+    // Index paths never carry a trailing separator (e.g., device only)
+    std::string
+    getIndexPath(std::string _relPath)
+    {
+      while (!_relPath.empty() && '/' == _relPath.back()) {
+        _relPath.pop_back();
+      }
+      return _relPath;
+    }
+  }
+
   // ===========================================================================
   // Constructors
   // ===========================================================================
   Git::Git(const std::string& _path) :
-    AbstractHandler(_path)
+    AbstractHandler(_path),
+    index(sfs::path(_path)/".git"/"nmdl-index")
   {}
 
   // ===========================================================================
@@ -60,103 +74,113 @@ namespace netmeld::datalake::handlers {
     return true;
   }
 
-  bool
-  Git::alignRepo(const nmco::Time& _dts)
+  std::string
+  Git::getHead() const
   {
-    LOG_DEBUG << "Target time: " << _dts << '\n';
+    return nmcu::trim(
+        nmcu::cmdExecOut("git rev-parse --verify -q HEAD 2>/dev/null"));
+  }
 
+  bool
+  Git::isAncestor(const std::string& _commit) const
+  {
+    // Not being one is expected, so avoid cmdExec's non-zero warning
     std::ostringstream oss;
-    std::string branch{this->branchName};
-    if (this->branchName.empty()) {
-
-      oss << "git branch --show-current";
-      branch = {nmcu::trim(nmcu::cmdExecOut(oss.str()))};
-      oss.str("");
-      if (branch.empty()) {
-        LOG_ERROR << "Invalid repo state: detached HEAD" << '\n';
-        return false;
+    oss << "git merge-base --is-ancestor " << _commit << " HEAD 2>/dev/null"
+        << " && echo ancestor";
+    return "ancestor" == nmcu::trim(nmcu::cmdExecOut(oss.str()));
+  }
+
+  bool
+  Git::loadIndex()
+  {
+    if (indexLoaded) { return true; }
+
+    if (!(index.exists() && index.load())) {
+      rebuildIndex();
+    } else if (const auto& indexHead {index.getHead()};
+               getHead() != indexHead)
+    {
+      // Repository changed without the index (e.g., plain git or a reset)
+      if (!indexHead.empty() && isAncestor(indexHead)) {
+        LOG_INFO << "Updating data lake index from repository history\n";
+        replayHistory(indexHead);
+      } else {
+        rebuildIndex();
       }
-      this->branchName = branch;
-    }
-    oss << "echo -n `git rev-list -n 1 --first-parent"
-        << " --before=\"" << _dts << "\" " << branch << "`";
-    auto result {nmcu::trim(nmcu::cmdExecOut(oss.str()))};
-    LOG_DEBUG << "Target SHA: " << result << '\n';
-
-    oss.str("");
-    if (result.empty()) {
-      oss << "git log --reverse --date='format-local:%FT%T'"
-            << " --format=\"format:%cd\""
-          ;
-      auto const& validDates {nmcu::cmdExecOut(oss.str())};
-      LOG_ERROR << "Invalid repository date: " << _dts << '\n'
-                << "Valid dates:"
-                << '\n' << validDates
-                << '\n';
-      return false;
-    } else {
-      oss << "git checkout -q "
-          << ("infinity" == _dts.toString() ? branch : result);
-      nmcu::cmdExec(oss.str());
     }
+    indexLoaded = true;
 
     return true;
   }
 
   void
-  Git::setIngestToolData(std::vector<nmdlo::DataEntry>& vde)
+  Git::rebuildIndex()
   {
+    LOG_INFO << "Building data lake index from repository history\n";
 
-    std::ostringstream oss;
-
-    oss << "git rev-parse --show-toplevel";
-    std::string topLevel = nmcu::cmdExecOut(oss.str());
-    topLevel[topLevel.size() - 1] = '/';
-    oss.str("");
-
-    oss << "git log --pretty=format:\"%B\"";
-    std::istringstream iss(nmcu::cmdExecOut(oss.str()));
-
-    std::unordered_map<std::string, std::pair<std::string, std::string>> parsedData;
+    index.clear();
+    index.save();
+    replayHistory("");
+  }
 
-    LOG_DEBUG << iss.str() << '\n';
+  void
+  Git::replayHistory(const std::string& _since)
+  {
+    // Record separator prefixed commit id and date, message, then changed files
+    std::ostringstream oss;
+    oss << "git -c core.quotePath=false log --reverse --date=unix"
+        << " --format=\"format:%x1e%H %cd%n%B\" --name-status";
+    if (!_since.empty()) {
+      oss << ' ' << _since << "..HEAD";
+    }
+    oss << " 2>/dev/null";
+    std::istringstream history(nmcu::cmdExecOut(oss.str()));
 
-    std::regex checkinRegex('^' + CHECK_IN_PREFIX + "(.*)$");
-    std::regex toolRegex('^' + INGEST_TOOL_PREFIX + "(.*)$");
-    std::regex argsRegex('^' + TOOL_ARGS_PREFIX + "(.*)$");
+    std::regex statusRegex("^([ACDMRT])[0-9]*\t([^\t]+)(\t(.+))?$");
     std::smatch m;
 
-    for (std::string line; std::getline(iss, line);) {
-      if (!std::regex_search(line, m, checkinRegex)) continue;
-      std::string path = topLevel + m.str(1);
-      std::string ingest;
-      std::string toolArgs;
-
-      std::getline(iss, line);
-      if (std::regex_search(line, m, toolRegex)) {
-        ingest = m.str(1);
-      }
+    for (std::string commit; std::getline(history, commit, '\x1e');) {
+      if (commit.empty()) { continue; }
 
+      std::istringstream iss(commit);
+      std::string id;
+      std::string line;
+      iss >> id;
       std::getline(iss, line);
-      if (std::regex_search(line, m, argsRegex)) {
-        toolArgs = m.str(1);
-
+      nmco::Time dts;
+      try {
+        dts.readUnixTimestamp(nmcu::trim(line));
+      } catch (std::exception& e) {
+        LOG_DEBUG << "Unparsable commit date: " << line << '\n';
+        continue;
       }
 
-      parsedData.emplace(path, std::make_pair(ingest, toolArgs));
-    }
-
-    for (nmdlo::DataEntry& _de : vde) {
-      auto it = parsedData.find(_de.getDataPath());
-      if (it == parsedData.end()) {
-        LOG_DEBUG << "Could not locate " << _de.getDataPath() << '\n';
-        continue;
+      std::string ingest;
+      std::string toolArgs;
+      while (std::getline(iss, line)) {
+        if (line.starts_with(INGEST_TOOL_PREFIX)) {
+          ingest = line.substr(INGEST_TOOL_PREFIX.size());
+        } else if (line.starts_with(TOOL_ARGS_PREFIX)) {
+          toolArgs = line.substr(TOOL_ARGS_PREFIX.size());
+        } else if (std::regex_match(line, m, statusRegex)) {
+          const auto& status {m.str(1)};
+          if ("D" == status) {
+            index.remove(m.str(2), dts);
+          } else if ("R" == status) {
+            index.remove(m.str(2), dts);
+            index.add(m.str(4), ingest, toolArgs, id, dts);
+          } else if ("C" == status) {
+            index.add(m.str(4), ingest, toolArgs, id, dts);
+          } else {
+            index.add(m.str(2), ingest, toolArgs, id, dts);
+          }
+        }
       }
-      auto pair = it->second;
-      _de.setIngestTool(pair.first);
-      _de.setToolArgs(pair.second);
     }
+    index.setHead(getHead());
 
+    LOG_DEBUG << "Data lake index contains " << index.size() << " records\n";
   }
 
   void
@@ -184,12 +208,16 @@ namespace netmeld::datalake::handlers {
     std::ostringstream oss;
     oss << "git init";
     nmcu::cmdExec(oss.str());
+
+    index.clear();
+    index.save();
+    indexLoaded = true;
   }
 
   void
   Git::commit(nmdlo::DataEntry& _de)
   {
-    if (!changeDirToRepo()) { return; }
+    if (!(changeDirToRepo() && loadIndex())) { return; }
 
     // Ensure device directory exists
     const sfs::path devicePath {this->dataLakePath/_de.getDeviceId()};
@@ -231,47 +259,68 @@ namespace netmeld::datalake::handlers {
     }
 
     // Store data
-    nmcu::cmdExec(oss.str());
+    if (0 == nmcu::cmdExec(oss.str())) {
+      const auto& head {getHead()};
+      index.add(dstRelPath, _de.getIngestTool(), _de.getToolArgs(), head);
+      index.setHead(head);
+    }
   }
 
-  std::vector<nmdlo::DataEntry>
-  Git::getDataEntries(const nmco::Time& _dts, bool useIngestToolData)
+  sfs::path
+  Git::getRevisionPath(const std::string& _relPath,
+                       const std::string& _commit) const
   {
-    std::vector<nmdlo::DataEntry> vde;
-    if (!(changeDirToRepo() && alignRepo(_dts))) { return vde; }
-
-    std::string deviceId;
-    for (auto i = sfs::recursive_directory_iterator(this->dataLakePath);
-         i != sfs::recursive_directory_iterator();
-         ++i)
-    {
-      // skip control directory
-      if (".git" == i->path().filename()) {
-        i.disable_recursion_pending();
-        continue;
-      }
+    const sfs::path workingPath {this->dataLakePath/_relPath};
+    if (_commit.empty()) {
+      LOG_WARN << "No revision recorded, using current: " << workingPath
+               << '\n';
+      return workingPath;
+    }
 
-      auto depth {i.depth()};
-      if (0 > depth) {
-        LOG_ERROR << "Exiting: Directory depth < 0\n";
-        std::exit(nmcu::Exit::FAILURE);
-      } else if (0 == depth) {
-        deviceId = i->path().filename().string();
-      } else {
-        const auto& filePath {i->path().string()};
-        nmdlo::DataEntry data;
+    // Extract once, revisions are immutable
+    const sfs::path revisionPath {
+      this->dataLakePath/".git"/"nmdl-revisions"/_commit/_relPath
+    };
+    if (sfs::exists(revisionPath)) { return revisionPath; }
 
-        data.setDeviceId(deviceId);
-        data.setDataPath(filePath);
+    sfs::create_directories(revisionPath.parent_path());
+    sfs::path tmpPath {revisionPath};
+    tmpPath += ".tmp";
 
-        vde.push_back(data);
-      }
+    std::ostringstream oss;
+    oss << "git cat-file blob '" << _commit << ':' << _relPath << "'"
+        << " > '" << tmpPath.string() << "'";
+    if (0 != nmcu::cmdExec(oss.str())) {
+      LOG_WARN << "Failed to extract " << _relPath << " at " << _commit
+               << ", using current: " << workingPath << '\n';
+      sfs::remove(tmpPath);
+      return workingPath;
     }
-    if (useIngestToolData) {
-      setIngestToolData(vde);
+    sfs::rename(tmpPath, revisionPath);
+
+    return revisionPath;
+  }
+
+  std::vector<nmdlo::DataEntry>
+  Git::getDataEntries(const nmco::Time& _dts, bool)
+  {
+    // NOTE: Ingest tool data is always available from the index, so there is
+    //       no extra cost to include it regardless of the request.
+    std::vector<nmdlo::DataEntry> vde;
+    if (!(changeDirToRepo() && loadIndex())) { return vde; }
+
+    vde = index.getDataEntries(this->dataLakePath, _dts,
+        [this](const std::string& _relPath, const std::string& _commit) {
+          return getRevisionPath(_relPath, _commit);
+        });
+
+    const auto& firstAdded {index.getFirstAdded()};
+    if (vde.empty() && _dts < firstAdded) {
+      LOG_ERROR << "Invalid repository date: " << _dts << '\n'
+                << "Earliest data: " << firstAdded
+                << '\n';
     }
 
-    alignRepo();
     return vde;
   }
 
@@ -280,7 +329,7 @@ namespace netmeld::datalake::handlers {
   Git::removeLast(const std::string& _deviceId,
                          const std::string& _dataPath)
   {
-    if (!changeDirToRepo()) { return; }
+    if (!(changeDirToRepo() && loadIndex())) { return; }
 
     const sfs::path tgtPath       {this->dataLakePath/_deviceId/_dataPath};
     const std::string tgtRelPath  {sfs::relative(tgtPath).string()};
@@ -292,14 +341,17 @@ namespace netmeld::datalake::handlers {
     oss << "git rm --ignore-unmatch -r " << tgtRelPath
         << " &&  git commit -m 'nmdl-remove: " << tgtRelPath << "'";
 
-    nmcu::cmdExec(oss.str());
+    if (0 == nmcu::cmdExec(oss.str())) {
+      index.remove(getIndexPath(tgtRelPath));
+      index.setHead(getHead());
+    }
   }
 
   void
   Git::removeAll(const std::string& _deviceId,
                         const std::string& _dataPath)
   {
-    if (!changeDirToRepo()) { return; }
+    if (!(changeDirToRepo() && loadIndex())) { return; }
 
     const sfs::path tgtPath       {this->dataLakePath/_deviceId/_dataPath};
     const std::string tgtRelPath  {sfs::relative(tgtPath).string()};
@@ -315,7 +367,12 @@ namespace netmeld::datalake::handlers {
           << " | xargs -n 1 git update-ref -d 2>/dev/null"
         << " && git reflog expire --expire=now --all"
         << "&& git gc --prune=now --aggressive";
-    nmcu::cmdExec(oss.str());
+    // History is rewritten, so every recorded revision changes and
+    // previously extracted revisions may hold the purged data
+    if (0 == nmcu::cmdExec(oss.str())) {
+      sfs::remove_all(this->dataLakePath/".git"/"nmdl-revisions");
+      rebuildIndex();
+    }
   }
 
   // ===========================================================================
@@ -29,6 +29,7 @@
 
 #include <netmeld/datalake/objects/DataEntry.hpp>
 #include <netmeld/datalake/handlers/AbstractHandler.hpp>
+#include <netmeld/datalake/handlers/DataEntryIndex.hpp>
 
 namespace nmdlo = netmeld::datalake::objects;
 
@@ -44,7 +45,8 @@ namespace netmeld::datalake::handlers {
       const std::string  INGEST_TOOL_PREFIX  {"ingest-tool:"};
       const std::string  TOOL_ARGS_PREFIX    {"tool-args:"};
 
-      std::string branchName;
+      DataEntryIndex  index;
+      bool            indexLoaded {false};
 
       nmcu::FileManager& nmfm {nmcu::FileManager::getInstance()};
 
@@ -64,10 +66,14 @@ namespace netmeld::datalake::handlers {
     // Methods
     // =========================================================================
     private: // Methods which should be hidden from API users
-      void setIngestToolData(std::vector<nmdlo::DataEntry>&);
-
-      bool alignRepo(const nmco::Time& = nmco::Time("infinity"));
       bool changeDirToRepo();
+      bool loadIndex();
+      void rebuildIndex();
+      void replayHistory(const std::string&);
+
+      std::string getHead() const;
+      bool isAncestor(const std::string&) const;
+      sfs::path getRevisionPath(const std::string&, const std::string&) const;
 
     protected: // Methods part of subclass API
     public: // Methods part of public API
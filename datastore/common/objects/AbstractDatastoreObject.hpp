@@ -34,6 +34,7 @@
 
 namespace nmco = netmeld::core::objects;
 namespace nmcu = netmeld::core::utils;
+namespace nmdu = netmeld::datastore::utils;
 
 namespace netmeld::datastore::objects {
 
@@ -56,7 +56,7 @@ namespace netmeld::datastore::objects {
     }
 
     if (0 == data.size()) {
-      t.exec_prepared("insert_raw_device_ac_net",
+      nmdu::execPrepared(t, "insert_raw_device_ac_net",
         toolRunId,
         _deviceId,
         id,
@@ -64,7 +64,7 @@ namespace netmeld::datastore::objects {
         nullptr);
     } else {
       for (const auto& entry : data) {
-        t.exec_prepared("insert_raw_device_ac_net",
+        nmdu::execPrepared(t, "insert_raw_device_ac_net",
           toolRunId,
           _deviceId,
           id,
@@ -209,7 +209,7 @@ namespace netmeld::datastore::objects {
         for (const auto& dst : dsts) {
           for (const auto& dstIface : dstIfaces) {
             for (const auto& service : services) {
-              t.exec_prepared("insert_raw_device_ac_rule",
+              nmdu::execPrepared(t, "insert_raw_device_ac_rule",
                 toolRunId,
                 deviceId,
                 enabled,
@@ -223,7 +223,7 @@ namespace netmeld::datastore::objects {
                 service,
                 actionStr,
                 description
-                );
+                     );
             }
           }
         }
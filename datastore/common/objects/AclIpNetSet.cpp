@@ -88,47 +88,47 @@ namespace netmeld::datastore::objects {
       return; // Always short circuit if invalid object
     }
 
-    t.exec_prepared( "insert_raw_device_acl_ip_net_base"
-                   , toolRunId
-                   , deviceId
-                   , ns
-                   , id
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_base"
+                        , toolRunId
+                        , deviceId
+                        , ns
+                        , id
+                        );
 
     for (const auto& ipNet : ipNets) {
-      t.exec_prepared( "insert_raw_device_acl_ip_net_ip_net"
-                     , toolRunId
-                     , deviceId
-                     , ns
-                     , id
-                     , ipNet.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_ip_net"
+                          , toolRunId
+                          , deviceId
+                          , ns
+                          , id
+                          , ipNet.toString()
+                          );
     }
 
     for (const auto& hostname : hostnames) {
-      t.exec_prepared( "insert_raw_device_dns_reference"
-                     , toolRunId
-                     , deviceId
-                     , hostname
-                     );
-      t.exec_prepared( "insert_raw_device_acl_ip_net_hostname"
-                     , toolRunId
-                     , deviceId
-                     , ns
-                     , id
-                     , hostname
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_dns_reference"
+                          , toolRunId
+                          , deviceId
+                          , hostname
+                          );
+      nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_hostname"
+                          , toolRunId
+                          , deviceId
+                          , ns
+                          , id
+                          , hostname
+                          );
     }
 
     for (const auto& includedId : includedIds) {
-      t.exec_prepared( "insert_raw_device_acl_ip_net_include"
-                     , toolRunId
-                     , deviceId
-                     , ns
-                     , id
-                     , std::get<0>(includedId)  // ns
-                     , std::get<1>(includedId)   // id
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_acl_ip_net_include"
+                          , toolRunId
+                          , deviceId
+                          , ns
+                          , id
+                          , std::get<0>(includedId)  // ns
+                          , std::get<1>(includedId)   // id
+                          );
     }
   }
 
@@ -77,28 +77,28 @@ namespace netmeld::datastore::objects {
       return; // Always short circuit if invalid object
     }
 
-    t.exec_prepared("insert_raw_device_acl_port_base",
+    nmdu::execPrepared(t, "insert_raw_device_acl_port_base",
         toolRunId,
         deviceId,
         id
-        );
+             );
 
     for (const auto& portRange : portRanges) {
-      t.exec_prepared("insert_raw_device_acl_port_port",
+      nmdu::execPrepared(t, "insert_raw_device_acl_port_port",
           toolRunId,
           deviceId,
           id,
           portRange
-          );
+               );
     }
 
     for (const auto& includedId : includedIds) {
-      t.exec_prepared("insert_raw_device_acl_port_include",
+      nmdu::execPrepared(t, "insert_raw_device_acl_port_include",
           toolRunId,
           deviceId,
           id,
           includedId
-          );
+               );
     }
   }
 
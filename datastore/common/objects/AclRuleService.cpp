@@ -50,20 +50,20 @@ namespace netmeld::datastore::objects {
                       )
   {
     //AclRule::save(t, toolRunId, deviceId);
-    t.exec_prepared( "insert_raw_device_acl_rule_service"
-                   , toolRunId
-                   , deviceId
-                   , priority
-                   , action
-                   , incomingZoneId
-                   , outgoingZoneId
-                   , srcIpNetSetNamespace
-                   , srcIpNetSetId
-                   , dstIpNetSetNamespace
-                   , dstIpNetSetId
-                   , serviceId
-                   , description
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_acl_rule_service"
+                        , toolRunId
+                        , deviceId
+                        , priority
+                        , action
+                        , incomingZoneId
+                        , outgoingZoneId
+                        , srcIpNetSetNamespace
+                        , srcIpNetSetId
+                        , dstIpNetSetNamespace
+                        , dstIpNetSetId
+                        , serviceId
+                        , description
+                        );
   }
 
   std::string
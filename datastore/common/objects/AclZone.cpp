@@ -75,28 +75,28 @@ namespace netmeld::datastore::objects {
       return; // Always short circuit if invalid object
     }
 
-    t.exec_prepared("insert_raw_device_acl_zone_base",
+    nmdu::execPrepared(t, "insert_raw_device_acl_zone_base",
         toolRunId,
         deviceId,
         id
-        );
+             );
 
     for (const auto& iface : ifaces) {
-      t.exec_prepared("insert_raw_device_acl_zone_interface",
+      nmdu::execPrepared(t, "insert_raw_device_acl_zone_interface",
           toolRunId,
           deviceId,
           id,
           iface
-          );
+               );
     }
 
     for (const auto& includedId : includedIds) {
-      t.exec_prepared("insert_raw_device_acl_zone_include",
+      nmdu::execPrepared(t, "insert_raw_device_acl_zone_include",
           toolRunId,
           deviceId,
           id,
           includedId
-          );
+               );
     }
   }
 
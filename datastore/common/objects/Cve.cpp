@@ -92,14 +92,14 @@ namespace netmeld::datastore::objects {
 
     port.save(t, toolRunId, _deviceId);
 
-    t.exec_prepared("insert_raw_nessus_result_cve"
-                   , toolRunId
-                   , port.getIpAddress().toString()
-                   , port.getProtocol()
-                   , port.getPort()
-                   , pluginId
-                   , *this
-                   );
+    nmdu::execPrepared(t, "insert_raw_nessus_result_cve"
+                        , toolRunId
+                        , port.getIpAddress().toString()
+                        , port.getProtocol()
+                        , port.getPort()
+                        , pluginId
+                        , *this
+                        );
   }
 
   std::string
@@ -134,10 +134,10 @@ namespace netmeld::datastore::objects {
                    , port
                    , pluginId
                    )
-       <=> std::tie( year
-                   , number
-                   , port
-                   , pluginId
+       <=> std::tie( rhs.year
+                   , rhs.number
+                   , rhs.port
+                   , rhs.pluginId
                    )
       ;
   }
@@ -120,26 +120,26 @@ namespace netmeld::datastore::objects {
     }
 
     //LOG_DEBUG << "Inserting interface" << std::endl;
-    t.exec_prepared( "insert_raw_device_interface"
-                   , toolRunId
-                   , deviceId
-                   , name
-                   , mediaType
-                   , isUp
-                   , description
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_interface"
+                        , toolRunId
+                        , deviceId
+                        , name
+                        , mediaType
+                        , isUp
+                        , description
+                        );
 
     macAddr.setResponding(isUp);
     macAddr.save(t, toolRunId, deviceId);
 
     // Tie interface to MAC
     if (macAddr.isValid()) {
-      t.exec_prepared( "insert_raw_device_mac_addr"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , macAddr.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_mac_addr"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , macAddr.toString()
+                          );
     } else {
       LOG_WARN << "Invalid MAC for: "
                << deviceId << ", " << name << ", " << macAddr
@@ -150,12 +150,12 @@ namespace netmeld::datastore::objects {
     for (const auto& ipAddr : macAddr.getIpAddresses()) {
       if (!ipAddr.isValid()) { continue; }
 
-      t.exec_prepared( "insert_raw_device_ip_addr"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , ipAddr.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_ip_addr"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , ipAddr.toString()
+                          );
     }
   }
 
@@ -169,29 +169,29 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared( "insert_tool_run_interface"
-                   , toolRunId
-                   , name
-                   , mediaType
-                   , isUp
-                   );
+    nmdu::execPrepared(t, "insert_tool_run_interface"
+                        , toolRunId
+                        , name
+                        , mediaType
+                        , isUp
+                        );
 
     if (macAddr.isValid()) {
-      t.exec_prepared( "insert_tool_run_mac_addr"
-                     , toolRunId
-                     , name
-                     , macAddr.toString()
-                     );
+      nmdu::execPrepared(t, "insert_tool_run_mac_addr"
+                          , toolRunId
+                          , name
+                          , macAddr.toString()
+                          );
     }
 
     for (const auto& ipAddr : macAddr.getIpAddresses()) {
       if (!ipAddr.isValid()) { continue; }
 
-      t.exec_prepared( "insert_tool_run_ip_addr"
-                     , toolRunId
-                     , name
-                     , ipAddr.toString()
-                     );
+      nmdu::execPrepared(t, "insert_tool_run_ip_addr"
+                          , toolRunId
+                          , name
+                          , ipAddr.toString()
+                          );
     }
   }
 
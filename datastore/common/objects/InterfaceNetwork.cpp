@@ -110,6 +110,19 @@ namespace netmeld::datastore::objects {
     name = nmcu::toLower(_name);
   }
 
+  void
+  InterfaceNetwork::setReachableMacVendors(
+      const std::function<std::string(const MacAddress&)>& _lookup)
+  {
+    // Vendor is not part of the ordering, but set members are immutable
+    std::set<MacAddress> tagged;
+    for (auto macAddr : reachableMacAddrs) {
+      macAddr.setVendor(_lookup(macAddr));
+      tagged.insert(tagged.end(), macAddr);
+    }
+    reachableMacAddrs = std::move(tagged);
+  }
+
   void
   InterfaceNetwork::setState(bool _state)
   {
@@ -215,54 +228,54 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared( "insert_raw_device_interface"
-                   , toolRunId
-                   , deviceId
-                   , name
-                   , mediaType
-                   , isUp
-                   , description
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_interface"
+                        , toolRunId
+                        , deviceId
+                        , name
+                        , mediaType
+                        , isUp
+                        , description
+                        );
 
     if (!isPartial) {
-      t.exec_prepared( "insert_raw_device_interfaces_cdp"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , isDiscoveryProtocolEnabled
-                     );
-
-      t.exec_prepared( "insert_raw_device_interfaces_bpdu"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , isBpduGuardEnabled
-                     , isBpduFilterEnabled
-                     );
-
-      t.exec_prepared( "insert_raw_device_interfaces_portfast"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , isPortfastEnabled
-                     );
-
-      t.exec_prepared( "insert_raw_device_interfaces_mode"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , mode
-                     );
-
-      t.exec_prepared( "insert_raw_device_interfaces_port_security"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , isPortSecurityEnabled
-                     , isPortSecurityStickyMac
-                     , portSecurityMaxMacAddrs
-                     , portSecurityViolationAction
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_cdp"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , isDiscoveryProtocolEnabled
+                          );
+
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_bpdu"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , isBpduGuardEnabled
+                          , isBpduFilterEnabled
+                          );
+
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_portfast"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , isPortfastEnabled
+                          );
+
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_mode"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , mode
+                          );
+
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_port_security"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , isPortSecurityEnabled
+                          , isPortSecurityStickyMac
+                          , portSecurityMaxMacAddrs
+                          , portSecurityViolationAction
+                          );
     }
 
     for (auto mac : learnedMacAddrs) {
@@ -270,19 +283,19 @@ namespace netmeld::datastore::objects {
 
       if (!mac.isValid()) { continue; }
 
-      t.exec_prepared( "insert_raw_device_link_connection"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , mac.toString()
-                     );
-
-      t.exec_prepared( "insert_raw_device_interfaces_port_security_mac_addr"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , mac.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_link_connection"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , mac.toString()
+                          );
+
+      nmdu::execPrepared(t, "insert_raw_device_interfaces_port_security_mac_addr"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , mac.toString()
+                          );
     }
 
     for (auto mac : reachableMacAddrs) {
@@ -290,46 +303,46 @@ namespace netmeld::datastore::objects {
 
       if (!mac.isValid()) { continue; }
 
-      t.exec_prepared( "insert_raw_device_link_connection"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , mac.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_link_connection"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , mac.toString()
+                          );
     }
 
     macAddr.setResponding(isUp);
     macAddr.save(t, toolRunId, deviceId);
 
     if (macAddr.isValid()) {
-      t.exec_prepared( "insert_raw_device_mac_addr"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , macAddr.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_mac_addr"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , macAddr.toString()
+                          );
     }
 
     for (const auto& ipAddr : macAddr.getIpAddresses()) {
       if (!ipAddr.isValid()) { continue; }
-      t.exec_prepared( "insert_raw_device_ip_addr"
-                     , toolRunId
-                     , deviceId
-                     , name
-                     , ipAddr.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_ip_addr"
+                          , toolRunId
+                          , deviceId
+                          , name
+                          , ipAddr.toString()
+                          );
     }
 
     for (auto vlan : vlans) {
       vlan.save(t, toolRunId, deviceId);
 
       if (vlan.isValid()) {
-        t.exec_prepared( "insert_raw_device_interfaces_vlan"
-                       , toolRunId
-                       , deviceId
-                       , name
-                       , vlan.getVlanId()
-                       );
+        nmdu::execPrepared(t, "insert_raw_device_interfaces_vlan"
+                            , toolRunId
+                            , deviceId
+                            , name
+                            , vlan.getVlanId()
+                            );
       }
     }
   }
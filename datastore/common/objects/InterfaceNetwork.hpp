@@ -27,6 +27,7 @@
 #ifndef INTERFACE_NETWORK_HPP
 #define INTERFACE_NETWORK_HPP
 
+#include <functional>
 #include <set>
 
 #include <netmeld/datastore/objects/AbstractDatastoreObject.hpp>
@@ -98,6 +99,9 @@ namespace netmeld::datastore::objects {
       void setMacAddress(const MacAddress&);
       void setMediaType(const std::string&);
       void setName(const std::string&);
+      // Tag reachable MACs with the vendor given by the lookup
+      void setReachableMacVendors(
+          const std::function<std::string(const MacAddress&)>&);
       void setState(bool);
       void setSwitchportMode(const std::string&);
       void setPortSecurity(bool);
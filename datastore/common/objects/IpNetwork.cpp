@@ -28,10 +28,12 @@
 #include <netmeld/datastore/objects/IpNetwork.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
+#include <netmeld/datastore/utils/ParseCache.hpp>
 
 #include <boost/math/special_functions/relative_difference.hpp>
 
 namespace nmdp = netmeld::datastore::parsers;
+namespace nmdu = netmeld::datastore::utils;
 namespace nmcu = netmeld::core::utils;
 
 
@@ -46,7 +48,13 @@ namespace netmeld::datastore::objects {
   IpNetwork::IpNetwork(const std::string& _addr, const std::string& _reason) :
     reason(_reason)
   {
-    IpNetwork temp = nmdp::fromString<nmdp::ParserIpAddress, IpAddress>(_addr);
+    thread_local nmdu::ParseCache<IpAddress> cache {"IpAddress"};
+
+    const IpNetwork& temp {
+      cache.get(_addr, [&_addr]() {
+          return nmdp::fromString<nmdp::ParserIpAddress, IpAddress>(_addr);
+        })
+    };
     address        = temp.address;
     prefix         = temp.prefix;
   }
@@ -341,13 +349,13 @@ namespace netmeld::datastore::objects {
       fullReason = deviceId + "'s " + fullReason;
     }
 
-    t.exec_prepared("insert_raw_ip_net",
+    nmdu::execPrepared(t, "insert_raw_ip_net",
       toolRunId,
       toString(),
       fullReason); // insert converts '' to null
 
     if (0.0 < extraWeight) {
-      t.exec_prepared("insert_ip_net_extra_weight",
+      nmdu::execPrepared(t, "insert_ip_net_extra_weight",
         toString(),
         extraWeight);
     }
@@ -29,8 +29,10 @@
 #include <netmeld/datastore/objects/MacAddress.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/parsers/ParserMacAddress.hpp>
+#include <netmeld/datastore/utils/ParseCache.hpp>
 
 namespace nmdp = netmeld::datastore::parsers;
+namespace nmdu = netmeld::datastore::utils;
 
 
 namespace netmeld::datastore::objects {
@@ -49,9 +51,11 @@ namespace netmeld::datastore::objects {
   void
   MacAddress::setMac(const std::string& _macAddr)
   {
-    MacAddress m1
-      {nmdp::fromString<nmdp::ParserMacAddress, MacAddress>(_macAddr)};
-    setMac(m1);
+    thread_local nmdu::ParseCache<MacAddress> cache {"MacAddress"};
+
+    setMac(cache.get(_macAddr, [&_macAddr]() {
+        return nmdp::fromString<nmdp::ParserMacAddress, MacAddress>(_macAddr);
+      }));
   }
 
   void
@@ -64,6 +68,9 @@ namespace netmeld::datastore::objects {
   MacAddress::setMac(const MacAddress& _macAddr)
   {
     setMac(_macAddr.macAddr);
+    if (!_macAddr.vendor.empty()) {
+      setVendor(_macAddr.vendor);
+    }
   }
 
   void
@@ -78,6 +85,12 @@ namespace netmeld::datastore::objects {
     isResponding = _isUp;
   }
 
+  void
+  MacAddress::setVendor(const std::string& _vendor)
+  {
+    vendor = _vendor;
+  }
+
   bool
   MacAddress::isValid() const
   {
@@ -90,15 +103,28 @@ namespace netmeld::datastore::objects {
     return ipAddrs;
   }
 
+  const std::vector<uint8_t>&
+  MacAddress::getMac() const
+  {
+    return macAddr;
+  }
+
+  const std::string&
+  MacAddress::getVendor() const
+  {
+    return vendor;
+  }
+
   void
   MacAddress::save(pqxx::transaction_base& t,
                    const nmco::Uuid& toolRunId, const std::string& deviceId)
   {
     if (isValid()) {
-      t.exec_prepared("insert_raw_mac_addr",
+      nmdu::execPrepared(t, "insert_raw_mac_addr",
         toolRunId,
         toString(),
-        isResponding);
+        isResponding,
+        vendor);
     } else {
       LOG_DEBUG << "MacAddress object is not saving: " << toDebugString()
                 << std::endl;
@@ -112,7 +138,7 @@ namespace netmeld::datastore::objects {
       if (!ipAddr.isValid()) { continue; }
 
       if (isValid()) {
-        t.exec_prepared("insert_raw_mac_addr_ip_addr",
+        nmdu::execPrepared(t, "insert_raw_mac_addr_ip_addr",
           toolRunId,
           toString(),
           ipAddr.toString());
@@ -150,8 +176,11 @@ namespace netmeld::datastore::objects {
     oss << "[";
     oss << "macAddress: " << toString() << ", "
         << "ipAddrs: " << ipAddrs << ", "
-        << "isResponding: " << std::boolalpha << isResponding
-        << "]";
+        << "isResponding: " << std::boolalpha << isResponding;
+    if (!vendor.empty()) {
+      oss << ", vendor: " << vendor;
+    }
+    oss << "]";
 
     return oss.str();
   }
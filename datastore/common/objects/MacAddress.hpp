@@ -43,6 +43,7 @@ namespace netmeld::datastore::objects {
       std::vector<uint8_t>    macAddr;
       std::set<IpAddress>     ipAddrs;
       bool                    isResponding {false};
+      std::string             vendor;
 
     public:
 
@@ -68,10 +69,13 @@ namespace netmeld::datastore::objects {
       void setMac(const std::vector<uint8_t>&);
       void setMac(const MacAddress&);
       void setResponding(bool);
+      void setVendor(const std::string&);
 
       bool isValid() const override;
 
       const std::set<IpAddress>& getIpAddresses() const;
+      const std::vector<uint8_t>& getMac() const;
+      const std::string& getVendor() const;
 
       void save(pqxx::transaction_base&,
                 const nmco::Uuid&, const std::string&) override;
@@ -119,15 +119,15 @@ namespace netmeld::datastore::objects
 
     ipAddr.save(t, toolRunId, deviceId);
 
-    t.exec_prepared( "insert_raw_operating_system"
-                   , toolRunId
-                   , ipAddr.toString()
-                   , vendorName
-                   , productName
-                   , productVersion
-                   , toCpeString()
-                   , accuracy
-                   );
+    nmdu::execPrepared(t, "insert_raw_operating_system"
+                        , toolRunId
+                        , ipAddr.toString()
+                        , vendorName
+                        , productName
+                        , productVersion
+                        , toCpeString()
+                        , accuracy
+                        );
   }
 
   std::string
@@ -89,10 +89,10 @@ namespace netmeld::datastore::objects {
 
     // Ensure both devices are in DB
     for (const auto& devId : {srcDeviceId, dstDeviceId}) {
-      t.exec_prepared( "insert_raw_device"
-                     , toolRunId
-                     , devId
-                     );
+      nmdu::execPrepared(t, "insert_raw_device"
+                          , toolRunId
+                          , devId
+                          );
     }
 
     // Ensure src network interface information in DB
@@ -101,13 +101,13 @@ namespace netmeld::datastore::objects {
     srcIn.save(t, toolRunId, deviceId);
 
     // Add port-to-port connectivity
-    t.exec_prepared( "insert_raw_device_phys_connection"
-                   , toolRunId
-                   , srcDeviceId
-                   , srcIfaceName
-                   , dstDeviceId
-                   , dstIfaceName
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_phys_connection"
+                        , toolRunId
+                        , srcDeviceId
+                        , srcIfaceName
+                        , dstDeviceId
+                        , dstIfaceName
+                        );
   }
 
   std::string
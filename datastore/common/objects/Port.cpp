@@ -108,7 +108,7 @@ namespace netmeld::datastore::objects {
 
     ipAddr.save(t, toolRunId, deviceId);
 
-    t.exec_prepared("insert_raw_port",
+    nmdu::execPrepared(t, "insert_raw_port",
         toolRunId,
         ipAddr.toString(),
         protocol,
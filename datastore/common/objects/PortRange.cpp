@@ -25,11 +25,15 @@
 // =============================================================================
 
 #include <netmeld/datastore/objects/PortRange.hpp>
+#include <netmeld/datastore/utils/ParseCache.hpp>
 
 #include <format>
 #include <regex>
 
 
+namespace nmdu = netmeld::datastore::utils;
+
+
 namespace netmeld::datastore::objects {
 
   PortRange::PortRange() : PortRange(0,0)
@@ -49,6 +53,20 @@ namespace netmeld::datastore::objects {
     : first(min)
     , last(max)
   {
+    thread_local nmdu::ParseCache<std::pair<uint16_t, uint16_t>>
+      cache {"PortRange"};
+
+    std::tie(min, max) =
+      cache.get(_portRangeString,
+                [&]() { return parse(_portRangeString); });
+  }
+
+  std::pair<uint16_t, uint16_t>
+  PortRange::parse(const std::string& _portRangeString) const
+  {
+    uint16_t low {0};
+    uint16_t high {0};
+
     const auto& portRangeString {
         translateFromTypicalServiceAlias(_portRangeString)
       };
@@ -57,11 +75,11 @@ namespace netmeld::datastore::objects {
       std::regex r {R"(^([\[\(])\s*(\d{1,5})\s*,\s*(\d{1,5})\s*([\]\)])$)"};
       std::smatch m;
       if (std::regex_match(portRangeString, m, r)) {
-        min = static_cast<uint16_t>(std::stoul(m[2]));
-        max = static_cast<uint16_t>(std::stoul(m[3]));
-        if ("(" == m[1]) { ++min; }
-        if (")" == m[4]) { --max; }
-        return;
+        low = static_cast<uint16_t>(std::stoul(m[2]));
+        high = static_cast<uint16_t>(std::stoul(m[3]));
+        if ("(" == m[1]) { ++low; }
+        if (")" == m[4]) { --high; }
+        return {low, high};
       }
     }
 
@@ -70,9 +88,9 @@ namespace netmeld::datastore::objects {
       std::regex r {R"(^(\d{1,5})\s*-{1,2}\s*(\d{1,5})$)"};
       std::smatch m;
       if (std::regex_match(portRangeString, m, r)) {
-        min = static_cast<uint16_t>(std::stoul(m[1]));
-        max = static_cast<uint16_t>(std::stoul(m[2]));
-        return;
+        low = static_cast<uint16_t>(std::stoul(m[1]));
+        high = static_cast<uint16_t>(std::stoul(m[2]));
+        return {low, high};
       }
     }
 
@@ -81,10 +99,10 @@ namespace netmeld::datastore::objects {
       std::regex r {R"(^>(\d{1,5})$)"};
       std::smatch m;
       if (std::regex_match(portRangeString, m, r)) {
-        min = static_cast<uint16_t>(std::stoul(m[1]));
-        max = std::numeric_limits<uint16_t>::max();
-        ++min;
-        return;
+        low = static_cast<uint16_t>(std::stoul(m[1]));
+        high = std::numeric_limits<uint16_t>::max();
+        ++low;
+        return {low, high};
       }
     }
 
@@ -93,10 +111,10 @@ namespace netmeld::datastore::objects {
       std::regex r {R"(^<(\d{1,5})$)"};
       std::smatch m;
       if (std::regex_match(portRangeString, m, r)) {
-        min = std::numeric_limits<uint16_t>::min();
-        max = static_cast<uint16_t>(std::stoul(m[1]));
-        --max;
-        return;
+        low = std::numeric_limits<uint16_t>::min();
+        high = static_cast<uint16_t>(std::stoul(m[1]));
+        --high;
+        return {low, high};
       }
     }
 
@@ -105,11 +123,13 @@ namespace netmeld::datastore::objects {
       std::regex r {R"(^(\d{1,5})$)"};
       std::smatch m;
       if (std::regex_match(portRangeString, m, r)) {
-        min = static_cast<uint16_t>(std::stoul(m[1]));
-        max = min;
-        return;
+        low = static_cast<uint16_t>(std::stoul(m[1]));
+        high = low;
+        return {low, high};
       }
     }
+
+    return {low, high};
   }
 
   std::string
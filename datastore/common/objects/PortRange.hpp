@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <string>
 #include <tuple>
+#include <utility>
 
 #include <netmeld/core/objects/AbstractObject.hpp>
 
@@ -103,6 +104,7 @@ namespace netmeld::datastore::objects {
     // Methods
     // =========================================================================
     private:
+      std::pair<uint16_t, uint16_t> parse(const std::string&) const;
       std::string translateFromTypicalServiceAlias(const std::string&) const;
 
     protected:
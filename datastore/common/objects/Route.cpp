@@ -170,29 +170,29 @@ namespace netmeld::datastore::objects {
     nextHopIpAddr.save(t, toolRunId, deviceId);
 
     if (!vrfId.empty()) {
-      t.exec_prepared( "insert_raw_device_vrf"
-                     , toolRunId
-                     , deviceId
-                     , vrfId
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_vrf"
+                          , toolRunId
+                          , deviceId
+                          , vrfId
+                          );
     }
 
-    t.exec_prepared( "insert_raw_device_ip_route"
-                   , toolRunId
-                   , deviceId // insert converts to lower
-                   , vrfId // insert converts '' to null
-                   , tableId // insert converts '' to null
-                   , isActive
-                   , dstIpNet.toString()
-                   , nextVrfId // insert converts '' to null
-                   , nextTableId // insert converts '' to null
-                   , getNextHopIpAddrString() // insert converts '' to null
-                   , outIfaceName // insert converts '' to null
-                   , protocol // insert converts to lower and '' to null
-                   , adminDistance
-                   , metric
-                   , description // insert converts '' to null
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_ip_route"
+                        , toolRunId
+                        , deviceId // insert converts to lower
+                        , vrfId // insert converts '' to null
+                        , tableId // insert converts '' to null
+                        , isActive
+                        , dstIpNet.toString()
+                        , nextVrfId // insert converts '' to null
+                        , nextTableId // insert converts '' to null
+                        , getNextHopIpAddrString() // insert converts '' to null
+                        , outIfaceName // insert converts '' to null
+                        , protocol // insert converts to lower and '' to null
+                        , adminDistance
+                        , metric
+                        , description // insert converts '' to null
+                        );
   }
 
   void
@@ -204,12 +204,12 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared( "insert_tool_run_ip_route"
-                   , toolRunId
-                   , outIfaceName
-                   , dstIpNet.toString()
-                   , getNextHopIpAddrString()
-                   );
+    nmdu::execPrepared(t, "insert_tool_run_ip_route"
+                        , toolRunId
+                        , outIfaceName
+                        , dstIpNet.toString()
+                        , getNextHopIpAddrString()
+                        );
   }
 
   std::string
@@ -161,28 +161,28 @@ namespace netmeld::datastore::objects {
                        )
   {
     if (dstPorts.empty()) {
-      t.exec_prepared( "insert_raw_device_ip_server"
-                     , toolRunId
-                     , deviceId
-                     , interfaceName
-                     , serviceName
-                     , dstAddress.toString()
-                     , nullptr
-                     , isLocal
-                     , serviceDescription   // insert converts '' to null
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_ip_server"
+                          , toolRunId
+                          , deviceId
+                          , interfaceName
+                          , serviceName
+                          , dstAddress.toString()
+                          , nullptr
+                          , isLocal
+                          , serviceDescription   // insert converts '' to null
+                          );
     } else {
       for (const auto& dstPort : dstPorts) {
-        t.exec_prepared( "insert_raw_device_ip_server"
-                       , toolRunId
-                       , deviceId
-                       , interfaceName
-                       , serviceName
-                       , dstAddress.toString()
-                       , dstPort
-                       , isLocal
-                       , serviceDescription   // insert converts '' to null
-                       );
+        nmdu::execPrepared(t, "insert_raw_device_ip_server"
+                            , toolRunId
+                            , deviceId
+                            , interfaceName
+                            , serviceName
+                            , dstAddress.toString()
+                            , dstPort
+                            , isLocal
+                            , serviceDescription   // insert converts '' to null
+                            );
       }
     }
   }
@@ -203,16 +203,16 @@ namespace netmeld::datastore::objects {
       port.setPort(std::stoi(dstPort));
       port.save(t, toolRunId, "");
 
-      t.exec_prepared( "insert_raw_network_service"
-                     , toolRunId
-                     , dstAddress.toString()
-                     , protocol
-                     , dstPort
-                     , serviceName
-                     , serviceDescription
-                     , serviceReason
-                     , srcAddress.toString()
-                     );
+      nmdu::execPrepared(t, "insert_raw_network_service"
+                          , toolRunId
+                          , dstAddress.toString()
+                          , protocol
+                          , dstPort
+                          , serviceName
+                          , serviceDescription
+                          , serviceReason
+                          , srcAddress.toString()
+                          );
     }
   }
 
@@ -31,6 +31,12 @@
 
 namespace netmeld::datastore::objects {
 
+  // Unnamed namespace to hide helper logic
+  namespace {
+    const std::string NOTABLE             {"notable"};
+    const std::string UNSUPPORTED_FEATURE {"unsupported feature"};
+  }
+
   // ===========================================================================
   // Constructors
   // ===========================================================================
@@ -44,12 +50,40 @@ namespace netmeld::datastore::objects {
   ToolObservations::addNotable(const std::string& _observation)
   {
     notables.emplace(_observation);
+    addObservation(NOTABLE, _observation);
   }
 
   void
   ToolObservations::addUnsupportedFeature(const std::string& _observation)
   {
     unsupportedFeatures.emplace(_observation);
+    addObservation(UNSUPPORTED_FEATURE, _observation);
+  }
+
+  void
+  ToolObservations::addObservation(const std::string& _category,
+                                   const std::string& _observation)
+  {
+    ++occurrences[{_category, _observation}];
+  }
+
+  size_t
+  ToolObservations::getOccurrences(const std::string& _category,
+                                   const std::string& _observation) const
+  {
+    const auto& it {occurrences.find({_category, _observation})};
+    return (occurrences.end() == it) ? 0 : it->second;
+  }
+
+  void
+  ToolObservations::merge(const ToolObservations& _other)
+  {
+    notables.insert(_other.notables.begin(), _other.notables.end());
+    unsupportedFeatures.insert(_other.unsupportedFeatures.begin(),
+                               _other.unsupportedFeatures.end());
+    for (const auto& [key, count] : _other.occurrences) {
+      occurrences[key] += count;
+    }
   }
 
   bool
@@ -79,24 +113,58 @@ namespace netmeld::datastore::objects {
       return; // Always short circuit if invalid object
     }
 
-    saveObservations(t, toolRunId, "notable", notables);
-    saveObservations(t, toolRunId, "unsupported feature", unsupportedFeatures);
-  }
+    // Only what was observed since the last save is new to the data store
+    std::vector<std::string> categories;
+    std::vector<std::string> observations;
+    std::vector<size_t>      counts;
+    std::map<std::string, std::pair<size_t, size_t>> summary;
+    for (const auto& [key, count] : occurrences) {
+      const auto& [category, observation] {key};
+
+      const size_t prior {persisted.count(key) ? persisted.at(key) : 0};
+      if (count <= prior) { continue; }
+
+      const size_t delta {count - prior};
+      categories.push_back(category);
+      observations.push_back(observation);
+      counts.push_back(delta);
+
+      auto& [distinct, total] {summary[category]};
+      total += delta;
+      if (0 == prior) {
+        ++distinct;
+        if (!quiet) {
+          LOG_INFO << nmcu::toUpper(category) << ": " << observation;
+          if (1 < count) {
+            LOG_INFO << " (x" << count << ")";
+          }
+          LOG_INFO << '\n';
+        }
+      }
+    }
 
-  void
-  ToolObservations::saveObservations(pqxx::transaction_base& t,
-                                     const nmco::Uuid& toolRunId,
-                                     const std::string& category,
-                                     const std::set<std::string>& observations)
-  {
-    for (const auto& observation : observations) {
-      if (!quiet) {
-        LOG_INFO << nmcu::toUpper(category) << ": " << observation << '\n';
+    if (observations.empty()) {
+      LOG_DEBUG << "ToolObservations has nothing new to save\n";
+      return;
+    }
+
+    nmdu::execPrepared(t, "insert_raw_tool_observations",
+        toolRunId,
+        categories,
+        observations,
+        counts);
+    persisted = occurrences;
+
+    for (const auto& [category, totals] : summary) {
+      const auto& [distinct, total] {totals};
+      std::ostringstream oss;
+      oss << nmcu::toUpper(category) << " observations saved: "
+          << distinct << " new distinct, " << total << " occurrences\n";
+      if (quiet) {
+        LOG_DEBUG << oss.str();
+      } else {
+        LOG_INFO << oss.str();
       }
-      t.exec_prepared("insert_raw_tool_observation",
-          toolRunId,
-          category,
-          observation);
     }
   }
 
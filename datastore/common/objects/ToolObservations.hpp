@@ -27,6 +27,7 @@
 #ifndef TOOL_OBSERVATIONS_HPP
 #define TOOL_OBSERVATIONS_HPP
 
+#include <map>
 #include <set>
 
 #include <netmeld/datastore/objects/AbstractDatastoreObject.hpp>
@@ -41,10 +42,17 @@ namespace netmeld::datastore::objects {
     private: // Variables will probably rarely appear at this scope
       bool quiet {false};
 
+      // Occurrences already written by a prior save, so repeated saves of
+      // the same (accumulating) object only persist the difference
+      std::map<std::pair<std::string, std::string>, size_t> persisted;
+
     protected: // Variables intended for internal/subclass API
       std::set<std::string> notables;
       std::set<std::string> unsupportedFeatures;
 
+      // (category, observation) -> number of times it was observed
+      std::map<std::pair<std::string, std::string>, size_t> occurrences;
+
     public: // Variables should rarely appear at this scope
 
     // =========================================================================
@@ -60,13 +68,17 @@ namespace netmeld::datastore::objects {
     // Methods
     // =========================================================================
     private: // Methods which should be hidden from API users
-      void saveObservations(pqxx::transaction_base&, const nmco::Uuid&,
-                            const std::string&, const std::set<std::string>&);
+      void addObservation(const std::string&, const std::string&);
+
     protected: // Methods part of subclass API
     public: // Methods part of public API
       void addNotable(const std::string&);
       void addUnsupportedFeature(const std::string&);
 
+      size_t getOccurrences(const std::string&, const std::string&) const;
+
+      void merge(const ToolObservations&);
+
       bool isValid() const override;
       void save(pqxx::transaction_base&,
                 const nmco::Uuid&, const std::string&) override;
@@ -86,3 +86,49 @@ BOOST_AUTO_TEST_CASE(testSetters)
     BOOST_TEST(values == tto.getUnsupportedFeatures());
   }
 }
+
+BOOST_AUTO_TEST_CASE(testOccurrences)
+{
+  {
+    TestToolObservations tto;
+
+    BOOST_TEST(0 == tto.getOccurrences("notable", "some data"));
+
+    tto.addNotable("some data");
+    tto.addNotable("some data");
+    tto.addNotable("more data");
+    tto.addUnsupportedFeature("some data");
+    tto.addUnsupportedFeature("some data");
+    tto.addUnsupportedFeature("some data");
+
+    BOOST_TEST(2 == tto.getNotables().size());
+    BOOST_TEST(1 == tto.getUnsupportedFeatures().size());
+
+    BOOST_TEST(2 == tto.getOccurrences("notable", "some data"));
+    BOOST_TEST(1 == tto.getOccurrences("notable", "more data"));
+    BOOST_TEST(3 == tto.getOccurrences("unsupported feature", "some data"));
+    BOOST_TEST(0 == tto.getOccurrences("unsupported feature", "more data"));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMerge)
+{
+  {
+    TestToolObservations tto1, tto2;
+
+    tto1.addNotable("some data");
+    tto1.addUnsupportedFeature("first data");
+    tto2.addNotable("some data");
+    tto2.addNotable("more data");
+
+    tto1.merge(tto2);
+
+    BOOST_TEST((std::set<std::string>{"some data", "more data"}
+                == tto1.getNotables()));
+    BOOST_TEST((std::set<std::string>{"first data"}
+                == tto1.getUnsupportedFeatures()));
+    BOOST_TEST(2 == tto1.getOccurrences("notable", "some data"));
+    BOOST_TEST(1 == tto1.getOccurrences("notable", "more data"));
+    BOOST_TEST(1 == tto1.getOccurrences("unsupported feature", "first data"));
+  }
+}
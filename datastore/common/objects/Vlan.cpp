@@ -89,38 +89,38 @@ namespace netmeld::datastore::objects {
     }
 
     if (deviceId.empty()) {
-      t.exec_prepared( "insert_raw_vlan"
-                     , toolRunId
-                     , vlanId
-                     , description
-                     );
+      nmdu::execPrepared(t, "insert_raw_vlan"
+                          , toolRunId
+                          , vlanId
+                          , description
+                          );
 
       // Associate VLAN to network
       if (ipNet.isValid()) {
         ipNet.save(t, toolRunId, deviceId);
-        t.exec_prepared( "insert_raw_vlan_ip_net"
-                       , toolRunId
-                       , vlanId
-                       , ipNet.toString()
-                       );
+        nmdu::execPrepared(t, "insert_raw_vlan_ip_net"
+                            , toolRunId
+                            , vlanId
+                            , ipNet.toString()
+                            );
       }
     } else {
-      t.exec_prepared( "insert_raw_device_vlan"
-                     , toolRunId
-                     , deviceId
-                     , vlanId
-                     , description
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_vlan"
+                          , toolRunId
+                          , deviceId
+                          , vlanId
+                          , description
+                          );
 
       // Associate VLAN to network
       if (ipNet.isValid()) {
         ipNet.save(t, toolRunId, deviceId);
-        t.exec_prepared( "insert_raw_device_vlan_ip_net"
-                       , toolRunId
-                       , deviceId
-                       , vlanId
-                       , ipNet.toString()
-                       );
+        nmdu::execPrepared(t, "insert_raw_device_vlan_ip_net"
+                            , toolRunId
+                            , deviceId
+                            , vlanId
+                            , ipNet.toString()
+                            );
       }
     }
   }
@@ -97,19 +97,19 @@ namespace netmeld::datastore::objects {
       return;
     }
 
-    t.exec_prepared( "insert_raw_device_vrf"
-                   , toolRunId
-                   , deviceId
-                   , vrfId
-                   );
+    nmdu::execPrepared(t, "insert_raw_device_vrf"
+                        , toolRunId
+                        , deviceId
+                        , vrfId
+                        );
 
     for (const auto& iface : ifaces) {
-      t.exec_prepared( "insert_raw_device_vrf_interface"
-                     , toolRunId
-                     , deviceId
-                     , vrfId
-                     , iface
-                     );
+      nmdu::execPrepared(t, "insert_raw_device_vrf_interface"
+                          , toolRunId
+                          , deviceId
+                          , vrfId
+                          , iface
+                          );
     }
 
     for (auto& route : routes) {
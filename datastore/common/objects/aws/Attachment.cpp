@@ -70,13 +70,13 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_network_interface_attachment"
-        , toolRunId
-        , deviceId
-        , attachmentId
-        , status
-        , deleteOnTermination
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_network_interface_attachment"
+             , toolRunId
+             , deviceId
+             , attachmentId
+             , status
+             , deleteOnTermination
+           );
   }
 
   std::string
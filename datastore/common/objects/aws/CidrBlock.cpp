@@ -85,10 +85,10 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_cidr_block"
-        , toolRunId
-        , cidrBlock
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_cidr_block"
+             , toolRunId
+             , cidrBlock
+           );
 
     nmdo::IpAddress ipa {cidrBlock};
     if (ipa.isValid()) {
@@ -105,20 +105,20 @@ namespace netmeld::datastore::objects::aws {
         !(state.empty())
       };
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_cidr_block_detail"
-          , toolRunId
-          , cidrBlock
-          , state
-          , description
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_cidr_block_detail"
+               , toolRunId
+               , cidrBlock
+               , state
+               , description
+             );
     }
 
     for (const auto& alias : aliases) {
-      t.exec_prepared("insert_raw_aws_cidr_block_fqdn"
-          , toolRunId
-          , cidrBlock
-          , alias
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_cidr_block_fqdn"
+               , toolRunId
+               , cidrBlock
+               , alias
+             );
     }
   }
 
@@ -100,23 +100,23 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_instance"
-        , toolRunId
-        , instanceId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_instance"
+             , toolRunId
+             , instanceId
+           );
 
-    t.exec_prepared("insert_raw_aws_instance_detail"
-        , toolRunId
-        , instanceId
-        , type
-        , imageId
-        , architecture
-        , platformDetails
-        , launchTime
-        , availabilityZone
-        , stateCode
-        , stateName
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_instance_detail"
+             , toolRunId
+             , instanceId
+             , type
+             , imageId
+             , architecture
+             , platformDetails
+             , launchTime
+             , availabilityZone
+             , stateCode
+             , stateName
+           );
 
     for (auto interface : interfaces) {
       interface.save(t, toolRunId, instanceId);
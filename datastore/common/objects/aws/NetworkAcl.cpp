@@ -72,39 +72,39 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_network_acl"
-        , toolRunId
-        , naclId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_network_acl"
+             , toolRunId
+             , naclId
+           );
 
     for (auto rule : rules) {
       rule.save(t, toolRunId, naclId);
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
-          , toolRunId
-          , vpcId
-        );
-
-      t.exec_prepared("insert_raw_aws_vpc_network_acl"
-          , toolRunId
-          , vpcId
-          , naclId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
+               , toolRunId
+               , vpcId
+             );
+
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_network_acl"
+               , toolRunId
+               , vpcId
+               , naclId
+             );
     }
 
     for (const auto& subnetId : subnetIds) {
-      t.exec_prepared("insert_raw_aws_subnet"
-          , toolRunId
-          , subnetId
-        );
-
-      t.exec_prepared("insert_raw_aws_network_acl_subnet"
-          , toolRunId
-          , naclId
-          , subnetId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_subnet"
+               , toolRunId
+               , subnetId
+             );
+
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_subnet"
+               , toolRunId
+               , naclId
+               , subnetId
+             );
     }
   }
 
@@ -106,15 +106,15 @@ namespace netmeld::datastore::objects::aws {
 
     for (auto ip : cidrBlocks) {
       ip.save(t, toolRunId, deviceId);
-      t.exec_prepared("insert_raw_aws_network_acl_rule"
-          , toolRunId
-          , deviceId
-          , egress
-          , number
-          , action
-          , protocol
-          , ip.toString()
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_rule"
+               , toolRunId
+               , deviceId
+               , egress
+               , number
+               , action
+               , protocol
+               , ip.toString()
+             );
     }
 
     if (portRange && typeCode) {
@@ -123,25 +123,25 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (portRange) {
-      t.exec_prepared("insert_raw_aws_network_acl_rules_port"
-          , toolRunId
-          , deviceId
-          , egress
-          , number
-          , fromOrType
-          , toOrCode
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_rules_port"
+               , toolRunId
+               , deviceId
+               , egress
+               , number
+               , fromOrType
+               , toOrCode
+             );
     }
 
     if (typeCode) {
-      t.exec_prepared("insert_raw_aws_network_acl_rules_type_code"
-          , toolRunId
-          , deviceId
-          , egress
-          , number
-          , fromOrType
-          , toOrCode
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_acl_rules_type_code"
+               , toolRunId
+               , deviceId
+               , egress
+               , number
+               , fromOrType
+               , toOrCode
+             );
     }
   }
 
@@ -123,87 +123,87 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_network_interface"
-        , toolRunId
-        , interfaceId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_network_interface"
+             , toolRunId
+             , interfaceId
+           );
 
     bool hasDetails {
         !(type.empty() || status.empty())
       };
 
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_network_interface_detail"
-          , toolRunId
-          , interfaceId
-          , type
-          , sourceDestinationCheck
-          , status
-          , description
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_detail"
+               , toolRunId
+               , interfaceId
+               , type
+               , sourceDestinationCheck
+               , status
+               , description
+             );
     }
 
     attachment.save(t, toolRunId, interfaceId);
 
     if (!macAddr.empty()) {
-      t.exec_prepared("insert_raw_aws_network_interface_mac"
-          , toolRunId
-          , interfaceId
-          , macAddr
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_mac"
+               , toolRunId
+               , interfaceId
+               , macAddr
+             );
     }
 
     for (auto cb : cidrBlocks) {
       cb.save(t, toolRunId, interfaceId);
-      t.exec_prepared("insert_raw_aws_network_interface_ip"
-          , toolRunId
-          , interfaceId
-          , cb.getCidrBlock()
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_ip"
+               , toolRunId
+               , interfaceId
+               , cb.getCidrBlock()
+             );
     }
 
     if (!subnetId.empty()) {
-      t.exec_prepared("insert_raw_aws_subnet"
-          , toolRunId
-          , subnetId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_subnet"
+               , toolRunId
+               , subnetId
+             );
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
-          , toolRunId
-          , vpcId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
+               , toolRunId
+               , vpcId
+             );
     }
 
     if (!(subnetId.empty() || vpcId.empty())) {
-      t.exec_prepared("insert_raw_aws_network_interface_vpc_subnet"
-          , toolRunId
-          , interfaceId
-          , vpcId
-          , subnetId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_vpc_subnet"
+               , toolRunId
+               , interfaceId
+               , vpcId
+               , subnetId
+             );
     }
 
     for (const auto& sg : securityGroups) {
-      t.exec_prepared("insert_raw_aws_security_group"
-          , toolRunId
-          , sg
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_security_group"
+               , toolRunId
+               , sg
+             );
 
-      t.exec_prepared("insert_raw_aws_network_interface_security_group"
-          , toolRunId
-          , interfaceId
-          , sg
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_network_interface_security_group"
+               , toolRunId
+               , interfaceId
+               , sg
+             );
     }
 
     if (!deviceId.empty()) {
-      t.exec_prepared("insert_raw_aws_instance_network_interface"
-          , toolRunId
-          , deviceId
-          , interfaceId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_instance_network_interface"
+               , toolRunId
+               , deviceId
+               , interfaceId
+             );
     }
   }
 
@@ -76,22 +76,22 @@ namespace netmeld::datastore::objects::aws {
     for (auto ip : cidrBlocks) {
       ip.save(t, toolRunId, deviceId);
 
-      t.exec_prepared("insert_raw_aws_route_table_route_cidr"
-          , toolRunId
-          , deviceId
-          , typeId
-          , state
-          , ip.toString()
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_route_table_route_cidr"
+               , toolRunId
+               , deviceId
+               , typeId
+               , state
+               , ip.toString()
+             );
     }
     for (auto dest : nonCidrBlocks) {
-      t.exec_prepared("insert_raw_aws_route_table_route_non_cidr"
-          , toolRunId
-          , deviceId
-          , typeId
-          , state
-          , dest
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_route_table_route_non_cidr"
+               , toolRunId
+               , deviceId
+               , typeId
+               , state
+               , dest
+             );
     }
   }
 
@@ -78,17 +78,17 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_route_table"
-        , toolRunId
-        , routeTableId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_route_table"
+             , toolRunId
+             , routeTableId
+           );
 
     for (const auto& association : associations) {
-      t.exec_prepared("insert_raw_aws_route_table_association"
-          , toolRunId
-          , routeTableId
-          , association
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_route_table_association"
+               , toolRunId
+               , routeTableId
+               , association
+             );
     }
 
     for (auto route : routes) {
@@ -96,17 +96,17 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
-          , toolRunId
-          , vpcId
-        );
-
-      t.exec_prepared("insert_raw_aws_vpc_route_table"
-          , toolRunId
-          , vpcId
-          , routeTableId
-          , isDefault
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
+               , toolRunId
+               , vpcId
+             );
+
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_route_table"
+               , toolRunId
+               , vpcId
+               , routeTableId
+               , isDefault
+             );
     }
   }
 
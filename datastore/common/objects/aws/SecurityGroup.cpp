@@ -78,22 +78,22 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_security_group"
-        , toolRunId
-        , sgId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_security_group"
+             , toolRunId
+             , sgId
+           );
 
     bool hasDetails {
         !(name.empty() || description.empty())
       };
 
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_security_group_detail"
-          , toolRunId
-          , sgId
-          , name
-          , description
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_security_group_detail"
+               , toolRunId
+               , sgId
+               , name
+               , description
+             );
     }
 
     for (auto rule : rules) {
@@ -101,16 +101,16 @@ namespace netmeld::datastore::objects::aws {
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
-          , toolRunId
-          , vpcId
-        );
-
-      t.exec_prepared("insert_raw_aws_vpc_security_group"
-          , toolRunId
-          , vpcId
-          , sgId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
+               , toolRunId
+               , vpcId
+             );
+
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_security_group"
+               , toolRunId
+               , vpcId
+               , sgId
+             );
     }
   }
 
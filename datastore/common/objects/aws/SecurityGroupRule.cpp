@@ -106,64 +106,64 @@ namespace netmeld::datastore::objects::aws {
     for (auto ip : cidrBlocks) {
       ip.save(t, toolRunId, deviceId);
       if (protocol == icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_type_code"
-            , toolRunId
-            , deviceId
-            , egress
-            , protocol
-            , fromOrType
-            , toOrCode
-            , ip.toString()
-          );
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_type_code"
+                 , toolRunId
+                 , deviceId
+                 , egress
+                 , protocol
+                 , fromOrType
+                 , toOrCode
+                 , ip.toString()
+               );
       }
       if (protocol != icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_port"
-            , toolRunId
-            , deviceId
-            , egress
-            , protocol
-            , fromOrType
-            , toOrCode
-            , ip.toString()
-          );
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_port"
+                 , toolRunId
+                 , deviceId
+                 , egress
+                 , protocol
+                 , fromOrType
+                 , toOrCode
+                 , ip.toString()
+               );
       }
     }
 
     for (const auto& target : nonCidrs) {
       if (protocol == icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_non_ip_type_code"
-            , toolRunId
-            , deviceId
-            , egress
-            , protocol
-            , fromOrType
-            , toOrCode
-            , target
-          );
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_non_ip_type_code"
+                 , toolRunId
+                 , deviceId
+                 , egress
+                 , protocol
+                 , fromOrType
+                 , toOrCode
+                 , target
+               );
       }
       if (protocol != icmp || protocol == any) {
-        t.exec_prepared("insert_raw_aws_security_group_rules_non_ip_port"
-            , toolRunId
-            , deviceId
-            , egress
-            , protocol
-            , fromOrType
-            , toOrCode
-            , target
-          );
+        nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_non_ip_port"
+                 , toolRunId
+                 , deviceId
+                 , egress
+                 , protocol
+                 , fromOrType
+                 , toOrCode
+                 , target
+               );
       }
     }
 
     for (const auto& detail : details) {
-      t.exec_prepared("insert_raw_aws_security_group_rules_non_ip_detail"
-          , toolRunId
-          , deviceId
-          , egress
-          , protocol
-          , fromOrType
-          , toOrCode
-          , detail
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_security_group_rules_non_ip_detail"
+               , toolRunId
+               , deviceId
+               , egress
+               , protocol
+               , fromOrType
+               , toOrCode
+               , detail
+             );
     }
   }
 
@@ -83,45 +83,45 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_subnet"
-        , toolRunId
-        , subnetId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_subnet"
+             , toolRunId
+             , subnetId
+           );
 
     bool hasDetails {
         !(availabilityZone.empty() || subnetArn.empty())
       };
 
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_subnet_detail"
-          , toolRunId
-          , subnetId
-          , availabilityZone
-          , subnetArn
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_subnet_detail"
+               , toolRunId
+               , subnetId
+               , availabilityZone
+               , subnetArn
+             );
     }
 
     for (auto cb : cidrBlocks) {
       cb.save(t, toolRunId, subnetId);
 
-      t.exec_prepared("insert_raw_aws_subnet_cidr_block"
-          , toolRunId
-          , subnetId
-          , cb.toString()
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_subnet_cidr_block"
+               , toolRunId
+               , subnetId
+               , cb.toString()
+             );
     }
 
     if (!vpcId.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc"
-          , toolRunId
-          , vpcId
-        );
-
-      t.exec_prepared("insert_raw_aws_vpc_subnet"
-          , toolRunId
-          , vpcId
-          , subnetId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc"
+               , toolRunId
+               , vpcId
+             );
+
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_subnet"
+               , toolRunId
+               , vpcId
+               , subnetId
+             );
     }
   }
 
@@ -93,24 +93,24 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_transit_gateway"
-        , toolRunId
-        , tgwId
-      );
-
-    t.exec_prepared("insert_raw_aws_transit_gateway_attachment"
-        , toolRunId
-        , tgwId
-        , tgwAttachmentId
-        , state
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_transit_gateway"
+             , toolRunId
+             , tgwId
+           );
+
+    nmdu::execPrepared(t, "insert_raw_aws_transit_gateway_attachment"
+             , toolRunId
+             , tgwId
+             , tgwAttachmentId
+             , state
+           );
 
     if (!tgwOwnerId.empty()) {
-      t.exec_prepared("insert_raw_aws_transit_gateway_owner"
-          , toolRunId
-          , tgwId
-          , tgwOwnerId
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_transit_gateway_owner"
+               , toolRunId
+               , tgwId
+               , tgwOwnerId
+             );
     }
 
     bool hasDetails {
@@ -121,15 +121,15 @@ namespace netmeld::datastore::objects::aws {
          )
       };
     if (hasDetails) {
-      t.exec_prepared("insert_raw_aws_transit_gateway_attachment_detail"
-          , toolRunId
-          , tgwId
-          , tgwAttachmentId
-          , resourceType
-          , resourceId
-          , resourceOwnerId
-          , associationState
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_transit_gateway_attachment_detail"
+               , toolRunId
+               , tgwId
+               , tgwAttachmentId
+               , resourceType
+               , resourceId
+               , resourceOwnerId
+               , associationState
+             );
     }
   }
 
@@ -84,34 +84,34 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_vpc"
-        , toolRunId
-        , vpcId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_vpc"
+             , toolRunId
+             , vpcId
+           );
 
-    t.exec_prepared("insert_raw_aws_vpc_owner"
-        , toolRunId
-        , vpcId
-        , ownerId
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_vpc_owner"
+             , toolRunId
+             , vpcId
+             , ownerId
+           );
 
     if (!state.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc_detail"
-          , toolRunId
-          , vpcId
-          , state
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_detail"
+               , toolRunId
+               , vpcId
+               , state
+             );
     }
 
     for (auto cidr : cidrBlocks) {
       cidr.save(t, toolRunId, vpcId);
 
-      t.exec_prepared("insert_raw_aws_vpc_cidr_block"
-          , toolRunId
-          , vpcId
-          , cidr.toString()
-          , state
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_cidr_block"
+               , toolRunId
+               , vpcId
+               , cidr.toString()
+               , state
+             );
     }
   }
 
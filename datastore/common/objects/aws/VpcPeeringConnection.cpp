@@ -76,27 +76,27 @@ namespace netmeld::datastore::objects::aws {
       return;
     }
 
-    t.exec_prepared("insert_raw_aws_vpc_peering_connection"
-        , toolRunId
-        , pcxId
-      );
-
-    t.exec_prepared("insert_raw_aws_vpc_peering_connection_peer"
-        , toolRunId
-        , pcxId
-        , accepter.getId()
-        , accepter.getOwnerId()
-        , requester.getId()
-        , requester.getOwnerId()
-      );
+    nmdu::execPrepared(t, "insert_raw_aws_vpc_peering_connection"
+             , toolRunId
+             , pcxId
+           );
+
+    nmdu::execPrepared(t, "insert_raw_aws_vpc_peering_connection_peer"
+             , toolRunId
+             , pcxId
+             , accepter.getId()
+             , accepter.getOwnerId()
+             , requester.getId()
+             , requester.getOwnerId()
+           );
 
     if (!statusCode.empty()) {
-      t.exec_prepared("insert_raw_aws_vpc_peering_connection_status"
-          , toolRunId
-          , pcxId
-          , statusCode
-          , statusMessage
-        );
+      nmdu::execPrepared(t, "insert_raw_aws_vpc_peering_connection_status"
+               , toolRunId
+               , pcxId
+               , statusCode
+               , statusMessage
+             );
     }
 
     accepter.save(t, toolRunId);
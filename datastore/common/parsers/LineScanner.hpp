@@ -0,0 +1,186 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef LINE_SCANNER_HPP
+#define LINE_SCANNER_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include <arpa/inet.h>
+
+
+namespace netmeld::datastore::parsers {
+
+  /* Helpers for scanning large, line oriented inputs (e.g., full routing
+     tables) in place, for when building objects through a grammar for every
+     line costs too much.  Nothing here allocates; results refer back into
+     the scanned data.
+   */
+
+  // Call `f(line)` for each line of `data`, without its line ending, until
+  // it returns false.  Returns false if stopped early.  Line ends are found
+  // with memchr(), which the C library vectorizes.
+  template<typename F>
+  bool
+  forEachLine(std::string_view data, F&& f)
+  {
+    while (!data.empty()) {
+      const auto* end {static_cast<const char*>(
+          std::memchr(data.data(), '\n', data.size()))};
+      const size_t length {end ? size_t(end - data.data()) : data.size()};
+
+      auto line {data.substr(0, length)};
+      if (!line.empty() && '\r' == line.back()) {
+        line.remove_suffix(1);
+      }
+      if (!f(line)) {
+        return false;
+      }
+
+      data.remove_prefix(end ? length + 1 : length);
+    }
+    return true;
+  }
+
+  // Remove and return the next blank separated token of `line`, empty if
+  // there are none left
+  inline std::string_view
+  nextToken(std::string_view& line)
+  {
+    const auto start {line.find_first_not_of(" \t")};
+    if (std::string_view::npos == start) {
+      line = {};
+      return {};
+    }
+    line.remove_prefix(start);
+
+    const auto end {std::min(line.find_first_of(" \t"), line.size())};
+    const auto token {line.substr(0, end)};
+    line.remove_prefix(end);
+    return token;
+  }
+
+  // An IP address with optional prefix (e.g., `10.0.0.0/8` or `fe80::1`), as
+  // scanned by parseIpPrefix()
+  struct IpPrefixView
+  {
+    std::string_view          text;
+    std::array<uint8_t, 16>   bytes   {};
+    uint8_t                   prefix  {0};
+    bool                      isV6    {false};
+
+    bool
+    isLoopback() const
+    {
+      if (!isV6) {
+        return 127 == bytes[0];
+      }
+      for (size_t i {0}; i < 15; ++i) {
+        if (0 != bytes[i]) { return false; }
+      }
+      return 1 == bytes[15];
+    }
+
+    bool
+    isMulticast() const
+    {
+      return isV6 ? (0xff == bytes[0]) : (0xe0 == (bytes[0] & 0xf0));
+    }
+
+    bool
+    isUnspecified() const
+    {
+      for (size_t i {0}; i < (isV6 ? 16 : 4); ++i) {
+        if (0 != bytes[i]) { return false; }
+      }
+      return true;
+    }
+
+    // Same as nmdo::IpAddress::isValid() for the scanned value
+    bool
+    isValidAddress() const
+    {
+      return !(isLoopback() || isMulticast() || isUnspecified());
+    }
+
+    // Same as nmdo::IpNetwork::isValid() for the scanned value
+    bool
+    isValidNetwork() const
+    {
+      return isValidAddress() && (prefix < (isV6 ? 128 : 32));
+    }
+  };
+
+  // Scan `text` as an IPv4 or IPv6 address with an optional `/prefix`, which
+  // defaults to the full width of the address (as nmdo::IpAddress does).
+  // False if it is not one.
+  inline bool
+  parseIpPrefix(std::string_view text, IpPrefixView& out)
+  {
+    const auto slash {text.find('/')};
+    const auto addr {text.substr(0, slash)};
+
+    // inet_pton() wants a terminated string; the longest IPv6 text form fits
+    char buffer[INET6_ADDRSTRLEN];
+    if (addr.empty() || addr.size() >= sizeof(buffer)) {
+      return false;
+    }
+    std::memcpy(buffer, addr.data(), addr.size());
+    buffer[addr.size()] = '\0';
+
+    out.bytes.fill(0);
+    if (1 == inet_pton(AF_INET, buffer, out.bytes.data())) {
+      out.isV6 = false;
+    } else if (1 == inet_pton(AF_INET6, buffer, out.bytes.data())) {
+      out.isV6 = true;
+    } else {
+      return false;
+    }
+
+    const unsigned maxPrefix {out.isV6 ? 128U : 32U};
+    unsigned prefix {maxPrefix};
+    if (std::string_view::npos != slash) {
+      const auto digits {text.substr(slash + 1)};
+      const auto* end {digits.data() + digits.size()};
+      const auto [ptr, ec] {std::from_chars(digits.data(), end, prefix)};
+      if (digits.empty() || std::errc() != ec || end != ptr
+          || maxPrefix < prefix)
+      {
+        return false;
+      }
+    }
+
+    out.text   = text;
+    out.prefix = static_cast<uint8_t>(prefix);
+    return true;
+  }
+}
+#endif // LINE_SCANNER_HPP
@@ -0,0 +1,130 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+#include <vector>
+
+#include <netmeld/datastore/objects/IpAddress.hpp>
+#include <netmeld/datastore/parsers/LineScanner.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdp = netmeld::datastore::parsers;
+
+
+BOOST_AUTO_TEST_CASE(testForEachLine)
+{
+  {
+    std::vector<std::string_view> lines;
+    const auto all {nmdp::forEachLine("a b\nc\r\n\n d", [&](auto line)
+        {
+          lines.push_back(line);
+          return true;
+        })};
+    BOOST_TEST(all);
+    const std::vector<std::string_view> expected {"a b", "c", "", " d"};
+    BOOST_TEST(expected == lines, boost::test_tools::per_element());
+  }
+
+  {
+    size_t count {0};
+    const auto all {nmdp::forEachLine("1\n2\n3\n", [&](auto line)
+        {
+          ++count;
+          return "2" != line;
+        })};
+    BOOST_TEST(!all);
+    BOOST_TEST(2 == count);
+  }
+
+  {
+    size_t count {0};
+    BOOST_TEST(nmdp::forEachLine("", [&](auto) { return 0 < ++count; }));
+    BOOST_TEST(0 == count);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testNextToken)
+{
+  std::string_view line {"  10.0.0.0/8 via\t1.2.3.4   dev eth0 "};
+  std::vector<std::string_view> tokens;
+  for (auto token {nmdp::nextToken(line)}; !token.empty();
+       token = nmdp::nextToken(line))
+  {
+    tokens.push_back(token);
+  }
+  const std::vector<std::string_view> expected
+    {"10.0.0.0/8", "via", "1.2.3.4", "dev", "eth0"};
+  BOOST_TEST(expected == tokens, boost::test_tools::per_element());
+  BOOST_TEST(line.empty());
+}
+
+BOOST_AUTO_TEST_CASE(testParseIpPrefix)
+{
+  nmdp::IpPrefixView ip;
+
+  {
+    BOOST_TEST(nmdp::parseIpPrefix("10.1.0.0/16", ip));
+    BOOST_TEST("10.1.0.0/16" == ip.text);
+    BOOST_TEST(!ip.isV6);
+    BOOST_TEST(16 == ip.prefix);
+    BOOST_TEST(10 == ip.bytes[0]);
+    BOOST_TEST(1 == ip.bytes[1]);
+
+    BOOST_TEST(nmdp::parseIpPrefix("1.2.3.4", ip));
+    BOOST_TEST(32 == ip.prefix);
+    BOOST_TEST(nmdp::parseIpPrefix("2001:db8::/32", ip));
+    BOOST_TEST(ip.isV6);
+    BOOST_TEST(32 == ip.prefix);
+    BOOST_TEST(nmdp::parseIpPrefix("fe80::1", ip));
+    BOOST_TEST(128 == ip.prefix);
+    BOOST_TEST(nmdp::parseIpPrefix("::ffff:1.2.3.4/96", ip));
+    BOOST_TEST(ip.isV6);
+  }
+
+  for (const auto& bad : {"", "default", "1.2.3", "1.2.3.4/", "1.2.3.4/33",
+                          "1.2.3.4/x", "1.2.3.4/24x", "256.1.1.1",
+                          "::/129", "fe80::1%eth0", "dev"})
+  {
+    BOOST_TEST(!nmdp::parseIpPrefix(bad, ip), bad);
+  }
+
+  // Agrees with what would be saved through the objects
+  for (const auto& text : {"10.0.0.0/8", "10.1.2.3", "0.0.0.0/0", "0.0.0.0",
+                           "127.0.0.1", "127.0.0.0/8", "224.0.0.0/4",
+                           "239.1.2.3", "192.168.1.0/24", "::/0", "::",
+                           "::1", "ff02::1", "fe80::/64", "2001:db8::1",
+                           "2001:db8::/32"})
+  {
+    BOOST_TEST_REQUIRE(nmdp::parseIpPrefix(text, ip), text);
+    const nmdo::IpAddress addr {text};
+    BOOST_TEST(addr.isValid() == ip.isValidAddress(), text);
+    BOOST_TEST(nmdo::IpNetwork(addr).isValid() == ip.isValidNetwork(), text);
+    BOOST_TEST(addr.getPrefix() == ip.prefix, text);
+  }
+}
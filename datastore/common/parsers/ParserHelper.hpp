@@ -27,8 +27,22 @@
 #ifndef PARSER_HELPER_HPP
 #define PARSER_HELPER_HPP
 
-#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #include <netmeld/core/utils/LoggerSingleton.hpp>
 
@@ -147,8 +161,9 @@ namespace netmeld::datastore::parsers {
     return result;
   }
 
+  // Parse a file, logging and returning nothing on failure instead of exiting
   template<class P, class R>
-  R fromFilePath(const std::string& data)
+  std::optional<R> tryFromFilePath(const std::string& data)
   {
     R result;
     std::ifstream dataStream {data};
@@ -168,12 +183,23 @@ namespace netmeld::datastore::parsers {
         oss << *i;
       }
       LOG_ERROR << oss.str() << std::endl;
-      std::exit(nmcu::Exit::FAILURE);
+      return std::nullopt;
     }
 
     return result;
   }
 
+  template<class P, class R>
+  R fromFilePath(const std::string& data)
+  {
+    auto result {tryFromFilePath<P,R>(data)};
+    if (!result) {
+      std::exit(nmcu::Exit::FAILURE);
+    }
+
+    return std::move(*result);
+  }
+
   template<class P, class R>
   R fromFilePathMM(const std::string& data)
   {
@@ -198,6 +224,290 @@ namespace netmeld::datastore::parsers {
     return result;
   }
 
+  // ===========================================================================
+  // Segmented (parallel) parsing
+  // ===========================================================================
+
+  // Inputs smaller than this are not worth splitting
+  inline constexpr size_t MIN_SEGMENT_SIZE {256 * 1024};
+
+  /* A parser which can parse independent, contiguous segments of its input
+     and stitch the partial results back together:
+       - splitSegments(data, count): cut the input at safe block boundaries
+       - setPartial(true):  parse a segment without finalizing the results
+       - merge(other):      fold a later segment's state into this one; return
+                            false if it cannot be stitched faithfully
+       - finalize():        produce the results as a whole-file parse would
+   */
+  template<class P, class R>
+  concept SegmentedParser =
+    requires(P& p, const std::string& data, size_t count) {
+      { P::splitSegments(data, count) } ->
+        std::same_as<std::vector<std::string>>;
+      p.setPartial(true);
+      { p.merge(p) } -> std::same_as<bool>;
+      { p.finalize() } -> std::same_as<R>;
+    };
+
+  // Split line oriented data into at most `count` contiguous, similarly sized
+  // segments.  A segment only ends in front of a line for which
+  // `canCut(previousLine, line)` holds.
+  inline std::vector<std::string>
+  splitLines(const std::string& data, size_t count,
+             const std::function<bool(std::string_view, std::string_view)>&
+               canCut)
+  {
+    std::vector<std::string> segments;
+    if (count < 2) {
+      segments.push_back(data);
+      return segments;
+    }
+
+    const size_t target {data.size() / count};
+    const std::string_view view {data};
+    std::string_view prev;
+    size_t segStart {0};
+    size_t lineStart {0};
+    while (lineStart < view.size()) {
+      size_t lineEnd {view.find('\n', lineStart)};
+      lineEnd = (std::string_view::npos == lineEnd) ? view.size() : lineEnd+1;
+      const auto line {view.substr(lineStart, lineEnd - lineStart)};
+
+      if (   (lineStart - segStart >= target)
+          && (segments.size() + 1 < count)
+          && canCut(prev, line))
+      {
+        segments.emplace_back(view.substr(segStart, lineStart - segStart));
+        segStart = lineStart;
+      }
+
+      prev = line;
+      lineStart = lineEnd;
+    }
+    segments.emplace_back(view.substr(segStart));
+
+    return segments;
+  }
+
+  // Split brace delimited data (e.g., `name { ... }`) into at most `count`
+  // contiguous, similarly sized segments, only cutting between top-level
+  // blocks.  Braces within quotes or comments (#..., /*...*/) are ignored.
+  inline std::vector<std::string>
+  splitBlocks(const std::string& data, size_t count)
+  {
+    std::vector<std::string> segments;
+    if (count < 2) {
+      segments.push_back(data);
+      return segments;
+    }
+
+    const size_t target {data.size() / count};
+    size_t segStart {0};
+    size_t depth {0};
+    bool inQuote {false};
+    bool inLineComment {false};
+    bool inBlockComment {false};
+    bool atLineStart {true};
+    for (size_t i {0}; i < data.size(); ++i) {
+      const char c {data[i]};
+
+      if (   atLineStart && (0 == depth)
+          && !inQuote && !inBlockComment
+          && (i - segStart >= target)
+          && (segments.size() + 1 < count))
+      {
+        segments.emplace_back(data, segStart, i - segStart);
+        segStart = i;
+      }
+      atLineStart = ('\n' == c);
+
+      if (inLineComment) {
+        inLineComment = ('\n' != c);
+      } else if (inBlockComment) {
+        if ('*' == c && (i+1) < data.size() && '/' == data[i+1]) {
+          inBlockComment = false;
+          ++i;
+        }
+      } else if (inQuote) {
+        if ('\\' == c) {
+          ++i;
+        } else if ('"' == c) {
+          inQuote = false;
+        }
+      } else if ('"' == c) {
+        inQuote = true;
+      } else if ('#' == c) {
+        inLineComment = true;
+      } else if ('/' == c && (i+1) < data.size() && '*' == data[i+1]) {
+        inBlockComment = true;
+        ++i;
+      } else if ('{' == c) {
+        ++depth;
+      } else if ('}' == c && depth > 0) {
+        --depth;
+      }
+    }
+    segments.emplace_back(data, segStart);
+
+    return segments;
+  }
+
+  // Parse each segment with its own parser instance in parallel, then stitch
+  // them, in order, into the first.  Returns nothing if any segment fails to
+  // parse or stitch, so the caller can fall back to a whole input parse.
+  template<class P, class R>
+    requires SegmentedParser<P,R>
+  std::optional<R>
+  fromSegments(const std::vector<std::string>& segments)
+  {
+    // Grammars may share (and re-wrap) namespace level rules while being
+    // constructed, so build all of them before any parsing starts.
+    std::vector<std::unique_ptr<P>> parsers;
+    for (size_t idx {0}; idx < segments.size(); ++idx) {
+      parsers.emplace_back(std::make_unique<P>())->setPartial(true);
+    }
+
+    std::vector<std::future<bool>> parses;
+    for (size_t idx {0}; idx < segments.size(); ++idx) {
+      parses.push_back(std::async(std::launch::async,
+          [&segment = segments[idx], parser = parsers[idx].get()]() {
+            std::istringstream dataStream {segment};
+            dataStream.unsetf(std::ios::skipws);
+
+            IstreamIter i {dataStream};
+            IstreamIter e;
+
+            R ignored;
+            const bool success
+              {qi::phrase_parse(i, e, *parser, qi::ascii::blank, ignored)};
+            return (success && (i == e));
+          }));
+    }
+
+    bool success {true};
+    for (size_t idx {0}; idx < parses.size(); ++idx) {
+      try {
+        if (!parses[idx].get()) {
+          LOG_DEBUG << "Segment " << idx << " failed to parse\n";
+          success = false;
+        }
+      } catch (const std::exception& e) {
+        LOG_DEBUG << "Segment " << idx << " failed: " << e.what() << '\n';
+        success = false;
+      }
+    }
+    if (!success) { return std::nullopt; }
+
+    auto& first {*parsers.front()};
+    for (size_t idx {1}; idx < parsers.size(); ++idx) {
+      if (!first.merge(*parsers[idx])) {
+        LOG_DEBUG << "Segment " << idx << " could not be stitched\n";
+        return std::nullopt;
+      }
+    }
+
+    return first.finalize();
+  }
+
+  // Parse a file by splitting it into at most `jobs` (0 = number of cores)
+  // segments parsed in parallel.  Small inputs, or inputs which cannot be
+  // split or stitched, are parsed whole with fromFilePath().
+  template<class P, class R>
+    requires SegmentedParser<P,R>
+  R fromFilePathSegmented(const std::string& dataPath, size_t jobs = 0)
+  {
+    if (0 == jobs) {
+      jobs = std::max(1U, std::thread::hardware_concurrency());
+    }
+
+    if (1 < jobs) {
+      std::ifstream dataStream {dataPath};
+      testFileStream(dataStream);
+      const std::string data {std::istreambuf_iterator<char>(dataStream),
+                              std::istreambuf_iterator<char>()};
+
+      if (MIN_SEGMENT_SIZE <= data.size()) {
+        const auto& segments {P::splitSegments(data, jobs)};
+        LOG_DEBUG << "Parsing " << dataPath << " as " << segments.size()
+                  << " segment(s)\n";
+        if (1 < segments.size()) {
+          auto result {fromSegments<P,R>(segments)};
+          if (result) { return std::move(*result); }
+          LOG_DEBUG << "Falling back to a whole input parse\n";
+        }
+      }
+    }
+
+    return fromFilePath<P,R>(dataPath);
+  }
+
+
+  // ===========================================================================
+  // Parallel parsing of independent sections
+  // ===========================================================================
+
+  /* A parser which can parse independent sections of its input (e.g.,
+     devices or logical systems) on several threads:
+       - setParseJobs(jobs): use at most `jobs` (0 = number of cores) threads
+   */
+  template<class P>
+  concept ParallelParser =
+    requires(P& p, size_t jobs) {
+      p.setParseJobs(jobs);
+    };
+
+  // Call `parse(idx)` for every idx in [0, count) on at most `jobs` (0 =
+  // number of cores) threads, the calling one included, and return the
+  // results in index order.  The first exception thrown by `parse` is
+  // rethrown once all of the work has stopped.
+  template<class F>
+  auto
+  parseInParallel(size_t count, size_t jobs, F&& parse)
+    -> std::vector<std::invoke_result_t<F&, size_t>>
+  {
+    using T = std::invoke_result_t<F&, size_t>;
+
+    if (0 == jobs) {
+      jobs = std::max(1U, std::thread::hardware_concurrency());
+    }
+    jobs = std::min(jobs, count);
+
+    std::vector<std::optional<T>> parsed(count);
+    std::atomic<size_t> next {0};
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    auto work = [&]() {
+      for (size_t idx {next++}; idx < count; idx = next++) {
+        try {
+          parsed[idx].emplace(parse(idx));
+        } catch (...) {
+          std::lock_guard<std::mutex> lock {errorMutex};
+          if (!error) { error = std::current_exception(); }
+          next = count;
+        }
+      }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t worker {1}; worker < jobs; ++worker) {
+      workers.emplace_back(work);
+    }
+    work();
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (error) { std::rethrow_exception(error); }
+
+    std::vector<T> results;
+    results.reserve(count);
+    for (auto& result : parsed) {
+      results.emplace_back(std::move(*result));
+    }
+    return results;
+  }
+
+
   class DummyParser :
     public qi::grammar<IstreamIter>
   {
@@ -0,0 +1,121 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <numeric>
+
+#include <netmeld/datastore/parsers/ParserHelper.hpp>
+
+namespace nmdp = netmeld::datastore::parsers;
+
+
+namespace {
+  std::string
+  join(const std::vector<std::string>& segments)
+  {
+    return std::accumulate(segments.cbegin(), segments.cend(), std::string());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSplitLines)
+{
+  const std::string data {
+      "a 1\n"
+      " a 2\n"
+      "b 1\n"
+      " b 2\n"
+      " b 3\n"
+      "c 1\n"
+    };
+  const auto atTopLevel {[](std::string_view, std::string_view line)
+                         { return !line.starts_with(" "); }};
+
+  {
+    const auto segments {nmdp::splitLines(data, 1, atTopLevel)};
+    BOOST_TEST(1 == segments.size());
+    BOOST_TEST(data == segments[0]);
+  }
+
+  for (size_t count {2}; count < 8; ++count) {
+    const auto segments {nmdp::splitLines(data, count, atTopLevel)};
+    BOOST_TEST(segments.size() <= count);
+    BOOST_TEST(data == join(segments));
+    for (const auto& segment : segments) {
+      BOOST_TEST(!segment.starts_with(" "));
+    }
+  }
+
+  {
+    const auto segments {nmdp::splitLines(data, 3, atTopLevel)};
+    BOOST_TEST_REQUIRE(3 == segments.size());
+    BOOST_TEST("a 1\n a 2\n" == segments[0]);
+    BOOST_TEST("b 1\n b 2\n b 3\n" == segments[1]);
+    BOOST_TEST("c 1\n" == segments[2]);
+  }
+
+  {
+    const auto never {[](std::string_view, std::string_view)
+                      { return false; }};
+    const auto segments {nmdp::splitLines(data, 4, never)};
+    BOOST_TEST(1 == segments.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSplitBlocks)
+{
+  const std::string data {
+      "a {\n"
+      "  b { c; }\n"
+      "}\n"
+      "d \"{\" {\n"
+      "  # }\n"
+      "  /* }\n"
+      "  } */\n"
+      "  e;\n"
+      "}\n"
+      "f;\n"
+    };
+
+  for (size_t count {1}; count < 8; ++count) {
+    const auto segments {nmdp::splitBlocks(data, count)};
+    BOOST_TEST(segments.size() <= count);
+    BOOST_TEST(data == join(segments));
+    for (const auto& segment : segments) {
+      BOOST_TEST((  segment.starts_with("a ")
+                 || segment.starts_with("d ")
+                 || segment.starts_with("f;")));
+    }
+  }
+
+  {
+    const auto segments {nmdp::splitBlocks(data, 4)};
+    BOOST_TEST_REQUIRE(3 == segments.size());
+    BOOST_TEST("a {\n  b { c; }\n}\n" == segments[0]);
+    BOOST_TEST("f;\n" == segments[2]);
+  }
+}
@@ -121,6 +121,30 @@ IMMUTABLE
 ;
 
 
+-- ----------------------------------------------------------------------
+-- ----------------------------------------------------------------------
+-- MAC_TRUNC(MACADDR, INT)
+--
+-- This function provides the leading `bits` bits of a MAC address,
+-- with the remainder zeroed, for matching against MAC prefix
+-- assignments (24-bit MA-L, 28-bit MA-M, and 36-bit MA-S).  The
+-- number of bits is expected to be a multiple of four.
+-- ----------------------------------------------------------------------
+
+CREATE OR REPLACE FUNCTION mac_trunc(
+    mac       MACADDR
+  , bits      INT
+)
+RETURNS MACADDR
+AS $$
+  SELECT mac & rpad(repeat('f', bits / 4), 12, '0')::MACADDR;
+$$
+LANGUAGE SQL
+PARALLEL SAFE
+IMMUTABLE
+;
+
+
 -- ----------------------------------------------------------------------
 
 COMMIT TRANSACTION;
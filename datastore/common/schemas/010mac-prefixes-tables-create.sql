@@ -28,11 +28,15 @@ BEGIN TRANSACTION;
 
 -- ----------------------------------------------------------------------
 
+-- Holds MA-L (24-bit), MA-M (28-bit), and MA-S (36-bit) assignments.
+-- A MAC's vendor is that of its longest matching prefix.
 CREATE TABLE vendor_mac_prefixes (
     mac_prefix                  MACADDR         NOT NULL
+  , prefix_length               INT             NOT NULL
   , vendor_name                 TEXT            NOT NULL
-  , PRIMARY KEY (mac_prefix)
-  , CHECK (trunc(mac_prefix) = mac_prefix)
+  , PRIMARY KEY (mac_prefix, prefix_length)
+  , CHECK (prefix_length IN (24, 28, 36))
+  , CHECK (mac_trunc(mac_prefix, prefix_length) = mac_prefix)
 );
 
 
@@ -189,6 +189,21 @@ CREATE INDEX tool_run_ip_routes_idx_views
 ON tool_run_ip_routes(interface_name, dst_ip_net, next_hop_ip_addr);
 
 
+-- ----------------------------------------------------------------------
+-- Timings recorded by a tool run with `--profile-store` (see `--profile`).
+-- ----------------------------------------------------------------------
+
+CREATE TABLE tool_run_profiles (
+    tool_run_id                 UUID            NOT NULL
+  , profile                     JSONB           NOT NULL
+  , PRIMARY KEY (tool_run_id)
+  , FOREIGN KEY (tool_run_id)
+        REFERENCES tool_runs(id)
+        ON DELETE CASCADE
+        ON UPDATE CASCADE
+);
+
+
 -- ----------------------------------------------------------------------
 
 COMMIT TRANSACTION;
@@ -30,10 +30,13 @@ BEGIN TRANSACTION;
 -- MAC Addresses of target systems
 -- ----------------------------------------------------------------------
 
+-- vendor_name is resolved at ingest, when the importer is able to,
+-- otherwise it is resolved from vendor_mac_prefixes by the views.
 CREATE TABLE raw_mac_addrs (
     tool_run_id                 UUID            NOT NULL
   , mac_addr                    MACADDR         NOT NULL
   , is_responding               BOOLEAN         NULL
+  , vendor_name                 TEXT            NULL
   , PRIMARY KEY (tool_run_id, mac_addr)
   , FOREIGN KEY (tool_run_id)
         REFERENCES tool_runs(id)
@@ -75,6 +78,10 @@ ON raw_ip_addrs(tool_run_id);
 CREATE INDEX raw_ip_addrs_idx_ip_addr
 ON raw_ip_addrs(ip_addr);
 
+-- Containment (<<=) capable index for host addresses
+CREATE INDEX raw_ip_addrs_idx_ip_addr_spgist
+ON raw_ip_addrs USING SPGIST (ip_addr inet_ops);
+
 CREATE INDEX raw_ip_addrs_idx_is_responding
 ON raw_ip_addrs(is_responding);
 
@@ -282,6 +289,10 @@ ON raw_ip_nets(tool_run_id);
 CREATE INDEX raw_ip_nets_idx_ip_net
 ON raw_ip_nets(ip_net);
 
+-- Containment (<<, >>) capable index for the overlapping networks view
+CREATE INDEX raw_ip_nets_idx_ip_net_gist
+ON raw_ip_nets USING GIST (ip_net inet_ops);
+
 
 -- ----------------------------------------------------------------------
 
@@ -428,6 +439,9 @@ ON raw_ports(tool_run_id);
 CREATE INDEX raw_ports_idx_ip_addr
 ON raw_ports(ip_addr);
 
+CREATE INDEX raw_ports_idx_ip_addr_spgist
+ON raw_ports USING SPGIST (ip_addr inet_ops);
+
 CREATE INDEX raw_ports_idx_protocol
 ON raw_ports(protocol);
 
@@ -863,6 +877,7 @@ CREATE TABLE raw_tool_observations (
     tool_run_id                 UUID            NOT NULL
   , category                    TEXT            NOT NULL
   , observation                 TEXT            NOT NULL
+  , occurrences                 INT             NOT NULL DEFAULT 1
   , PRIMARY KEY (tool_run_id, category, observation)
   , FOREIGN KEY (tool_run_id)
       REFERENCES tool_runs(id)
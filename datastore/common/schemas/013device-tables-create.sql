@@ -323,9 +323,17 @@ ON raw_device_ip_addrs(interface_name);
 CREATE INDEX raw_device_ip_addrs_idx_ip_addr
 ON raw_device_ip_addrs(ip_addr);
 
+-- Containment/overlap (<<=, >>=, &&) capable indexes; B-tree can't serve
+-- those operators.  SP-GiST suits host addresses, GiST suits networks.
+CREATE INDEX raw_device_ip_addrs_idx_ip_addr_spgist
+ON raw_device_ip_addrs USING SPGIST (ip_addr inet_ops);
+
 CREATE INDEX raw_device_ip_addrs_idx_ip_net
 ON raw_device_ip_addrs(ip_net);
 
+CREATE INDEX raw_device_ip_addrs_idx_ip_net_gist
+ON raw_device_ip_addrs USING GIST (ip_net inet_ops);
+
 CREATE INDEX raw_device_ip_addrs_idx_device_id_interface_name
 ON raw_device_ip_addrs(device_id, interface_name);
 
@@ -479,6 +487,10 @@ ON raw_device_ip_routes(is_active);
 CREATE INDEX raw_device_ip_routes_idx_dst_ip_net
 ON raw_device_ip_routes(dst_ip_net);
 
+-- Route lookups by destination overlap (e.g., `$1 && dst_ip_net`)
+CREATE INDEX raw_device_ip_routes_idx_dst_ip_net_gist
+ON raw_device_ip_routes USING GIST (dst_ip_net inet_ops);
+
 CREATE INDEX raw_device_ip_routes_idx_next_vrf_id
 ON raw_device_ip_routes(next_vrf_id);
 
@@ -488,6 +500,9 @@ ON raw_device_ip_routes(next_table_id);
 CREATE INDEX raw_device_ip_routes_idx_next_hop_ip_addr
 ON raw_device_ip_routes(next_hop_ip_addr);
 
+CREATE INDEX raw_device_ip_routes_idx_next_hop_ip_addr_spgist
+ON raw_device_ip_routes USING SPGIST (next_hop_ip_addr inet_ops);
+
 CREATE INDEX raw_device_ip_routes_idx_outgoing_interface_name
 ON raw_device_ip_routes(outgoing_interface_name);
 
@@ -1380,6 +1395,9 @@ ON raw_device_acl_ip_nets_ip_nets(ip_net_set_id);
 CREATE INDEX raw_device_acl_ip_nets_ip_nets_idx_ip_net
 ON raw_device_acl_ip_nets_ip_nets(ip_net);
 
+CREATE INDEX raw_device_acl_ip_nets_ip_nets_idx_ip_net_gist
+ON raw_device_acl_ip_nets_ip_nets USING GIST (ip_net inet_ops);
+
 -- Index the primary key without tool_run_id (if not already indexed).
 -- Helps the views that ignore the tool_run_id.
 CREATE INDEX raw_device_acl_ip_nets_ip_nets_idx_views
@@ -2075,6 +2093,9 @@ ON raw_device_vlans_ip_nets(vlan);
 CREATE INDEX raw_device_vlans_ip_nets_idx_ip_net
 ON raw_device_vlans_ip_nets(ip_net);
 
+CREATE INDEX raw_device_vlans_ip_nets_idx_ip_net_gist
+ON raw_device_vlans_ip_nets USING GIST (ip_net inet_ops);
+
 -- Index the primary key without tool_run_id (if not already indexed).
 -- Helps the views that ignore the tool_run_id.
 CREATE INDEX raw_device_vlans_ip_nets_idx_views
@@ -43,10 +43,24 @@ CREATE VIEW raw_mac_addrs_vendors AS
 SELECT
     ma.tool_run_id              AS tool_run_id,
     ma.mac_addr                 AS mac_addr,
-    vmp.vendor_name             AS vendor_name
+    COALESCE(ma.vendor_name, vmp.vendor_name)
+                                AS vendor_name
 FROM raw_mac_addrs AS ma
-JOIN vendor_mac_prefixes AS vmp
-ON (trunc(ma.mac_addr) = vmp.mac_prefix)
+LEFT JOIN LATERAL (
+    -- Longest prefix match, only if not resolved at ingest
+    SELECT
+        vendor_name
+    FROM vendor_mac_prefixes
+    WHERE (ma.vendor_name IS NULL) AND
+          ((mac_prefix, prefix_length) IN (
+             (mac_trunc(ma.mac_addr, 36), 36),
+             (mac_trunc(ma.mac_addr, 28), 28),
+             (mac_trunc(ma.mac_addr, 24), 24)))
+    ORDER BY prefix_length DESC
+    LIMIT 1
+  ) AS vmp
+ON true
+WHERE (COALESCE(ma.vendor_name, vmp.vendor_name) IS NOT NULL)
 ;
 
 
@@ -668,14 +682,16 @@ FROM raw_hotfixes
 -- ----------------------------------------------------------------------
 
 CREATE VIEW tool_observations AS
-SELECT DISTINCT
+SELECT
     tr.tool_name                AS tool_name
   , tr.data_path                AS data_path
   , rto.category                AS category
   , rto.observation             AS observation
+  , SUM(rto.occurrences)        AS occurrences
 FROM raw_tool_observations AS rto
 LEFT OUTER JOIN tool_runs AS tr
    ON (rto.tool_run_id = tr.id)
+GROUP BY tr.tool_name, tr.data_path, rto.category, rto.observation
 ;
 
 -- ----------------------------------------------------------------------
@@ -368,6 +368,10 @@ WITH RECURSIVE device_ip_route_recursion (
               )
             OR (outgoing_interface_name IS NULL)
             )
+        -- Every hop must route towards the destination.  Filtering here,
+        -- rather than in each case, lets it reach the dst_ip_net indexes
+        -- before cte1 is materialized.
+        AND ($2 && dst_ip_net)
     )
     -- Base case: First router in path to destination.
     SELECT DISTINCT
@@ -395,7 +399,6 @@ WITH RECURSIVE device_ip_route_recursion (
         )::RouteHop]                                  AS route_path_detail
     FROM cte1 AS route_conns
     WHERE ($1 && route_conns.incoming_ip_net)
-      AND ($2 && route_conns.dst_ip_net)
     UNION ALL
     -- Recursive case: Move current router one hop downstream.
     SELECT DISTINCT
@@ -435,7 +438,6 @@ WITH RECURSIVE device_ip_route_recursion (
      AND (route_recur.next_hop_incoming_ip_net && route_conns.incoming_ip_net)
      AND (route_recur.dst_ip_net && route_conns.dst_ip_net)
     WHERE (route_conns.device_id != ALL(route_path))
-      AND ($2 && route_conns.dst_ip_net)
 )
 -- Filter results
 SELECT
@@ -1126,6 +1128,68 @@ LEFT JOIN device_acl_ip_nets_recursion AS acl_recur
 ;
 
 
+-- ----------------------------------------------------------------------
+-- Same sets `device_acl_ip_nets` would report as overlapping `arg_ip_net`,
+-- but starting from the overlapping networks and walking the includes up
+-- instead of expanding every set first.  The recursive view is an
+-- optimization fence, this lets the containment indexes be used.
+
+CREATE OR REPLACE FUNCTION device_acl_ip_net_sets_overlapping (
+    arg_device_id TEXT
+  , arg_ip_net INET
+)
+RETURNS TABLE (
+    ip_net_set_namespace    TEXT
+  , ip_net_set_id           TEXT
+) AS $$
+WITH RECURSIVE device_acl_ip_nets_recursion(
+    ip_net_set_namespace
+  , ip_net_set_id
+) AS (
+    -- Base case: sets directly containing an overlapping network
+    SELECT DISTINCT
+        acl_ip_nets.ip_net_set_namespace    AS ip_net_set_namespace
+      , acl_ip_nets.ip_net_set_id           AS ip_net_set_id
+    FROM raw_device_acl_ip_nets_ip_nets AS acl_ip_nets
+    WHERE (acl_ip_nets.device_id = $1)
+      AND (acl_ip_nets.ip_net && $2)
+    UNION
+    SELECT DISTINCT
+        acl_hostnames.ip_net_set_namespace  AS ip_net_set_namespace
+      , acl_hostnames.ip_net_set_id         AS ip_net_set_id
+    FROM raw_device_acl_ip_nets_hostnames AS acl_hostnames
+    JOIN device_dns_ip_addrs AS dns_ip_addrs
+      ON (acl_hostnames.device_id = dns_ip_addrs.device_id)
+     AND (acl_hostnames.hostname  = dns_ip_addrs.hostname)
+    WHERE (acl_hostnames.device_id = $1)
+      AND (dns_ip_addrs.ip_addr::CIDR && $2)
+    UNION
+    -- Recursive case: sets including an already found set
+    SELECT DISTINCT
+        acl_includes.ip_net_set_namespace   AS ip_net_set_namespace
+      , acl_includes.ip_net_set_id          AS ip_net_set_id
+    FROM device_acl_ip_nets_recursion AS acl_recur
+    JOIN raw_device_acl_ip_nets_includes AS acl_includes
+      ON (  (acl_recur.ip_net_set_namespace  = acl_includes.included_namespace)
+         OR (acl_includes.included_namespace = '')
+         )
+     AND (acl_recur.ip_net_set_id         = acl_includes.included_id)
+    WHERE (acl_includes.device_id = $1)
+)
+SELECT DISTINCT
+    acl_bases.ip_net_set_namespace          AS ip_net_set_namespace
+  , acl_bases.ip_net_set_id                 AS ip_net_set_id
+FROM raw_device_acl_ip_nets_bases AS acl_bases
+JOIN device_acl_ip_nets_recursion AS acl_recur
+  ON (acl_bases.ip_net_set_namespace  = acl_recur.ip_net_set_namespace)
+ AND (acl_bases.ip_net_set_id         = acl_recur.ip_net_set_id)
+WHERE (acl_bases.device_id = $1)
+$$
+LANGUAGE SQL
+STABLE
+;
+
+
 -- ----------------------------------------------------------------------
 
 CREATE VIEW device_acl_ports AS
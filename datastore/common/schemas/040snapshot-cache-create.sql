@@ -0,0 +1,328 @@
+-- =============================================================================
+-- Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+-- (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+-- Government retains certain rights in this software.
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+-- =============================================================================
+-- Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+BEGIN TRANSACTION;
+
+-- ----------------------------------------------------------------------
+-- Snapshots of the heavy views used by the graph and export tools.
+--
+-- With `--snapshot-cache`, those tools call SNAPSHOT_REFRESH() for each
+-- view they query and then put the "snapshot" schema first in their
+-- search_path, so the unchanged queries read the snapshot (an unlogged
+-- table) instead of re-running the view.  A snapshot is only rebuilt when
+-- SNAPSHOT_DATA_KEY() changes, i.e., a transaction wrote to a table some
+-- snapshot (or cached result) depends on since it was taken.  Only those
+-- tables are tracked, so writes elsewhere (e.g., most imports) cost nothing.
+-- ----------------------------------------------------------------------
+
+CREATE SCHEMA snapshot;
+
+-- One row per committed transaction that wrote to a tracked table, added
+-- by the SNAPSHOT_DATA_CHANGED triggers (see SNAPSHOT_TRACK_CHANGES()).
+CREATE UNLOGGED TABLE snapshot.data_changes (
+    transaction_id              BIGINT          NOT NULL
+  , PRIMARY KEY (transaction_id)
+);
+
+CREATE UNLOGGED TABLE snapshot.snapshot_keys (
+    relation                    TEXT            NOT NULL
+  , run_key                     TEXT            NOT NULL
+  , refreshed                   TIMESTAMP       NOT NULL
+  , PRIMARY KEY (relation)
+);
+
+-- Output of nmdb-analyze-data `sql` procedures (see `--result-cache`),
+-- keyed by the MD5 of the query and reused while the run_key matches.
+CREATE UNLOGGED TABLE snapshot.analyze_results (
+    procedure_key               TEXT            NOT NULL
+  , run_key                     TEXT            NOT NULL
+  , output                      TEXT            NOT NULL
+  , refreshed                   TIMESTAMP       NOT NULL
+  , PRIMARY KEY (procedure_key)
+);
+
+
+-- ----------------------------------------------------------------------
+-- SNAPSHOT_DATA_KEY()
+--
+-- Identifies the data currently in the datastore.  Rows of data_changes are
+-- only ever added and become visible with the data they cover, so the count
+-- grows with every committed write to a tracked table (whatever its tool
+-- run) and a key read before a snapshot is taken is never newer than the
+-- snapshot.
+-- ----------------------------------------------------------------------
+CREATE OR REPLACE FUNCTION snapshot_data_key()
+RETURNS TEXT
+AS $$
+  SELECT COUNT(*)::TEXT
+  FROM snapshot.data_changes
+$$
+LANGUAGE sql
+STABLE
+;
+
+
+-- ----------------------------------------------------------------------
+-- SNAPSHOT_RECORD_CHANGE()
+--
+-- Statement level trigger function noting the current transaction in
+-- snapshot.data_changes.  Only the first write of a transaction inserts;
+-- the rest are skipped through a transaction local setting.
+-- ----------------------------------------------------------------------
+CREATE OR REPLACE FUNCTION snapshot_record_change()
+RETURNS TRIGGER
+AS $$
+BEGIN
+  IF (TXID_CURRENT()::TEXT
+      = COALESCE(CURRENT_SETTING('netmeld.snapshot_change', true), ''))
+  THEN
+    RETURN NULL;
+  END IF;
+
+  INSERT INTO snapshot.data_changes
+    (transaction_id)
+  VALUES (TXID_CURRENT())
+  ON CONFLICT DO NOTHING
+  ;
+  PERFORM SET_CONFIG('netmeld.snapshot_change', TXID_CURRENT()::TEXT, true);
+
+  RETURN NULL;
+END;
+$$
+LANGUAGE plpgsql
+VOLATILE
+;
+
+
+-- ----------------------------------------------------------------------
+-- SNAPSHOT_TRACK_CHANGES()
+--
+-- Add the SNAPSHOT_DATA_CHANGED trigger to every public table the query
+-- may read, so any insert, update, delete, or truncate of them changes
+-- SNAPSHOT_DATA_KEY().  The tables are found from the relations and
+-- functions the query names, following view definitions and function
+-- bodies; a name only has to appear, so this errs towards tracking more.
+-- Triggers are never removed, so anything built after tracking its query
+-- is outdated by the next write to its tables.
+-- ----------------------------------------------------------------------
+CREATE OR REPLACE FUNCTION snapshot_track_changes(arg_query TEXT)
+RETURNS VOID
+AS $$
+DECLARE
+  public_namespace CONSTANT OID := 'public'::REGNAMESPACE;
+  relation_class   CONSTANT OID := 'pg_catalog.pg_class'::REGCLASS;
+  function_class   CONSTANT OID := 'pg_catalog.pg_proc'::REGCLASS;
+  relations     OID[];
+  functions     OID[];
+  new_relations OID[];
+  new_functions OID[];
+  tracked_table TEXT;
+BEGIN
+  SELECT COALESCE(ARRAY_AGG(c.oid), '{}')
+  INTO new_relations
+  FROM pg_catalog.pg_class AS c
+  WHERE (c.relnamespace = public_namespace)
+    AND (c.relkind IN ('r', 'p', 'v', 'm'))
+    AND (arg_query ~ ('\m' || c.relname || '\M'))
+  ;
+  SELECT COALESCE(ARRAY_AGG(p.oid), '{}')
+  INTO new_functions
+  FROM pg_catalog.pg_proc AS p
+  WHERE (p.pronamespace = public_namespace)
+    AND (arg_query ~ ('\m' || p.proname || '\M'))
+  ;
+  relations := new_relations;
+  functions := new_functions;
+
+  WHILE (0 < CARDINALITY(new_relations) + CARDINALITY(new_functions)) LOOP
+    WITH referenced(class_id, object_id) AS (
+        -- By the definitions of views (and materialized views)
+        SELECT d.refclassid, d.refobjid
+        FROM pg_catalog.pg_rewrite AS r
+        JOIN pg_catalog.pg_depend AS d
+          ON (d.classid = 'pg_catalog.pg_rewrite'::REGCLASS)
+         AND (d.objid = r.oid)
+        WHERE (r.ev_class = ANY(new_relations))
+      UNION
+        -- By name, in function bodies (not recorded as dependencies)
+        SELECT relation_class, c.oid
+        FROM pg_catalog.pg_proc AS p
+        JOIN pg_catalog.pg_class AS c
+          ON (c.relnamespace = public_namespace)
+         AND (c.relkind IN ('r', 'p', 'v', 'm'))
+         AND (p.prosrc ~ ('\m' || c.relname || '\M'))
+        WHERE (p.oid = ANY(new_functions))
+      UNION
+        SELECT function_class, f.oid
+        FROM pg_catalog.pg_proc AS p
+        JOIN pg_catalog.pg_proc AS f
+          ON (f.pronamespace = public_namespace)
+         AND (p.prosrc ~ ('\m' || f.proname || '\M'))
+        WHERE (p.oid = ANY(new_functions))
+    )
+    SELECT
+        COALESCE(ARRAY_AGG(DISTINCT object_id)
+                   FILTER (WHERE (class_id = relation_class)
+                             AND NOT (object_id = ANY(relations))),
+                 '{}')
+      , COALESCE(ARRAY_AGG(DISTINCT object_id)
+                   FILTER (WHERE (class_id = function_class)
+                             AND NOT (object_id = ANY(functions))),
+                 '{}')
+    INTO new_relations, new_functions
+    FROM referenced
+    ;
+    relations := relations || new_relations;
+    functions := functions || new_functions;
+  END LOOP;
+
+  FOR tracked_table IN
+    SELECT c.relname
+    FROM pg_catalog.pg_class AS c
+    WHERE (c.oid = ANY(relations))
+      AND (c.relnamespace = public_namespace)
+      AND (c.relkind IN ('r', 'p'))
+      AND NOT EXISTS (SELECT 1
+                      FROM pg_catalog.pg_trigger AS t
+                      WHERE (t.tgrelid = c.oid)
+                        AND (t.tgname = 'snapshot_data_changed')
+                     )
+  LOOP
+    -- Concurrent tools could add the same trigger
+    PERFORM PG_ADVISORY_XACT_LOCK(HASHTEXT('snapshot_refresh'));
+    CONTINUE WHEN EXISTS (SELECT 1
+                          FROM pg_catalog.pg_trigger AS t
+                          WHERE (t.tgrelid = FORMAT('public.%I',
+                                                    tracked_table)::REGCLASS)
+                            AND (t.tgname = 'snapshot_data_changed')
+                         );
+
+    EXECUTE FORMAT('CREATE TRIGGER snapshot_data_changed'
+                   ' AFTER INSERT OR UPDATE OR DELETE OR TRUNCATE'
+                   ' ON public.%I'
+                   ' FOR EACH STATEMENT'
+                   ' EXECUTE FUNCTION snapshot_record_change()',
+                   tracked_table);
+  END LOOP;
+END;
+$$
+LANGUAGE plpgsql
+VOLATILE
+;
+
+
+-- ----------------------------------------------------------------------
+-- SNAPSHOT_REFRESH()
+--
+-- Rebuild snapshot.<relation> from public.<relation>, if the snapshot is
+-- missing or older than the current data.  Each index argument is
+-- the remainder of a CREATE INDEX on the snapshot, e.g., '(device_id)'
+-- or 'USING GIST (ip_net inet_ops)'.  Returns whether it was rebuilt.
+-- ----------------------------------------------------------------------
+CREATE OR REPLACE FUNCTION snapshot_refresh(
+    arg_relation TEXT
+  , VARIADIC arg_indexes TEXT[] DEFAULT '{}'
+)
+RETURNS BOOLEAN
+AS $$
+DECLARE
+  current_key TEXT;
+  index_definition TEXT;
+BEGIN
+  IF (TO_REGCLASS(FORMAT('public.%I', arg_relation)) IS NULL) THEN
+    RAISE EXCEPTION 'Cannot snapshot unknown relation: %', arg_relation;
+  END IF;
+
+  -- Concurrent tools wait for, then reuse, a snapshot being rebuilt
+  PERFORM PG_ADVISORY_XACT_LOCK(HASHTEXT('snapshot_refresh'));
+
+  -- Before reading the key, so it covers every write the snapshot sees
+  PERFORM snapshot_track_changes(FORMAT('SELECT * FROM public.%I',
+                                        arg_relation));
+  current_key := snapshot_data_key();
+  IF (    TO_REGCLASS(FORMAT('snapshot.%I', arg_relation)) IS NOT NULL
+      AND EXISTS (SELECT 1
+                  FROM snapshot.snapshot_keys
+                  WHERE (arg_relation = relation)
+                    AND (current_key = run_key)
+                 )
+     ) THEN
+    RETURN false;
+  END IF;
+
+  EXECUTE FORMAT('DROP TABLE IF EXISTS snapshot.%I', arg_relation);
+  EXECUTE FORMAT('CREATE UNLOGGED TABLE snapshot.%I AS SELECT * FROM public.%I',
+                 arg_relation, arg_relation);
+  FOREACH index_definition IN ARRAY arg_indexes LOOP
+    EXECUTE FORMAT('CREATE INDEX ON snapshot.%I %s',
+                   arg_relation, index_definition);
+  END LOOP;
+  EXECUTE FORMAT('ANALYZE snapshot.%I', arg_relation);
+
+  INSERT INTO snapshot.snapshot_keys
+    (relation, run_key, refreshed)
+  VALUES (arg_relation, current_key, NOW())
+  ON CONFLICT (relation) DO UPDATE
+  SET run_key   = EXCLUDED.run_key
+    , refreshed = EXCLUDED.refreshed
+  ;
+
+  RETURN true;
+END;
+$$
+LANGUAGE plpgsql
+VOLATILE
+;
+
+
+-- ----------------------------------------------------------------------
+-- SNAPSHOT_CLEAR()
+--
+-- Drop all snapshots and cached results, e.g., after redefining a view
+-- or function they depend on.
+-- ----------------------------------------------------------------------
+CREATE OR REPLACE FUNCTION snapshot_clear()
+RETURNS VOID
+AS $$
+DECLARE
+  snapshot_relation TEXT;
+BEGIN
+  PERFORM PG_ADVISORY_XACT_LOCK(HASHTEXT('snapshot_refresh'));
+
+  FOR snapshot_relation IN
+    SELECT relation FROM snapshot.snapshot_keys
+  LOOP
+    EXECUTE FORMAT('DROP TABLE IF EXISTS snapshot.%I', snapshot_relation);
+  END LOOP;
+  DELETE FROM snapshot.snapshot_keys;
+  DELETE FROM snapshot.analyze_results;
+END;
+$$
+LANGUAGE plpgsql
+VOLATILE
+;
+
+
+COMMIT TRANSACTION;
@@ -0,0 +1,122 @@
+-- =============================================================================
+-- Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+-- (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+-- Government retains certain rights in this software.
+--
+-- Permission is hereby granted, free of charge, to any person obtaining a copy
+-- of this software and associated documentation files (the "Software"), to deal
+-- in the Software without restriction, including without limitation the rights
+-- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+-- copies of the Software, and to permit persons to whom the Software is
+-- furnished to do so, subject to the following conditions:
+--
+-- The above copyright notice and this permission notice shall be included in
+-- all copies or substantial portions of the Software.
+--
+-- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+-- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+-- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+-- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+-- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+-- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+-- SOFTWARE.
+-- =============================================================================
+-- Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+BEGIN TRANSACTION;
+
+-- ----------------------------------------------------------------------
+-- Installed packages affected by CVEs, as found by nmdb-analyze-packages
+-- from a local vulnerability feed.
+--
+-- A match is stored once per package manager, package name, and version
+-- rather than per device; many hosts share the same package versions, so
+-- this keeps the table near the size of the distinct packages.  The
+-- DEVICE_PACKAGE_CVES view joins the matches back to the devices through
+-- raw_packages.
+-- ----------------------------------------------------------------------
+
+CREATE TABLE raw_package_cves (
+    tool_run_id                 UUID            NOT NULL
+  , package_manager             TEXT            NOT NULL
+  , package_name                TEXT            NOT NULL
+  , package_version             TEXT            NOT NULL
+  , cve_id                      CVE             NOT NULL
+  , PRIMARY KEY (tool_run_id, package_manager, package_name
+                , package_version, cve_id
+                )
+  , FOREIGN KEY (tool_run_id)
+        REFERENCES tool_runs(id)
+        ON DELETE CASCADE
+        ON UPDATE CASCADE
+);
+
+-- Partial indexes
+CREATE INDEX raw_package_cves_idx_tool_run_id
+ON raw_package_cves(tool_run_id);
+
+CREATE INDEX raw_package_cves_idx_cve_id
+ON raw_package_cves(cve_id);
+
+-- Index the primary key without tool_run_id (if not already indexed).
+-- Helps the views that ignore the tool_run_id.
+CREATE INDEX raw_package_cves_idx_views
+ON raw_package_cves(package_name, package_version, package_manager, cve_id);
+
+
+-- ----------------------------------------------------------------------
+-- PACKAGE_MANAGER_OF_TOOL(TEXT)
+--
+-- The package manager (as in raw_package_cves) whose packages the named
+-- import tool saves into raw_packages; NULL for any other tool.
+-- ----------------------------------------------------------------------
+CREATE OR REPLACE FUNCTION package_manager_of_tool(
+    arg_tool_name TEXT
+)
+RETURNS TEXT
+AS $$
+  SELECT
+    CASE arg_tool_name
+    WHEN 'nmdb-import-dpkg'       THEN 'dpkg'
+    WHEN 'nmdb-import-rpm-query'  THEN 'rpm'
+    WHEN 'nmdb-import-apk'        THEN 'apk'
+    END
+$$
+LANGUAGE sql
+PARALLEL SAFE
+IMMUTABLE
+;
+
+
+-- ----------------------------------------------------------------------
+CREATE VIEW package_cves AS
+SELECT DISTINCT
+    package_manager             AS package_manager,
+    package_name                AS package_name,
+    package_version             AS package_version,
+    cve_id                      AS cve_id
+FROM raw_package_cves
+;
+
+
+-- ----------------------------------------------------------------------
+CREATE VIEW device_package_cves AS
+SELECT DISTINCT
+    rd.device_id                AS device_id,
+    rp.package_name             AS package_name,
+    rp.package_version          AS package_version,
+    rp.package_architecture     AS package_architecture,
+    rpc.cve_id                  AS cve_id
+FROM raw_devices AS rd
+JOIN raw_packages AS rp
+    ON (rd.tool_run_id = rp.tool_run_id)
+JOIN tool_runs AS tr
+    ON (rp.tool_run_id = tr.id)
+JOIN raw_package_cves AS rpc
+    ON (rp.package_name = rpc.package_name)
+   AND (rp.package_version = rpc.package_version)
+   AND (package_manager_of_tool(tr.tool_name) = rpc.package_manager)
+;
+
+
+COMMIT TRANSACTION;
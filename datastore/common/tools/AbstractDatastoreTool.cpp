@@ -25,6 +25,7 @@
 // =============================================================================
 
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 
 namespace netmeld::datastore::tools {
@@ -43,6 +44,19 @@ namespace netmeld::datastore::tools {
     nmct::AbstractTool(_helpBlurb, _programName, _version)
   {}
 
+  AbstractDatastoreTool::~AbstractDatastoreTool()
+  {
+    if (!profiler.isEnabled()) {
+      return;
+    }
+
+    try {
+      profiler.write(opts.getValue("profile"));
+    } catch (std::exception& e) {
+      LOG_ERROR << "Failed to write profile: " << e.what() << std::endl;
+    }
+  }
+
 
   // ===========================================================================
   // Tool Entry Points (execution order)
@@ -61,6 +75,12 @@ namespace netmeld::datastore::tools {
           "Additional database connection args."
           " Space separated `key=value` libpqxx connection string parameters.")
         );
+    opts.addOptionalOption("profile", std::make_tuple(
+          "profile",
+          po::value<std::string>()->implicit_value("-"),
+          "Write phase, statement, and table timings as JSON to the file"
+          " (standard error if no file given) on exit.")
+        );
   }
 
 
@@ -87,6 +107,43 @@ namespace netmeld::datastore::tools {
         );
   }
 
+  void
+  AbstractDatastoreTool::addDbWriteOptions()
+  {
+    opts.addAdvancedOption("db-pipeline", std::make_tuple(
+          "db-pipeline",
+          po::value<size_t>()->default_value(0),
+          "Keep up to this many inserts in flight instead of waiting on each;"
+          " useful with remote databases.  0 disables.")
+        );
+    opts.addAdvancedOption("no-insert-cache", std::make_tuple(
+          "no-insert-cache",
+          NULL_SEMANTIC,
+          "Send every insert, even exact repeats within the transaction.")
+        );
+  }
+
+  void
+  AbstractDatastoreTool::addProfileStoreOption()
+  {
+    opts.addAdvancedOption("profile-store", std::make_tuple(
+          "profile-store",
+          NULL_SEMANTIC,
+          "With --profile, also store the report with the tool run.")
+        );
+  }
+
+  void
+  AbstractDatastoreTool::addSnapshotCacheOption()
+  {
+    opts.addOptionalOption("snapshot-cache", std::make_tuple(
+          "snapshot-cache",
+          NULL_SEMANTIC,
+          "Reuse snapshots of the views queried, rebuilding them only after"
+          " the data store changes.")
+        );
+  }
+
   const std::string
   AbstractDatastoreTool::getDbName() const
   {
@@ -112,4 +169,82 @@ namespace netmeld::datastore::tools {
     }
     return oss.str();
   }
+
+  size_t
+  AbstractDatastoreTool::getDbPipelineDepth() const
+  {
+    if (!opts.exists("db-pipeline")) {
+      return 0;
+    }
+    return opts.getValueAs<size_t>("db-pipeline");
+  }
+
+  void
+  AbstractDatastoreTool::profilePhase(const std::string& name)
+  {
+    if (!opts.exists("profile")) {
+      return;
+    }
+    if (!profiler.isEnabled()) {
+      profiler.enable();
+    }
+    profiler.mark(name);
+  }
+
+  void
+  AbstractDatastoreTool::profileBatch(pqxx::transaction_base& t)
+  {
+    if (!profiler.isEnabled()) {
+      return;
+    }
+
+    profiler.addTableCounts(t);
+  }
+
+  void
+  AbstractDatastoreTool::profileCommitted(const nmco::Uuid& toolRunId)
+  {
+    if (!profiler.isEnabled()) {
+      return;
+    }
+
+    // Row counts are per transaction, so only those of any batches are known
+    LOG_DEBUG << "Tool committed its own transaction(s)\n";
+    if (opts.exists("profile-store")) {
+      pqxx::connection db {getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+      pqxx::work t {db};
+      nmdu::execPrepared(t, "insert_tool_run_profile",
+                         toolRunId,
+                         profiler.toJson().dump());
+      t.commit();
+    }
+  }
+
+  void
+  AbstractDatastoreTool::profileTransaction(pqxx::transaction_base& t,
+                                            const nmco::Uuid& toolRunId)
+  {
+    if (!profiler.isEnabled()) {
+      return;
+    }
+
+    profiler.addTableCounts(t);
+    if (opts.exists("profile-store")) {
+      nmdu::execPrepared(t, "insert_tool_run_profile",
+                         toolRunId,
+                         profiler.toJson().dump());
+    }
+  }
+
+  void
+  AbstractDatastoreTool::useSnapshots(
+      pqxx::connection& db, const nmdu::SnapshotRelations& relations) const
+  {
+    if (!opts.exists("snapshot-cache")) {
+      return;
+    }
+
+    nmdu::useSnapshots(db, relations);
+  }
 }
@@ -27,9 +27,16 @@
 #ifndef ABSTRACT_DATASTORE_TOOL_HPP
 #define ABSTRACT_DATASTORE_TOOL_HPP
 
+#include <pqxx/pqxx>
+
+#include <netmeld/core/objects/Uuid.hpp>
 #include <netmeld/core/tools/AbstractTool.hpp>
+#include <netmeld/datastore/utils/Profiler.hpp>
+#include <netmeld/datastore/utils/SnapshotCache.hpp>
 
+namespace nmco = netmeld::core::objects;
 namespace nmct = netmeld::core::tools;
+namespace nmdu = netmeld::datastore::utils;
 
 
 namespace netmeld::datastore::tools {
@@ -40,6 +47,8 @@ namespace netmeld::datastore::tools {
     // Variables
     // =========================================================================
     private:
+      nmdu::Profiler  profiler;
+
     protected:
     public:
 
@@ -54,7 +63,8 @@ namespace netmeld::datastore::tools {
       AbstractDatastoreTool(const char*, const char*, const char*);
 
     public:
-      virtual ~AbstractDatastoreTool() override = default;
+      // Writes the --profile report, if requested
+      virtual ~AbstractDatastoreTool() override;
 
 
     // =========================================================================
@@ -65,10 +75,33 @@ namespace netmeld::datastore::tools {
       void addModuleOptions() override;
 
       void addRequiredDeviceId();
+      void addDbWriteOptions();
+      void addProfileStoreOption();
+      void addSnapshotCacheOption();
 
       const std::string getDbName() const;
       const std::string getDbArgs() const;
       const std::string getDbConnectString() const;
+      size_t getDbPipelineDepth() const;
+
+      // With --profile, end the named phase (the first call starts profiling)
+      void profilePhase(const std::string&);
+      // With --profile, record the transaction's per table row counts and,
+      // with --profile-store, save the report for the tool run.  Call
+      // just before commit.
+      void profileTransaction(pqxx::transaction_base&, const nmco::Uuid&);
+      // With --profile, add the transaction's per table row counts; for tools
+      // committing in batches, call on each just before its commit
+      void profileBatch(pqxx::transaction_base&);
+      // As profileTransaction(), for tools which committed their own
+      // transaction(s); so only with any profileBatch() table counts, and
+      // stored on a new one
+      void profileCommitted(const nmco::Uuid&);
+
+      // With --snapshot-cache, read the relations from their snapshots
+      // (refreshed if stale) for the rest of the connection
+      void useSnapshots(pqxx::connection&,
+                        const nmdu::SnapshotRelations&) const;
 
     public:
   };
@@ -45,6 +45,41 @@ namespace netmeld::datastore::tools {
   // ===========================================================================
   // Tool Entry Points (execution order)
   // ===========================================================================
+  void
+  AbstractGraphTool::addModuleOptions()
+  {
+    AbstractDatastoreTool::addModuleOptions();
+
+    addSnapshotCacheOption();
+
+    opts.addOptionalOption("format", std::make_tuple(
+          "format",
+          po::value<std::string>()->required()->default_value("dot"),
+          "Output format: dot, graphml, or json")
+        );
+    opts.addOptionalOption("hops", std::make_tuple(
+          "hops",
+          po::value<size_t>(),
+          "Only output vertices within this many hops of the root vertex")
+        );
+    opts.addOptionalOption("hops-root", std::make_tuple(
+          "hops-root",
+          po::value<std::string>(),
+          "Root vertex name for --hops, if not the tool's default")
+        );
+    opts.addOptionalOption("cluster", std::make_tuple(
+          "cluster",
+          po::value<std::string>(),
+          "Only output the cluster's (e.g., VLAN or VPC) vertices and their"
+          " neighbors, if the tool supports clusters")
+        );
+    opts.addOptionalOption("list-clusters", std::make_tuple(
+          "list-clusters",
+          NULL_SEMANTIC,
+          "List the graph's clusters, and their sizes, instead of the graph")
+        );
+  }
+
   int
   AbstractGraphTool::runTool()
   {
@@ -54,7 +89,8 @@ namespace netmeld::datastore::tools {
   void
   AbstractGraphTool::printHelp() const
   {
-    LOG_NOTICE << "Create dot formatted graph of " << helpBlurb
+    LOG_NOTICE << "Create dot (or GraphML/JSON) formatted graph of "
+               << helpBlurb
                << "\nUsage: " << programName << " [options]"
                << "\nOptions:\n"
                << opts
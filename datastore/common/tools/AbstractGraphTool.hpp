@@ -31,6 +31,7 @@
 #include <boost/graph/graphviz.hpp>
 
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/GraphOutput.hpp>
 #include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 
@@ -61,9 +62,21 @@ namespace netmeld::datastore::tools {
     // =========================================================================
     private:
     protected:
+      void addModuleOptions() override;
       virtual void printHelp() const override;
       // Tool specific behavior entry point
       virtual int  runTool() override;
+
+      // Write the graph to stdout in the requested format, limited to the
+      // requested cluster and/or hops from the root (default given, if any).
+      // Graphviz output uses the tool's property writers.
+      template<typename Graph, typename VertexWriter, typename EdgeWriter,
+               typename GraphWriter>
+      void writeGraph(const Graph&,
+                      const VertexWriter&, const EdgeWriter&,
+                      const GraphWriter&,
+                      const std::string& = "") const;
   };
 }
+#include "AbstractGraphTool.ipp"
 #endif // ABSTRACT_GRAPH_TOOL_HPP
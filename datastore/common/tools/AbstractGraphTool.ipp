@@ -0,0 +1,105 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+// NOTE This implementation is included in the header (at the end) since it
+//      leverages templating.
+
+#include <iostream>
+#include <optional>
+
+namespace nmcu = netmeld::core::utils;
+namespace nmdu = netmeld::datastore::utils;
+
+
+namespace netmeld::datastore::tools {
+
+  // ===========================================================================
+  // General Functions (alphabetical)
+  // ===========================================================================
+  template<typename Graph, typename VertexWriter, typename EdgeWriter,
+           typename GraphWriter>
+  void
+  AbstractGraphTool::writeGraph(const Graph& graph,
+                                const VertexWriter& vertexWriter,
+                                const EdgeWriter& edgeWriter,
+                                const GraphWriter& graphWriter,
+                                const std::string& defaultRoot) const
+  {
+    auto selected {nmdu::selectAll(graph)};
+
+    if (opts.exists("list-clusters") || opts.exists("cluster")) {
+      if constexpr (nmdu::ClusteredGraph<Graph>) {
+        if (opts.exists("list-clusters")) {
+          for (const auto& [name, size] : nmdu::getClusterSizes(graph)) {
+            std::cout << name << '\t' << size << '\n';
+          }
+          return;
+        }
+        selected = nmdu::selectCluster(graph, opts.getValue("cluster"));
+      } else {
+        LOG_ERROR << "Clusters are not supported by this tool\n";
+        std::exit(nmcu::Exit::FAILURE);
+      }
+    }
+
+    if (opts.exists("hops")) {
+      const std::string rootName {
+          opts.exists("hops-root") ? opts.getValue("hops-root") : defaultRoot
+        };
+      std::optional<nmdu::GraphVertex<Graph>> root;
+      for (const auto& v : boost::make_iterator_range(boost::vertices(graph))) {
+        if (rootName == graph[v].name) {
+          root = v;
+          break;
+        }
+      }
+      if (!root) {
+        LOG_ERROR << "Root vertex for --hops (" << rootName << ") not found,"
+                  << " see --hops-root\n";
+        std::exit(nmcu::Exit::FAILURE);
+      }
+
+      const auto nearby {nmdu::selectNeighborhood(
+          graph, *root, opts.getValueAs<size_t>("hops"))};
+      for (size_t i {0}; i < selected.size(); ++i) {
+        selected[i] = selected[i] && nearby[i];
+      }
+    }
+
+    const std::string format {opts.getValue("format")};
+    if ("dot" == format) {
+      nmdu::writeGraphviz(std::cout, graph, selected,
+                          vertexWriter, edgeWriter, graphWriter);
+    } else if ("graphml" == format) {
+      nmdu::writeGraphml(std::cout, graph, selected);
+    } else if ("json" == format) {
+      nmdu::writeGraphJson(std::cout, graph, selected);
+    } else {
+      LOG_ERROR << "Unknown output format: " << format << '\n';
+      std::exit(nmcu::Exit::FAILURE);
+    }
+  }
+}
@@ -68,7 +68,15 @@ namespace netmeld::datastore::tools {
       try {
           P parser;
           std::ifstream f {this->getDataPath().string()};
-          parser.fromJson(json::parse(f));
+          // Parsers which can, read large documents piecewise
+          if constexpr (requires (std::istream& _in) {
+                          parser.fromJsonStream(_in);
+                        })
+          {
+            parser.fromJsonStream(f);
+          } else {
+            parser.fromJson(json::parse(f));
+          }
           this->tResults = parser.getData();
       } catch (json::out_of_range& ex) {
           LOG_ERROR << "Parse error " << ex.what()
@@ -55,12 +55,39 @@ namespace netmeld::datastore::tools {
   // Tool Entry Points (execution order)
   // ===========================================================================
 
+  template<typename P, typename R>
+  void
+  AbstractImportSpiritTool<P,R>::addToolOptions()
+  {
+    if constexpr (nmdp::SegmentedParser<P,R>) {
+      this->opts.addAdvancedOption("parse-jobs", std::make_tuple(
+            "parse-jobs",
+            po::value<size_t>()->default_value(0),
+            "Parse large inputs as up to this many segments in parallel;"
+            " 0 uses one per core, 1 disables.")
+          );
+    } else if constexpr (nmdp::ParallelParser<P>) {
+      this->opts.addAdvancedOption("parse-jobs", std::make_tuple(
+            "parse-jobs",
+            po::value<size_t>()->default_value(0),
+            "Parse independent sections (e.g., devices) on up to this many"
+            " threads; 0 uses one per core, 1 disables.")
+          );
+    }
+  }
+
   template<typename P, typename R>
   void
   AbstractImportSpiritTool<P,R>::parseData() // Could pass the parser as an argument
   {
     this->executionStart = nmco::Time();
-    this->tResults = nmdp::fromFilePath<P,R>(this->dataPath.string());
+    if constexpr (nmdp::SegmentedParser<P,R>) {
+      this->tResults = nmdp::fromFilePathSegmented<P,R>(
+          this->dataPath.string(),
+          this->opts.template getValueAs<size_t>("parse-jobs"));
+    } else {
+      this->tResults = nmdp::fromFilePath<P,R>(this->dataPath.string());
+    }
     this->executionStop = nmco::Time();
   }
 }
@@ -55,6 +55,7 @@ namespace netmeld::datastore::tools {
 
       nmdo::DeviceInformation devInfo;
 
+      // Set by tools which commit the transaction themselves
       bool preCommitTool {false};
 
     // =========================================================================
@@ -73,14 +74,20 @@ namespace netmeld::datastore::tools {
     // Methods
     // =========================================================================
     private:
-      // Performs default inserts into the DB
-      void generalInserts(pqxx::transaction_base&, const std::string&);
       void addModuleOptions() override;
 
     protected:
+      // Performs default inserts into the DB
+      void generalInserts(pqxx::transaction_base&, const std::string&);
       const sfs::path   getDataPath() const;
       const std::string getDeviceId() const;
       const nmco::Uuid  getToolRunId() const;
+      // Saves the tool run (if asked) and the specificInserts() in the
+      // transaction, using the insert cache and --db-pipeline as configured;
+      // for tools committing in batches, as runTool() does for all at once
+      void insertResults(pqxx::transaction_base&, bool = true);
+      // False if parsing found nothing to save, so the transaction is aborted
+      virtual bool hasStorableData() const;
       virtual void addToolOptions() override;
       virtual void parseData() = 0;
       virtual void printHelp() const override;
@@ -27,7 +27,10 @@
 // NOTE This implementation is included in the header (at the end) since it
 //      leverages templating.
 
+#include <optional>
+
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/utils/ParseCache.hpp>
 #include <netmeld/datastore/utils/QueriesCommon.hpp>
 
 namespace nmcu = netmeld::core::utils;
@@ -59,6 +62,8 @@ namespace netmeld::datastore::tools {
   int
   AbstractImportTool<P,R>::runTool()
   {
+    profilePhase("startup");
+
     if (opts.exists("data-path")) {
       dataPath = sfs::canonical(opts.getValue("data-path"));
     }
@@ -66,9 +71,14 @@ namespace netmeld::datastore::tools {
     setToolRunId();
 
     parseData(); // only returns on success
+    profilePhase("parse");
 
     pqxx::connection db {getDbConnectString()};
+    profilePhase("connect");
+
     nmdu::dbPrepareCommon(db);
+    profilePhase("prepare");
+
     pqxx::work t{db};
 
     if (opts.exists("tool-run-metadata")) {
@@ -77,11 +87,11 @@ namespace netmeld::datastore::tools {
     }
     else {
       LOG_DEBUG << "Running as general/specific tool\n";
-      generalInserts(t, dataPath.string());
-      specificInserts(t);
+      insertResults(t);
+      nmdu::ParseCacheStats::logStats();
     }
 
-    if (tResults == R() && !preCommitTool) {
+    if (!hasStorableData() && !preCommitTool) {
         LOG_WARN << "Parsed data contained no storable information.\n";
         try {
           t.abort();
@@ -90,7 +100,14 @@ namespace netmeld::datastore::tools {
           LOG_DEBUG << "Failed to manually abort: " <<  e.what() << std::endl;
         }
     } else {
+      // A tool which committed itself may have closed the transaction
+      if (preCommitTool) {
+        profileCommitted(toolRunId);
+      } else {
+        profileTransaction(t, toolRunId);
+      }
       t.commit();
+      profilePhase("commit");
       if (!opts.exists("tool-run-id")) {
         LOG_INFO << "tool-run-id: " << toolRunId << '\n';
       }
@@ -138,6 +155,8 @@ namespace netmeld::datastore::tools {
     AbstractDatastoreTool::addModuleOptions();
 
     addRequiredDeviceId();
+    addDbWriteOptions();
+    addProfileStoreOption();
 
     opts.addRequiredOption("data-path", std::make_tuple(
           "data-path",
@@ -221,4 +240,42 @@ namespace netmeld::datastore::tools {
   {
     return toolRunId;
   }
+
+  template<typename P, typename R>
+  bool
+  AbstractImportTool<P,R>::hasStorableData() const
+  {
+    return !(tResults == R());
+  }
+
+  template<typename P, typename R>
+  void
+  AbstractImportTool<P,R>::insertResults(
+      pqxx::transaction_base& t,
+      bool saveToolRun)
+  {
+    std::optional<nmdu::InsertCache> cache;
+    if (!opts.exists("no-insert-cache")) {
+      cache.emplace(t);
+    }
+    if (saveToolRun) {
+      generalInserts(t, dataPath.string());
+      profilePhase("general-inserts");
+    }
+
+    std::optional<nmdu::InsertPipeline> pipeline;
+    if (const auto depth {getDbPipelineDepth()}; 0 < depth) {
+      pipeline.emplace(t, depth);
+    }
+    specificInserts(t);
+    profilePhase("specific-inserts");
+    if (pipeline) {
+      pipeline->flush();
+      LOG_DEBUG << "Pipelined statements: " << pipeline->count() << '\n';
+      profilePhase("pipeline-flush");
+    }
+    if (cache) {
+      cache->logStats();
+    }
+  }
 }
@@ -59,6 +59,7 @@ namespace netmeld::datastore::tools {
     // Methods
     // =========================================================================
     protected:
+      virtual void addToolOptions() override;
       virtual void parseData();
   };
 }
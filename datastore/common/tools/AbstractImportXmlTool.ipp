@@ -58,6 +58,20 @@ namespace netmeld::datastore::tools {
   // Tool Entry Points (execution order)
   // ===========================================================================
 
+  template<typename P, typename R>
+  void
+  AbstractImportXmlTool<P,R>::addToolOptions()
+  {
+    if constexpr (nmdp::ParallelParser<P>) {
+      this->opts.addAdvancedOption("parse-jobs", std::make_tuple(
+            "parse-jobs",
+            po::value<size_t>()->default_value(0),
+            "Parse independent sections (e.g., logical systems) on up to"
+            " this many threads; 0 uses one per core, 1 disables.")
+          );
+    }
+  }
+
   template<typename P,typename R>
   void
   AbstractImportXmlTool<P,R>::parseData()
@@ -72,6 +86,10 @@ namespace netmeld::datastore::tools {
         std::exit(nmcu::Exit::FAILURE);
       }
       P parser;
+      if constexpr (nmdp::ParallelParser<P>) {
+        parser.setParseJobs(
+            this->opts.template getValueAs<size_t>("parse-jobs"));
+      }
       parser.handleXML(doc);
       this->tResults = parser.getData();
       this->executionStop = nmco::Time();
@@ -50,16 +50,26 @@ namespace netmeld::datastore::tools {
   int
   AbstractInsertTool::runTool()
   {
+    profilePhase("startup");
+
     setToolRunId();
 
     pqxx::connection db {getDbConnectString()};
+    profilePhase("connect");
+
     nmdu::dbPrepareCommon(db);
+    profilePhase("prepare");
+
     pqxx::work t{db};
 
     generalInserts(t);
+    profilePhase("general-inserts");
     specificInserts(t);
+    profilePhase("specific-inserts");
 
+    profileTransaction(t, toolRunId);
     t.commit();
+    profilePhase("commit");
 
     if (!opts.exists("tool-run-id")) {
       LOG_INFO << "tool-run-id: " << toolRunId << '\n';
@@ -97,6 +107,8 @@ namespace netmeld::datastore::tools {
   {
     AbstractDatastoreTool::addModuleOptions();
 
+    addProfileStoreOption();
+
     opts.addAdvancedOption("tool-run-id", std::make_tuple(
           "tool-run-id",
           po::value<std::string>(),
@@ -0,0 +1,62 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <netmeld/datastore/tools/ImportRegistry.hpp>
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+
+
+namespace netmeld::datastore::tools {
+
+  // ===========================================================================
+  // InProcessImport
+  // ===========================================================================
+  void
+  InProcessImport::saveAsMetadata(pqxx::transaction_base&, const nmco::Uuid&)
+  {
+    LOG_WARN << "Import does not support tool run metadata, skipping\n";
+  }
+
+
+  // ===========================================================================
+  // ImportRegistry
+  // ===========================================================================
+  bool
+  ImportRegistry::contains(const std::string& toolName) const
+  {
+    return factories.contains(toolName);
+  }
+
+  std::unique_ptr<InProcessImport>
+  ImportRegistry::create(const std::string& toolName) const
+  {
+    const auto& it {factories.find(toolName)};
+    if (factories.end() == it) {
+      return nullptr;
+    }
+
+    return (it->second)();
+  }
+}
@@ -0,0 +1,115 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef IMPORT_REGISTRY_HPP
+#define IMPORT_REGISTRY_HPP
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/core/utils/FileManager.hpp>
+
+namespace nmco = netmeld::core::objects;
+
+
+namespace netmeld::datastore::tools {
+
+  // ===========================================================================
+  // An importer's parse and save steps, callable without spawning its tool
+  // ===========================================================================
+  class InProcessImport
+  {
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    public:
+      virtual ~InProcessImport() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    public:
+      // Parse the data file, false on failure; must not touch the DB as
+      // several imports may parse concurrently
+      virtual bool parse(const sfs::path&) = 0;
+
+      // Save the parsed data as observed on the given device
+      virtual void save(pqxx::transaction_base&, const nmco::Uuid&,
+                        const std::string&) = 0;
+
+      // Save the parsed data as describing the tool run's own host
+      virtual void saveAsMetadata(pqxx::transaction_base&, const nmco::Uuid&);
+  };
+
+
+  // ===========================================================================
+  // Convenience base for importers with a Spirit parser
+  // ===========================================================================
+  template<typename TParser, typename TResults>
+  class AbstractSpiritImport : public InProcessImport
+  {
+    protected:
+      TResults results;
+
+    public:
+      bool parse(const sfs::path&) override;
+  };
+
+
+  // ===========================================================================
+  // Importers which can run in process, by tool name
+  // ===========================================================================
+  class ImportRegistry
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      std::map<std::string,
+               std::function<std::unique_ptr<InProcessImport>()>>
+        factories;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    public:
+      template<typename TImport>
+      void add(const std::string&);
+
+      bool contains(const std::string&) const;
+
+      // New import for the named tool, nullptr if none is registered
+      std::unique_ptr<InProcessImport> create(const std::string&) const;
+  };
+}
+
+#include "ImportRegistry.ipp"
+#endif // IMPORT_REGISTRY_HPP
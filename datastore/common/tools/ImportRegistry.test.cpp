@@ -0,0 +1,179 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+#include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/tools/ImportRegistry.hpp>
+
+namespace nmdp = netmeld::datastore::parsers;
+namespace nmdt = netmeld::datastore::tools;
+
+
+namespace {
+  // Records what it was handed, the DB steps are never reached here
+  class TestImport : public nmdt::InProcessImport
+  {
+    public:
+      static inline size_t created {0};
+      std::vector<sfs::path> parsed;
+
+      TestImport() { ++created; }
+
+      bool
+      parse(const sfs::path& dataPath) override
+      {
+        parsed.push_back(dataPath);
+        return "fail" != dataPath.filename();
+      }
+
+      void
+      save(pqxx::transaction_base&, const nmco::Uuid&,
+           const std::string&) override
+      {}
+  };
+
+  class OtherImport : public TestImport
+  {};
+
+  // One or more whitespace separated words, one per line
+  typedef std::vector<std::string> Words;
+
+  class WordParser :
+    public qi::grammar<nmdp::IstreamIter, Words(), qi::ascii::blank_type>
+  {
+    public:
+      qi::rule<nmdp::IstreamIter, Words(), qi::ascii::blank_type>
+        start;
+      qi::rule<nmdp::IstreamIter, std::string()>
+        word;
+
+      WordParser() : WordParser::base_type(start)
+      {
+        start = +(word >> qi::eol);
+        word  = +qi::ascii::alpha;
+      }
+  };
+
+  class WordImport : public nmdt::AbstractSpiritImport<WordParser, Words>
+  {
+    public:
+      const Words& getResults() const { return results; }
+
+      void
+      save(pqxx::transaction_base&, const nmco::Uuid&,
+           const std::string&) override
+      {}
+  };
+
+  sfs::path
+  writeTestFile(const std::string& name, const std::string& data)
+  {
+    const auto path {sfs::temp_directory_path()/("import-registry-" + name)};
+    std::ofstream f {path};
+    f << data;
+    return path;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLookup)
+{
+  nmdt::ImportRegistry registry;
+  BOOST_TEST(!registry.contains("nmdb-import-test"));
+  BOOST_TEST(nullptr == registry.create("nmdb-import-test"));
+
+  registry.add<TestImport>("nmdb-import-test");
+  registry.add<OtherImport>("nmdb-import-other");
+  BOOST_TEST(registry.contains("nmdb-import-test"));
+  BOOST_TEST(registry.contains("nmdb-import-other"));
+
+  // Exact tool names only
+  BOOST_TEST(!registry.contains("nmdb-import"));
+  BOOST_TEST(!registry.contains("nmdb-import-test "));
+  BOOST_TEST(nullptr == registry.create("nmdb-import-missing"));
+
+  // A new import, of the registered type, per call
+  const auto created {TestImport::created};
+  const auto& first {registry.create("nmdb-import-test")};
+  const auto& second {registry.create("nmdb-import-test")};
+  BOOST_TEST(created + 2 == TestImport::created);
+  BOOST_TEST(nullptr != first);
+  BOOST_TEST(first != second);
+  BOOST_TEST(nullptr == dynamic_cast<OtherImport*>(first.get()));
+  BOOST_TEST(nullptr != dynamic_cast<OtherImport*>(
+        registry.create("nmdb-import-other").get()));
+
+  // Re-registering a name replaces its import
+  registry.add<OtherImport>("nmdb-import-test");
+  BOOST_TEST(nullptr != dynamic_cast<OtherImport*>(
+        registry.create("nmdb-import-test").get()));
+}
+
+BOOST_AUTO_TEST_CASE(testDispatch)
+{
+  nmdt::ImportRegistry registry;
+  registry.add<TestImport>("nmdb-import-test");
+
+  // Calls go to the created import, and only that one
+  auto import {registry.create("nmdb-import-test")};
+  auto other {registry.create("nmdb-import-test")};
+  BOOST_TEST(import->parse("/tmp/data.log"));
+  BOOST_TEST(!import->parse("/tmp/fail"));
+
+  const auto& parsed {dynamic_cast<TestImport&>(*import).parsed};
+  BOOST_TEST(2 == parsed.size());
+  BOOST_TEST("/tmp/data.log" == parsed.at(0));
+  BOOST_TEST(dynamic_cast<TestImport&>(*other).parsed.empty());
+}
+
+BOOST_AUTO_TEST_CASE(testSpiritImport)
+{
+  nmdt::ImportRegistry registry;
+  registry.add<WordImport>("nmdb-import-words");
+
+  {
+    const auto path {writeTestFile("good.txt", "alpha\nbeta\n")};
+    auto import {registry.create("nmdb-import-words")};
+    BOOST_TEST(import->parse(path));
+
+    const auto& results {dynamic_cast<WordImport&>(*import).getResults()};
+    BOOST_TEST((Words {"alpha", "beta"}) == results);
+    sfs::remove(path);
+  }
+
+  // Failures are reported, not fatal, so other imports can carry on
+  {
+    const auto path {writeTestFile("bad.txt", "alpha\n1234\n")};
+    auto import {registry.create("nmdb-import-words")};
+    BOOST_TEST(!import->parse(path));
+    BOOST_TEST(dynamic_cast<WordImport&>(*import).getResults().empty());
+    sfs::remove(path);
+  }
+}
@@ -64,5 +64,23 @@ namespace netmeld::datastore::utils {
     return true;
   }
 
+  // Fold the books of `src` into `dst`, combining the data of same named
+  // books (e.g., when stitching separately parsed sections of a config)
+  template<typename DType>
+  void
+  mergeBooks(std::map<std::string, std::map<std::string, DType>>& dst,
+             const std::map<std::string, std::map<std::string, DType>>& src)
+  {
+    for (const auto& [setName, books] : src) {
+      auto& dstBooks {dst[setName]};
+      for (const auto& [name, book] : books) {
+        const auto& [it, inserted] {dstBooks.emplace(name, book)};
+        if (!inserted) {
+          it->second.addData(book.getData());
+        }
+      }
+    }
+  }
+
 }
 #endif  /* AC_BOOK_UTILITIES_HPP */
@@ -0,0 +1,140 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <regex>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/CveFeed.hpp>
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+using json = nlohmann::json;
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  CveFeed::CveFeed()
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  void
+  CveFeed::load(std::istream& in)
+  {
+    const std::regex cveRegex {R"(CVE-(\d{4})-(\d{4,}))"};
+
+    parseJsonStream(in, {"vulnerabilities"},
+        [&](const std::string&, const json& entry) {
+          if (!entry.is_object()) {
+            ++skipped;
+            return;
+          }
+
+          const auto& cveId   {entry.value("cve", "")};
+          const auto& name    {entry.value("package", "")};
+          const auto& manager {
+            toPackageManager(entry.value("package_manager", ""))};
+
+          std::smatch m;
+          if (name.empty() || !manager
+              || !std::regex_match(cveId, m, cveRegex))
+          {
+            LOG_DEBUG << "Skipping feed entry: " << entry.dump() << '\n';
+            ++skipped;
+            return;
+          }
+
+          add(*manager, name,
+              { nmdo::Cve(static_cast<short>(std::stoi(m[1])),
+                          std::stoi(m[2]))
+              , entry.value("introduced", "")
+              , entry.value("fixed", "")
+              });
+        }
+      );
+  }
+
+  void
+  CveFeed::add(PackageManager manager, const std::string& name,
+               const CveFeedEntry& entry)
+  {
+    packages[static_cast<size_t>(manager)][name].push_back(entry);
+    ++count;
+  }
+
+  std::vector<nmdo::Cve>
+  CveFeed::matches(PackageManager manager, const std::string& name,
+                   std::string_view version) const
+  {
+    std::vector<nmdo::Cve> cves;
+
+    const auto& index {packages[static_cast<size_t>(manager)]};
+    const auto& it {index.find(name)};
+    if (index.end() == it) {
+      return cves;
+    }
+
+    for (const auto& entry : it->second) {
+      if (!entry.introduced.empty()
+          && 0 > compareVersions(manager, version, entry.introduced))
+      {
+        continue;
+      }
+      if (!entry.fixed.empty()
+          && 0 <= compareVersions(manager, version, entry.fixed))
+      {
+        continue;
+      }
+      if (cves.end() == std::find(cves.begin(), cves.end(), entry.cve)) {
+        cves.push_back(entry.cve);
+      }
+    }
+
+    return cves;
+  }
+
+  size_t
+  CveFeed::size() const
+  {
+    return count;
+  }
+
+  size_t
+  CveFeed::skippedEntries() const
+  {
+    return skipped;
+  }
+
+  bool
+  CveFeed::empty() const
+  {
+    return 0 == count;
+  }
+}
@@ -0,0 +1,111 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef CVE_FEED_HPP
+#define CVE_FEED_HPP
+
+#include <array>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <netmeld/datastore/objects/Cve.hpp>
+#include <netmeld/datastore/utils/PackageVersion.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+namespace netmeld::datastore::utils {
+
+  // A range of a package's versions affected by a CVE
+  struct CveFeedEntry
+  {
+    nmdo::Cve    cve;
+    std::string  introduced;  // empty if all earlier versions are affected
+    std::string  fixed;       // empty if no version is fixed yet
+  };
+
+  /* Affected package versions from a local, OVAL-style vulnerability feed,
+     indexed by package manager and package name for bulk evaluation.
+
+     The feed is JSON; its "vulnerabilities" array is streamed, so feeds
+     larger than memory as a document may be used:
+       {"vulnerabilities": [
+         {"cve": "CVE-2021-3156", "package_manager": "dpkg",
+          "package": "sudo", "introduced": "1.8.2",
+          "fixed": "1.8.31-1ubuntu1.2"},
+         ...
+       ]}
+     A version is affected if it is not older than "introduced" and is older
+     than "fixed", as ordered by the package manager; either may be omitted.
+   */
+  class CveFeed {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      using Index =
+        std::unordered_map<std::string, std::vector<CveFeedEntry>>;
+
+    protected:
+      // One index per PackageManager
+      std::array<Index, 3>  packages;
+      size_t                count {0};
+      size_t                skipped {0};
+
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      CveFeed();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+    public:
+      // Add the feed's entries; malformed entries are counted and skipped
+      void load(std::istream&);
+
+      void add(PackageManager, const std::string&, const CveFeedEntry&);
+
+      // CVEs (once each) whose ranges include the package's version
+      std::vector<nmdo::Cve> matches(PackageManager, const std::string&,
+                                     std::string_view) const;
+
+      size_t size() const;
+      size_t skippedEntries() const;
+      bool empty() const;
+  };
+}
+#endif // CVE_FEED_HPP
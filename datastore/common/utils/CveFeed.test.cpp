@@ -0,0 +1,125 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include <netmeld/datastore/utils/CveFeed.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
+
+using nmdu::PackageManager;
+
+
+class TestCveFeed : public nmdu::CveFeed {
+  public:
+    using CveFeed::packages;
+};
+
+BOOST_AUTO_TEST_CASE(testLoad)
+{
+  TestCveFeed feed;
+  std::istringstream in {R"({
+      "source": "test",
+      "vulnerabilities": [
+        {"cve": "CVE-2021-3156", "package_manager": "dpkg",
+         "package": "sudo", "fixed": "1.8.31-1ubuntu1.2"},
+        {"cve": "CVE-2021-3156", "package_manager": "rpm",
+         "package": "sudo", "introduced": "1.8.2", "fixed": "1.8.29-6.el8"},
+        {"cve": "CVE-2022-0001", "package_manager": "apk",
+         "package": "busybox"},
+        {"cve": "bad", "package_manager": "apk", "package": "busybox"},
+        {"cve": "CVE-2022-0002", "package_manager": "pip", "package": "x"},
+        {"cve": "CVE-2022-0003", "package_manager": "apk"},
+        "bad"
+      ]
+    })"};
+
+  feed.load(in);
+
+  BOOST_TEST(3 == feed.size());
+  BOOST_TEST(4 == feed.skippedEntries());
+  BOOST_TEST(!feed.empty());
+  for (const auto& index : feed.packages) {
+    BOOST_TEST(1 == index.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMatches)
+{
+  nmdu::CveFeed feed;
+
+  BOOST_TEST(feed.empty());
+
+  const nmdo::Cve cveA {2021, 3156};
+  const nmdo::Cve cveB {2023, 12345};
+  feed.add(PackageManager::DPKG, "sudo", {cveA, "", "1.8.31-1ubuntu1.2"});
+  feed.add(PackageManager::DPKG, "sudo", {cveB, "1.9.0", "1.9.5p2-1"});
+  // a second range for the same CVE
+  feed.add(PackageManager::DPKG, "sudo", {cveB, "1.8.0", "1.8.10"});
+  feed.add(PackageManager::RPM, "openssl", {cveA, "1:1.1.0", ""});
+
+  BOOST_TEST(4 == feed.size());
+
+  {
+    const auto& cves {feed.matches(PackageManager::DPKG, "sudo",
+                                   "1.8.31-1ubuntu1.1")};
+    BOOST_TEST(1 == cves.size());
+    BOOST_TEST("CVE-2021-3156" == cves.at(0).toString());
+  }
+
+  // fixed version and later are not affected
+  BOOST_TEST(feed.matches(PackageManager::DPKG, "sudo",
+                          "1.8.31-1ubuntu1.2").empty());
+  BOOST_TEST(feed.matches(PackageManager::DPKG, "sudo",
+                          "1.8.31-1ubuntu2").empty());
+
+  {
+    // both CVEs, each once
+    const auto& cves {feed.matches(PackageManager::DPKG, "sudo", "1.8.5-1")};
+    BOOST_TEST(2 == cves.size());
+  }
+
+  {
+    const auto& cves {feed.matches(PackageManager::DPKG, "sudo", "1.9.1-1")};
+    BOOST_TEST(1 == cves.size());
+    BOOST_TEST("CVE-2023-12345" == cves.at(0).toString());
+  }
+
+  // introduced honours the epoch, no fixed version means still affected
+  BOOST_TEST(feed.matches(PackageManager::RPM, "openssl",
+                          "1.1.1k-7.el8").empty());
+  BOOST_TEST(1 == feed.matches(PackageManager::RPM, "openssl",
+                               "1:1.1.1k-7.el8").size());
+
+  // indexed per package manager and name
+  BOOST_TEST(feed.matches(PackageManager::RPM, "sudo", "1.8.5-1").empty());
+  BOOST_TEST(feed.matches(PackageManager::DPKG, "openssl", "1.0").empty());
+}
@@ -0,0 +1,329 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef GRAPH_OUTPUT_HPP
+#define GRAPH_OUTPUT_HPP
+
+#include <deque>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <boost/graph/adjacency_list.hpp>
+#include <boost/graph/filtered_graph.hpp>
+#include <boost/graph/graphviz.hpp>
+#include <nlohmann/json.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Output helpers shared by the graph tools.
+
+     A selection marks, by vertex index, the vertices to output; edges are
+     output when both ends are.  The GraphML and JSON writers stream the
+     selected part of the graph directly, and output the common vertex and
+     edge properties (name, label, shape, style, weight, etc.) where the
+     graph's property types have them.  Vertex properties can also list the
+     clusters (e.g., VLAN or VPC) a vertex belongs to, for selectCluster().
+   */
+
+  template<typename Graph>
+  using GraphVertex = typename boost::graph_traits<Graph>::vertex_descriptor;
+
+  // Graphs whose vertex properties list cluster membership
+  template<typename Graph>
+  concept ClusteredGraph = requires (const Graph& g, GraphVertex<Graph> v) {
+    { g[v].clusters } -> std::convertible_to<std::set<std::string>>;
+  };
+
+  // ===========================================================================
+  // Selection
+  // ===========================================================================
+  template<typename Graph>
+  std::vector<bool>
+  selectAll(const Graph& g)
+  {
+    return std::vector<bool>(boost::num_vertices(g), true);
+  }
+
+  // Vertices within the hops of (following edge direction, if any) the root
+  template<typename Graph>
+  std::vector<bool>
+  selectNeighborhood(const Graph& g, GraphVertex<Graph> root, size_t hops)
+  {
+    const auto index {boost::get(boost::vertex_index, g)};
+    std::vector<bool> selected(boost::num_vertices(g), false);
+
+    std::deque<std::pair<GraphVertex<Graph>, size_t>> queue {{root, 0}};
+    selected[index[root]] = true;
+    while (!queue.empty()) {
+      const auto [v, distance] {queue.front()};
+      queue.pop_front();
+      if (hops <= distance) {
+        continue;
+      }
+      for (const auto& u : boost::make_iterator_range(
+                             boost::adjacent_vertices(v, g)))
+      {
+        if (!selected[index[u]]) {
+          selected[index[u]] = true;
+          queue.emplace_back(u, distance + 1);
+        }
+      }
+    }
+
+    return selected;
+  }
+
+  // Vertices in the cluster, and those adjacent to them
+  template<ClusteredGraph Graph>
+  std::vector<bool>
+  selectCluster(const Graph& g, const std::string& cluster)
+  {
+    const auto index {boost::get(boost::vertex_index, g)};
+    std::vector<bool> selected(boost::num_vertices(g), false);
+
+    for (const auto& v : boost::make_iterator_range(boost::vertices(g))) {
+      if (!g[v].clusters.contains(cluster)) {
+        continue;
+      }
+      selected[index[v]] = true;
+      for (const auto& u : boost::make_iterator_range(
+                             boost::adjacent_vertices(v, g)))
+      {
+        selected[index[u]] = true;
+      }
+    }
+
+    return selected;
+  }
+
+  // Cluster names and their number of member vertices
+  template<ClusteredGraph Graph>
+  std::map<std::string, size_t>
+  getClusterSizes(const Graph& g)
+  {
+    std::map<std::string, size_t> sizes;
+    for (const auto& v : boost::make_iterator_range(boost::vertices(g))) {
+      for (const auto& cluster : g[v].clusters) {
+        ++sizes[cluster];
+      }
+    }
+    return sizes;
+  }
+
+
+  // ===========================================================================
+  // Writers
+  // ===========================================================================
+  template<typename Graph>
+  class SelectedVertex {
+    private:
+      const Graph*              graph    {nullptr};
+      const std::vector<bool>*  selected {nullptr};
+
+    public:
+      SelectedVertex() = default;
+      SelectedVertex(const Graph& _g, const std::vector<bool>& _selected) :
+        graph(&_g), selected(&_selected)
+      {}
+
+      bool operator()(GraphVertex<Graph> v) const
+      {
+        return (*selected)[boost::get(boost::vertex_index, *graph, v)];
+      }
+  };
+
+  template<typename Graph>
+  using SelectedGraph =
+    boost::filtered_graph<Graph, boost::keep_all, SelectedVertex<Graph>>;
+
+  template<typename Graph>
+  SelectedGraph<Graph>
+  getSelectedGraph(const Graph& g, const std::vector<bool>& selected)
+  {
+    return SelectedGraph<Graph>(g, boost::keep_all(),
+                                SelectedVertex<Graph>(g, selected));
+  }
+
+  // Calls visit(name, value) for each common property the object has
+  template<typename Properties, typename Visitor>
+  void
+  visitGraphProperties(const Properties& p, Visitor&& visit)
+  {
+    if constexpr (requires { p.name; })       { visit("name", p.name); }
+    if constexpr (requires { p.label; })      { visit("label", p.label); }
+    if constexpr (requires { p.shape; })      { visit("shape", p.shape); }
+    if constexpr (requires { p.style; })      { visit("style", p.style); }
+    if constexpr (requires { p.fillcolor; })  {
+      visit("fillcolor", p.fillcolor);
+    }
+    if constexpr (requires { p.direction; })  {
+      visit("direction", p.direction);
+    }
+    if constexpr (requires { p.arrowhead; })  {
+      visit("arrowhead", p.arrowhead);
+    }
+    if constexpr (requires { p.arrowtail; })  {
+      visit("arrowtail", p.arrowtail);
+    }
+    if constexpr (requires { p.weight; })     { visit("weight", p.weight); }
+    if constexpr (requires { p.clusters; })   {
+      visit("clusters", p.clusters);
+    }
+  }
+
+  std::string escapeXml(const std::string&);
+
+  template<typename Graph>
+  void
+  writeGraphml(std::ostream& os, const Graph& g,
+               const std::vector<bool>& selected)
+  {
+    using VertexProperties = typename Graph::vertex_bundled;
+    using EdgeProperties   = typename Graph::edge_bundled;
+
+    const auto toText = [](const auto& value) {
+        std::ostringstream oss;
+        if constexpr (std::is_same_v<decltype(value),
+                                     const std::set<std::string>&>)
+        {
+          bool first {true};
+          for (const auto& item : value) {
+            oss << (first ? "" : ",") << item;
+            first = false;
+          }
+        } else {
+          oss << value;
+        }
+        return escapeXml(oss.str());
+      };
+    const auto writeKeys = [&os](const char* domain, const auto& properties) {
+        visitGraphProperties(properties,
+            [&os, domain](const char* name, const auto& value) {
+              const bool isNumber {std::is_arithmetic_v<
+                  std::remove_cvref_t<decltype(value)>>};
+              os << R"(  <key id=")" << domain << '_' << name
+                 << R"(" for=")" << domain
+                 << R"(" attr.name=")" << name
+                 << R"(" attr.type=")" << (isNumber ? "double" : "string")
+                 << R"("/>)" << '\n';
+            });
+      };
+    const auto writeData = [&os, &toText](const char* domain,
+                                          const auto& properties) {
+        visitGraphProperties(properties,
+            [&os, &toText, domain](const char* name, const auto& value) {
+              os << R"(      <data key=")" << domain << '_' << name
+                 << R"(">)" << toText(value) << "</data>\n";
+            });
+      };
+
+    os << R"(<?xml version="1.0" encoding="UTF-8"?>)" << '\n'
+       << R"(<graphml xmlns="http://graphml.graphdrawing.org/xmlns">)"
+       << '\n';
+    writeKeys("node", VertexProperties());
+    writeKeys("edge", EdgeProperties());
+    os << R"(  <graph id="G" edgedefault=")"
+       << (boost::is_directed(g) ? "directed" : "undirected") << R"(">)"
+       << '\n';
+
+    const auto sg {getSelectedGraph(g, selected)};
+    for (const auto& v : boost::make_iterator_range(boost::vertices(sg))) {
+      os << R"(    <node id=")" << escapeXml(g[v].name) << R"(">)" << '\n';
+      writeData("node", g[v]);
+      os << "    </node>\n";
+    }
+    for (const auto& e : boost::make_iterator_range(boost::edges(sg))) {
+      os << R"(    <edge source=")"
+         << escapeXml(g[boost::source(e, g)].name)
+         << R"(" target=")" << escapeXml(g[boost::target(e, g)].name)
+         << R"(">)" << '\n';
+      writeData("edge", g[e]);
+      os << "    </edge>\n";
+    }
+
+    os << "  </graph>\n"
+       << "</graphml>\n";
+  }
+
+  template<typename Graph>
+  void
+  writeGraphJson(std::ostream& os, const Graph& g,
+                 const std::vector<bool>& selected)
+  {
+    const auto writeProperties = [&os](const auto& properties) {
+        visitGraphProperties(properties,
+            [&os](const char* name, const auto& value) {
+              os << ", " << nlohmann::json(name).dump()
+                 << ": " << nlohmann::json(value).dump();
+            });
+      };
+
+    os << R"({"directed": )" << std::boolalpha << boost::is_directed(g)
+       << R"(, "nodes": [)";
+
+    const auto sg {getSelectedGraph(g, selected)};
+    bool first {true};
+    for (const auto& v : boost::make_iterator_range(boost::vertices(sg))) {
+      os << (first ? "\n" : ",\n")
+         << R"(  {"id": )" << nlohmann::json(g[v].name).dump();
+      writeProperties(g[v]);
+      os << '}';
+      first = false;
+    }
+
+    os << R"(], "edges": [)";
+    first = true;
+    for (const auto& e : boost::make_iterator_range(boost::edges(sg))) {
+      os << (first ? "\n" : ",\n")
+         << R"(  {"source": )"
+         << nlohmann::json(g[boost::source(e, g)].name).dump()
+         << R"(, "target": )"
+         << nlohmann::json(g[boost::target(e, g)].name).dump();
+      writeProperties(g[e]);
+      os << '}';
+      first = false;
+    }
+    os << "]}\n";
+  }
+
+  // Graphviz output, via the graph tool's own property writers
+  template<typename Graph, typename VertexWriter, typename EdgeWriter,
+           typename GraphWriter>
+  void
+  writeGraphviz(std::ostream& os, const Graph& g,
+                const std::vector<bool>& selected,
+                const VertexWriter& vw, const EdgeWriter& ew,
+                const GraphWriter& gw)
+  {
+    boost::write_graphviz(os, getSelectedGraph(g, selected), vw, ew, gw,
+        boost::get(&Graph::vertex_bundled::name, g));
+  }
+}
+#endif // GRAPH_OUTPUT_HPP
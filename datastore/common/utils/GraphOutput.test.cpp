@@ -0,0 +1,167 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include <netmeld/datastore/utils/GraphOutput.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+using json = nlohmann::json;
+
+
+struct TestVertex
+{
+  std::string name;
+  std::string label;
+  std::set<std::string> clusters;
+};
+
+struct TestEdge
+{
+  std::string label;
+  double weight {1.0};
+};
+
+using TestGraph =
+  boost::adjacency_list<boost::listS, boost::vecS, boost::undirectedS,
+                        TestVertex, TestEdge>;
+
+// a -- b -- c -- d, with b and c in cluster x and d in y
+TestGraph
+getTestGraph()
+{
+  TestGraph g;
+  for (const auto& name : {"a", "b", "c", "d"}) {
+    const auto v {boost::add_vertex(g)};
+    g[v].name  = name;
+    g[v].label = std::string("<") + name + ">";
+  }
+  g[1].clusters = {"x"};
+  g[2].clusters = {"x"};
+  g[3].clusters = {"y"};
+  for (size_t i {0}; i < 3; ++i) {
+    const auto [e, _] {boost::add_edge(i, i+1, g)};
+    g[e].label = "e" + std::to_string(i);
+  }
+  return g;
+}
+
+BOOST_AUTO_TEST_CASE(testSelect)
+{
+  const auto& g {getTestGraph()};
+
+  BOOST_TEST((std::vector<bool>{true, true, true, true} == nmdu::selectAll(g)));
+
+  BOOST_TEST((std::vector<bool>{true, false, false, false}
+             == nmdu::selectNeighborhood(g, 0, 0)));
+  BOOST_TEST((std::vector<bool>{true, true, true, false}
+             == nmdu::selectNeighborhood(g, 0, 2)));
+  BOOST_TEST((std::vector<bool>{false, true, true, true}
+             == nmdu::selectNeighborhood(g, 3, 2)));
+
+  BOOST_TEST((std::vector<bool>{true, true, true, true}
+             == nmdu::selectCluster(g, "x")));
+  BOOST_TEST((std::vector<bool>{false, false, true, true}
+             == nmdu::selectCluster(g, "y")));
+  BOOST_TEST((std::vector<bool>{false, false, false, false}
+             == nmdu::selectCluster(g, "z")));
+
+  const auto& sizes {nmdu::getClusterSizes(g)};
+  BOOST_TEST(2 == sizes.size());
+  BOOST_TEST(2 == sizes.at("x"));
+  BOOST_TEST(1 == sizes.at("y"));
+}
+
+BOOST_AUTO_TEST_CASE(testWriteGraphJson)
+{
+  const auto& g {getTestGraph()};
+  std::ostringstream oss;
+  nmdu::writeGraphJson(oss, g, {false, true, true, true});
+
+  const auto out = json::parse(oss.str());
+  BOOST_TEST(false == out.at("directed").get<bool>());
+
+  const auto& nodes {out.at("nodes")};
+  BOOST_TEST(3 == nodes.size());
+  BOOST_TEST("b" == nodes.at(0).at("id"));
+  BOOST_TEST("<b>" == nodes.at(0).at("label"));
+  BOOST_TEST(json::parse(R"(["x"])") == nodes.at(0).at("clusters"));
+
+  // edges to unselected vertices are left out
+  const auto& edges {out.at("edges")};
+  BOOST_TEST(2 == edges.size());
+  BOOST_TEST("b" == edges.at(0).at("source"));
+  BOOST_TEST("c" == edges.at(0).at("target"));
+  BOOST_TEST("e1" == edges.at(0).at("label"));
+  BOOST_TEST(1.0 == edges.at(0).at("weight").get<double>());
+}
+
+BOOST_AUTO_TEST_CASE(testWriteGraphml)
+{
+  const auto& g {getTestGraph()};
+  std::ostringstream oss;
+  nmdu::writeGraphml(oss, g, {true, true, false, false});
+  const auto& out {oss.str()};
+
+  for (const auto& expected
+      : { R"(<key id="node_label" for="node" attr.name="label")"
+          R"( attr.type="string"/>)"
+        , R"(<key id="edge_weight" for="edge" attr.name="weight")"
+          R"( attr.type="double"/>)"
+        , R"(<graph id="G" edgedefault="undirected">)"
+        , R"(<node id="a">)"
+        , R"(<data key="node_label">&lt;a&gt;</data>)"
+        , R"(<edge source="a" target="b">)"
+        , R"(<data key="edge_label">e0</data>)"
+        })
+  {
+    BOOST_TEST(out.find(expected) != std::string::npos, expected);
+  }
+  BOOST_TEST(out.find(R"(<node id="c">)") == std::string::npos);
+  BOOST_TEST(out.find(R"(<edge source="b")") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(testEscapeXml)
+{
+  BOOST_TEST("a&amp;b &lt;c&gt; &quot;d&quot; &apos;e&apos;"
+             == nmdu::escapeXml(R"(a&b <c> "d" 'e')"));
+}
+
+BOOST_AUTO_TEST_CASE(testWriteGraphviz)
+{
+  const auto& g {getTestGraph()};
+  std::ostringstream oss;
+  nmdu::writeGraphviz(oss, g, {false, false, true, true},
+                      boost::default_writer(), boost::default_writer(),
+                      boost::default_writer());
+
+  BOOST_TEST("graph G {\nc;\nd;\nc--d ;\n}\n" == oss.str());
+}
@@ -0,0 +1,106 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/core/utils/StringUtilities.hpp>
+#include <netmeld/datastore/utils/IconIndex.hpp>
+
+namespace nmcu = netmeld::core::utils;
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  IconIndex::IconIndex(const sfs::path& _folder) :
+    folder(_folder)
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  void
+  IconIndex::load()
+  {
+    isLoaded = true;
+    icons.clear();
+
+    std::error_code ec;
+    for ( auto iter {sfs::recursive_directory_iterator(folder, ec)}
+        ; !ec && iter != sfs::recursive_directory_iterator()
+        ; iter.increment(ec)
+        )
+    {
+      if (!iter->is_directory()) {
+        const auto& path {iter->path()};
+        icons.emplace(nmcu::toLower(path.filename().string()), path);
+      }
+    }
+    if (ec) {
+      LOG_WARN << "Failed to read icons folder (" << folder << "): "
+               << ec.message() << '\n';
+    }
+    LOG_DEBUG << "Icons found in " << folder << ": " << icons.size() << '\n';
+  }
+
+  void
+  IconIndex::setFolder(const sfs::path& _folder)
+  {
+    folder   = _folder;
+    isLoaded = false;
+  }
+
+  const sfs::path&
+  IconIndex::getFolder() const
+  {
+    return folder;
+  }
+
+  sfs::path
+  IconIndex::find(const std::string& fileName)
+  {
+    if (!isLoaded) {
+      load();
+    }
+
+    const auto iter {icons.find(nmcu::toLower(fileName))};
+    if (icons.end() == iter) {
+      return {};
+    }
+    return iter->second;
+  }
+
+  size_t
+  IconIndex::size()
+  {
+    if (!isLoaded) {
+      load();
+    }
+    return icons.size();
+  }
+}
@@ -0,0 +1,83 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef ICON_INDEX_HPP
+#define ICON_INDEX_HPP
+
+#include <filesystem>
+#include <map>
+#include <string>
+
+namespace sfs = std::filesystem;
+
+
+namespace netmeld::datastore::utils {
+
+  /* Index of the icon files under a folder, by (case insensitive) file name.
+
+     The folder is walked once, when first searched, instead of for every
+     graph vertex needing an icon.  If names repeat in sub-folders, the first
+     one found is kept.
+   */
+  class IconIndex {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      sfs::path                         folder;
+      std::map<std::string, sfs::path>  icons;
+      bool                              isLoaded {false};
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      IconIndex() = default;
+      explicit IconIndex(const sfs::path&);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      void load();
+
+    protected:
+    public:
+      void setFolder(const sfs::path&);
+      const sfs::path& getFolder() const;
+
+      // Path of the named file, empty if not found
+      sfs::path find(const std::string&);
+
+      size_t size();
+  };
+}
+#endif // ICON_INDEX_HPP
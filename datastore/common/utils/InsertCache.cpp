@@ -0,0 +1,140 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <set>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/InsertCache.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // Inserts whose conflict handling accumulates, so repeats are meaningful
+  static const std::set<std::string_view> NON_IDEMPOTENT_INSERTS {
+      "insert_raw_tool_observations",
+    };
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  InsertCache::InsertCache(pqxx::transaction_base& _t) :
+    t(_t),
+    previous(current())
+  {
+    current() = this;
+  }
+
+  InsertCache::~InsertCache()
+  {
+    current() = previous;
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  InsertCache*&
+  InsertCache::current()
+  {
+    thread_local InsertCache* active {nullptr};
+    return active;
+  }
+
+  InsertCache*
+  InsertCache::find(const pqxx::transaction_base& _t)
+  {
+    for (auto* cache {current()}; cache; cache = cache->previous) {
+      if (&cache->t == &_t) {
+        return cache;
+      }
+    }
+    return nullptr;
+  }
+
+  bool
+  InsertCache::isCacheable(std::string_view statement)
+  {
+    return statement.starts_with("insert_")
+        && !NON_IDEMPOTENT_INSERTS.contains(statement)
+        ;
+  }
+
+  bool
+  InsertCache::record(std::string_view statement, std::string_view key)
+  {
+    auto iter {counts.find(statement)};
+    if (iter == counts.end()) {
+      iter = counts.emplace(std::string(statement), Counts()).first;
+    }
+    auto& count {iter->second};
+
+    ++count.total;
+    if (seen.contains(key)) {
+      ++count.hits;
+      return true;
+    }
+    seen.emplace(key);
+    return false;
+  }
+
+  size_t
+  InsertCache::getHits() const
+  {
+    size_t hits {0};
+    for (const auto& [_, count] : counts) {
+      hits += count.hits;
+    }
+    return hits;
+  }
+
+  size_t
+  InsertCache::getTotal() const
+  {
+    size_t total {0};
+    for (const auto& [_, count] : counts) {
+      total += count.total;
+    }
+    return total;
+  }
+
+  void
+  InsertCache::logStats() const
+  {
+    const auto total {getTotal()};
+    if (0 == total) {
+      return;
+    }
+
+    const auto hits {getHits()};
+    LOG_DEBUG << "Insert cache: skipped " << hits << " of " << total
+              << " inserts (" << (100 * hits / total) << "%)\n";
+    for (const auto& [statement, count] : counts) {
+      if (0 == count.hits) { continue; }
+      LOG_DEBUG << "  " << statement << ": skipped " << count.hits
+                << " of " << count.total << '\n';
+    }
+  }
+}
@@ -0,0 +1,131 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef INSERT_CACHE_HPP
+#define INSERT_CACHE_HPP
+
+#include <functional>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include <pqxx/pqxx>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Remembers the prepared inserts (statement and values) executed in a
+     transaction so exact repeats can be dropped before reaching the server.
+
+     Objects are routinely saved many times during an import (e.g., an
+     IpAddress by each MacAddress it is on), and each repeat would otherwise
+     cost a round trip to do nothing.  Only `insert_*` statements, which are
+     idempotent upserts, are considered; those which accumulate values are
+     excluded.  Per statement hit rates are logged at debug level.
+
+     The full statement and values are kept, so distinct inserts are never
+     mistaken for repeats.  Statements loaded by an active InsertCopy (e.g.,
+     routes and networks, the bulk of large imports) never reach the cache
+     (see execPrepared()), as COPY already handles repeats cheaply and those
+     rows rarely repeat.
+   */
+  class InsertCache {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      struct Counts {
+        size_t  hits  {0};
+        size_t  total {0};
+      };
+
+      struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view value) const
+        { return std::hash<std::string_view>()(value); }
+      };
+
+      pqxx::transaction_base&                      t;
+      std::unordered_set<std::string, KeyHash, std::equal_to<>>
+                                                   seen;
+      std::map<std::string, Counts, std::less<>>   counts;
+      InsertCache*                                 previous;
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      InsertCache() = delete;
+      explicit InsertCache(pqxx::transaction_base&);
+      InsertCache(const InsertCache&) = delete;
+      InsertCache& operator=(const InsertCache&) = delete;
+      ~InsertCache();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      static InsertCache*& current();
+      bool record(std::string_view, std::string_view);
+
+    protected:
+    public:
+      // True if an identical statement was already executed; else records it
+      template<typename... Args>
+      bool isRepeat(pqxx::zview, const Args&...);
+
+      size_t getHits() const;
+      size_t getTotal() const;
+      void logStats() const;
+
+      static bool isCacheable(std::string_view);
+      // Active cache for the transaction (in this thread), if any
+      static InsertCache* find(const pqxx::transaction_base&);
+  };
+
+
+  template<typename... Args>
+  bool
+  InsertCache::isRepeat(pqxx::zview statement, const Args&... args)
+  {
+    if (!isCacheable(statement)) {
+      return false;
+    }
+
+    thread_local std::string key;
+    key.assign(statement);
+    ((key += '\0', key += t.quote(args)), ...);
+
+    return record(statement, key);
+  }
+}
+#endif // INSERT_CACHE_HPP
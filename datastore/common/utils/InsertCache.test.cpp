@@ -0,0 +1,134 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <optional>
+
+#include <netmeld/datastore/utils/InsertCache.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+namespace utf = boost::unit_test;
+
+
+namespace {
+  // Values are quoted by the connection, so these need a server; they run
+  // against a scratch database, e.g.:
+  //   NETMELD_TEST_DB="dbname=netmeld_test" ctest -R InsertCache
+  // and are skipped otherwise.  Nothing is executed or committed.
+  struct HasTestDb
+  {
+    boost::test_tools::assertion_result
+    operator()(utf::test_unit_id) const
+    {
+      boost::test_tools::assertion_result
+        result {nullptr != std::getenv("NETMELD_TEST_DB")};
+      result.message() << "NETMELD_TEST_DB is not set";
+      return result;
+    }
+  };
+
+  const std::string TOOL_RUN_ID {"00000000-0000-0000-0000-000000000001"};
+}
+
+BOOST_AUTO_TEST_CASE(testIsCacheable)
+{
+  BOOST_TEST(nmdu::InsertCache::isCacheable("insert_raw_ip_addr"));
+  BOOST_TEST(nmdu::InsertCache::isCacheable("insert_raw_device"));
+
+  // Accumulating conflict handling, so repeats are meaningful
+  BOOST_TEST(!nmdu::InsertCache::isCacheable("insert_raw_tool_observations"));
+  // Not an insert
+  BOOST_TEST(!nmdu::InsertCache::isCacheable("select_ip_addrs"));
+  BOOST_TEST(!nmdu::InsertCache::isCacheable("update_raw_ip_addr"));
+}
+
+BOOST_AUTO_TEST_CASE(testHitMiss, * utf::precondition(HasTestDb()))
+{
+  pqxx::connection db {std::getenv("NETMELD_TEST_DB")};
+  pqxx::work t {db};
+
+  nmdu::InsertCache cache {t};
+  BOOST_TEST(&cache == nmdu::InsertCache::find(t));
+
+  const std::string stmt {"insert_raw_ip_addr"};
+
+  // First seen is a miss, an exact repeat a hit
+  BOOST_TEST(!cache.isRepeat(stmt, TOOL_RUN_ID, "10.0.0.1/32", true));
+  BOOST_TEST(cache.isRepeat(stmt, TOOL_RUN_ID, "10.0.0.1/32", true));
+
+  // Any differing value, or statement, is distinct
+  BOOST_TEST(!cache.isRepeat(stmt, TOOL_RUN_ID, "10.0.0.2/32", true));
+  BOOST_TEST(!cache.isRepeat(stmt, TOOL_RUN_ID, "10.0.0.1/32", false));
+  BOOST_TEST(!cache.isRepeat("insert_raw_ip_addr_2",
+                             TOOL_RUN_ID, "10.0.0.1/32", true));
+
+  // As are NULL and its text, and values split differently across arguments
+  const std::optional<std::string> null;
+  BOOST_TEST(!cache.isRepeat(stmt, TOOL_RUN_ID, null));
+  BOOST_TEST(!cache.isRepeat(stmt, TOOL_RUN_ID, std::string("NULL")));
+  BOOST_TEST(!cache.isRepeat(stmt, "ab", "c"));
+  BOOST_TEST(!cache.isRepeat(stmt, "a", "bc"));
+
+  // Uncacheable statements always run
+  BOOST_TEST(!cache.isRepeat("insert_raw_tool_observations", TOOL_RUN_ID));
+  BOOST_TEST(!cache.isRepeat("insert_raw_tool_observations", TOOL_RUN_ID));
+
+  BOOST_TEST(1 == cache.getHits());
+  BOOST_TEST(9 == cache.getTotal());
+
+  // Every distinct row is kept, however many there are
+  size_t hits {0};
+  for (size_t i {0}; i < 100000; ++i) {
+    hits += cache.isRepeat("insert_raw_port", TOOL_RUN_ID, i);
+  }
+  BOOST_TEST(0 == hits);
+}
+
+BOOST_AUTO_TEST_CASE(testCopyBypass, * utf::precondition(HasTestDb()))
+{
+  pqxx::connection db {std::getenv("NETMELD_TEST_DB")};
+  pqxx::work t {db};
+
+  nmdu::InsertCache cache {t};
+  nmdu::InsertCopy  copy {t};
+
+  // Copied statements are buffered as given, repeats included, and never
+  // reach the cache; the buffered rows are discarded, not flushed
+  const std::string stmt {"insert_raw_ip_net"};
+  BOOST_TEST(nmdu::InsertCopy::isCopyable(stmt));
+  BOOST_TEST(nmdu::InsertCache::isCacheable(stmt));
+  for (size_t i {0}; i < 3; ++i) {
+    nmdu::execPrepared(t, stmt, TOOL_RUN_ID, "10.0.0.0/8", "");
+  }
+  BOOST_TEST(3 == copy.count());
+  BOOST_TEST(0 == cache.getTotal());
+}
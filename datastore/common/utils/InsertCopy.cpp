@@ -0,0 +1,280 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
+#include <netmeld/datastore/utils/InsertPipeline.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // Prepared inserts which can be loaded by COPY, in the order flushed (so
+  // rows are in place before any rows referencing them).  Each `insert` reads
+  // the COPY rows from `insert_copy_rows` (columns c1 to cN, for the
+  // statement's $1 to $N, plus `n` for the row order) and must match the
+  // conversions and conflict handling of the prepared statement.
+  struct CopyTarget {
+    std::string_view  statement;
+    size_t            columns;
+    const char*       insert;
+  };
+
+  static const CopyTarget COPY_TARGETS[] {
+      {"insert_raw_ip_net", 3, R"(
+          INSERT INTO raw_ip_nets
+            (tool_run_id, ip_net, description)
+          SELECT c1::UUID, network((c2)::INET), nullif(c3, '')
+          FROM insert_copy_rows
+          ORDER BY n
+          ON CONFLICT
+          DO NOTHING
+        )"},
+      {"insert_ip_net_extra_weight", 2, R"(
+          INSERT INTO ip_nets_extra_weights
+            (ip_net, extra_weight)
+          SELECT network((c1)::INET), c2::FLOAT
+          FROM insert_copy_rows
+          ORDER BY n
+          ON CONFLICT
+          DO NOTHING
+        )"},
+      // Rows for the same address are combined first, as one statement may
+      // not update the same row twice
+      {"insert_raw_ip_addr", 3, R"(
+          INSERT INTO raw_ip_addrs AS orig
+            (tool_run_id, ip_addr, is_responding)
+          SELECT c1::UUID, host((c2)::INET)::INET, bool_or(c3::BOOLEAN)
+          FROM insert_copy_rows
+          GROUP BY 1, 2
+          ON CONFLICT
+            (tool_run_id, ip_addr)
+          DO UPDATE
+            SET is_responding =
+                GREATEST(orig.is_responding, EXCLUDED.is_responding)
+        )"},
+      {"insert_raw_hostname", 4, R"(
+          INSERT INTO raw_hostnames
+            (tool_run_id, ip_addr, hostname, reason)
+          SELECT c1::UUID, host((c2)::INET)::INET, c3, c4
+          FROM insert_copy_rows
+          ORDER BY n
+          ON CONFLICT
+          DO NOTHING
+        )"},
+      {"insert_raw_device_vrf", 3, R"(
+          INSERT INTO raw_device_vrfs
+            (tool_run_id, device_id, vrf_id)
+          SELECT c1::UUID, c2, c3
+          FROM insert_copy_rows
+          ORDER BY n
+          ON CONFLICT
+          DO NOTHING
+        )"},
+      {"insert_raw_device_ip_route", 14, R"(
+          INSERT INTO raw_device_ip_routes(
+                tool_run_id, device_id
+              , vrf_id , table_id
+              , is_active
+              , dst_ip_net
+              , next_vrf_id , next_table_id
+              , next_hop_ip_addr , outgoing_interface_name
+              , protocol , administrative_distance, metric
+              , description
+            )
+          SELECT
+                c1::UUID, c2
+              , nullif(c3, '') , nullif(c4, '')
+              , c5::BOOLEAN
+              , network((c6)::INET)
+              , nullif(c7, '') , nullif(c8, '')
+              , host((nullif(c9, ''))::INET)::INET , nullif(c10, '')
+              , nullif(c11, '') , c12::INT, c13::INT
+              , nullif(c14, '')
+          FROM insert_copy_rows
+          ORDER BY n
+          ON CONFLICT
+          DO NOTHING
+        )"},
+      {"insert_tool_run_ip_route", 4, R"(
+          INSERT INTO tool_run_ip_routes
+            (tool_run_id, interface_name, dst_ip_net, next_hop_ip_addr)
+          SELECT c1::UUID, c2, network((c3)::INET), host((c4)::INET)::INET
+          FROM insert_copy_rows
+          ORDER BY n
+          ON CONFLICT
+          DO NOTHING
+        )"},
+    };
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  InsertCopy::InsertCopy(pqxx::transaction_base& _t, size_t _limit) :
+    t(_t),
+    limit(std::max<size_t>(_limit, 1)),
+    previous(current())
+  {
+    current() = this;
+  }
+
+  InsertCopy::~InsertCopy()
+  {
+    current() = previous;
+    if (0 < buffered) {
+      LOG_DEBUG << "Discarding " << buffered
+                << " rows buffered for copy" << std::endl;
+    }
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  InsertCopy*&
+  InsertCopy::current()
+  {
+    thread_local InsertCopy* active {nullptr};
+    return active;
+  }
+
+  InsertCopy*
+  InsertCopy::find(const pqxx::transaction_base& _t)
+  {
+    for (auto* copy {current()}; copy; copy = copy->previous) {
+      if (&copy->t == &_t) {
+        return copy;
+      }
+    }
+    return nullptr;
+  }
+
+  bool
+  InsertCopy::isCopyable(std::string_view statement)
+  {
+    for (const auto& target : COPY_TARGETS) {
+      if (target.statement == statement) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Append value as a COPY text format field
+  void
+  InsertCopy::appendField(std::string& buffer, std::string_view value)
+  {
+    // Most values need no escaping, so copy the runs between escapes whole
+    while (!value.empty()) {
+      const auto pos {value.find_first_of("\\\t\n\r")};
+      buffer.append(value.substr(0, pos));
+      if (std::string_view::npos == pos) {
+        break;
+      }
+      switch (value[pos]) {
+        case '\\': buffer += "\\\\"; break;
+        case '\t': buffer += "\\t";  break;
+        case '\n': buffer += "\\n";  break;
+        case '\r': buffer += "\\r";  break;
+      }
+      value.remove_prefix(pos + 1);
+    }
+  }
+
+  std::string&
+  InsertCopy::bufferFor(std::string_view statement)
+  {
+    auto iter {buffers.find(statement)};
+    if (iter == buffers.end()) {
+      iter = buffers.emplace(std::string(statement), std::string()).first;
+    }
+    return iter->second;
+  }
+
+  void
+  InsertCopy::rowAdded()
+  {
+    if (++buffered >= limit) {
+      flush();
+    }
+  }
+
+  void
+  InsertCopy::flush()
+  {
+    if (0 == buffered) {
+      return;
+    }
+
+    // The transaction can only do one thing at a time
+    if (auto* pipeline {InsertPipeline::find(t)}) {
+      pipeline->flush();
+    }
+
+    for (const auto& target : COPY_TARGETS) {
+      auto iter {buffers.find(target.statement)};
+      if (iter == buffers.end() || iter->second.empty()) {
+        continue;
+      }
+
+      std::string columns;
+      for (size_t i {1}; i <= target.columns; ++i) {
+        columns += (1 == i ? "c" : ", c") + std::to_string(i);
+      }
+      std::string create {"CREATE TEMP TABLE insert_copy_rows (n BIGSERIAL"};
+      for (size_t i {1}; i <= target.columns; ++i) {
+        create += ", c" + std::to_string(i) + " TEXT";
+      }
+      create += ") ON COMMIT DROP";
+      t.exec(create);
+
+      auto stream {pqxx::stream_to::raw_table(t, "insert_copy_rows", columns)};
+      std::string_view rows {iter->second};
+      while (!rows.empty()) {
+        const auto end {rows.find('\n')};
+        stream.write_raw_line(rows.substr(0, end));
+        rows.remove_prefix(end + 1);
+      }
+      stream.complete();
+
+      t.exec(target.insert);
+      t.exec("DROP TABLE insert_copy_rows");
+
+      LOG_DEBUG << "Copied rows for " << target.statement << '\n';
+      iter->second.clear();
+    }
+
+    copied += buffered;
+    buffered = 0;
+  }
+
+  size_t
+  InsertCopy::count() const
+  {
+    return copied + buffered;
+  }
+}
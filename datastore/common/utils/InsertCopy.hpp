@@ -0,0 +1,126 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef INSERT_COPY_HPP
+#define INSERT_COPY_HPP
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <pqxx/pqxx>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Loads the rows of select prepared inserts with COPY, instead of one
+     statement per row.
+
+     While an instance exists, execPrepared() calls against its transaction
+     for a supported statement (see isCopyable()) are buffered as COPY text
+     rows.  On flush() each statement's rows are streamed into a temporary
+     table and moved into place with a single `INSERT ... SELECT`, which
+     applies the same conversions and conflict handling as the prepared
+     statement.  Rows are flushed automatically once `limit` are buffered,
+     and before any other statement is executed through execPrepared() as it
+     may reference them (e.g., by foreign key).  Any active InsertPipeline on
+     the transaction is flushed first.  flush() before any other use of the
+     transaction (e.g., other queries or commit).
+   */
+  class InsertCopy {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      pqxx::transaction_base&                          t;
+      const size_t                                     limit;
+      std::map<std::string, std::string, std::less<>>  buffers;
+      InsertCopy*                                      previous;
+      size_t                                           buffered {0};
+      size_t                                           copied {0};
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      InsertCopy() = delete;
+      // Buffer up to `limit` rows before copying them to the server
+      explicit InsertCopy(pqxx::transaction_base&, size_t = 100000);
+      InsertCopy(const InsertCopy&) = delete;
+      InsertCopy& operator=(const InsertCopy&) = delete;
+      ~InsertCopy();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      static InsertCopy*& current();
+      static void appendField(std::string&, std::string_view);
+      std::string& bufferFor(std::string_view);
+      void rowAdded();
+
+    protected:
+    public:
+      template<typename... Args>
+      void execPrepared(pqxx::zview, const Args&...);
+      void flush();
+
+      size_t count() const;
+
+      static bool isCopyable(std::string_view);
+      // Active copy for the transaction (in this thread), if any
+      static InsertCopy* find(const pqxx::transaction_base&);
+  };
+
+
+  template<typename... Args>
+  void
+  InsertCopy::execPrepared(pqxx::zview statement, const Args&... args)
+  {
+    auto& buffer {bufferFor(statement)};
+    std::string_view sep {""};
+    const auto append {[&buffer](const auto& arg)
+      {
+        // Text is appended as is, rather than through a temporary string
+        if constexpr (std::is_convertible_v<decltype(arg), std::string_view>) {
+          appendField(buffer, arg);
+        } else {
+          appendField(buffer, pqxx::to_string(arg));
+        }
+      }};
+    ((buffer += std::exchange(sep, "\t"), append(args)), ...);
+    buffer += '\n';
+    rowAdded();
+  }
+}
+#endif // INSERT_COPY_HPP
@@ -0,0 +1,138 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/InsertPipeline.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  InsertPipeline::InsertPipeline(pqxx::transaction_base& _t, size_t _depth) :
+    t(_t),
+    depth(std::max<size_t>(_depth, 1)),
+    previous(current())
+  {
+    current() = this;
+  }
+
+  InsertPipeline::~InsertPipeline()
+  {
+    current() = previous;
+    if (!pending.empty()) {
+      LOG_DEBUG << "Discarding " << pending.size()
+                << " pipelined statements" << std::endl;
+    }
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  InsertPipeline*&
+  InsertPipeline::current()
+  {
+    thread_local InsertPipeline* active {nullptr};
+    return active;
+  }
+
+  InsertPipeline*
+  InsertPipeline::find(const pqxx::transaction_base& _t)
+  {
+    for (auto* pipeline {current()}; pipeline; pipeline = pipeline->previous) {
+      if (&pipeline->t == &_t) {
+        return pipeline;
+      }
+    }
+    return nullptr;
+  }
+
+  void
+  InsertPipeline::insert(const std::string& query, std::string_view statement)
+  {
+    if (!pipeline) {
+      pipeline = std::make_unique<pqxx::pipeline>(t);
+      pipeline->retain(static_cast<int>(depth));
+    }
+
+    const auto queuedAt {Profiler::Clock::now()};
+    pending.push_back({pipeline->insert(query), query, std::string(statement),
+                       queuedAt});
+    ++queued;
+
+    // Collect what is done, so failures surface near their cause, and bound
+    // how much is held waiting on the server
+    while (!pending.empty()
+           && (  pending.size() > 2 * depth
+              || pipeline->is_finished(pending.front().id)))
+    {
+      retrieveOldest();
+    }
+  }
+
+  void
+  InsertPipeline::retrieveOldest()
+  {
+    const auto oldest {std::move(pending.front())};
+    pending.pop_front();
+    try {
+      pipeline->retrieve(oldest.id);
+    } catch (const std::exception& e) {
+      LOG_ERROR << "Pipelined statement failed: " << oldest.query << '\n'
+                << e.what() << std::endl;
+      pending.clear();
+      throw;
+    }
+
+    if (auto* profiler {Profiler::getActive()}) {
+      profiler->addStatement(oldest.statement, oldest.queued);
+    }
+  }
+
+  void
+  InsertPipeline::flush()
+  {
+    if (!pipeline) {
+      return;
+    }
+
+    while (!pending.empty()) {
+      retrieveOldest();
+    }
+    pipeline->complete();
+    pipeline.reset();
+  }
+
+  size_t
+  InsertPipeline::count() const
+  {
+    return queued;
+  }
+}
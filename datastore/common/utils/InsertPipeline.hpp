@@ -0,0 +1,129 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef INSERT_PIPELINE_HPP
+#define INSERT_PIPELINE_HPP
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/datastore/utils/Profiler.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Runs prepared statements through a pqxx::pipeline so many are in flight
+     at once, instead of each waiting on a full round trip to the server.
+
+     While an instance exists, execPrepared() calls against its transaction
+     are queued rather than executed.  Results are collected in order as
+     they arrive and the first failure is logged with the statement and
+     values which caused it, then rethrown.  The pipeline owns the
+     transaction while open, so flush() before any other use of it (e.g.,
+     other queries or commit).
+
+     Statements are timed for the active Profiler, if any, from when they
+     are queued until their result is retrieved.  As results are only
+     checked for while queuing more or flushing, this is an upper bound on
+     the server's time.
+   */
+  class InsertPipeline {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      struct Pending {
+        pqxx::pipeline::query_id     id;
+        std::string                  query;
+        std::string                  statement;
+        Profiler::Clock::time_point  queued;
+      };
+
+      pqxx::transaction_base&          t;
+      const size_t                     depth;
+      std::unique_ptr<pqxx::pipeline>  pipeline;
+      std::deque<Pending>              pending;
+      InsertPipeline*                  previous;
+      size_t                           queued {0};
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      InsertPipeline() = delete;
+      // Pipeline up to `depth` statements on the transaction
+      InsertPipeline(pqxx::transaction_base&, size_t);
+      InsertPipeline(const InsertPipeline&) = delete;
+      InsertPipeline& operator=(const InsertPipeline&) = delete;
+      ~InsertPipeline();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      static InsertPipeline*& current();
+      void retrieveOldest();
+
+    protected:
+    public:
+      template<typename... Args>
+      void execPrepared(pqxx::zview, Args&&...);
+      // Queue the query, timed as the named statement
+      void insert(const std::string&, std::string_view);
+      void flush();
+
+      size_t count() const;
+
+      // Active pipeline for the transaction (in this thread), if any
+      static InsertPipeline* find(const pqxx::transaction_base&);
+  };
+
+
+  template<typename... Args>
+  void
+  InsertPipeline::execPrepared(pqxx::zview statement, Args&&... args)
+  {
+    std::string query {"EXECUTE "};
+    query += statement;
+    if constexpr (sizeof...(Args) > 0) {
+      std::string sep {"("};
+      ((query += std::exchange(sep, ", "), query += t.quote(args)), ...);
+      query += ')';
+    }
+    insert(query, statement);
+  }
+}
+#endif // INSERT_PIPELINE_HPP
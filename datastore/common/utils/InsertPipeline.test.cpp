@@ -0,0 +1,137 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+
+#include <netmeld/datastore/utils/InsertPipeline.hpp>
+#include <netmeld/datastore/utils/Profiler.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+namespace utf = boost::unit_test;
+
+
+namespace {
+  // Pipelines need a server; these run against a scratch database, e.g.:
+  //   NETMELD_TEST_DB="dbname=netmeld_test" ctest -R InsertPipeline
+  // and are skipped otherwise.  Only temporary tables are used.
+  struct HasTestDb
+  {
+    boost::test_tools::assertion_result
+    operator()(utf::test_unit_id) const
+    {
+      boost::test_tools::assertion_result
+        result {nullptr != std::getenv("NETMELD_TEST_DB")};
+      result.message() << "NETMELD_TEST_DB is not set";
+      return result;
+    }
+  };
+
+  const std::string INSERT {"insert_pipeline_test"};
+
+  void
+  prepareTable(pqxx::connection& db)
+  {
+    pqxx::nontransaction n {db};
+    n.exec("CREATE TEMP TABLE pipeline_test"
+           " (id SERIAL, seq INT PRIMARY KEY)");
+    db.prepare(INSERT, "INSERT INTO pipeline_test (seq) VALUES ($1)");
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOrdering, * utf::precondition(HasTestDb()))
+{
+  pqxx::connection db {std::getenv("NETMELD_TEST_DB")};
+  prepareTable(db);
+
+  pqxx::work t {db};
+  {
+    nmdu::InsertPipeline pipeline {t, 4};
+    BOOST_TEST(&pipeline == nmdu::InsertPipeline::find(t));
+
+    // Far more than the depth, so results are collected while queuing
+    for (int i {0}; i < 100; ++i) {
+      nmdu::execPrepared(t, INSERT, i);
+    }
+    BOOST_TEST(100 == pipeline.count());
+    pipeline.flush();
+  }
+  BOOST_TEST(nullptr == nmdu::InsertPipeline::find(t));
+
+  // Executed in the order queued
+  const auto& rows {t.exec("SELECT seq FROM pipeline_test ORDER BY id")};
+  BOOST_TEST(100 == rows.size());
+  for (int i {0}; i < 100; ++i) {
+    BOOST_TEST(i == rows[i][0].as<int>());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testQueuedError, * utf::precondition(HasTestDb()))
+{
+  pqxx::connection db {std::getenv("NETMELD_TEST_DB")};
+  prepareTable(db);
+
+  pqxx::work t {db};
+  nmdu::InsertPipeline pipeline {t, 2};
+
+  // The duplicate fails on the server after being queued; it must surface
+  // by the time the pipeline is flushed, not be lost
+  BOOST_CHECK_THROW(
+      {
+        for (int i : {0, 1, 0, 2, 3, 4, 5}) {
+          nmdu::execPrepared(t, INSERT, i);
+        }
+        pipeline.flush();
+      },
+      pqxx::sql_error);
+}
+
+BOOST_AUTO_TEST_CASE(testProfiledOnRetrieve, * utf::precondition(HasTestDb()))
+{
+  pqxx::connection db {std::getenv("NETMELD_TEST_DB")};
+  prepareTable(db);
+
+  nmdu::Profiler profiler;
+  profiler.enable();
+
+  pqxx::work t {db};
+  nmdu::InsertPipeline pipeline {t, 64};
+  for (int i {0}; i < 10; ++i) {
+    nmdu::execPrepared(t, INSERT, i);
+  }
+  pipeline.flush();
+
+  // Each counted once, when its result arrived
+  const auto& report {profiler.toJson()};
+  const auto& statement {report.at("statements").at(INSERT)};
+  BOOST_TEST(10 == statement.at("calls").get<size_t>());
+  BOOST_TEST(statement.at("maxSeconds").get<double>()
+             <= statement.at("seconds").get<double>());
+}
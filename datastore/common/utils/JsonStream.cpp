@@ -0,0 +1,86 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+using json = nlohmann::json;
+
+
+namespace netmeld::datastore::utils {
+
+  json
+  parseJsonStream(std::istream& in, const std::set<std::string>& keys,
+                  const JsonStreamHandler& handler)
+  {
+    // Depths, as reported to the callback, of the top level object's
+    // members and of the elements of its arrays
+    constexpr int MEMBER_DEPTH  {1};
+    constexpr int ELEMENT_DEPTH {2};
+
+    std::string key;
+    bool isNamed     {false};
+    bool isStreaming {false};
+
+    json::parser_callback_t callback =
+      [&](int depth, json::parse_event_t event, json& parsed)
+      {
+        switch (event) {
+          case json::parse_event_t::key:
+            if (MEMBER_DEPTH == depth) {
+              key     = parsed.get<std::string>();
+              isNamed = keys.contains(key);
+            }
+            break;
+          case json::parse_event_t::array_start:
+            if (MEMBER_DEPTH == depth && isNamed) {
+              isStreaming = true;
+            }
+            break;
+          case json::parse_event_t::array_end:
+          case json::parse_event_t::object_end:
+          case json::parse_event_t::value:
+            if (isStreaming && ELEMENT_DEPTH == depth) {
+              handler(key, parsed);
+              return false;
+            }
+            if (MEMBER_DEPTH == depth && isNamed) {
+              if (isStreaming) {
+                isStreaming = false;
+              } else {
+                handler(key, parsed);
+              }
+              isNamed = false;
+            }
+            break;
+          default:
+            break;
+        }
+        return true;
+      };
+
+    return json::parse(in, callback);
+  }
+}
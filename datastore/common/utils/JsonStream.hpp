@@ -0,0 +1,56 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef JSON_STREAM_HPP
+#define JSON_STREAM_HPP
+
+#include <functional>
+#include <istream>
+#include <set>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  using JsonStreamHandler =
+    std::function<void(const std::string&, const nlohmann::json&)>;
+
+  /* Parse a JSON object from the stream without building the whole document.
+
+     Each element of the named top level arrays (e.g., "Reservations") is
+     handed to the handler, with the array's name, as soon as it is complete
+     and is then discarded; so at most one element is held in memory.  Other
+     values of the named top level members are handed over as well, but are
+     also kept.  The rest of the document is returned, with the named arrays
+     left empty.
+   */
+  nlohmann::json
+  parseJsonStream(std::istream&, const std::set<std::string>&,
+                  const JsonStreamHandler&);
+}
+#endif // JSON_STREAM_HPP
@@ -0,0 +1,105 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+using json = nlohmann::json;
+
+
+BOOST_AUTO_TEST_CASE(testParseJsonStream)
+{
+  {
+    std::istringstream iss {R"(
+        { "NextToken": "abc"
+        , "Items": [{"Id": 1, "Nested": [{"Id": 2}]}, 3, [4, 5]]
+        , "Others": [{"Id": 6}]
+        }
+      )"};
+    std::vector<std::pair<std::string, json>> handled;
+    const auto rest = nmdu::parseJsonStream(iss, {"Items"},
+        [&](const std::string& _key, const json& _value) {
+          handled.emplace_back(_key, _value);
+        });
+
+    BOOST_TEST(3 == handled.size());
+    BOOST_TEST("Items" == handled.at(0).first);
+    BOOST_TEST(json::parse(R"({"Id": 1, "Nested": [{"Id": 2}]})")
+               == handled.at(0).second);
+    BOOST_TEST(json(3) == handled.at(1).second);
+    BOOST_TEST(json::parse("[4, 5]") == handled.at(2).second);
+
+    const auto tev = json::parse(R"(
+        {"NextToken": "abc", "Items": [], "Others": [{"Id": 6}]}
+      )");
+    BOOST_TEST(tev == rest);
+  }
+  {
+    // non-array members are handed over, in order, and kept
+    std::istringstream iss {R"(
+        {"kind": "a", "items": [{"Id": 1}], "more": {"kind": "b"}}
+      )"};
+    std::vector<std::pair<std::string, json>> handled;
+    const auto rest = nmdu::parseJsonStream(iss, {"kind", "items", "more"},
+        [&](const std::string& _key, const json& _value) {
+          handled.emplace_back(_key, _value);
+        });
+
+    BOOST_TEST(3 == handled.size());
+    BOOST_TEST("kind" == handled.at(0).first);
+    BOOST_TEST(json("a") == handled.at(0).second);
+    BOOST_TEST("items" == handled.at(1).first);
+    BOOST_TEST("more" == handled.at(2).first);
+    BOOST_TEST(json::parse(R"({"kind": "b"})") == handled.at(2).second);
+
+    const auto tev = json::parse(R"(
+        {"kind": "a", "items": [], "more": {"kind": "b"}}
+      )");
+    BOOST_TEST(tev == rest);
+  }
+  {
+    // missing arrays are not an error here, malformed input is
+    std::istringstream iss {R"({"Other": []})"};
+    size_t count {0};
+    const auto rest = nmdu::parseJsonStream(iss, {"Items"},
+        [&](const std::string&, const json&) { ++count; });
+    BOOST_TEST(0 == count);
+    BOOST_TEST(!rest.contains("Items"));
+
+    std::istringstream bad {R"({"Items": [{"Id": 1}, )"};
+    BOOST_CHECK_THROW(nmdu::parseJsonStream(bad, {"Items"},
+          [&](const std::string&, const json&) { ++count; }),
+        json::parse_error);
+    BOOST_TEST(1 == count);
+  }
+}
@@ -0,0 +1,201 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <cctype>
+
+#include <netmeld/datastore/utils/MacVendorTrie.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  MacVendorTrie::MacVendorTrie()
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  uint32_t
+  MacVendorTrie::internVendor(const std::string& vendor)
+  {
+    const auto& iter {vendorIds.find(vendor)};
+    if (iter != vendorIds.end()) {
+      return iter->second;
+    }
+
+    const auto id {static_cast<uint32_t>(vendors.size())};
+    vendors.push_back(vendor);
+    vendorIds.emplace(vendor, id);
+    return id;
+  }
+
+  bool
+  MacVendorTrie::addSub(SubAssignments& subs, uint16_t suffix, uint32_t id)
+  {
+    auto iter {std::lower_bound(subs.begin(), subs.end(),
+                                std::make_pair(suffix, uint32_t {0}))};
+    if (iter != subs.end() && iter->first == suffix) {
+      iter->second = id;
+      return false;
+    }
+
+    subs.emplace(iter, suffix, id);
+    return true;
+  }
+
+  const std::string*
+  MacVendorTrie::findSub(const SubAssignments& subs, uint16_t suffix,
+                         const std::vector<std::string>& vendors)
+  {
+    auto iter {std::lower_bound(subs.begin(), subs.end(),
+                                std::make_pair(suffix, uint32_t {0}))};
+    if (iter != subs.end() && iter->first == suffix) {
+      return &vendors[iter->second];
+    }
+
+    return nullptr;
+  }
+
+  bool
+  MacVendorTrie::add(uint64_t prefix, size_t bits, const std::string& vendor)
+  {
+    const auto oui    {static_cast<uint32_t>((prefix >> 24) & 0xFFFFFF)};
+    const auto next12 {static_cast<uint16_t>((prefix >> 12) & 0xFFF)};
+
+    bool added {false};
+    switch (bits) {
+      case 24:
+        {
+          auto& node {ouis[oui]};
+          added = (NO_VENDOR == node.vendor);
+          node.vendor = internVendor(vendor);
+          break;
+        }
+      case 28:
+        added = addSub(ouis[oui].maM, next12 >> 8, internVendor(vendor));
+        break;
+      case 36:
+        added = addSub(ouis[oui].maS, next12, internVendor(vendor));
+        break;
+      default:
+        return false;
+    }
+
+    if (added) { ++count; }
+
+    return true;
+  }
+
+  bool
+  MacVendorTrie::add(const std::string& prefix, size_t bits,
+                     const std::string& vendor)
+  {
+    uint64_t value {0};
+    size_t digits {0};
+    for (const auto c : prefix) {
+      if (!std::isxdigit(static_cast<unsigned char>(c))) { continue; }
+      const uint64_t nibble
+        {static_cast<uint64_t>(std::isdigit(static_cast<unsigned char>(c))
+                               ? c - '0'
+                               : std::tolower(c) - 'a' + 10)};
+      value = (value << 4) | nibble;
+      ++digits;
+    }
+    if (12 != digits) {
+      return false;
+    }
+
+    return add(value, bits, vendor);
+  }
+
+  void
+  MacVendorTrie::load(pqxx::transaction_base& t)
+  {
+    const auto& rows {t.exec(
+        "SELECT mac_prefix::TEXT, prefix_length, vendor_name"
+        " FROM vendor_mac_prefixes"
+      )};
+    for (const auto& row : rows) {
+      add(row[0].as<std::string>(), row[1].as<size_t>(),
+          row[2].as<std::string>());
+    }
+  }
+
+  std::string
+  MacVendorTrie::lookup(const std::vector<uint8_t>& mac) const
+  {
+    if (6 != mac.size()) {
+      return "";
+    }
+
+    const uint32_t oui {  (static_cast<uint32_t>(mac[0]) << 16)
+                        | (static_cast<uint32_t>(mac[1]) << 8)
+                        |  static_cast<uint32_t>(mac[2])
+                       };
+    const auto& iter {ouis.find(oui)};
+    if (iter == ouis.end()) {
+      return "";
+    }
+
+    const auto& node {iter->second};
+    const uint16_t next12 {static_cast<uint16_t>(
+        (static_cast<uint16_t>(mac[3]) << 4) | (mac[4] >> 4))};
+    if (const auto* vendor {findSub(node.maS, next12, vendors)}) {
+      return *vendor;
+    }
+    if (const auto* vendor {findSub(node.maM, next12 >> 8, vendors)}) {
+      return *vendor;
+    }
+
+    if (NO_VENDOR != node.vendor) {
+      return vendors[node.vendor];
+    }
+
+    return "";
+  }
+
+  std::string
+  MacVendorTrie::lookup(const nmdo::MacAddress& mac) const
+  {
+    return lookup(mac.getMac());
+  }
+
+  size_t
+  MacVendorTrie::size() const
+  {
+    return count;
+  }
+
+  bool
+  MacVendorTrie::empty() const
+  {
+    return 0 == count;
+  }
+}
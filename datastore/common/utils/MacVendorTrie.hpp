@@ -0,0 +1,112 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef MAC_VENDOR_TRIE_HPP
+#define MAC_VENDOR_TRIE_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/datastore/objects/MacAddress.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+
+
+namespace netmeld::datastore::utils {
+
+  /* Longest prefix match of MAC addresses to vendors, for tagging at ingest.
+
+     Assignments are MA-L (24-bit), MA-M (28-bit), or MA-S (36-bit).  The
+     trie is two levels: 24-bit OUIs, each holding its MA-L vendor (if any)
+     and sorted lists of the MA-M/MA-S assignments carved out of it.
+     Vendor names are stored once and referenced by index.
+   */
+  class MacVendorTrie {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      static constexpr uint32_t NO_VENDOR {UINT32_MAX};
+
+      // (bits following the OUI, vendor) sorted by those bits
+      using SubAssignments = std::vector<std::pair<uint16_t, uint32_t>>;
+
+      struct Node {
+        uint32_t        vendor {NO_VENDOR}; // MA-L
+        SubAssignments  maM;                // next 4 bits
+        SubAssignments  maS;                // next 12 bits
+      };
+
+      std::map<std::string, uint32_t, std::less<>> vendorIds;
+
+    protected:
+      std::unordered_map<uint32_t, Node>  ouis;
+      std::vector<std::string>            vendors;
+      size_t                              count {0};
+
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      MacVendorTrie();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      uint32_t internVendor(const std::string&);
+      bool addSub(SubAssignments&, uint16_t, uint32_t);
+      static const std::string* findSub(const SubAssignments&, uint16_t,
+                                        const std::vector<std::string>&);
+
+    protected:
+    public:
+      // Add prefix (top `bits` of a 48-bit value); false if unsupported
+      bool add(uint64_t, size_t, const std::string&);
+      // Add prefix given as MAC text (e.g., "00:50:c2:a0:00:00")
+      bool add(const std::string&, size_t, const std::string&);
+
+      // Load all assignments from the vendor_mac_prefixes table
+      void load(pqxx::transaction_base&);
+
+      std::string lookup(const std::vector<uint8_t>&) const;
+      std::string lookup(const nmdo::MacAddress&) const;
+
+      size_t size() const;
+      bool empty() const;
+  };
+}
+#endif // MAC_VENDOR_TRIE_HPP
@@ -0,0 +1,92 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/MacVendorTrie.hpp>
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
+
+
+class TestMacVendorTrie : public nmdu::MacVendorTrie {
+  public:
+    using MacVendorTrie::ouis;
+    using MacVendorTrie::vendors;
+};
+
+BOOST_AUTO_TEST_CASE(testAdd)
+{
+  {
+    TestMacVendorTrie trie;
+
+    BOOST_TEST(trie.empty());
+    BOOST_TEST(trie.add("00:50:c2:00:00:00", 24, "Vendor A"));
+    BOOST_TEST(trie.add("00:50:c2:a0:00:00", 28, "Vendor B"));
+    BOOST_TEST(trie.add("00:50:c2:ab:c0:00", 36, "Vendor A"));
+    BOOST_TEST(3 == trie.size());
+    BOOST_TEST(1 == trie.ouis.size());
+    BOOST_TEST(2 == trie.vendors.size());
+
+    // replacing an assignment does not grow the trie
+    BOOST_TEST(trie.add("00:50:c2:a0:00:00", 28, "Vendor C"));
+    BOOST_TEST(3 == trie.size());
+    BOOST_TEST(3 == trie.vendors.size());
+  }
+
+  {
+    TestMacVendorTrie trie;
+
+    BOOST_TEST(!trie.add("00:50:c2:00:00:00", 32, "Vendor A"));
+    BOOST_TEST(!trie.add("00:50:c2", 24, "Vendor A"));
+    BOOST_TEST(!trie.add(0x0050C2000000, 48, "Vendor A"));
+    BOOST_TEST(trie.add(0x0050C2000000, 24, "Vendor A"));
+    BOOST_TEST(1 == trie.size());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLookup)
+{
+  nmdu::MacVendorTrie trie;
+  trie.add("00:50:c2:00:00:00", 24, "MA-L");
+  trie.add("00:50:c2:a0:00:00", 28, "MA-M");
+  trie.add("00:50:c2:ab:c0:00", 36, "MA-S");
+  trie.add("70:b3:d5:12:30:00", 36, "MA-S only");
+
+  BOOST_TEST("MA-L" == trie.lookup(nmdo::MacAddress("00:50:c2:11:22:33")));
+  BOOST_TEST("MA-L" == trie.lookup(nmdo::MacAddress("00:50:c2:b0:00:00")));
+  BOOST_TEST("MA-M" == trie.lookup(nmdo::MacAddress("00:50:c2:a0:00:00")));
+  BOOST_TEST("MA-M" == trie.lookup(nmdo::MacAddress("00:50:c2:af:ff:ff")));
+  BOOST_TEST("MA-M" == trie.lookup(nmdo::MacAddress("00:50:c2:ab:d0:00")));
+  BOOST_TEST("MA-S" == trie.lookup(nmdo::MacAddress("00:50:c2:ab:c0:00")));
+  BOOST_TEST("MA-S" == trie.lookup(nmdo::MacAddress("00:50:c2:ab:cf:ff")));
+  BOOST_TEST("MA-S only" == trie.lookup(nmdo::MacAddress("70:b3:d5:12:3a:bc")));
+  BOOST_TEST("" == trie.lookup(nmdo::MacAddress("70:b3:d5:12:40:00")));
+  BOOST_TEST("" == trie.lookup(nmdo::MacAddress("00:11:22:33:44:55")));
+  BOOST_TEST("" == trie.lookup(nmdo::MacAddress()));
+}
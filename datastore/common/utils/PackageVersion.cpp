@@ -0,0 +1,439 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <vector>
+
+#include <netmeld/datastore/utils/PackageVersion.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  namespace {
+    // Character at the index, or NUL past the end (as the C originals see)
+    char
+    at(std::string_view s, size_t i)
+    {
+      return (i < s.size()) ? s[i] : '\0';
+    }
+
+    bool
+    isDigit(char c)
+    {
+      return std::isdigit(static_cast<unsigned char>(c));
+    }
+
+    bool
+    isAlpha(char c)
+    {
+      return std::isalpha(static_cast<unsigned char>(c));
+    }
+
+    int
+    sign(int value)
+    {
+      return (0 < value) - (value < 0);
+    }
+
+    // Compare digit strings numerically, without overflow
+    int
+    compareDigits(std::string_view a, std::string_view b)
+    {
+      a.remove_prefix(std::min(a.find_first_not_of('0'), a.size()));
+      b.remove_prefix(std::min(b.find_first_not_of('0'), b.size()));
+      if (a.size() != b.size()) {
+        return (a.size() < b.size()) ? -1 : 1;
+      }
+      return sign(a.compare(b));
+    }
+
+    // Leading "N:" epoch, 0 if none; removed from the version
+    std::string_view
+    takeEpoch(std::string_view& version)
+    {
+      const auto colon {version.find(':')};
+      if (std::string_view::npos == colon
+          || !std::all_of(version.begin(), version.begin() + colon, isDigit))
+      {
+        return "0";
+      }
+
+      const auto epoch {version.substr(0, colon)};
+      version.remove_prefix(colon + 1);
+      return epoch;
+    }
+
+    // Trailing "-release", empty if none; removed from the version
+    std::string_view
+    takeRelease(std::string_view& version)
+    {
+      const auto dash {version.rfind('-')};
+      if (std::string_view::npos == dash) {
+        return {};
+      }
+
+      const auto release {version.substr(dash + 1)};
+      version = version.substr(0, dash);
+      return release;
+    }
+
+
+    // =========================================================================
+    // dpkg
+    // =========================================================================
+    int
+    dpkgOrder(char c)
+    {
+      if (isDigit(c)) { return 0; }
+      if (isAlpha(c)) { return c; }
+      if ('~' == c)   { return -1; }
+      if (c)          { return c + 256; }
+      return 0;
+    }
+
+    int
+    verrevcmp(std::string_view a, std::string_view b)
+    {
+      size_t i {0};
+      size_t j {0};
+      while (i < a.size() || j < b.size()) {
+        while ((i < a.size() && !isDigit(a[i]))
+            || (j < b.size() && !isDigit(b[j])))
+        {
+          const int ac {dpkgOrder(at(a, i))};
+          const int bc {dpkgOrder(at(b, j))};
+          if (ac != bc) {
+            return sign(ac - bc);
+          }
+          ++i;
+          ++j;
+        }
+
+        size_t ie {i};
+        size_t je {j};
+        while (isDigit(at(a, ie))) { ++ie; }
+        while (isDigit(at(b, je))) { ++je; }
+        if (const int rc {compareDigits(a.substr(i, ie - i),
+                                        b.substr(j, je - j))}; rc)
+        {
+          return rc;
+        }
+        i = ie;
+        j = je;
+      }
+
+      return 0;
+    }
+
+
+    // =========================================================================
+    // rpm
+    // =========================================================================
+    bool
+    isRpmSeparator(char c)
+    {
+      return c && !isDigit(c) && !isAlpha(c) && ('~' != c) && ('^' != c);
+    }
+
+    int
+    rpmvercmp(std::string_view a, std::string_view b)
+    {
+      if (a == b) {
+        return 0;
+      }
+
+      size_t i {0};
+      size_t j {0};
+      while (i < a.size() || j < b.size()) {
+        while (isRpmSeparator(at(a, i))) { ++i; }
+        while (isRpmSeparator(at(b, j))) { ++j; }
+
+        // Tilde sorts before everything, even the end of the version
+        if ('~' == at(a, i) || '~' == at(b, j)) {
+          if ('~' != at(a, i)) { return 1; }
+          if ('~' != at(b, j)) { return -1; }
+          ++i;
+          ++j;
+          continue;
+        }
+
+        // Caret sorts after the end of the version, before everything else
+        if ('^' == at(a, i) || '^' == at(b, j)) {
+          if (!at(a, i))       { return -1; }
+          if (!at(b, j))       { return 1; }
+          if ('^' != at(a, i)) { return 1; }
+          if ('^' != at(b, j)) { return -1; }
+          ++i;
+          ++j;
+          continue;
+        }
+
+        if (!(at(a, i) && at(b, j))) {
+          break;
+        }
+
+        const bool isNum {isDigit(a[i])};
+        const auto& inSegment {isNum ? isDigit : isAlpha};
+        size_t ie {i};
+        size_t je {j};
+        while (inSegment(at(a, ie))) { ++ie; }
+        while (inSegment(at(b, je))) { ++je; }
+
+        // Segments of different types; numeric is newer
+        if (j == je) {
+          return isNum ? 1 : -1;
+        }
+
+        const auto& segA {a.substr(i, ie - i)};
+        const auto& segB {b.substr(j, je - j)};
+        const int rc {isNum ? compareDigits(segA, segB)
+                            : sign(segA.compare(segB))};
+        if (rc) {
+          return rc;
+        }
+        i = ie;
+        j = je;
+      }
+
+      if (!at(a, i) && !at(b, j)) {
+        return 0;
+      }
+      return at(a, i) ? 1 : -1;
+    }
+
+
+    // =========================================================================
+    // apk
+    // =========================================================================
+    // Suffix ranks; pre-release suffixes sort before no suffix
+    const std::array<std::string_view, 4> APK_PRE_SUFFIXES
+      {"alpha", "beta", "pre", "rc"};
+    const std::array<std::string_view, 5> APK_POST_SUFFIXES
+      {"cvs", "svn", "git", "hg", "p"};
+    constexpr int APK_NO_SUFFIX {static_cast<int>(APK_PRE_SUFFIXES.size())};
+
+    struct ApkVersion
+    {
+      std::vector<std::string_view>                      numbers;
+      char                                               letter {'\0'};
+      std::vector<std::pair<int, std::string_view>>      suffixes;
+      std::string_view                                   revision;
+    };
+
+    std::optional<ApkVersion>
+    parseApk(std::string_view v)
+    {
+      ApkVersion apk;
+      size_t i {0};
+
+      auto digits = [&]() {
+        const size_t start {i};
+        while (isDigit(at(v, i))) { ++i; }
+        return v.substr(start, i - start);
+      };
+
+      do {
+        if (!apk.numbers.empty()) { ++i; } // the '.'
+        const auto number {digits()};
+        if (number.empty()) {
+          return std::nullopt;
+        }
+        apk.numbers.push_back(number);
+      } while ('.' == at(v, i));
+
+      if (std::islower(static_cast<unsigned char>(at(v, i)))) {
+        apk.letter = v[i++];
+      }
+
+      while ('_' == at(v, i)) {
+        const size_t start {++i};
+        while (std::islower(static_cast<unsigned char>(at(v, i)))) { ++i; }
+        const auto name {v.substr(start, i - start)};
+
+        int rank {-1};
+        if (auto it {std::find(APK_PRE_SUFFIXES.begin(),
+                               APK_PRE_SUFFIXES.end(), name)};
+            APK_PRE_SUFFIXES.end() != it)
+        {
+          rank = static_cast<int>(it - APK_PRE_SUFFIXES.begin());
+        } else if (auto it {std::find(APK_POST_SUFFIXES.begin(),
+                                      APK_POST_SUFFIXES.end(), name)};
+                   APK_POST_SUFFIXES.end() != it)
+        {
+          rank = APK_NO_SUFFIX + 1
+               + static_cast<int>(it - APK_POST_SUFFIXES.begin());
+        } else {
+          return std::nullopt;
+        }
+        apk.suffixes.emplace_back(rank, digits());
+      }
+
+      // Commit hashes ("~abc123") do not take part in ordering
+      if ('~' == at(v, i)) {
+        while (i < v.size() && '-' != v[i]) { ++i; }
+      }
+
+      if ('-' == at(v, i) && 'r' == at(v, i + 1)) {
+        i += 2;
+        apk.revision = digits();
+      }
+
+      if (i != v.size()) {
+        return std::nullopt;
+      }
+      return apk;
+    }
+  }
+
+
+  // ===========================================================================
+  // Package managers
+  // ===========================================================================
+  std::optional<PackageManager>
+  toPackageManager(std::string_view name)
+  {
+    if ("dpkg" == name || "deb" == name) { return PackageManager::DPKG; }
+    if ("rpm" == name)                   { return PackageManager::RPM; }
+    if ("apk" == name)                   { return PackageManager::APK; }
+    return std::nullopt;
+  }
+
+  std::string
+  toString(PackageManager manager)
+  {
+    switch (manager) {
+      case PackageManager::DPKG: return "dpkg";
+      case PackageManager::RPM:  return "rpm";
+      case PackageManager::APK:  return "apk";
+    }
+    return "";
+  }
+
+
+  // ===========================================================================
+  // Version comparison
+  // ===========================================================================
+  int
+  compareVersions(PackageManager manager,
+                  std::string_view a, std::string_view b)
+  {
+    switch (manager) {
+      case PackageManager::DPKG: return compareDpkgVersions(a, b);
+      case PackageManager::RPM:  return compareRpmVersions(a, b);
+      case PackageManager::APK:  return compareApkVersions(a, b);
+    }
+    return 0;
+  }
+
+  int
+  compareDpkgVersions(std::string_view a, std::string_view b)
+  {
+    const auto& epochA {takeEpoch(a)};
+    const auto& epochB {takeEpoch(b)};
+    if (const int rc {compareDigits(epochA, epochB)}; rc) {
+      return rc;
+    }
+
+    const auto& revisionA {takeRelease(a)};
+    const auto& revisionB {takeRelease(b)};
+    if (const int rc {verrevcmp(a, b)}; rc) {
+      return rc;
+    }
+    return verrevcmp(revisionA, revisionB);
+  }
+
+  int
+  compareRpmVersions(std::string_view a, std::string_view b)
+  {
+    const auto& epochA {takeEpoch(a)};
+    const auto& epochB {takeEpoch(b)};
+    if (const int rc {compareDigits(epochA, epochB)}; rc) {
+      return rc;
+    }
+
+    const auto& releaseA {takeRelease(a)};
+    const auto& releaseB {takeRelease(b)};
+    if (const int rc {rpmvercmp(a, b)}; rc) {
+      return rc;
+    }
+
+    // As rpm, a missing release matches any release
+    if (releaseA.empty() || releaseB.empty()) {
+      return 0;
+    }
+    return rpmvercmp(releaseA, releaseB);
+  }
+
+  int
+  compareApkVersions(std::string_view a, std::string_view b)
+  {
+    const auto& apkA {parseApk(a)};
+    const auto& apkB {parseApk(b)};
+    if (!apkA || !apkB) {
+      // Not a version apk understands, fall back to a plain ordering
+      return sign(a.compare(b));
+    }
+
+    const auto& numA {apkA->numbers};
+    const auto& numB {apkB->numbers};
+    for (size_t k {0}; k < std::min(numA.size(), numB.size()); ++k) {
+      // As apk, later components with a leading zero compare as fractions
+      const bool asFraction {0 < k && ('0' == numA[k][0] || '0' == numB[k][0])};
+      const int rc {asFraction ? sign(numA[k].compare(numB[k]))
+                               : compareDigits(numA[k], numB[k])};
+      if (rc) {
+        return rc;
+      }
+    }
+    if (numA.size() != numB.size()) {
+      return (numA.size() < numB.size()) ? -1 : 1;
+    }
+
+    if (apkA->letter != apkB->letter) {
+      return (apkA->letter < apkB->letter) ? -1 : 1;
+    }
+
+    const auto& sufA {apkA->suffixes};
+    const auto& sufB {apkB->suffixes};
+    for (size_t k {0}; k < std::max(sufA.size(), sufB.size()); ++k) {
+      const auto& [rankA, numberA] {
+        (k < sufA.size()) ? sufA[k] : std::pair{APK_NO_SUFFIX, ""}};
+      const auto& [rankB, numberB] {
+        (k < sufB.size()) ? sufB[k] : std::pair{APK_NO_SUFFIX, ""}};
+      if (rankA != rankB) {
+        return (rankA < rankB) ? -1 : 1;
+      }
+      if (const int rc {compareDigits(numberA, numberB)}; rc) {
+        return rc;
+      }
+    }
+
+    return compareDigits(apkA->revision, apkB->revision);
+  }
+}
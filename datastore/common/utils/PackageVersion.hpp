@@ -0,0 +1,58 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef PACKAGE_VERSION_HPP
+#define PACKAGE_VERSION_HPP
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+
+namespace netmeld::datastore::utils {
+
+  // Package managers whose version ordering is understood
+  enum class PackageManager { DPKG, RPM, APK };
+
+  // From a name as used in feeds (e.g., "dpkg", "deb", "rpm", "apk")
+  std::optional<PackageManager> toPackageManager(std::string_view);
+
+  std::string toString(PackageManager);
+
+  /* Compare two versions as the package manager would; negative, zero, or
+     positive as the first is older, the same as, or newer than the second.
+
+     - DPKG: [epoch:]upstream[-revision], per dpkg's verrevcmp
+     - RPM:  [epoch:]version[-release], per rpm's rpmvercmp
+     - APK:  digits{.digits}[letter]{_suffix[N]}[-rN], per apk-tools
+   */
+  int compareVersions(PackageManager, std::string_view, std::string_view);
+
+  int compareDpkgVersions(std::string_view, std::string_view);
+  int compareRpmVersions(std::string_view, std::string_view);
+  int compareApkVersions(std::string_view, std::string_view);
+}
+#endif // PACKAGE_VERSION_HPP
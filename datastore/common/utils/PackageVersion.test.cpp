@@ -0,0 +1,143 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/PackageVersion.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+using nmdu::PackageManager;
+
+
+BOOST_AUTO_TEST_CASE(testPackageManagers)
+{
+  BOOST_TEST((PackageManager::DPKG == nmdu::toPackageManager("deb")));
+  BOOST_TEST((PackageManager::RPM == nmdu::toPackageManager("rpm")));
+  BOOST_TEST((PackageManager::APK == nmdu::toPackageManager("apk")));
+  BOOST_TEST(!nmdu::toPackageManager("pip"));
+
+  BOOST_TEST("apk" == nmdu::toString(PackageManager::APK));
+}
+
+BOOST_AUTO_TEST_CASE(testDpkg)
+{
+  // (older, newer)
+  std::vector<std::pair<std::string, std::string>> ordered {
+    {"1.0", "1.1"},
+    {"1.9", "1.10"},
+    {"1.0~rc1", "1.0"},
+    {"1.0", "1.0a"},
+    {"1.0a", "1.0+b1"},
+    {"1.0-1", "1.0-2"},
+    {"1.0-9", "1.0-10"},
+    {"1.0-1ubuntu1", "1.0-1ubuntu1.1"},
+    {"9.9-1", "1:0.1-1"},
+    {"1.2.3", "1.2.3-1"},
+    {"2.30-0ubuntu2", "2.31-0ubuntu9.2"},
+    {"1.8.31-1ubuntu1.1", "1.8.31-1ubuntu1.2"},
+  };
+  for (const auto& [older, newer] : ordered) {
+    BOOST_TEST_INFO(older << " < " << newer);
+    BOOST_TEST(0 > nmdu::compareDpkgVersions(older, newer));
+    BOOST_TEST(0 < nmdu::compareDpkgVersions(newer, older));
+  }
+
+  BOOST_TEST(0 == nmdu::compareDpkgVersions("1.0", "1.0"));
+  BOOST_TEST(0 == nmdu::compareDpkgVersions("0:1.0", "1.0"));
+  BOOST_TEST(0 == nmdu::compareDpkgVersions("1.01", "1.1"));
+  BOOST_TEST(0 == nmdu::compareDpkgVersions("1.0", "1.0-0"));
+}
+
+BOOST_AUTO_TEST_CASE(testRpm)
+{
+  // (older, newer)
+  std::vector<std::pair<std::string, std::string>> ordered {
+    {"1.0", "1.1"},
+    {"1.9", "1.10"},
+    {"1.0~rc1", "1.0"},
+    {"1.0", "1.0^git1"},
+    {"1.0^git1", "1.0.1"},
+    {"1.0a", "1.0.1"},
+    {"a", "1"},
+    {"1.0-1.el8", "1.0-2.el8"},
+    {"1.0-1.el8", "1.0-1.el8_4.1"},
+    {"9.9-1", "1:0.1-1"},
+    {"2.28-151.el8", "2.28-164.el8"},
+  };
+  for (const auto& [older, newer] : ordered) {
+    BOOST_TEST_INFO(older << " < " << newer);
+    BOOST_TEST(0 > nmdu::compareRpmVersions(older, newer));
+    BOOST_TEST(0 < nmdu::compareRpmVersions(newer, older));
+  }
+
+  BOOST_TEST(0 == nmdu::compareRpmVersions("1.0-1", "1.0-1"));
+  BOOST_TEST(0 == nmdu::compareRpmVersions("1.0.0", "1.0_0"));
+  BOOST_TEST(0 == nmdu::compareRpmVersions("1.01", "1.1"));
+  // without a release, any release matches
+  BOOST_TEST(0 == nmdu::compareRpmVersions("1.0", "1.0-5"));
+}
+
+BOOST_AUTO_TEST_CASE(testApk)
+{
+  // (older, newer)
+  std::vector<std::pair<std::string, std::string>> ordered {
+    {"1.0", "1.1"},
+    {"1.9", "1.10"},
+    {"1.2", "1.2.1"},
+    {"1.2", "1.2a"},
+    {"1.2a", "1.2.1"},
+    {"1.2_alpha", "1.2_beta"},
+    {"1.2_rc1", "1.2_rc2"},
+    {"1.2_rc2", "1.2"},
+    {"1.2", "1.2_p1"},
+    {"1.2_git20200101", "1.2_p1"},
+    {"1.2-r0", "1.2-r1"},
+    {"1.2-r9", "1.2-r10"},
+    {"1.2-r10", "1.2.1-r0"},
+    {"1.05", "1.1"},
+    {"3.1.4-r5", "3.1.4_p1-r0"},
+  };
+  for (const auto& [older, newer] : ordered) {
+    BOOST_TEST_INFO(older << " < " << newer);
+    BOOST_TEST(0 > nmdu::compareApkVersions(older, newer));
+    BOOST_TEST(0 < nmdu::compareApkVersions(newer, older));
+  }
+
+  BOOST_TEST(0 == nmdu::compareApkVersions("1.2-r0", "1.2"));
+  BOOST_TEST(0 == nmdu::compareApkVersions("1.2_git1~abc-r1",
+                                           "1.2_git1~def-r1"));
+}
+
+BOOST_AUTO_TEST_CASE(testDispatch)
+{
+  // "~" sorts first for dpkg and rpm; apk does not treat it specially
+  BOOST_TEST(0 > nmdu::compareVersions(PackageManager::DPKG, "1~a", "1"));
+  BOOST_TEST(0 > nmdu::compareVersions(PackageManager::RPM, "1~a", "1"));
+  BOOST_TEST(0 < nmdu::compareVersions(PackageManager::APK, "1.1", "1.0"));
+}
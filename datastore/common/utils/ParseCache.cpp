@@ -0,0 +1,79 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <map>
+#include <mutex>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/ParseCache.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // Unnamed namespace to hide helper logic
+  namespace {
+    std::mutex registryMutex;
+
+    // Nodes are stable, so handed out references stay valid
+    std::map<std::string, ParseCacheStats::Counts, std::less<>>&
+    registry()
+    {
+      static std::map<std::string, ParseCacheStats::Counts, std::less<>>
+        counts;
+      return counts;
+    }
+  }
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  ParseCacheStats::Counts&
+  ParseCacheStats::get(std::string_view kind)
+  {
+    std::lock_guard<std::mutex> lock {registryMutex};
+
+    auto& counts {registry()};
+    auto iter {counts.find(kind)};
+    if (counts.end() == iter) {
+      iter = counts.try_emplace(std::string(kind)).first;
+    }
+    return iter->second;
+  }
+
+  void
+  ParseCacheStats::logStats()
+  {
+    std::lock_guard<std::mutex> lock {registryMutex};
+
+    for (const auto& [kind, count] : registry()) {
+      const size_t hits   {count.hits.load(std::memory_order_relaxed)};
+      const size_t total  {hits + count.misses.load(std::memory_order_relaxed)};
+      if (0 == total) { continue; }
+      LOG_DEBUG << "Parse cache " << kind << ": reused " << hits << " of "
+                << total << " parses (" << (100 * hits / total) << "%)\n";
+    }
+  }
+}
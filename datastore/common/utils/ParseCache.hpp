@@ -0,0 +1,183 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef PARSE_CACHE_HPP
+#define PARSE_CACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Hit and miss counts of every ParseCache of a kind, across threads.
+   */
+  class ParseCacheStats {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+    protected:
+    public:
+      struct Counts {
+        std::atomic<size_t> hits    {0};
+        std::atomic<size_t> misses  {0};
+      };
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+      ParseCacheStats() = delete;
+    protected:
+    public:
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+    public:
+      static Counts& get(std::string_view);
+      static void logStats();
+  };
+
+
+  /* Bounded, least recently used, memo of string to parsed object
+     conversions (e.g., an IpAddress, MacAddress, or PortRange from its text).
+
+     Vendor configs repeat the same values many times (object-group members,
+     host entries, "any"), each otherwise going through a fresh parse.  Not
+     thread safe; declare it `thread_local` where used so parallel parsers
+     each have their own and need no locking.
+   */
+  template<typename T>
+  class ParseCache {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      using Entries = std::list<std::pair<std::string, T>>;
+
+      Entries   entries; // most recently used first
+      std::unordered_map<std::string_view, typename Entries::iterator>
+                index;
+      size_t    capacity;
+
+      size_t                    hits    {0};
+      size_t                    misses  {0};
+      ParseCacheStats::Counts&  totals;
+
+    protected:
+    public:
+      static constexpr size_t DEFAULT_CAPACITY {16 * 1024};
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      ParseCache() = delete;
+      explicit ParseCache(std::string_view, size_t = DEFAULT_CAPACITY);
+      ParseCache(const ParseCache&) = delete;
+      ParseCache& operator=(const ParseCache&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+    public:
+      // Parsed value of the key, from parse() if not cached; the reference
+      // is only valid until the cache is next used
+      template<typename F>
+      const T& get(const std::string&, F&&);
+
+      size_t getHits() const;
+      size_t getMisses() const;
+      size_t size() const;
+  };
+
+
+  template<typename T>
+  ParseCache<T>::ParseCache(std::string_view kind, size_t _capacity) :
+    capacity(std::max(size_t {1}, _capacity)),
+    totals(ParseCacheStats::get(kind))
+  {}
+
+  template<typename T>
+  template<typename F>
+  const T&
+  ParseCache<T>::get(const std::string& key, F&& parse)
+  {
+    if (const auto& found {index.find(key)}; index.end() != found) {
+      ++hits;
+      totals.hits.fetch_add(1, std::memory_order_relaxed);
+      entries.splice(entries.begin(), entries, found->second);
+      return found->second->second;
+    }
+
+    ++misses;
+    totals.misses.fetch_add(1, std::memory_order_relaxed);
+
+    T value {parse()};
+    if (capacity <= entries.size()) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+    }
+    entries.emplace_front(key, std::move(value));
+    index.emplace(entries.front().first, entries.begin());
+
+    return entries.front().second;
+  }
+
+  template<typename T>
+  size_t
+  ParseCache<T>::getHits() const
+  {
+    return hits;
+  }
+
+  template<typename T>
+  size_t
+  ParseCache<T>::getMisses() const
+  {
+    return misses;
+  }
+
+  template<typename T>
+  size_t
+  ParseCache<T>::size() const
+  {
+    return entries.size();
+  }
+}
+#endif // PARSE_CACHE_HPP
@@ -0,0 +1,110 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/ParseCache.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+BOOST_AUTO_TEST_CASE(testHitsAndMisses)
+{
+  nmdu::ParseCache<int> cache {"testHitsAndMisses"};
+  size_t parses {0};
+  const auto& parse {[&parses](const std::string& s) {
+      ++parses;
+      return std::stoi(s);
+    }};
+
+  BOOST_TEST(0 == cache.size());
+  BOOST_TEST(1 == cache.get("1", [&]() { return parse("1"); }));
+  BOOST_TEST(1 == cache.get("1", [&]() { return parse("1"); }));
+  BOOST_TEST(2 == cache.get("2", [&]() { return parse("2"); }));
+  BOOST_TEST(1 == cache.get("1", [&]() { return parse("1"); }));
+
+  BOOST_TEST(2 == parses);
+  BOOST_TEST(2 == cache.getMisses());
+  BOOST_TEST(2 == cache.getHits());
+  BOOST_TEST(2 == cache.size());
+}
+
+BOOST_AUTO_TEST_CASE(testFailedParse)
+{
+  nmdu::ParseCache<int> cache {"testFailedParse"};
+
+  BOOST_CHECK_THROW(
+      cache.get("x", []() -> int { throw std::invalid_argument("x"); }),
+      std::invalid_argument);
+  BOOST_TEST(0 == cache.size());
+  BOOST_TEST(1 == cache.get("x", []() { return 1; }));
+}
+
+BOOST_AUTO_TEST_CASE(testEviction)
+{
+  {
+    nmdu::ParseCache<int> cache {"testEviction", 2};
+
+    cache.get("1", []() { return 1; });
+    cache.get("2", []() { return 2; });
+    cache.get("1", []() { return 1; }); // "2" now least recently used
+    cache.get("3", []() { return 3; });
+    BOOST_TEST(2 == cache.size());
+
+    BOOST_TEST(1 == cache.get("1", []() { return -1; }));
+    BOOST_TEST(3 == cache.get("3", []() { return -1; }));
+    BOOST_TEST(-1 == cache.get("2", []() { return -1; }));
+    BOOST_TEST(2 == cache.size());
+  }
+  {
+    nmdu::ParseCache<int> cache {"testEviction", 0};
+
+    cache.get("1", []() { return 1; });
+    BOOST_TEST(1 == cache.size());
+    BOOST_TEST(1 == cache.get("1", []() { return -1; }));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testTotals)
+{
+  auto& totals {nmdu::ParseCacheStats::get("testTotals")};
+  BOOST_TEST(&totals == &nmdu::ParseCacheStats::get("testTotals"));
+  BOOST_TEST(&totals != &nmdu::ParseCacheStats::get("testTotalsOther"));
+
+  nmdu::ParseCache<int> cache1 {"testTotals"};
+  nmdu::ParseCache<int> cache2 {"testTotals"};
+
+  cache1.get("1", []() { return 1; });
+  cache1.get("1", []() { return 1; });
+  cache2.get("1", []() { return 1; });
+
+  BOOST_TEST(1 == cache1.getMisses());
+  BOOST_TEST(1 == cache2.getMisses());
+  BOOST_TEST(1 == totals.hits.load());
+  BOOST_TEST(2 == totals.misses.load());
+}
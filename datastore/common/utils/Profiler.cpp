@@ -0,0 +1,195 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/Profiler.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  Profiler::Profiler() :
+    start(Clock::now()),
+    last(start)
+  {}
+
+  Profiler::~Profiler()
+  {
+    if (active() == this) {
+      active() = nullptr;
+    }
+  }
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  Profiler*&
+  Profiler::active()
+  {
+    static Profiler* profiler {nullptr};
+    return profiler;
+  }
+
+  Profiler*
+  Profiler::getActive()
+  {
+    return active();
+  }
+
+  void
+  Profiler::enable()
+  {
+    enabled = true;
+    active() = this;
+  }
+
+  bool
+  Profiler::isEnabled() const
+  {
+    return enabled;
+  }
+
+  void
+  Profiler::mark(const std::string& name)
+  {
+    const auto now {Clock::now()};
+    const auto seconds {std::chrono::duration<double>(now - last).count()};
+
+    std::lock_guard<std::mutex> lock {mutex};
+    last = now;
+    for (auto& phase : phases) {
+      if (phase.name == name) {
+        phase.seconds += seconds;
+        return;
+      }
+    }
+    phases.push_back({name, seconds});
+  }
+
+  void
+  Profiler::addStatement(std::string_view name, Clock::time_point started)
+  {
+    const auto seconds
+      {std::chrono::duration<double>(Clock::now() - started).count()};
+
+    std::lock_guard<std::mutex> lock {mutex};
+    auto iter {statements.find(name)};
+    if (iter == statements.end()) {
+      iter = statements.emplace(std::string(name), Statement()).first;
+    }
+    auto& statement {iter->second};
+    ++statement.calls;
+    statement.seconds   += seconds;
+    statement.maxSeconds = std::max(statement.maxSeconds, seconds);
+  }
+
+  void
+  Profiler::addSkipped(std::string_view name)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+    auto iter {statements.find(name)};
+    if (iter == statements.end()) {
+      iter = statements.emplace(std::string(name), Statement()).first;
+    }
+    ++iter->second.skipped;
+  }
+
+  void
+  Profiler::addTableCounts(pqxx::transaction_base& t)
+  {
+    const auto& rows {t.exec(
+        "SELECT relname::TEXT, n_tup_ins, n_tup_upd"
+        " FROM pg_stat_xact_user_tables"
+        " WHERE (0 < n_tup_ins + n_tup_upd)"
+      )};
+
+    std::lock_guard<std::mutex> lock {mutex};
+    for (const auto& row : rows) {
+      auto& table {tables[row[0].as<std::string>()]};
+      table.inserted += row[1].as<size_t>();
+      table.updated  += row[2].as<size_t>();
+    }
+  }
+
+  nlohmann::json
+  Profiler::toJson() const
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    nlohmann::json report;
+    report["totalSeconds"] =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+    report["phases"] = nlohmann::json::array();
+    for (const auto& phase : phases) {
+      report["phases"].push_back(
+          {{"name", phase.name}, {"seconds", phase.seconds}});
+    }
+
+    report["statements"] = nlohmann::json::object();
+    for (const auto& [name, statement] : statements) {
+      report["statements"][name] = {
+          {"calls",       statement.calls},
+          {"skipped",     statement.skipped},
+          {"seconds",     statement.seconds},
+          {"maxSeconds",  statement.maxSeconds},
+        };
+    }
+
+    report["tables"] = nlohmann::json::object();
+    for (const auto& [name, table] : tables) {
+      report["tables"][name] = {
+          {"inserted",  table.inserted},
+          {"updated",   table.updated},
+        };
+    }
+
+    return report;
+  }
+
+  void
+  Profiler::write(const std::string& path) const
+  {
+    const auto report {toJson().dump(2)};
+    if ("-" == path) {
+      std::cerr << report << std::endl;
+      return;
+    }
+
+    std::ofstream file {path};
+    file << report << std::endl;
+    if (!file) {
+      LOG_ERROR << "Failed to write profile: " << path << std::endl;
+    }
+  }
+}
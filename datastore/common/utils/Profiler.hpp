@@ -0,0 +1,127 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <pqxx/pqxx>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Records where a datastore tool spends its time, for --profile.
+
+     Phases are recorded in order by mark(), each covering the time since the
+     previous mark; a repeated name (e.g., per batch) adds to its phase.
+     While enabled, every statement run via execPrepared() is
+     counted and timed (for pipelined statements this is from being queued
+     until their result is retrieved), as are inserts dropped by an
+     InsertCache.  Per table row counts come from the
+     server's statistics for the transaction(s).
+   */
+  class Profiler {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    public:
+      using Clock = std::chrono::steady_clock;
+
+    private:
+      struct Phase {
+        std::string  name;
+        double       seconds;
+      };
+
+      struct Statement {
+        size_t  calls       {0};
+        size_t  skipped     {0};
+        double  seconds     {0};
+        double  maxSeconds  {0};
+      };
+
+      struct Table {
+        size_t  inserted  {0};
+        size_t  updated   {0};
+      };
+
+      Clock::time_point                               start;
+      Clock::time_point                               last;
+      std::vector<Phase>                              phases;
+      std::map<std::string, Statement, std::less<>>   statements;
+      std::map<std::string, Table>                    tables;
+      mutable std::mutex                              mutex;
+      bool                                            enabled {false};
+
+    protected:
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      Profiler();
+      Profiler(const Profiler&) = delete;
+      Profiler& operator=(const Profiler&) = delete;
+      ~Profiler();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      static Profiler*& active();
+
+    protected:
+    public:
+      // Start collecting statement timings (process wide)
+      void enable();
+      bool isEnabled() const;
+
+      // Add the time since the previous mark to the named phase
+      void mark(const std::string&);
+
+      void addStatement(std::string_view, Clock::time_point);
+      void addSkipped(std::string_view);
+      // Add the row counts, per table, of the (uncommitted) transaction
+      void addTableCounts(pqxx::transaction_base&);
+
+      nlohmann::json toJson() const;
+      // Write JSON report to the file, or standard error if "-"
+      void write(const std::string&) const;
+
+      // Enabled profiler, if any
+      static Profiler* getActive();
+  };
+}
+#endif // PROFILER_HPP
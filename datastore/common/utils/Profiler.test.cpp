@@ -0,0 +1,109 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/utils/Profiler.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
+
+BOOST_AUTO_TEST_CASE(testEnable)
+{
+  BOOST_TEST(nullptr == nmdu::Profiler::getActive());
+  {
+    nmdu::Profiler profiler;
+    BOOST_TEST(!profiler.isEnabled());
+    BOOST_TEST(nullptr == nmdu::Profiler::getActive());
+
+    profiler.enable();
+    BOOST_TEST(profiler.isEnabled());
+    BOOST_TEST(&profiler == nmdu::Profiler::getActive());
+  }
+  BOOST_TEST(nullptr == nmdu::Profiler::getActive());
+}
+
+BOOST_AUTO_TEST_CASE(testReport)
+{
+  nmdu::Profiler profiler;
+
+  {
+    const auto& report {profiler.toJson()};
+    BOOST_TEST(0 <= report.at("totalSeconds").get<double>());
+    BOOST_TEST(report.at("phases").empty());
+    BOOST_TEST(report.at("statements").empty());
+    BOOST_TEST(report.at("tables").empty());
+  }
+
+  profiler.mark("parse");
+  profiler.mark("inserts");
+  const auto started {nmdu::Profiler::Clock::now()};
+  profiler.addStatement("insert_raw_ip_addr", started);
+  profiler.addStatement("insert_raw_ip_addr", started);
+  profiler.addSkipped("insert_raw_ip_addr");
+  profiler.addSkipped("insert_raw_mac_addr");
+
+  {
+    const auto& report {profiler.toJson()};
+
+    const auto& phases {report.at("phases")};
+    BOOST_TEST(2 == phases.size());
+    BOOST_TEST("parse" == phases.at(0).at("name"));
+    BOOST_TEST("inserts" == phases.at(1).at("name"));
+
+    const auto& statements {report.at("statements")};
+    BOOST_TEST(2 == statements.size());
+    const auto& ipAddr {statements.at("insert_raw_ip_addr")};
+    BOOST_TEST(2 == ipAddr.at("calls").get<size_t>());
+    BOOST_TEST(1 == ipAddr.at("skipped").get<size_t>());
+    BOOST_TEST(ipAddr.at("maxSeconds").get<double>()
+               <= ipAddr.at("seconds").get<double>());
+    const auto& macAddr {statements.at("insert_raw_mac_addr")};
+    BOOST_TEST(0 == macAddr.at("calls").get<size_t>());
+    BOOST_TEST(1 == macAddr.at("skipped").get<size_t>());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testRepeatedPhase)
+{
+  nmdu::Profiler profiler;
+
+  // Batches mark the same phases over and over, they add up in first order
+  for (size_t i {0}; i < 3; ++i) {
+    profiler.mark("wait");
+    profiler.mark("inserts");
+  }
+  profiler.mark("wait");
+
+  const auto& report {profiler.toJson()};
+  const auto& phases {report.at("phases")};
+  BOOST_TEST(2 == phases.size());
+  BOOST_TEST("wait" == phases.at(0).at("name"));
+  BOOST_TEST("inserts" == phases.at(1).at("name"));
+  BOOST_TEST(0 <= phases.at(0).at("seconds").get<double>());
+}
@@ -640,6 +640,20 @@ namespace netmeld::datastore::utils {
        " ON CONFLICT"
        " DO NOTHING");
 
+    // ----------------------------------------------------------------------
+    // TABLE: tool_run_profiles
+    // ----------------------------------------------------------------------
+
+    db.prepare
+      ("insert_tool_run_profile",
+       "INSERT INTO tool_run_profiles"
+       "  (tool_run_id, profile)"
+       " VALUES ($1, ($2)::JSONB)"
+       " ON CONFLICT"
+       "  (tool_run_id)"
+       " DO UPDATE"
+       "  SET profile = EXCLUDED.profile");
+
     // ----------------------------------------------------------------------
     // TABLE: raw_devices
     // ----------------------------------------------------------------------
@@ -896,12 +910,13 @@ namespace netmeld::datastore::utils {
     db.prepare
       ("insert_raw_mac_addr",
        "INSERT INTO raw_mac_addrs AS orig"
-       "  (tool_run_id, mac_addr, is_responding)"
-       " VALUES ($1, $2, $3)"
+       "  (tool_run_id, mac_addr, is_responding, vendor_name)"
+       " VALUES ($1, $2, $3, NULLIF($4, ''))"
        " ON CONFLICT"
        "  (tool_run_id, mac_addr)"
        " DO UPDATE"
-       "  SET is_responding = GREATEST(orig.is_responding, $3)");
+       "  SET is_responding = GREATEST(orig.is_responding, $3)"
+       "    , vendor_name = COALESCE(EXCLUDED.vendor_name, orig.vendor_name)");
 
     // ----------------------------------------------------------------------
     // TABLE: raw_ip_addrs
@@ -1525,13 +1540,19 @@ namespace netmeld::datastore::utils {
     // TABLE: ToolObservations
     // ----------------------------------------------------------------------
 
+    // Parallel arrays of (category, observation, occurrences) so a whole
+    // set of observations is a single round trip
     db.prepare
-      ("insert_raw_tool_observation",
-       "INSERT INTO raw_tool_observations"
-       "  (tool_run_id, category, observation)"
-       " VALUES ($1, $2, $3)"
+      ("insert_raw_tool_observations",
+       "INSERT INTO raw_tool_observations AS orig"
+       "  (tool_run_id, category, observation, occurrences)"
+       " SELECT $1, obs.category, obs.observation, obs.occurrences"
+       " FROM UNNEST(($2)::TEXT[], ($3)::TEXT[], ($4)::INTEGER[])"
+       "   AS obs(category, observation, occurrences)"
        " ON CONFLICT"
-       " DO NOTHING");
+       "  (tool_run_id, category, observation)"
+       " DO UPDATE"
+       "  SET occurrences = orig.occurrences + EXCLUDED.occurrences");
 
     // ----------------------------------------------------------------------
     // TABLE: Prowler*
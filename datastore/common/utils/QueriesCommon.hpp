@@ -28,7 +28,11 @@
 #define QUERIES_COMMON_HPP
 
 #include <pqxx/pqxx>
+#include <netmeld/datastore/utils/InsertCache.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
+#include <netmeld/datastore/utils/InsertPipeline.hpp>
 #include <netmeld/datastore/utils/NetmeldPostgresConversions.hpp>
+#include <netmeld/datastore/utils/Profiler.hpp>
 
 
 namespace netmeld::datastore::utils {
@@ -39,5 +43,47 @@ namespace netmeld::datastore::utils {
   void
   dbPrepareAws(pqxx::connection&);
 
+  // Execute a prepared statement.  It is buffered for COPY if the
+  // transaction has an active InsertCopy which supports it.  Otherwise, exact
+  // repeats are dropped if the transaction has an active InsertCache and it
+  // is queued if it has an active InsertPipeline or else executed
+  // immediately.  All are counted by the active Profiler, if any; queued
+  // ones by the pipeline once their result arrives.
+  template<typename... Args>
+  void
+  execPrepared(pqxx::transaction_base& t, pqxx::zview statement,
+               Args&&... args)
+  {
+    auto* profiler {Profiler::getActive()};
+
+    auto* copy {InsertCopy::find(t)};
+    const bool isCopied {copy && InsertCopy::isCopyable(statement)};
+    if (auto* cache {InsertCache::find(t)};
+        !isCopied && cache && cache->isRepeat(statement, args...))
+    {
+      if (profiler) {
+        profiler->addSkipped(statement);
+      }
+      return;
+    }
+
+    const auto started {Profiler::Clock::now()};
+    if (isCopied) {
+      copy->execPrepared(statement, args...);
+    } else {
+      if (copy) {
+        copy->flush();  // as this may reference rows still buffered
+      }
+      if (auto* pipeline {InsertPipeline::find(t)}) {
+        pipeline->execPrepared(statement, std::forward<Args>(args)...);
+        return;
+      }
+      t.exec_prepared(statement, std::forward<Args>(args)...);
+    }
+    if (profiler) {
+      profiler->addStatement(statement, started);
+    }
+  }
+
 }
 #endif  /* QUERIES_COMMON_HPP */
@@ -0,0 +1,136 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+#include <netmeld/datastore/utils/RouteCopy.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  RouteCopy::RouteCopy(pqxx::transaction_base& _t,
+                       const nmco::Uuid& _toolRunId,
+                       const std::string& _deviceId,
+                       const std::string& _reason) :
+    t(_t),
+    toolRunId(pqxx::to_string(_toolRunId)),
+    deviceId(_deviceId),
+    // As nmdo::IpNetwork::save() qualifies it
+    fullReason((_reason.empty() || _deviceId.empty())
+               ? _reason : (_deviceId + "'s " + _reason))
+  {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  bool
+  RouteCopy::isValid(const ScannedRoute& route)
+  {
+    // The destination is always set once scanned
+    return (  route.hasNextHopIpAddr
+           || route.isNullRoute
+           || !route.outIfaceName.empty()
+           );
+  }
+
+  std::string_view
+  RouteCopy::getNextHopIpAddrString(const ScannedRoute& route) const
+  {
+    if (!route.isNullRoute && route.hasNextHopIpAddr) {
+      return route.nextHopIpAddr.text;
+    }
+    return "";
+  }
+
+  void
+  RouteCopy::save(const ScannedRoute& route)
+  {
+    if (!isValid(route)) {
+      LOG_DEBUG << "Scanned route is not saving: "
+                << route.dstIpNet.text << std::endl;
+      return;
+    }
+
+    // As nmdo::IpNetwork::save() for the destination
+    const auto& dst {route.dstIpNet};
+    if (dst.isValidNetwork()) {
+      execPrepared(t, "insert_raw_ip_net", toolRunId, dst.text, fullReason);
+    }
+
+    // As nmdo::IpAddress::save() for the next hop
+    const auto& nextHop {route.nextHopIpAddr};
+    if (route.hasNextHopIpAddr && nextHop.isValidAddress()) {
+      if (nextHop.isValidNetwork()) {
+        execPrepared(t, "insert_raw_ip_net",
+                     toolRunId, nextHop.text, fullReason);
+      }
+      execPrepared(t, "insert_raw_ip_addr", toolRunId, nextHop.text, false);
+    }
+
+    if (!route.vrfId.empty()) {
+      execPrepared(t, "insert_raw_device_vrf",
+                   toolRunId, deviceId, route.vrfId);
+    }
+
+    execPrepared(t, "insert_raw_device_ip_route"
+                  , toolRunId
+                  , deviceId // insert converts to lower
+                  , route.vrfId // insert converts '' to null
+                  , std::string_view() // table, insert converts '' to null
+                  , route.isActive
+                  , dst.text
+                  , std::string_view() // next vrf, insert converts '' to null
+                  , std::string_view() // next table, insert converts '' to null
+                  , getNextHopIpAddrString(route) // '' to null
+                  , route.outIfaceName // insert converts '' to null
+                  , route.protocol // insert converts to lower and '' to null
+                  , route.adminDistance
+                  , route.metric
+                  , std::string_view() // description, '' to null
+                  );
+  }
+
+  void
+  RouteCopy::saveAsMetadata(const ScannedRoute& route)
+  {
+    if (!isValid(route)) {
+      LOG_DEBUG << "Scanned route is not saving as metadata: "
+                << route.dstIpNet.text << std::endl;
+      return;
+    }
+
+    execPrepared(t, "insert_tool_run_ip_route"
+                  , toolRunId
+                  , route.outIfaceName
+                  , route.dstIpNet.text
+                  , getNextHopIpAddrString(route)
+                  );
+  }
+}
@@ -0,0 +1,108 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef ROUTE_COPY_HPP
+#define ROUTE_COPY_HPP
+
+#include <string>
+#include <string_view>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/datastore/parsers/LineScanner.hpp>
+
+namespace nmco = netmeld::core::objects;
+namespace nmdp = netmeld::datastore::parsers;
+
+
+namespace netmeld::datastore::utils {
+
+  // A route as scanned from text, with the meaning (and defaults) of the
+  // matching nmdo::Route fields.  Views refer into the scanned data.
+  struct ScannedRoute
+  {
+    std::string_view    vrfId;
+    nmdp::IpPrefixView  dstIpNet;
+    nmdp::IpPrefixView  nextHopIpAddr;
+    bool                hasNextHopIpAddr  {false};
+    std::string_view    outIfaceName;
+    std::string_view    protocol;
+    size_t              adminDistance     {0};
+    size_t              metric            {0};
+    bool                isActive          {true};
+    bool                isNullRoute       {false};
+  };
+
+
+  /* Saves scanned routes without building an nmdo::Route for each.
+
+     Issues the same prepared inserts, with the same values, which
+     nmdo::Route::save() and saveAsMetadata() issue for the equivalent route,
+     so an active InsertCopy on the transaction loads them with COPY.  Meant
+     for full routing tables, where building objects for every line costs more
+     than loading them does.
+   */
+  class RouteCopy {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      pqxx::transaction_base&  t;
+      const std::string        toolRunId;
+      const std::string        deviceId;
+      const std::string        fullReason;
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      RouteCopy() = delete;
+      // `reason` for the IP addresses and networks, as set on a Route's
+      RouteCopy(pqxx::transaction_base&, const nmco::Uuid&,
+                const std::string&, const std::string&);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      std::string_view getNextHopIpAddrString(const ScannedRoute&) const;
+
+    protected:
+    public:
+      void save(const ScannedRoute&);
+      void saveAsMetadata(const ScannedRoute&);
+
+      // Same as nmdo::Route::isValid() for the scanned route
+      static bool isValid(const ScannedRoute&);
+  };
+}
+#endif // ROUTE_COPY_HPP
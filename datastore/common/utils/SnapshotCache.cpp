@@ -0,0 +1,58 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <sstream>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/SnapshotCache.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  void
+  useSnapshots(pqxx::connection& db, const SnapshotRelations& relations)
+  {
+    pqxx::work t {db};
+
+    for (const auto& [relation, indexes] : relations) {
+      std::ostringstream oss;
+      oss << "SELECT snapshot_refresh(" << t.quote(relation);
+      for (const auto& index : indexes) {
+        oss << ", " << t.quote(index);
+      }
+      oss << ")";
+
+      const auto& row {t.exec1(oss.str())};
+      if (row[0].as<bool>()) {
+        LOG_DEBUG << "Refreshed snapshot of " << relation << '\n';
+      }
+    }
+
+    // Persists past the commit, for the rest of the session
+    t.exec("SET search_path TO snapshot, public");
+    t.commit();
+  }
+}
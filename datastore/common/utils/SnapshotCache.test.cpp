@@ -0,0 +1,230 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include <unistd.h>
+
+#include <netmeld/datastore/utils/SnapshotCache.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+namespace utf = boost::unit_test;
+
+
+namespace {
+  // The schema is applied to a database created (and dropped) for each test,
+  // so these need a server and a role allowed to create databases, e.g.:
+  //   NETMELD_TEST_DB="dbname=netmeld_test" ctest -R SnapshotCache
+  // and are skipped otherwise.
+  struct HasTestDb
+  {
+    boost::test_tools::assertion_result
+    operator()(utf::test_unit_id) const
+    {
+      boost::test_tools::assertion_result
+        result {nullptr != std::getenv("NETMELD_TEST_DB")};
+      result.message() << "NETMELD_TEST_DB is not set";
+      return result;
+    }
+  };
+
+  class ScratchDb
+  {
+    private:
+      const std::string admin {std::getenv("NETMELD_TEST_DB")};
+      const std::string name;
+
+    public:
+      std::unique_ptr<pqxx::connection> db;
+
+      explicit ScratchDb(const std::string& _suffix) :
+        name {"netmeld_snapshot_test_" + std::to_string(getpid())
+              + "_" + _suffix}
+      {
+        {
+          pqxx::connection adminDb {admin};
+          pqxx::nontransaction n {adminDb};
+          n.exec("DROP DATABASE IF EXISTS " + n.quote_name(name));
+          n.exec("CREATE DATABASE " + n.quote_name(name));
+        }
+        // Later keywords override the earlier
+        db = std::make_unique<pqxx::connection>(admin + " dbname=" + name);
+
+        std::ifstream f {SCHEMA_SOURCE_DIR "/040snapshot-cache-create.sql"};
+        std::ostringstream sql;
+        sql << f.rdbuf();
+        BOOST_REQUIRE(!sql.str().empty());
+        exec(sql.str());
+      }
+
+      ~ScratchDb()
+      {
+        db.reset();
+        try {
+          pqxx::connection adminDb {admin};
+          pqxx::nontransaction n {adminDb};
+          n.exec("DROP DATABASE IF EXISTS " + n.quote_name(name));
+        } catch (const std::exception& e) {
+          BOOST_TEST_MESSAGE("Failed to drop " << name << ": " << e.what());
+        }
+      }
+
+      // Each its own committed transaction
+      void
+      exec(const std::string& sql)
+      {
+        pqxx::nontransaction n {*db};
+        n.exec(sql);
+      }
+
+      std::string
+      key()
+      {
+        pqxx::nontransaction n {*db};
+        return n.exec1("SELECT snapshot_data_key()")[0].as<std::string>();
+      }
+
+      bool
+      refresh(const std::string& relation)
+      {
+        pqxx::work t {*db};
+        const bool rebuilt {
+          t.exec1("SELECT snapshot_refresh(" + t.quote(relation) + ")")[0]
+            .as<bool>()};
+        t.commit();
+        return rebuilt;
+      }
+
+      bool
+      isTracked(const std::string& table)
+      {
+        pqxx::nontransaction n {*db};
+        return n.exec1(
+            "SELECT EXISTS (SELECT 1 FROM pg_trigger"
+            " WHERE tgrelid = " + n.quote("public." + table) + "::REGCLASS"
+            "   AND tgname = 'snapshot_data_changed')"
+          )[0].as<bool>();
+      }
+  };
+}
+
+BOOST_AUTO_TEST_CASE(testRelationTracking, * utf::precondition(HasTestDb()))
+{
+  ScratchDb sdb {"relation"};
+  sdb.exec("CREATE TABLE raw_things (id INT)");
+  sdb.exec("CREATE TABLE hidden_things (id INT)");
+  sdb.exec("CREATE TABLE other_things (id INT)");
+  sdb.exec("CREATE VIEW things AS SELECT id FROM raw_things");
+  sdb.exec("CREATE FUNCTION hidden_ids() RETURNS SETOF INT"
+           " AS $$ SELECT id FROM hidden_things $$ LANGUAGE SQL");
+  sdb.exec("CREATE VIEW function_things AS SELECT * FROM hidden_ids()");
+
+  // Nothing is tracked until a snapshot depends on it
+  BOOST_TEST(!sdb.isTracked("raw_things"));
+  const auto& initialKey {sdb.key()};
+
+  BOOST_TEST(sdb.refresh("things"));
+  BOOST_TEST(!sdb.refresh("things"));
+  BOOST_TEST(sdb.isTracked("raw_things"));
+  BOOST_TEST(!sdb.isTracked("hidden_things"));
+  BOOST_TEST(!sdb.isTracked("other_things"));
+  BOOST_TEST(initialKey == sdb.key());
+
+  // A data change changes the key, so the snapshot is rebuilt
+  sdb.exec("INSERT INTO raw_things VALUES (1)");
+  const auto& changedKey {sdb.key()};
+  BOOST_TEST(initialKey != changedKey);
+  BOOST_TEST(sdb.refresh("things"));
+  BOOST_TEST(!sdb.refresh("things"));
+
+  // Counted once per transaction, however many statements
+  {
+    pqxx::work t {*sdb.db};
+    t.exec("INSERT INTO raw_things VALUES (2)");
+    t.exec("UPDATE raw_things SET id = 3 WHERE id = 2");
+    t.exec("DELETE FROM raw_things WHERE id = 3");
+    t.commit();
+  }
+  BOOST_TEST(std::stoul(changedKey) + 1 == std::stoul(sdb.key()));
+
+  // Rolled back changes, and untracked tables, leave the key alone
+  const auto& trackedKey {sdb.key()};
+  {
+    pqxx::work t {*sdb.db};
+    t.exec("INSERT INTO raw_things VALUES (4)");
+  }
+  sdb.exec("INSERT INTO other_things VALUES (1)");
+  BOOST_TEST(trackedKey == sdb.key());
+  BOOST_TEST(!sdb.refresh("things"));
+
+  // Tables only read in function bodies are found too
+  BOOST_TEST(sdb.refresh("function_things"));
+  BOOST_TEST(sdb.isTracked("hidden_things"));
+  sdb.exec("INSERT INTO hidden_things VALUES (1)");
+  BOOST_TEST(trackedKey != sdb.key());
+  BOOST_TEST(sdb.refresh("function_things"));
+
+  // As the tools use them, the snapshot is then what is read
+  nmdu::useSnapshots(*sdb.db, {{"things", {"(id)"}}});
+  pqxx::nontransaction n {*sdb.db};
+  BOOST_TEST("snapshot" == n.exec1(
+        "SELECT relnamespace::REGNAMESPACE::TEXT FROM pg_class"
+        " WHERE oid = 'things'::REGCLASS")[0].as<std::string>());
+}
+
+BOOST_AUTO_TEST_CASE(testQueryTracking, * utf::precondition(HasTestDb()))
+{
+  ScratchDb sdb {"query"};
+  sdb.exec("CREATE TABLE raw_things (id INT)");
+  sdb.exec("CREATE TABLE other_things (id INT)");
+  sdb.exec("CREATE VIEW things AS SELECT id FROM raw_things");
+
+  // As for the cached output of nmdb-analyze-data
+  sdb.exec("SELECT snapshot_track_changes("
+           "'SELECT COUNT(*) FROM things AS t')");
+  BOOST_TEST(sdb.isTracked("raw_things"));
+  BOOST_TEST(!sdb.isTracked("other_things"));
+
+  const auto& initialKey {sdb.key()};
+  sdb.exec("INSERT INTO other_things VALUES (1)");
+  BOOST_TEST(initialKey == sdb.key());
+  sdb.exec("TRUNCATE raw_things");
+  BOOST_TEST(initialKey != sdb.key());
+
+  // Repeat calls add nothing
+  sdb.exec("SELECT snapshot_track_changes('SELECT * FROM raw_things')");
+  pqxx::nontransaction n {*sdb.db};
+  BOOST_TEST(1 == n.exec1(
+        "SELECT COUNT(*) FROM pg_trigger"
+        " WHERE tgname = 'snapshot_data_changed'")[0].as<int>());
+}
@@ -0,0 +1,665 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <arpa/inet.h>
+
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/SnapshotFile.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  static_assert(std::endian::native == std::endian::little,
+                "Snapshot files are little-endian");
+
+  // Bytes per value of the type, zero if not a valid type
+  static size_t
+  typeWidth(uint32_t type)
+  {
+    switch (static_cast<SnapshotType>(type)) {
+      case SnapshotType::BOOL:    return sizeof(uint8_t);
+      case SnapshotType::INT:     return sizeof(int64_t);
+      case SnapshotType::DOUBLE:  return sizeof(double);
+      case SnapshotType::STRING:  return sizeof(uint32_t);
+      case SnapshotType::INET:    return sizeof(SnapshotInet);
+      case SnapshotType::MAC:     return sizeof(SnapshotMac);
+    }
+    return 0;
+  }
+
+  // Sizes and offsets computed from values read from a file, which must not
+  // wrap around before they are bounds checked
+  static uint64_t
+  checkedAdd(uint64_t lhs, uint64_t rhs)
+  {
+    uint64_t result;
+    if (__builtin_add_overflow(lhs, rhs, &result)) {
+      throw std::runtime_error("Snapshot file is truncated or corrupt");
+    }
+    return result;
+  }
+
+  static uint64_t
+  checkedMul(uint64_t lhs, uint64_t rhs)
+  {
+    uint64_t result;
+    if (__builtin_mul_overflow(lhs, rhs, &result)) {
+      throw std::runtime_error("Snapshot file is truncated or corrupt");
+    }
+    return result;
+  }
+
+  // ===========================================================================
+  // Value conversions
+  // ===========================================================================
+  bool
+  toSnapshotInet(std::string_view text, SnapshotInet& inet)
+  {
+    std::memset(&inet, 0, sizeof(inet));
+
+    const auto slash {text.find('/')};
+    const std::string address {text.substr(0, slash)};
+    if (1 == inet_pton(AF_INET, address.c_str(), inet.bytes)) {
+      inet.family = 4;
+      inet.prefix = 32;
+    } else if (1 == inet_pton(AF_INET6, address.c_str(), inet.bytes)) {
+      inet.family = 6;
+      inet.prefix = 128;
+    } else {
+      return false;
+    }
+
+    if (std::string_view::npos != slash) {
+      const auto prefixText {text.substr(slash + 1)};
+      unsigned prefix {0};
+      const auto [end, ec] {std::from_chars(prefixText.data(),
+          prefixText.data() + prefixText.size(), prefix)};
+      if (  ec != std::errc() || end != prefixText.data() + prefixText.size()
+         || inet.prefix < prefix)
+      {
+        return false;
+      }
+      inet.prefix = static_cast<uint8_t>(prefix);
+    }
+
+    return true;
+  }
+
+  bool
+  toSnapshotMac(std::string_view text, SnapshotMac& mac)
+  {
+    if (17 != text.size()) {
+      return false;
+    }
+    for (size_t i {0}; i < sizeof(mac.bytes); ++i) {
+      const auto* begin {text.data() + 3 * i};
+      if (0 < i && ':' != begin[-1] && '-' != begin[-1]) {
+        return false;
+      }
+      const auto [end, ec] {std::from_chars(begin, begin + 2, mac.bytes[i], 16)};
+      if (ec != std::errc() || end != begin + 2) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::string
+  toString(const SnapshotInet& inet)
+  {
+    char buffer[INET6_ADDRSTRLEN] {};
+    const int family {(6 == inet.family) ? AF_INET6 : AF_INET};
+    if (!inet_ntop(family, inet.bytes, buffer, sizeof(buffer))) {
+      return "";
+    }
+    return std::string(buffer) + '/' + std::to_string(inet.prefix);
+  }
+
+  std::string
+  toString(const SnapshotMac& mac)
+  {
+    static const char HEX[] {"0123456789abcdef"};
+    std::string text;
+    for (const auto byte : mac.bytes) {
+      if (!text.empty()) {
+        text += ':';
+      }
+      text += HEX[byte >> 4];
+      text += HEX[byte & 0xf];
+    }
+    return text;
+  }
+
+
+  // ===========================================================================
+  // SnapshotWriter
+  // ===========================================================================
+  SnapshotWriter::SnapshotWriter(const std::string& path) :
+    file(path, std::ios::binary | std::ios::trunc)
+  {
+    if (!file) {
+      throw std::runtime_error("Failed to open snapshot for writing: " + path);
+    }
+    const SnapshotHeader header {};
+    writeBlock(&header, sizeof(header));  // completed by close()
+  }
+
+  uint32_t
+  SnapshotWriter::getStringId(std::string_view value)
+  {
+    if (const auto iter {stringIds.find(value)}; iter != stringIds.end()) {
+      return iter->second;
+    }
+    const auto id {static_cast<uint32_t>(stringIds.size())};
+    stringIds.emplace(value, id);
+    return id;
+  }
+
+  uint64_t
+  SnapshotWriter::writeBlock(const void* bytes, size_t size)
+  {
+    const auto offset {static_cast<uint64_t>(file.tellp())};
+    file.write(static_cast<const char*>(bytes),
+               static_cast<std::streamsize>(size));
+    return offset;
+  }
+
+  void
+  SnapshotWriter::pad()
+  {
+    static const char ZEROS[8] {};
+    const auto offset {static_cast<uint64_t>(file.tellp())};
+    if (const auto extra {offset % 8}; 0 != extra) {
+      file.write(ZEROS, static_cast<std::streamsize>(8 - extra));
+    }
+  }
+
+  void
+  SnapshotWriter::beginTable(
+      const std::string& name,
+      const std::vector<std::pair<std::string, SnapshotType>>& _columns)
+  {
+    if (inTable) {
+      endTable();
+    }
+
+    auto& table {tables.emplace_back()};
+    table.name = name;
+    columns.clear();
+    for (const auto& [columnName, type] : _columns) {
+      auto& column {columns.emplace_back()};
+      column.name = columnName;
+      column.type = type;
+    }
+    inTable = true;
+  }
+
+  void
+  SnapshotWriter::addRow(
+      const std::vector<std::optional<std::string_view>>& values)
+  {
+    if (!inTable || values.size() != columns.size()) {
+      throw std::invalid_argument("Snapshot row does not match table columns");
+    }
+
+    const auto row {tables.back().rowCount++};
+    for (size_t i {0}; i < columns.size(); ++i) {
+      auto& column {columns[i]};
+      const auto width {typeWidth(static_cast<uint32_t>(column.type))};
+      const auto start {column.data.size()};
+      column.data.resize(start + width, 0);
+      auto* value {column.data.data() + start};
+
+      bool valid {values[i].has_value()};
+      if (valid) {
+        const auto text {*values[i]};
+        const auto* end {text.data() + text.size()};
+        switch (column.type) {
+          case SnapshotType::BOOL: {
+            *value = ("t" == text || "true" == text) ? 1 : 0;
+            break;
+          }
+          case SnapshotType::INT: {
+            int64_t number {0};
+            valid = (std::from_chars(text.data(), end, number).ptr == end);
+            std::memcpy(value, &number, sizeof(number));
+            break;
+          }
+          case SnapshotType::DOUBLE: {
+            double number {0};
+            valid = (std::from_chars(text.data(), end, number).ptr == end);
+            std::memcpy(value, &number, sizeof(number));
+            break;
+          }
+          case SnapshotType::STRING: {
+            const auto id {getStringId(text)};
+            std::memcpy(value, &id, sizeof(id));
+            break;
+          }
+          case SnapshotType::INET: {
+            SnapshotInet inet;
+            valid = toSnapshotInet(text, inet);
+            std::memcpy(value, &inet, sizeof(inet));
+            break;
+          }
+          case SnapshotType::MAC: {
+            SnapshotMac mac;
+            valid = toSnapshotMac(text, mac);
+            std::memcpy(value, &mac, sizeof(mac));
+            break;
+          }
+        }
+        if (!valid) {
+          LOG_DEBUG << "Storing unconvertable snapshot value as null: "
+                    << column.name << " -- " << text << '\n';
+          std::memset(value, 0, width);
+        }
+      }
+
+      column.nulls.resize(row / 8 + 1, 0);
+      if (!valid) {
+        column.nulls[row / 8] |= static_cast<uint8_t>(1U << (row % 8));
+        column.hasNulls = true;
+      }
+    }
+  }
+
+  void
+  SnapshotWriter::endTable()
+  {
+    if (!inTable) {
+      return;
+    }
+
+    auto& table {tables.back()};
+    for (auto& column : columns) {
+      SnapshotColumnEntry entry {};
+      entry.nameId = getStringId(column.name);
+      entry.type   = static_cast<uint32_t>(column.type);
+
+      pad();
+      entry.dataOffset = writeBlock(column.data.data(), column.data.size());
+      if (column.hasNulls) {
+        column.nulls.resize((table.rowCount + 7) / 8, 0);
+        pad();
+        entry.nullsOffset =
+          writeBlock(column.nulls.data(), column.nulls.size());
+      }
+      table.columns.emplace_back(entry);
+    }
+    columns.clear();
+    inTable = false;
+  }
+
+  void
+  SnapshotWriter::close()
+  {
+    endTable();
+
+    SnapshotHeader header {};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version    = SNAPSHOT_VERSION;
+    header.tableCount = static_cast<uint32_t>(tables.size());
+
+    // Names are interned before the string table is written
+    std::vector<uint32_t> tableNameIds;
+    for (const auto& table : tables) {
+      tableNameIds.emplace_back(getStringId(table.name));
+    }
+
+    std::vector<const std::string*> strings(stringIds.size());
+    for (const auto& [value, id] : stringIds) {
+      strings[id] = &value;
+    }
+
+    header.stringCount = strings.size();
+    std::vector<uint64_t> stringOffsets {0};
+    for (const auto* value : strings) {
+      stringOffsets.emplace_back(stringOffsets.back() + value->size());
+    }
+    pad();
+    header.stringOffsetsOffset = writeBlock(stringOffsets.data(),
+        stringOffsets.size() * sizeof(uint64_t));
+    header.stringDataOffset = static_cast<uint64_t>(file.tellp());
+    for (const auto* value : strings) {
+      writeBlock(value->data(), value->size());
+    }
+
+    pad();
+    header.tablesOffset = static_cast<uint64_t>(file.tellp());
+    for (size_t i {0}; i < tables.size(); ++i) {
+      const auto& table {tables[i]};
+      SnapshotTableEntry entry {};
+      entry.nameId      = tableNameIds[i];
+      entry.columnCount = static_cast<uint32_t>(table.columns.size());
+      entry.rowCount    = table.rowCount;
+      writeBlock(&entry, sizeof(entry));
+      writeBlock(table.columns.data(),
+                 table.columns.size() * sizeof(SnapshotColumnEntry));
+    }
+
+    file.seekp(0);
+    writeBlock(&header, sizeof(header));
+    file.close();
+    if (!file) {
+      throw std::runtime_error("Failed to write snapshot");
+    }
+  }
+
+
+  // ===========================================================================
+  // SnapshotReader
+  // ===========================================================================
+  SnapshotReader::SnapshotReader(const std::string& path) :
+    file(path)
+  {
+    check(0, sizeof(SnapshotHeader));
+    header = reinterpret_cast<const SnapshotHeader*>(file.data());
+    if (0 != std::memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic))) {
+      throw std::runtime_error("Not a snapshot file: " + path);
+    }
+    if (SNAPSHOT_VERSION != header->version) {
+      throw std::runtime_error("Unsupported snapshot version "
+                               + std::to_string(header->version)
+                               + ": " + path);
+    }
+
+    check(header->stringOffsetsOffset,
+          checkedMul(checkedAdd(header->stringCount, 1), sizeof(uint64_t)));
+    const auto* stringOffsets {reinterpret_cast<const uint64_t*>(
+        data(header->stringOffsetsOffset))};
+    check(header->stringDataOffset, stringOffsets[header->stringCount]);
+
+    auto offset {header->tablesOffset};
+    for (uint32_t i {0}; i < header->tableCount; ++i) {
+      check(offset, sizeof(SnapshotTableEntry));
+      const auto* table {
+        reinterpret_cast<const SnapshotTableEntry*>(data(offset))};
+      offset = checkedAdd(offset, sizeof(SnapshotTableEntry));
+
+      const auto columnsSize {
+        checkedMul(table->columnCount, sizeof(SnapshotColumnEntry))};
+      check(offset, columnsSize);
+      const auto* columns {
+        reinterpret_cast<const SnapshotColumnEntry*>(data(offset))};
+      for (uint32_t j {0}; j < table->columnCount; ++j) {
+        const auto& column {columns[j]};
+        const auto width {typeWidth(column.type)};
+        if (0 == width) {
+          throw std::runtime_error("Unknown snapshot column type "
+                                   + std::to_string(column.type));
+        }
+        check(column.dataOffset, checkedMul(table->rowCount, width));
+        if (0 != column.nullsOffset) {
+          check(column.nullsOffset, checkedAdd(table->rowCount, 7) / 8);
+        }
+      }
+      offset = checkedAdd(offset, columnsSize);
+
+      tables.emplace_back(table);
+    }
+  }
+
+  void
+  SnapshotReader::check(uint64_t offset, uint64_t size) const
+  {
+    if (file.size() < offset || file.size() - offset < size) {
+      throw std::runtime_error("Snapshot file is truncated or corrupt");
+    }
+  }
+
+  const uint8_t*
+  SnapshotReader::data(uint64_t offset) const
+  {
+    return reinterpret_cast<const uint8_t*>(file.data()) + offset;
+  }
+
+  uint32_t
+  SnapshotReader::getVersion() const
+  {
+    return header->version;
+  }
+
+  size_t
+  SnapshotReader::getTableCount() const
+  {
+    return tables.size();
+  }
+
+  SnapshotTable
+  SnapshotReader::getTable(size_t index) const
+  {
+    return SnapshotTable(this, tables.at(index));
+  }
+
+  std::optional<SnapshotTable>
+  SnapshotReader::findTable(std::string_view name) const
+  {
+    for (const auto* table : tables) {
+      if (getString(table->nameId) == name) {
+        return SnapshotTable(this, table);
+      }
+    }
+    return std::nullopt;
+  }
+
+  std::string_view
+  SnapshotReader::getString(uint64_t id) const
+  {
+    if (header->stringCount <= id) {
+      throw std::out_of_range("Snapshot string id out of range");
+    }
+    const auto* offsets {reinterpret_cast<const uint64_t*>(
+        data(header->stringOffsetsOffset))};
+    const auto begin {offsets[id]};
+    const auto end {offsets[id + 1]};
+    if (end < begin || offsets[header->stringCount] < end) {
+      throw std::runtime_error("Snapshot file is truncated or corrupt");
+    }
+    return std::string_view(
+        reinterpret_cast<const char*>(data(header->stringDataOffset + begin)),
+        end - begin);
+  }
+
+
+  // ===========================================================================
+  // SnapshotTable
+  // ===========================================================================
+  SnapshotTable::SnapshotTable(const SnapshotReader* _reader,
+                               const SnapshotTableEntry* _entry) :
+    reader(_reader),
+    entry(_entry)
+  {}
+
+  std::string_view
+  SnapshotTable::getName() const
+  {
+    return reader->getString(entry->nameId);
+  }
+
+  size_t
+  SnapshotTable::getRowCount() const
+  {
+    return entry->rowCount;
+  }
+
+  size_t
+  SnapshotTable::getColumnCount() const
+  {
+    return entry->columnCount;
+  }
+
+  SnapshotColumn
+  SnapshotTable::getColumn(size_t index) const
+  {
+    if (entry->columnCount <= index) {
+      throw std::out_of_range("Snapshot column index out of range");
+    }
+    const auto* columns {
+      reinterpret_cast<const SnapshotColumnEntry*>(entry + 1)};
+    return SnapshotColumn(reader, columns + index, entry->rowCount);
+  }
+
+  std::optional<SnapshotColumn>
+  SnapshotTable::findColumn(std::string_view name) const
+  {
+    for (size_t i {0}; i < entry->columnCount; ++i) {
+      auto column {getColumn(i)};
+      if (column.getName() == name) {
+        return column;
+      }
+    }
+    return std::nullopt;
+  }
+
+
+  // ===========================================================================
+  // SnapshotColumn
+  // ===========================================================================
+  SnapshotColumn::SnapshotColumn(const SnapshotReader* _reader,
+                                 const SnapshotColumnEntry* _entry,
+                                 uint64_t _rowCount) :
+    reader(_reader),
+    entry(_entry),
+    rowCount(_rowCount)
+  {}
+
+  const uint8_t*
+  SnapshotColumn::at(size_t row, SnapshotType type) const
+  {
+    if (rowCount <= row) {
+      throw std::out_of_range("Snapshot row out of range");
+    }
+    if (getType() != type) {
+      throw std::invalid_argument("Snapshot column type mismatch: "
+                                  + std::string(getName()));
+    }
+    return reader->data(entry->dataOffset)
+         + row * typeWidth(entry->type);
+  }
+
+  std::string_view
+  SnapshotColumn::getName() const
+  {
+    return reader->getString(entry->nameId);
+  }
+
+  SnapshotType
+  SnapshotColumn::getType() const
+  {
+    return static_cast<SnapshotType>(entry->type);
+  }
+
+  size_t
+  SnapshotColumn::size() const
+  {
+    return rowCount;
+  }
+
+  bool
+  SnapshotColumn::isNull(size_t row) const
+  {
+    if (rowCount <= row) {
+      throw std::out_of_range("Snapshot row out of range");
+    }
+    if (0 == entry->nullsOffset) {
+      return false;
+    }
+    const auto* nulls {reader->data(entry->nullsOffset)};
+    return 0 != (nulls[row / 8] & (1U << (row % 8)));
+  }
+
+  bool
+  SnapshotColumn::getBool(size_t row) const
+  {
+    return 0 != *at(row, SnapshotType::BOOL);
+  }
+
+  int64_t
+  SnapshotColumn::getInt(size_t row) const
+  {
+    int64_t value;
+    std::memcpy(&value, at(row, SnapshotType::INT), sizeof(value));
+    return value;
+  }
+
+  double
+  SnapshotColumn::getDouble(size_t row) const
+  {
+    double value;
+    std::memcpy(&value, at(row, SnapshotType::DOUBLE), sizeof(value));
+    return value;
+  }
+
+  std::string_view
+  SnapshotColumn::getString(size_t row) const
+  {
+    uint32_t id;
+    std::memcpy(&id, at(row, SnapshotType::STRING), sizeof(id));
+    return reader->getString(id);
+  }
+
+  const SnapshotInet&
+  SnapshotColumn::getInet(size_t row) const
+  {
+    return *reinterpret_cast<const SnapshotInet*>(
+        at(row, SnapshotType::INET));
+  }
+
+  const SnapshotMac&
+  SnapshotColumn::getMac(size_t row) const
+  {
+    return *reinterpret_cast<const SnapshotMac*>(
+        at(row, SnapshotType::MAC));
+  }
+
+  std::string
+  SnapshotColumn::toString(size_t row) const
+  {
+    if (isNull(row)) {
+      return "";
+    }
+    switch (getType()) {
+      case SnapshotType::BOOL:    return getBool(row) ? "t" : "f";
+      case SnapshotType::INT:     return std::to_string(getInt(row));
+      case SnapshotType::DOUBLE: {
+        char buffer[32];
+        const auto [end, ec] {std::to_chars(buffer, buffer + sizeof(buffer),
+                                            getDouble(row))};
+        return std::string(buffer, end);
+      }
+      case SnapshotType::STRING:  return std::string(getString(row));
+      case SnapshotType::INET:    return utils::toString(getInet(row));
+      case SnapshotType::MAC:     return utils::toString(getMac(row));
+    }
+    return "";
+  }
+}
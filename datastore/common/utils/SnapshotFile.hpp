@@ -0,0 +1,310 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef SNAPSHOT_FILE_HPP
+#define SNAPSHOT_FILE_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+
+
+namespace netmeld::datastore::utils {
+
+  /* Snapshot files hold query results (e.g., the datastore's views) as
+     columnar tables which can be memory mapped and read in place.
+
+     All values are little-endian and blocks start on 8 byte boundaries:
+
+       SnapshotHeader
+       column data, per table and column: values, then null bitmap (if any)
+       string offsets (uint64_t, one per string plus one) and string bytes
+       per table: SnapshotTableEntry, then its SnapshotColumnEntry set
+
+     Strings are dictionary encoded; every name and STRING value is the id
+     of its entry in the one string table.  Null bitmaps have one bit per
+     row, set for null, and null values are stored zeroed.
+   */
+
+  inline constexpr char      SNAPSHOT_MAGIC[8] {'N','M','D','B','S','N','A','P'};
+  inline constexpr uint32_t  SNAPSHOT_VERSION {1};
+
+  enum class SnapshotType : uint32_t {
+    BOOL    = 1,  // uint8_t
+    INT     = 2,  // int64_t
+    DOUBLE  = 3,  // double
+    STRING  = 4,  // uint32_t string id
+    INET    = 5,  // SnapshotInet
+    MAC     = 6,  // SnapshotMac
+  };
+
+  struct SnapshotInet {
+    uint8_t family;     // 4 or 6
+    uint8_t prefix;
+    uint8_t bytes[16];  // network order, IPv4 uses the first 4
+  };
+
+  struct SnapshotMac {
+    uint8_t bytes[6];
+  };
+
+  struct SnapshotHeader {
+    char      magic[8];
+    uint32_t  version;
+    uint32_t  tableCount;
+    uint64_t  tablesOffset;
+    uint64_t  stringCount;
+    uint64_t  stringOffsetsOffset;
+    uint64_t  stringDataOffset;
+  };
+
+  struct SnapshotTableEntry {
+    uint32_t  nameId;
+    uint32_t  columnCount;
+    uint64_t  rowCount;
+  };
+
+  struct SnapshotColumnEntry {
+    uint32_t  nameId;
+    uint32_t  type;
+    uint64_t  dataOffset;
+    uint64_t  nullsOffset;  // zero if the column has no nulls
+  };
+
+  static_assert(sizeof(SnapshotInet) == 18);
+  static_assert(sizeof(SnapshotMac) == 6);
+  static_assert(sizeof(SnapshotHeader) == 48);
+  static_assert(sizeof(SnapshotTableEntry) == 16);
+  static_assert(sizeof(SnapshotColumnEntry) == 24);
+
+  // Text form (as PostgreSQL outputs it) to value, false if not valid
+  bool toSnapshotInet(std::string_view, SnapshotInet&);
+  bool toSnapshotMac(std::string_view, SnapshotMac&);
+  std::string toString(const SnapshotInet&);
+  std::string toString(const SnapshotMac&);
+
+
+  // ===========================================================================
+  // Writer
+  // ===========================================================================
+  /* Writes a snapshot one table at a time; only the table being written and
+     the string dictionary are held in memory.  Values are given in text form
+     (as from PostgreSQL) and converted per the column's type.
+   */
+  class SnapshotWriter {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      struct Column {
+        std::string             name;
+        SnapshotType            type;
+        std::vector<uint8_t>    data;
+        std::vector<uint8_t>    nulls;
+        bool                    hasNulls {false};
+      };
+
+      struct Table {
+        std::string                       name;
+        uint64_t                          rowCount {0};
+        std::vector<SnapshotColumnEntry>  columns;
+      };
+
+      struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view value) const
+        { return std::hash<std::string_view>()(value); }
+      };
+
+      std::ofstream         file;
+      std::unordered_map<std::string, uint32_t, StringHash, std::equal_to<>>
+                            stringIds;
+      std::vector<Table>    tables;
+      std::vector<Column>   columns;
+      bool                  inTable {false};
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      explicit SnapshotWriter(const std::string&);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      uint32_t getStringId(std::string_view);
+      uint64_t writeBlock(const void*, size_t);
+      void     pad();
+
+    protected:
+    public:
+      void beginTable(const std::string&,
+                      const std::vector<std::pair<std::string, SnapshotType>>&);
+      // One value per column; nullopt for null
+      void addRow(const std::vector<std::optional<std::string_view>>&);
+      void endTable();
+      void close();
+  };
+
+
+  // ===========================================================================
+  // Reader
+  // ===========================================================================
+  class SnapshotReader;
+
+  class SnapshotColumn {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      const SnapshotReader*       reader;
+      const SnapshotColumnEntry*  entry;
+      uint64_t                    rowCount;
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      SnapshotColumn(const SnapshotReader*, const SnapshotColumnEntry*,
+                     uint64_t);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      const uint8_t* at(size_t, SnapshotType) const;
+
+    protected:
+    public:
+      std::string_view getName() const;
+      SnapshotType getType() const;
+      size_t size() const;
+
+      bool isNull(size_t) const;
+      bool getBool(size_t) const;
+      int64_t getInt(size_t) const;
+      double getDouble(size_t) const;
+      std::string_view getString(size_t) const;
+      const SnapshotInet& getInet(size_t) const;
+      const SnapshotMac& getMac(size_t) const;
+
+      // Value in text form, empty if null
+      std::string toString(size_t) const;
+  };
+
+  class SnapshotTable {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      const SnapshotReader*       reader;
+      const SnapshotTableEntry*   entry;
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      SnapshotTable(const SnapshotReader*, const SnapshotTableEntry*);
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+    public:
+      std::string_view getName() const;
+      size_t getRowCount() const;
+      size_t getColumnCount() const;
+      SnapshotColumn getColumn(size_t) const;
+      std::optional<SnapshotColumn> findColumn(std::string_view) const;
+  };
+
+  /* Maps a snapshot file and reads it in place.  The file is checked when
+     opened (std::runtime_error if not a valid snapshot); tables and columns
+     are views into the mapping, so must not outlive the reader.
+   */
+  class SnapshotReader {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      boost::iostreams::mapped_file_source      file;
+      const SnapshotHeader*                     header {nullptr};
+      std::vector<const SnapshotTableEntry*>    tables;
+
+    protected:
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      explicit SnapshotReader(const std::string&);
+      SnapshotReader(const SnapshotReader&) = delete;
+      SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      void check(uint64_t, uint64_t) const;
+
+    protected:
+    public:
+      const uint8_t* data(uint64_t) const;
+
+      uint32_t getVersion() const;
+      size_t getTableCount() const;
+      SnapshotTable getTable(size_t) const;
+      std::optional<SnapshotTable> findTable(std::string_view) const;
+      std::string_view getString(uint64_t) const;
+  };
+}
+#endif // SNAPSHOT_FILE_HPP
@@ -0,0 +1,209 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+
+#include <netmeld/datastore/utils/SnapshotFile.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+namespace sfs = std::filesystem;
+
+
+static sfs::path
+testPath(const std::string& _name)
+{
+  return sfs::temp_directory_path()/("nmdb-snapshot-unit-test-" + _name);
+}
+
+BOOST_AUTO_TEST_CASE(testSnapshotValues)
+{
+  nmdu::SnapshotInet inet;
+  BOOST_TEST(nmdu::toSnapshotInet("10.1.2.3", inet));
+  BOOST_TEST(4 == inet.family);
+  BOOST_TEST(32 == inet.prefix);
+  BOOST_TEST("10.1.2.3/32" == nmdu::toString(inet));
+  BOOST_TEST(nmdu::toSnapshotInet("10.1.0.0/16", inet));
+  BOOST_TEST("10.1.0.0/16" == nmdu::toString(inet));
+  BOOST_TEST(nmdu::toSnapshotInet("fe80::1/64", inet));
+  BOOST_TEST(6 == inet.family);
+  BOOST_TEST("fe80::1/64" == nmdu::toString(inet));
+  BOOST_TEST(!nmdu::toSnapshotInet("10.1.2.3/33", inet));
+  BOOST_TEST(!nmdu::toSnapshotInet("host", inet));
+
+  nmdu::SnapshotMac mac;
+  BOOST_TEST(nmdu::toSnapshotMac("00:1a:2B:3c:4d:5e", mac));
+  BOOST_TEST("00:1a:2b:3c:4d:5e" == nmdu::toString(mac));
+  BOOST_TEST(!nmdu::toSnapshotMac("00:1a:2b:3c:4d", mac));
+  BOOST_TEST(!nmdu::toSnapshotMac("00:1a:2b:3c:4d:zz", mac));
+}
+
+BOOST_AUTO_TEST_CASE(testSnapshotRoundTrip)
+{
+  const auto path {testPath("round-trip")};
+  {
+    nmdu::SnapshotWriter writer {path.string()};
+    writer.beginTable("devices", {
+        {"device_id",   nmdu::SnapshotType::STRING},
+        {"is_virtual",  nmdu::SnapshotType::BOOL},
+        {"hops",        nmdu::SnapshotType::INT},
+        {"weight",      nmdu::SnapshotType::DOUBLE},
+        {"ip_addr",     nmdu::SnapshotType::INET},
+        {"mac_addr",    nmdu::SnapshotType::MAC},
+      });
+    writer.addRow({"router", "t", "-2", "0.5", "10.0.0.1", "00:11:22:33:44:55"});
+    writer.addRow({"switch", "f", std::nullopt, "1e3", "::1/128", std::nullopt});
+    writer.addRow({"router", "f", "7", "x", std::nullopt, "00:11:22:33:44:66"});
+    writer.endTable();
+    writer.beginTable("empty", {{"device_id", nmdu::SnapshotType::STRING}});
+    writer.close();
+  }
+
+  {
+    nmdu::SnapshotReader reader {path.string()};
+    BOOST_TEST(nmdu::SNAPSHOT_VERSION == reader.getVersion());
+    BOOST_TEST(2 == reader.getTableCount());
+    BOOST_TEST(!reader.findTable("missing"));
+
+    const auto empty {reader.findTable("empty")};
+    BOOST_TEST_REQUIRE(empty.has_value());
+    BOOST_TEST(0 == empty->getRowCount());
+    BOOST_TEST(1 == empty->getColumnCount());
+
+    const auto devices {reader.getTable(0)};
+    BOOST_TEST("devices" == devices.getName());
+    BOOST_TEST(3 == devices.getRowCount());
+    BOOST_TEST(6 == devices.getColumnCount());
+
+    const auto deviceIds {devices.getColumn(0)};
+    BOOST_TEST("device_id" == deviceIds.getName());
+    BOOST_TEST("router" == deviceIds.getString(0));
+    BOOST_TEST("switch" == deviceIds.getString(1));
+    BOOST_TEST("router" == deviceIds.getString(2));
+    BOOST_TEST(deviceIds.getString(0).data() == deviceIds.getString(2).data());
+
+    const auto isVirtual {devices.findColumn("is_virtual")};
+    BOOST_TEST_REQUIRE(isVirtual.has_value());
+    BOOST_TEST(isVirtual->getBool(0));
+    BOOST_TEST(!isVirtual->getBool(1));
+
+    const auto hops {devices.getColumn(2)};
+    BOOST_TEST(-2 == hops.getInt(0));
+    BOOST_TEST(hops.isNull(1));
+    BOOST_TEST(7 == hops.getInt(2));
+    BOOST_TEST("" == hops.toString(1));
+    BOOST_CHECK_THROW(hops.getDouble(0), std::invalid_argument);
+    BOOST_CHECK_THROW(hops.getInt(3), std::out_of_range);
+
+    const auto weights {devices.getColumn(3)};
+    BOOST_TEST(0.5 == weights.getDouble(0));
+    BOOST_TEST(1000.0 == weights.getDouble(1));
+    BOOST_TEST(weights.isNull(2));  // not convertible
+
+    const auto ipAddrs {devices.getColumn(4)};
+    BOOST_TEST("10.0.0.1/32" == ipAddrs.toString(0));
+    BOOST_TEST(6 == ipAddrs.getInet(1).family);
+    BOOST_TEST(ipAddrs.isNull(2));
+
+    const auto macAddrs {devices.getColumn(5)};
+    BOOST_TEST("00:11:22:33:44:55" == macAddrs.toString(0));
+    BOOST_TEST(macAddrs.isNull(1));
+    BOOST_TEST(0x66 == macAddrs.getMac(2).bytes[5]);
+  }
+
+  sfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(testSnapshotInvalid)
+{
+  const auto path {testPath("invalid")};
+  {
+    std::ofstream ofs {path};
+    ofs << "not a snapshot, but long enough to hold a snapshot header....";
+  }
+  BOOST_CHECK_THROW(nmdu::SnapshotReader(path.string()), std::runtime_error);
+
+  {
+    nmdu::SnapshotWriter writer {path.string()};
+    writer.beginTable("t", {{"c", nmdu::SnapshotType::INT}});
+    writer.addRow({"1"});
+    BOOST_CHECK_THROW(writer.addRow({"1", "2"}), std::invalid_argument);
+    writer.close();
+  }
+  sfs::resize_file(path, sfs::file_size(path) - 8);
+  BOOST_CHECK_THROW(nmdu::SnapshotReader(path.string()), std::runtime_error);
+
+  sfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(testSnapshotOverflow)
+{
+  const auto path {testPath("overflow")};
+  const auto write {[&path]()
+    {
+      nmdu::SnapshotWriter writer {path.string()};
+      writer.beginTable("t", {{"c", nmdu::SnapshotType::INT}});
+      writer.addRow({"1"});
+      writer.close();
+    }};
+  // Overwrite a field of the file, at `offset`, with `value`
+  const auto patch {[&path](uint64_t offset, uint64_t value)
+    {
+      std::fstream fs {path, std::ios::in | std::ios::out | std::ios::binary};
+      fs.seekp(static_cast<std::streamoff>(offset));
+      fs.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }};
+  const auto tablesOffset {[&path]()
+    {
+      nmdu::SnapshotHeader header;
+      std::ifstream ifs {path, std::ios::binary};
+      ifs.read(reinterpret_cast<char*>(&header), sizeof(header));
+      return header.tablesOffset;
+    }};
+
+  // Sizes which wrap around to (almost) nothing must not pass as in bounds
+  write();
+  BOOST_TEST_REQUIRE(1 == nmdu::SnapshotReader(path.string()).getTableCount());
+  patch(offsetof(nmdu::SnapshotHeader, stringCount), UINT64_MAX);
+  BOOST_CHECK_THROW(nmdu::SnapshotReader(path.string()), std::runtime_error);
+
+  write();
+  patch(tablesOffset() + offsetof(nmdu::SnapshotTableEntry, rowCount),
+        uint64_t {1} << 61);
+  BOOST_CHECK_THROW(nmdu::SnapshotReader(path.string()), std::runtime_error);
+
+  write();
+  patch(tablesOffset() + offsetof(nmdu::SnapshotTableEntry, rowCount),
+        UINT64_MAX);
+  BOOST_CHECK_THROW(nmdu::SnapshotReader(path.string()), std::runtime_error);
+
+  sfs::remove(path);
+}
@@ -109,8 +109,11 @@ class Tool : public nmdt::AbstractExportTool
     int
     runTool() override
     {
-      // Contains tool's primary logic
+      // Contains tool's primary logic; mark its phases for --profile
+      profilePhase("startup");
+
       pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
 
       db.prepare
         ("select_tool_runs",
@@ -124,6 +127,7 @@ class Tool : public nmdt::AbstractExportTool
          " FROM tool_runs"
          " WHERE ($1 = tool_name)"
          "   AND ($2 = data_path)");
+      profilePhase("prepare");
 
       // Use a read_transaction and do not commit()
       pqxx::read_transaction t {db};
@@ -131,6 +135,7 @@ class Tool : public nmdt::AbstractExportTool
       pqxx::result toolRuns =
         t.exec_prepared("select_tool_runs");
           // any arguments separated by commas after table name
+      profilePhase("query");
 
       for (const auto& toolRun : toolRuns) {
         nmco::Uuid uuid;
@@ -143,6 +148,7 @@ class Tool : public nmdt::AbstractExportTool
         LOG_INFO << uuid << std::endl
                  << "  " <<toolName << "::" << commandLine << std::endl;
       }
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -159,6 +159,7 @@ class Tool : public nmdt::AbstractExportTool
     {
       pqxx::connection db       {getDbConnectString()};
       pqxx::read_transaction t  {db};
+      profilePhase("connect");
 
       pqxx::result portRows =
         t.exec("SELECT DISTINCT protocol, port"
@@ -252,12 +253,15 @@ class Tool : public nmdt::AbstractExportTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       if (opts.exists("from-db")) {
         addPortsFromDb();
       }
       else {
         addPortsFromFile();
       }
+      profilePhase("query");
 
       // If this program is being used, ports are being specified to nmap.
       // Nmap is unhappy if there are no ports, so ensure at least one.
@@ -291,6 +295,7 @@ class Tool : public nmdt::AbstractExportTool
       }
 
       LOG_NOTICE << nmapPorts << std::endl;
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
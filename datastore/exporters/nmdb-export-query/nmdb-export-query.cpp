@@ -92,9 +92,14 @@ class Tool : public nmdt::AbstractExportTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       pqxx::connection db       {getDbConnectString()};
       pqxx::read_transaction t  {db};
+      profilePhase("connect");
+
       pqxx::result records      {t.exec(opts.getValue("query"))};
+      profilePhase("query");
 
       // Populate column width and sanity check
       std::vector<float> sizes;
@@ -161,6 +166,7 @@ class Tool : public nmdt::AbstractExportTool
       }
 
       LOG_INFO << wc.write();
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -46,6 +46,18 @@ namespace netmeld::datastore::exporters::scans {
   // ==========================================================================
   // Methods
   // ==========================================================================
+  nmdu::SnapshotRelations
+  ExportScan::getSnapshotRelations() const
+  {
+    return {{"device_ip_addrs", {"(ip_addr)"}}};
+  }
+
+  void
+  ExportScan::useSnapshots()
+  {
+    nmdu::useSnapshots(db, getSnapshotRelations());
+  }
+
   std::string
   ExportScan::getHostname(
       pqxx::read_transaction& rt, const std::string& targetIp
@@ -30,9 +30,12 @@
 #include <pqxx/pqxx>
 
 #include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/utils/SnapshotCache.hpp>
 
 #include "../writers/Writer.hpp"
 
+namespace nmdu = netmeld::datastore::utils;
+
 namespace netmeld::datastore::exporters::scans {
 
   // ==========================================================================
@@ -70,7 +73,13 @@ namespace netmeld::datastore::exporters::scans {
 
       virtual void finalize(const std::unique_ptr<Writer>&) const = 0;
 
+      // Views queried, and the indexes their snapshots should have
+      virtual nmdu::SnapshotRelations getSnapshotRelations() const;
+
     public: // Methods part of public API
+      // Read the queried views from their (refreshed if stale) snapshots
+      void useSnapshots();
+
       virtual void exportTemplate(const std::unique_ptr<Writer>&) const = 0;
       virtual void exportFromDb(const std::unique_ptr<Writer>&) = 0;
   };
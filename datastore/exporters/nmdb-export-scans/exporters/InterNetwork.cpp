@@ -72,6 +72,14 @@ namespace netmeld::datastore::exporters::scans {
   // ========================================================================
   // Methods
   // ========================================================================
+  nmdu::SnapshotRelations
+  InterNetwork::getSnapshotRelations() const
+  {
+    auto relations {ExportScan::getSnapshotRelations()};
+    relations["inter_network_ports"] = {"(src_ip_addr, next_hop_ip_addr)"};
+    return relations;
+  }
+
   void
   InterNetwork::exportTemplate(const std::unique_ptr<Writer>& writer) const
   {
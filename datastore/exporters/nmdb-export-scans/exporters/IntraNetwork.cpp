@@ -74,6 +74,15 @@ namespace netmeld::datastore::exporters::scans {
   // ========================================================================
   // Methods
   // ========================================================================
+  nmdu::SnapshotRelations
+  IntraNetwork::getSnapshotRelations() const
+  {
+    auto relations {ExportScan::getSnapshotRelations()};
+    relations["intra_network_ports"] = {"(src_ip_addr, dst_ip_addr)"};
+    relations["network_services"] = {"(ip_addr, protocol, port)"};
+    return relations;
+  }
+
   void
   IntraNetwork::exportTemplate(const std::unique_ptr<Writer>& writer) const
   {
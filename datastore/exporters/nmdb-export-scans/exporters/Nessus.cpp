@@ -51,6 +51,14 @@ namespace netmeld::datastore::exporters::scans {
   // ========================================================================
   // Methods
   // ========================================================================
+  nmdu::SnapshotRelations
+  Nessus::getSnapshotRelations() const
+  {
+    auto relations {ExportScan::getSnapshotRelations()};
+    relations["nessus_results"] = {"(plugin_id)"};
+    return relations;
+  }
+
   void
   Nessus::exportTemplate(const std::unique_ptr<Writer>& writer) const
   {
@@ -63,6 +63,14 @@ namespace netmeld::datastore::exporters::scans {
   // ========================================================================
   // Methods
   // ========================================================================
+  nmdu::SnapshotRelations
+  Prowler::getSnapshotRelations() const
+  {
+    auto relations {ExportScan::getSnapshotRelations()};
+    relations["prowler_checks"] = {};
+    return relations;
+  }
+
   void
   Prowler::exportTemplate(const std::unique_ptr<Writer>& writer) const
   {
@@ -56,6 +56,7 @@ namespace netmeld::datastore::exporters::scans {
     private: // Methods which should be hidden from API users
     protected: // Methods part of subclass API
       void finalize(const std::unique_ptr<Writer>&) const override;
+      nmdu::SnapshotRelations getSnapshotRelations() const override;
 
     public: // Methods part of public API
       void exportTemplate(const std::unique_ptr<Writer>&) const override;
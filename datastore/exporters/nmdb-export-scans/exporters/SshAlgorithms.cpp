@@ -69,6 +69,14 @@ namespace netmeld::datastore::exporters::scans {
   // ========================================================================
   // Methods
   // ========================================================================
+  nmdu::SnapshotRelations
+  SshAlgorithms::getSnapshotRelations() const
+  {
+    auto relations {ExportScan::getSnapshotRelations()};
+    relations["ssh_host_algorithms"] = {"(ip_addr, ssh_algo_type)"};
+    return relations;
+  }
+
   void
   SshAlgorithms::exportTemplate(const std::unique_ptr<Writer>& writer) const
   {
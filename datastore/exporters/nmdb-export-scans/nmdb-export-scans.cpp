@@ -137,12 +137,16 @@ class Tool : public nmdt::AbstractExportTool
           , "Output template rather than actual data"
           )
         );
+
+      addSnapshotCacheOption();
     }
 
     // Overriden from AbstractExportTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       const auto& dbConInfo {getDbConnectString()};
 
       const auto& toFile      {opts.exists("to-file")};
@@ -160,37 +164,41 @@ class Tool : public nmdt::AbstractExportTool
 
       if (opts.exists("intra-network")) {
         nmdes::IntraNetwork exporter {dbConInfo};
-        doExport(exporter, writer);
+        doExport(exporter, writer, "intra-network");
       }
       if (opts.exists("inter-network")) {
         nmdes::InterNetwork exporter {dbConInfo};
-        doExport(exporter, writer);
+        doExport(exporter, writer, "inter-network");
       }
       if (opts.exists("nessus")) {
         nmdes::Nessus exporter {dbConInfo};
-        doExport(exporter, writer);
+        doExport(exporter, writer, "nessus");
       }
       if (opts.exists("prowler")) {
         nmdes::Prowler exporter {dbConInfo};
-        doExport(exporter, writer);
+        doExport(exporter, writer, "prowler");
       }
       if (opts.exists("ssh")) {
         nmdes::SshAlgorithms exporter {dbConInfo};
-        doExport(exporter, writer);
+        doExport(exporter, writer, "ssh");
       }
 
       return nmcu::Exit::SUCCESS;
     }
 
     void
-    doExport(auto& exporter, auto& writer) {
+    doExport(auto& exporter, auto& writer, const std::string& phase) {
       if (opts.exists("template")) {
         LOG_DEBUG << "Exporting template data\n";
         exporter.exportTemplate(writer);
       } else {
         LOG_DEBUG << "Exporting DB data\n";
+        if (opts.exists("snapshot-cache")) {
+          exporter.useSnapshots();
+        }
         exporter.exportFromDb(writer);
       }
+      profilePhase(phase);
     }
 
   protected: // Methods part of subclass API
@@ -0,0 +1,214 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <filesystem>
+
+#include <netmeld/datastore/tools/AbstractExportTool.hpp>
+#include <netmeld/datastore/utils/SnapshotFile.hpp>
+
+namespace nmcu = netmeld::core::utils;
+namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
+namespace sfs = std::filesystem;
+
+
+// =============================================================================
+// Export tool definition
+// =============================================================================
+class Tool : public nmdt::AbstractExportTool
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private: // Variables should generally be private
+    // Core views, exported when none are specified
+    const std::vector<std::string> DEFAULT_VIEWS {
+        "devices",
+        "device_interfaces",
+        "device_vrfs",
+        "device_mac_addrs",
+        "device_ip_addrs",
+        "device_ip_routes",
+        "device_ac_rules",
+        "device_acl_rules",
+        "device_vlans",
+        "ip_addrs",
+        "mac_addrs",
+        "mac_addrs_ip_addrs",
+        "ip_nets",
+        "hostnames",
+        "ports",
+      };
+
+  protected: // Variables intended for internal/subclass API
+    // Inhertied from AbstractTool at this scope
+      // std::string            helpBlurb;
+      // std::string            programName;
+      // std::string            version;
+      // ProgramOptions         opts;
+
+  public: // Variables should rarely appear at this scope
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  private: // Constructors should rarely appear at this scope
+  protected: // Constructors intended for internal/subclass API
+  public: // Constructors should generally be public
+    Tool() : nmdt::AbstractExportTool
+      ("memory mappable columnar snapshot of data store views",
+       PROGRAM_NAME,
+       PROGRAM_VERSION)
+    {}
+
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private: // Methods part of internal API
+    // Overriden from AbstractExportTool
+    void
+    addToolOptions() override
+    {
+      opts.addRequiredOption("output", std::make_tuple(
+            "output,o",
+            po::value<std::string>()->required(),
+            "Snapshot file to write")
+          );
+
+      opts.addOptionalOption("view", std::make_tuple(
+            "view",
+            po::value<std::vector<std::string>>()->multitoken()->composing(),
+            "View (or table) to export, instead of the default core views;"
+            " may be repeated")
+          );
+    }
+
+    // Overriden from AbstractExportTool
+    int
+    runTool() override
+    {
+      profilePhase("startup");
+
+      const auto& views {opts.exists("view")
+                        ? opts.getValues("view")
+                        : DEFAULT_VIEWS};
+      const sfs::path outPath {opts.getValue("output")};
+      const sfs::path tmpPath {outPath.string() + ".tmp"};
+
+      pqxx::connection db {getDbConnectString()};
+      // One consistent view of the data across every exported view
+      pqxx::transaction<pqxx::isolation_level::repeatable_read,
+                        pqxx::write_policy::read_only> t {db};
+      profilePhase("connect");
+
+      // Written aside and moved into place, so readers never see a partial
+      nmdu::SnapshotWriter writer {tmpPath.string()};
+      for (const auto& view : views) {
+        const std::string query {"SELECT * FROM " + t.quote_name(view)};
+
+        // Column names and types only; rows are streamed below
+        const auto& header {t.exec(query + " LIMIT 0")};
+        std::vector<std::pair<std::string, nmdu::SnapshotType>> columns;
+        for (pqxx::row_size_type i {0}; i < header.columns(); ++i) {
+          columns.emplace_back(header.column_name(i),
+                               toSnapshotType(header.column_type(i)));
+        }
+        writer.beginTable(view, columns);
+
+        size_t count {0};
+        std::vector<std::optional<std::string_view>> values(columns.size());
+        auto stream {pqxx::stream_from::query(t, query)};
+        while (const auto* row {stream.read_row()}) {
+          for (size_t i {0}; i < row->size(); ++i) {
+            const auto& field {(*row)[i]};
+            values[i] = (nullptr == field.data())
+                      ? std::nullopt
+                      : std::optional<std::string_view>(field);
+          }
+          writer.addRow(values);
+          ++count;
+        }
+        stream.complete();
+        writer.endTable();
+
+        LOG_INFO << "Exported " << count << " rows from " << view
+                 << '\n';
+        profilePhase(view);
+      }
+      writer.close();
+      sfs::rename(tmpPath, outPath);
+      profilePhase("output");
+
+      LOG_INFO << "Wrote snapshot: " << outPath.string() << '\n';
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+    // Column storage for the PostgreSQL type; text for all others
+    static nmdu::SnapshotType
+    toSnapshotType(pqxx::oid type)
+    {
+      switch (type) {
+        case 16:    // bool
+          return nmdu::SnapshotType::BOOL;
+        case 20:    // int8
+        case 21:    // int2
+        case 23:    // int4
+          return nmdu::SnapshotType::INT;
+        case 700:   // float4
+        case 701:   // float8
+          return nmdu::SnapshotType::DOUBLE;
+        case 650:   // cidr
+        case 869:   // inet
+          return nmdu::SnapshotType::INET;
+        case 829:   // macaddr
+          return nmdu::SnapshotType::MAC;
+        default:
+          return nmdu::SnapshotType::STRING;
+      }
+    }
+
+  protected: // Methods part of subclass API
+    // Inherited from AbstractTool at this scope
+      // std::string const getDbName() const;
+      // virtual void printVersion() const;
+    // Inherited from AbstractExportTool at this scope
+      // virtual void printHelp() const;
+
+  public: // Methods part of public API
+    // Inherited from AbstractTool, don't override as primary tool entry point
+      // int start(int, char**) noexcept;
+};
+
+
+// =============================================================================
+// Program entry point
+// =============================================================================
+int main(int argc, char** argv) {
+  Tool tool;
+  return tool.start(argc, argv);
+}
@@ -81,7 +81,7 @@ class Tool : public nmdt::AbstractGraphTool
     Tool() : nmdt::AbstractGraphTool
       (
        "help blurb",    // help blurb, prefixed with:
-                        //   "Create dot formatted graph of "
+                        //   "Create dot (or GraphML/JSON) formatted graph of "
        PROGRAM_NAME,    // program name (set in CMakeLists.txt)
        PROGRAM_VERSION  // program version (set in CMakeLists.txt)
       )
@@ -116,6 +116,11 @@ class Tool : public nmdt::AbstractGraphTool
                  is to hide the mechanism that does the graphing behind an
                  interface so the tool focusing on graph construction logic and
                  not graph data structure logic.
+
+        Once built, output the graph with writeGraph(...) (see
+        AbstractGraphTool) so the common output format and subgraph options
+        apply.  Mark the tool's phases (e.g., connect, build, output) with
+        profilePhase(...) so --profile reports them.
       */
       LOG_DEBUG << "No demo logic implemented" << std::endl;
 
@@ -69,7 +69,7 @@ class Tool : public nmdt::AbstractGraphTool
     Tool() : nmdt::AbstractGraphTool
       (
        "network based access control rules",    // help blurb, prefixed with:
-                        //   "Create dot formatted graph of "
+                        //   "Create dot (or GraphML/JSON) formatted graph of "
        PROGRAM_NAME,    // program name (set in CMakeLists.txt)
        PROGRAM_VERSION  // program version (set in CMakeLists.txt)
       )
@@ -100,13 +100,22 @@ class Tool : public nmdt::AbstractGraphTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
+
       nmdu::dbPrepareCommon(db);
 
       std::string rulesTarget {"device_ac_rules_known_applied"};
       if (opts.exists("all")) {
         rulesTarget = "device_ac_rules";
       }
+      useSnapshots(db, {
+          {rulesTarget, {"(device_id)"}},
+          {"device_ac_nets", {"(device_id, net_set_id)"}},
+          {"device_ac_services", {"(device_id, service_set)"}},
+        });
 
       db.prepare
         ("select_device_ac_sets",
@@ -161,18 +170,19 @@ class Tool : public nmdt::AbstractGraphTool
          "   AND (dar.enabled)"
          " GROUP BY src, dst, id, action, description"
          "");
-
+      profilePhase("prepare");
 
       std::string const deviceId {nmcu::toLower(opts.getValue("device-id"))};
 
       buildAcGraph(db, deviceId);
-
-      boost::write_graphviz
-        (std::cout, graph,
-         LabelWriter(graph),   // VertexPropertyWriter
-         LabelWriter(graph),   // EdgePropertyWriter
-         GraphWriter(),        // GraphPropertyWriter
-         boost::get(&VertexProperties::name, graph));  // VertexID
+      profilePhase("build");
+
+      writeGraph(graph,
+                 LabelWriter(graph),   // VertexPropertyWriter
+                 LabelWriter(graph),   // EdgePropertyWriter
+                 GraphWriter(),        // GraphPropertyWriter
+                 deviceId);            // Root for --hops
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -28,6 +28,7 @@
 
 #include <netmeld/datastore/objects/PortRange.hpp>
 #include <netmeld/datastore/tools/AbstractGraphTool.hpp>
+#include <netmeld/datastore/utils/IconIndex.hpp>
 
 #include "GraphHelper.hpp"
 
@@ -70,6 +71,8 @@ class Tool : public nmdt::AbstractGraphTool
 
     AwsGraph graph;
 
+    nmdu::IconIndex icons;
+
     std::map<std::string, Vertex>
       vertexLookup;
     std::map<std::string, std::map<std::string, Edge>>
@@ -97,7 +100,7 @@ class Tool : public nmdt::AbstractGraphTool
     Tool() : nmdt::AbstractGraphTool
       (
        "AWS VPC related resources", // help blurb, prefixed with:
-                        //   "Create dot formatted graph of "
+                        //   "Create dot (or GraphML/JSON) formatted graph of "
        PROGRAM_NAME,    // program name (set in CMakeLists.txt)
        PROGRAM_VERSION  // program version (set in CMakeLists.txt)
       )
@@ -140,8 +143,19 @@ class Tool : public nmdt::AbstractGraphTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
+
       nmdu::dbPrepareCommon(db);
+      useSnapshots(db, {
+          {"aws_active_instance_details", {}},
+          {"aws_eni_security_group_rules_full_machine", {"(interface_id)"}},
+          {"aws_network_interface_mac_ips", {"(interface_id)"}},
+          {"aws_subnet_network_acl_rules_full_machine", {}},
+          {"aws_vpc_cidr_blocks", {"(vpc_id)"}},
+        });
 
       db.prepare("select_aws_instance_vertices", R"(
           SELECT DISTINCT
@@ -395,15 +409,17 @@ class Tool : public nmdt::AbstractGraphTool
       noNetworkInterfaces = opts.exists("no-network-interfaces");
       graphInstances      = opts.exists("graph-instances");
 
+      icons.setFolder(opts.getValue("icons-folder"));
+      profilePhase("prepare");
 
       buildAwsGraph(db);
+      profilePhase("build");
 
-      boost::write_graphviz
-        (std::cout, graph,
-         LabelWriter(graph),   // VertexPropertyWriter
-         LabelWriter(graph),   // EdgePropertyWriter
-         GraphWriter(),        // GraphPropertyWriter
-         boost::get(&VertexProperties::name, graph));  // VertexID
+      writeGraph(graph,
+                 LabelWriter(graph),   // VertexPropertyWriter
+                 LabelWriter(graph),   // EdgePropertyWriter
+                 GraphWriter());       // GraphPropertyWriter
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -702,11 +718,16 @@ class Tool : public nmdt::AbstractGraphTool
           vRow.at("subnet_id").to(id);
           std::string subnet;
           vRow.at("cidr_block").to(subnet);
+          std::string vpcId;
+          vRow.at("vpc_id").to(vpcId);
 
           std::ostringstream oss;
           oss << '(' << subnet << R"()<br/>)";
 
           addVertex("oval", id, oss.str());
+          if (!vpcId.empty()) {
+            graph[vertexLookup.at(id)].clusters.emplace(vpcId);
+          }
         }
       }
 
@@ -891,6 +912,7 @@ class Tool : public nmdt::AbstractGraphTool
         }
 
         addVertex("oval", id, oss.str());
+        graph[vertexLookup.at(id)].clusters.emplace(id);
       }
     }
 
@@ -949,21 +971,7 @@ class Tool : public nmdt::AbstractGraphTool
         std::string type {"aws-" + id.substr(0, pos) + ".svg"};
         LOG_DEBUG << "Looking for icon name: " << type << '\n';
 
-        sfs::path iPath {opts.getValue("icons-folder")};
-        for (const auto& pathIter : sfs::recursive_directory_iterator(iPath)) {
-          std::string fileName {pathIter.path().filename()};
-
-          LOG_DEBUG << " - " << fileName << '\n';
-          if (std::equal(type.begin(), type.end(),
-                         fileName.begin(), fileName.end(),
-                         [](auto a, auto b) {
-                            return std::tolower(a) == std::tolower(b);
-                         }))
-          {
-            iconPath = pathIter.path();
-            break;
-          }
-        }
+        iconPath = icons.find(type);
       }
 
       LOG_DEBUG << "Icon path: " << iconPath << '\n';
@@ -29,6 +29,7 @@
 
 #include <boost/graph/adjacency_list.hpp>
 
+#include <set>
 #include <string>
 
 //==============================================================================
@@ -42,6 +43,8 @@ struct VertexProperties
   std::string style;
   std::string fillcolor;
 
+  std::set<std::string> clusters;   // e.g., VLANs
+
   double distance     {std::numeric_limits<double>::infinity()};
   double extraWeight  {0.0};
 };
@@ -27,11 +27,13 @@
 #include <boost/graph/dijkstra_shortest_paths.hpp>
 
 #include <netmeld/datastore/tools/AbstractGraphTool.hpp>
+#include <netmeld/datastore/utils/IconIndex.hpp>
 
 #include "GraphHelper.hpp"
 
 namespace nmdt = netmeld::datastore::tools;
 namespace nmcu = netmeld::core::utils;
+namespace nmdu = netmeld::datastore::utils;
 
 
 // ============================================================================
@@ -52,6 +54,8 @@ class Tool : public nmdt::AbstractGraphTool
 
     const nmcu::FileManager& nmfm {nmcu::FileManager::getInstance()};
 
+    nmdu::IconIndex icons;
+
     bool useIcons           {false};
     bool hideUnknown        {false};
     bool removeEmptySubnets {false};
@@ -116,7 +120,33 @@ class Tool : public nmdt::AbstractGraphTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
+
+      useSnapshots(db, {
+          {"device_connections", {}},
+          {"device_hardware_information", {"(device_id)"}},
+          {"device_ip_addrs", {"(device_id)", "(ip_addr)",
+                               "USING GIST (ip_addr inet_ops)"}},
+          {"device_mac_addrs_ip_addrs", {"(device_id, interface_name)"}},
+          {"device_virtualizations", {}},
+          {"device_vlans_ip_nets", {"(ip_net)"}},
+          {"device_vlans_summaries", {"(ip_net)"}},
+          {"devices", {}},
+          {"hostnames", {"(ip_addr)"}},
+          {"ip_addrs", {"(ip_addr)", "USING GIST (ip_addr inet_ops)"}},
+          {"ip_addrs_without_devices", {}},
+          {"ip_nets", {"(ip_net)"}},
+          {"ip_traceroutes", {}},
+          {"mac_addrs", {"(mac_addr)"}},
+          {"mac_addrs_ip_addrs", {"(mac_addr)", "(ip_addr)"}},
+          {"mac_addrs_vendors", {"(mac_addr)"}},
+          {"mac_addrs_without_devices", {}},
+          {"vlans_ip_nets", {"(ip_net)"}},
+          {"vlans_summaries", {"(ip_net)"}},
+        });
 
       // Layer 2
       db.prepare("select_device_connections", R"(
@@ -287,6 +317,7 @@ class Tool : public nmdt::AbstractGraphTool
         );
 
       useIcons = opts.exists("icons");
+      icons.setFolder(opts.getValue("icons-folder"));
       hideUnknown = opts.exists("no-unknown");
       removeEmptySubnets = opts.exists("no-empty-subnets");
       showTracerouteHops = opts.exists("show-traceroute-hops");
@@ -302,6 +333,7 @@ class Tool : public nmdt::AbstractGraphTool
         respondingState = "{t,f,NULL}";
         passRespondingState = true;
       }
+      profilePhase("prepare");
 
       unsigned int layer {opts.getValueAs<unsigned int>("layer")};
       switch (layer) {
@@ -334,14 +366,15 @@ class Tool : public nmdt::AbstractGraphTool
 
       buildVirtualizationGraph(db);
       buildTracerouteGraph(db);
+      profilePhase("build");
 
-      boost::write_graphviz(
-          std::cout, graph,
-          LabelWriter(graph),   // VertexPropertyWriter
-          LabelWriter(graph),   // EdgePropertyWriter
-          GraphWriter(),        // GraphPropertyWriter
-          boost::get(&VertexProperties::name, graph)  // VertexID
-        );
+      writeGraph(graph,
+                 LabelWriter(graph),   // VertexPropertyWriter
+                 LabelWriter(graph),   // EdgePropertyWriter
+                 GraphWriter(),        // GraphPropertyWriter
+                 deviceId              // Root for --hops
+                );
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -409,10 +442,12 @@ class Tool : public nmdt::AbstractGraphTool
 
         // Add any VLAN tag information
         pqxx::result vlanRows {rt.exec_prepared("select_network_vlan", ipNet)};
+        std::set<std::string> vlans;
         if (vlanRows.size()) {
           oss << "VLAN:";
           for (const auto& vlanRow : vlanRows) {
             oss << " " << vlanRow.at("vlan").c_str();
+            vlans.emplace(std::string("vlan-") + vlanRow.at("vlan").c_str());
           }
           oss << R"(\n)";
         }
@@ -426,6 +461,7 @@ class Tool : public nmdt::AbstractGraphTool
         }
 
         addNetVertex(ipNet, oss.str(), extraWeight);
+        graph[vertexLookup.at(ipNet)].clusters = vlans;
 
         // only connect responding IPs to subnets; unless want specific state
         std::string state {"{t}"};
@@ -718,22 +754,11 @@ class Tool : public nmdt::AbstractGraphTool
         return "";
       }
 
-      sfs::path imagePath  {opts.getValue("icons-folder")};
-      std::string iconPath {imagePath.string() + "/unknown.svg"};
+      std::string iconPath {icons.getFolder().string() + "/unknown.svg"};
 
       if (!deviceType.empty()) {
-        for (auto& pathIter : sfs::recursive_directory_iterator(imagePath)) {
-          std::string fileName {pathIter.path().filename()};
-
-          if (std::equal(deviceType.begin(), deviceType.end(),
-                         fileName.begin(), fileName.end(),
-                         [](auto a, auto b) {
-                            return std::tolower(a) == std::tolower(b);
-                         }))
-          {
-            iconPath = fileName;
-            break;
-          }
+        if (const auto path {icons.find(deviceType)}; !path.empty()) {
+          iconPath = path.filename();
         }
       }
 
@@ -73,7 +73,8 @@ class Tool : public nmdt::AbstractGraphTool
   protected: // Constructors intended for internal/subclass API
   public: // Constructors should generally be public
     Tool() : nmdt::AbstractGraphTool
-      ( // help blurb, prefixed with: "Create dot formatted graph of "
+      ( // help blurb, prefixed with:
+        //   "Create dot (or GraphML/JSON) formatted graph of "
         "routes between two points"
       , PROGRAM_NAME    // program name (set in CMakeLists.txt)
       , PROGRAM_VERSION // program version (set in CMakeLists.txt)
@@ -121,23 +122,35 @@ class Tool : public nmdt::AbstractGraphTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       processOptions();
 
       pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
+
       nmdu::dbPrepareCommon(db);
+      useSnapshots(db, {
+          {"device_acl_rules_all", {"(device_id)"}},
+          {"device_ip_routes", {"(device_id)",
+                                "USING GIST (dst_ip_net inet_ops)"}},
+          {"device_vrfs_ip_addrs", {"(device_id, vrf_id)", "(ip_addr)",
+                                    "USING GIST (ip_net inet_ops)"}},
+        });
 
       dbPrepareToolSpecific(db);
+      profilePhase("prepare");
 
       buildRouteGraph(db);
+      profilePhase("build");
 
-      boost::write_graphviz( std::cout          // std::ostream
-                           , graph              // VertexAndEdgeListGraph
-                           , LabelWriter(graph) // VertexPropertyWriter
-                           , LabelWriter(graph) // EdgePropertyWriter
-                           , GraphWriter()      // GraphPropertyWriter
-                           // VertexID
-                           , boost::get(&VertexProperties::name, graph)
-                           );
+      writeGraph( graph              // VertexAndEdgeListGraph
+                , LabelWriter(graph) // VertexPropertyWriter
+                , LabelWriter(graph) // EdgePropertyWriter
+                , GraphWriter()      // GraphPropertyWriter
+                , firstHop           // Root for --hops
+                );
+      profilePhase("output");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -294,9 +307,7 @@ class Tool : public nmdt::AbstractGraphTool
             )
             AND dst_ip_net_set_id in (
               SELECT ip_net_set_id
-              FROM device_acl_ip_nets
-              WHERE device_id = $1
-                AND ip_net && $2
+              FROM device_acl_ip_net_sets_overlapping($1, $2)
               )
           ORDER BY priority
           )"
@@ -28,6 +28,9 @@
 
 #include <netmeld/datastore/objects/IpAddress.hpp>
 #include <netmeld/datastore/objects/aws/Attachment.hpp>
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
 
 // =============================================================================
 // Parser logic
@@ -43,6 +46,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  fromJson(nmdu::parseJsonStream(_in, {"Reservations"},
+      [this](const std::string&, const json& _reservation) {
+        processInstances(_reservation);
+      }));
+}
+
 void
 Parser::processInstances(const json& _reservation)
 {
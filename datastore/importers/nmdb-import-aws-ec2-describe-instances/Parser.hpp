@@ -82,6 +82,8 @@ class Parser
 
   public:
     void fromJson(const json&);
+    // Same as fromJson, but reads one Reservations element at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
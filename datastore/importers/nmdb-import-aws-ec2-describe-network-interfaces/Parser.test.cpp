@@ -45,6 +45,7 @@ class TestParser : public Parser
     using Parser::processInterfaceAttachment;
     using Parser::processInterface;
     using Parser::fromJson;
+    using Parser::fromJsonStream;
 };
 
 BOOST_AUTO_TEST_CASE(testProcessIps)
@@ -328,3 +329,39 @@ BOOST_AUTO_TEST_CASE(testFromJson)
     BOOST_TEST(0 == tp.getData().size());
   }
 }
+
+BOOST_AUTO_TEST_CASE(testFromJsonStream)
+{
+  const std::string tv1 {R"(
+      { "NetworkInterfaces":
+        [ { "NetworkInterfaceId": "eni-1", "MacAddress": "00:11:22:33:44:55"
+          , "Groups": [{"GroupId": "sg-1"}]
+          , "Ipv6Addresses": []
+          , "PrivateIpAddresses": [{"PrivateIpAddress": "10.0.0.1"}]
+          }
+        , { "NetworkInterfaceId": "eni-2", "Status": "in-use"
+          , "Groups": [], "Ipv6Addresses": [{"Ipv6Address": "1::2"}]
+          , "PrivateIpAddresses": []
+          }
+        ]
+      , "NextToken": "abc"
+      }
+    )"};
+  {
+    TestParser tev;
+    tev.fromJson(json::parse(tv1));
+
+    TestParser tp;
+    std::istringstream iss {tv1};
+    tp.fromJsonStream(iss);
+
+    BOOST_TEST(1 == tp.getData().size());
+    BOOST_TEST(2 == tp.getData()[0].interfaces.size());
+    BOOST_TEST((tev.getData() == tp.getData()));
+  }
+  {
+    TestParser tp;
+    std::istringstream iss {R"({ "NextToken": "abc" })"};
+    BOOST_CHECK_THROW(tp.fromJsonStream(iss), json::out_of_range);
+  }
+}
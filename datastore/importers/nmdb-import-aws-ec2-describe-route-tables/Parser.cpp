@@ -26,6 +26,10 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -40,6 +44,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  fromJson(nmdu::parseJsonStream(_in, {"RouteTables"},
+      [this](const std::string&, const json& _routeTable) {
+        processRouteTable(_routeTable);
+      }));
+}
+
 void
 Parser::processRouteTable(const json& _routeTable)
 {
@@ -83,6 +83,8 @@ class Parser
 
   public:
     void fromJson(const json&);
+    // Same as fromJson, but reads one SecurityGroups element at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
@@ -26,6 +26,10 @@
 
 #include "Parser.hpp"
 
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
+
 
 // =============================================================================
 // Parser logic
@@ -41,6 +45,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  fromJson(nmdu::parseJsonStream(_in, {"TransitGatewayAttachments"},
+      [this](const std::string&, const json& _json) {
+        processTransitGatewayAttachment(_json);
+      }));
+}
+
 void
 Parser::processTransitGatewayAttachment(const json& _json)
 {
@@ -78,6 +78,8 @@ class Parser
 
   public:
     void fromJson(const json&);
+    // Same as fromJson, but reads one TransitGatewayAttachments element at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
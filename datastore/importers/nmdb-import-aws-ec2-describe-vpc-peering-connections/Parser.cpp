@@ -27,6 +27,9 @@
 #include "Parser.hpp"
 
 #include <netmeld/datastore/objects/aws/CidrBlock.hpp>
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
 
 // =============================================================================
 // Parser logic
@@ -42,6 +45,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  fromJson(nmdu::parseJsonStream(_in, {"VpcPeeringConnections"},
+      [this](const std::string&, const json& _json) {
+        processVpcPeeringConnection(_json);
+      }));
+}
+
 void
 Parser::processVpcPeeringConnection(const json& _json)
 {
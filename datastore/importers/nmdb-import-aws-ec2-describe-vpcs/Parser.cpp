@@ -27,6 +27,9 @@
 #include "Parser.hpp"
 
 #include <netmeld/datastore/objects/aws/CidrBlock.hpp>
+#include <netmeld/datastore/utils/JsonStream.hpp>
+
+namespace nmdu = netmeld::datastore::utils;
 
 // =============================================================================
 // Parser logic
@@ -42,6 +45,15 @@ Parser::fromJson(const json& _data)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& _in)
+{
+  fromJson(nmdu::parseJsonStream(_in, {"Vpcs"},
+      [this](const std::string&, const json& _vpc) {
+        processVpcs(_vpc);
+      }));
+}
+
 void
 Parser::processVpcs(const json& _vpc)
 {
@@ -79,6 +79,8 @@ class Parser
 
   public:
     void fromJson(const json&);
+    // Same as fromJson, but reads one Vpcs element at a time
+    void fromJsonStream(std::istream&);
     Result getData();
 };
 #endif // PARSER_HPP
@@ -25,6 +25,7 @@
 // =============================================================================
 
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
 
 #include "Parser.hpp"
 
@@ -64,11 +65,15 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& deviceId  {this->getDeviceId()};
 
+      // Full routing tables are far too large to insert a row at a time
+      nmdu::InsertCopy copy {t};
+
       LOG_DEBUG << "Iterating over results\n";
       for (auto& result : this->tResults) {
         result.save(t, toolRunId, deviceId);
         LOG_DEBUG << result.toDebugString() << std::endl;
       }
+      copy.flush();
     }
 
   protected: // Methods part of subclass API
@@ -26,6 +26,7 @@
 
 #include <netmeld/datastore/objects/DeviceInformation.hpp>
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "Parser.hpp"
@@ -73,6 +74,9 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       deviceInfo.save(t, toolRunId, deviceId);
       LOG_DEBUG << deviceInfo.toDebugString() << std::endl;
 
+      // Full routing tables are far too large to insert a row at a time
+      nmdu::InsertCopy copy {t};
+
       LOG_DEBUG << "Iterating over results\n";
       for (auto& vrf : this->tResults) {
         LOG_DEBUG << "Iterating over Routes\n";
@@ -85,6 +89,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
         vrf.observations.save(t, toolRunId, deviceId);
         LOG_DEBUG << vrf.observations.toDebugString() << std::endl;
       }
+      copy.flush();
     }
 
   protected: // Methods part of subclass API
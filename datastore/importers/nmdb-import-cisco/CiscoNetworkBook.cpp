@@ -230,10 +230,8 @@ namespace netmeld::datastore::importers::cisco {
                                           const nmdo::IpAddress& _mask)
   {
     if (0 == networkBooks.count(_otherBook)) {
-      LOG_WARN << "CiscoNetworkBook:"
-               << " Cannot apply mask (" << _mask << ")"
-               << " to undefined book (" << _otherBook << ")"
-               << '\n';
+      // May be defined later (or in another segment), retry when finalizing
+      unresolvedMasks.emplace_back(curBook.getName(), _otherBook, _mask);
       return;
     }
     for (const auto& ip : networkBooks[_otherBook].getData()) {
@@ -266,10 +264,45 @@ namespace netmeld::datastore::importers::cisco {
   }
 
 
+  void
+  CiscoNetworkBook::resolveMasks()
+  {
+    for (const auto& [tgtBook, otherBook, mask] : unresolvedMasks) {
+      if (0 == networkBooks.count(otherBook)) {
+        LOG_WARN << "CiscoNetworkBook:"
+                 << " Cannot apply mask (" << mask << ")"
+                 << " to undefined book (" << otherBook << ")"
+                 << '\n';
+        continue;
+      }
+      curBook.setName(tgtBook);
+      fromNetworkObjectMask(otherBook, mask);
+      finalizeCurBook();
+    }
+    unresolvedMasks.clear();
+  }
+
+  void
+  CiscoNetworkBook::merge(const CiscoNetworkBook& _other)
+  {
+    for (const auto& [name, book] : _other.networkBooks) {
+      curBook = book;
+      finalizeCurBook();
+    }
+    unresolvedMasks.insert(unresolvedMasks.end(),
+                           _other.unresolvedMasks.begin(),
+                           _other.unresolvedMasks.end());
+    ignoredRuleData.insert(_other.ignoredRuleData.begin(),
+                           _other.ignoredRuleData.end());
+  }
+
+
   // Object return
   NetworkBooks
   CiscoNetworkBook::getFinalVersion()
   {
+    resolveMasks();
+
     NetworkBooks zoneBooks;
     zoneBooks.emplace(ZONE, networkBooks);
     for (const auto& [zone, books] : zoneBooks) {
@@ -27,6 +27,8 @@
 #ifndef CISO_NETWORK_BOOK_HPP
 #define CISO_NETWORK_BOOK_HPP
 
+#include <tuple>
+
 #include <netmeld/datastore/objects/AcNetworkBook.hpp>
 #include <netmeld/datastore/parsers/ParserIpAddress.hpp>
 #include <netmeld/datastore/utils/AcBookUtilities.hpp>
@@ -98,6 +100,10 @@ namespace netmeld::datastore::importers::cisco {
 
       std::set<std::string> ignoredRuleData;
 
+      // (book, referenced book, mask) seen before the referenced book
+      std::vector<std::tuple<std::string, std::string, nmdo::IpAddress>>
+        unresolvedMasks;
+
     private:
 
     // =========================================================================
@@ -112,6 +118,9 @@ namespace netmeld::datastore::importers::cisco {
     public:
       NetworkBooks getFinalVersion();
 
+      // Fold in the books of a later, separately parsed, config segment
+      void merge(const CiscoNetworkBook&);
+
     protected:
     private: // Methods which should be hidden from API users
       void addData(const std::string&);
@@ -120,6 +129,7 @@ namespace netmeld::datastore::importers::cisco {
       void fromIpRange(const nmdo::IpAddress&, const nmdo::IpAddress&);
       void fromNetworkObjectMask(const std::string&, const nmdo::IpAddress&);
       void finalizeCurBook();
+      void resolveMasks();
 
       // Object return
       NetworkBooks getData();
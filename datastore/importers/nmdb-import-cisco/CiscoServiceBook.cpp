@@ -298,6 +298,18 @@ namespace netmeld::datastore::importers::cisco {
   }
 
 
+  void
+  CiscoServiceBook::merge(const CiscoServiceBook& _other)
+  {
+    for (const auto& [name, book] : _other.serviceBooks) {
+      curBook = book;
+      finalizeCurBook();
+    }
+    ignoredRuleData.insert(_other.ignoredRuleData.begin(),
+                           _other.ignoredRuleData.end());
+  }
+
+
   // Object return
   ServiceBooks
   CiscoServiceBook::getFinalVersion()
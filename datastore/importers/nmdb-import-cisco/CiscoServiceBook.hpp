@@ -116,6 +116,9 @@ namespace netmeld::datastore::importers::cisco {
     public:
       ServiceBooks getFinalVersion();
 
+      // Fold in the books of a later, separately parsed, config segment
+      void merge(const CiscoServiceBook&);
+
     protected:
     private: // Methods which should be hidden from API users
       void addData(const std::string&);
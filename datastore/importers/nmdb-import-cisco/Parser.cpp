@@ -534,7 +534,6 @@ Parser::serviceAddDhcp(const nmdo::IpAddress& ip)
 {
   auto service = nmdu::ServiceFactory::makeDhcp();
   service.setDstAddress(ip);
-  service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
   d.services.push_back(service);
 }
 
@@ -543,7 +542,6 @@ Parser::serviceAddNtp(const nmdo::IpAddress& ip)
 {
   auto service = nmdu::ServiceFactory::makeNtp();
   service.setDstAddress(ip);
-  service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
   d.services.push_back(service);
 }
 
@@ -552,7 +550,6 @@ Parser::serviceAddSnmp(const nmdo::IpAddress& ip)
 {
   auto service = nmdu::ServiceFactory::makeSnmp();
   service.setDstAddress(ip);
-  service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
   d.services.push_back(service);
 }
 
@@ -561,7 +558,6 @@ Parser::serviceAddRadius(const nmdo::IpAddress& ip)
 {
   auto service = nmdu::ServiceFactory::makeRadius();
   service.setDstAddress(ip);
-  service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
   d.services.push_back(service);
 }
 
@@ -570,7 +566,6 @@ Parser::serviceAddDns(const nmdo::IpAddress& ip)
 {
   auto service = nmdu::ServiceFactory::makeDns();
   service.setDstAddress(ip);
-  service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
   d.services.push_back(service);
 }
 
@@ -579,7 +574,6 @@ Parser::serviceAddSyslog(const nmdo::IpAddress& ip)
 {
   auto service = nmdu::ServiceFactory::makeSyslog();
   service.setDstAddress(ip);
-  service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
   d.services.push_back(service);
 }
 
@@ -855,8 +849,15 @@ Parser::setRuleTargetIface( nmdo::AcRule& _rule
 Result
 Parser::getData()
 {
+  if (partial) { return Result(); } // Segment state is kept until finalize()
+
   finalizeNamedBooks();
 
+  // The hostname may be set after (or in another segment than) services
+  for (auto& service : d.services) {
+    service.setServiceReason(d.devInfo.getDeviceId() + "'s config");
+  }
+
   if (globalCdpEnabled) {
     d.observations.addNotable("CDP is enabled at global scope.");
   }
@@ -975,3 +976,118 @@ Parser::getData()
 
   return r;
 }
+
+
+// Segmented (parallel) parsing
+std::vector<std::string>
+Parser::splitSegments(const std::string& data, size_t count)
+{
+  // Only cut in front of top-level (un-indented) lines and never within a run
+  // of lines for the same access-list (e.g., ASA or IOS numbered lists)
+  const std::string_view acl {"access-list "};
+  const auto aclName =
+    [&acl](std::string_view line) {
+      line.remove_prefix(acl.size());
+      return line.substr(0, line.find_first_of(" \r\n"));
+    };
+
+  return nmdp::splitLines(data, count,
+      [&](std::string_view prev, std::string_view line) {
+        if (line.empty() || std::isspace(static_cast<unsigned char>(line[0])))
+        {
+          return false;
+        }
+        if (line.starts_with(acl) && prev.starts_with(acl)) {
+          return aclName(prev) != aclName(line);
+        }
+        return true;
+      });
+}
+
+void
+Parser::setPartial(bool _partial)
+{
+  partial = _partial;
+}
+
+bool
+Parser::merge(Parser& other)
+{
+  // Interfaces are moved, not copied, so the pointers held by the other
+  // segment's alias data stay valid.  An interface configured across
+  // segments would need its settings combined, so is not stitched.
+  for (const auto& [name, _] : other.d.ifaces) {
+    if (d.ifaces.contains(name)) { return false; }
+  }
+  d.ifaces.merge(other.d.ifaces);
+
+  if (d.devInfo.getDeviceId().empty()) {
+    d.devInfo.setDeviceId(other.d.devInfo.getDeviceId());
+  }
+  d.dnsSearchDomains.insert(d.dnsSearchDomains.end(),
+                            other.d.dnsSearchDomains.begin(),
+                            other.d.dnsSearchDomains.end());
+  d.aaas.insert(d.aaas.end(), other.d.aaas.begin(), other.d.aaas.end());
+  d.observations.merge(other.d.observations);
+
+  for (const auto& [name, vrf] : other.d.vrfs) {
+    const auto& [it, inserted] {d.vrfs.emplace(name, vrf)};
+    if (!inserted) {
+      it->second.merge(vrf);
+    }
+  }
+  for (const auto& [id, ifaceNames] : other.d.portChannels) {
+    d.portChannels[id].insert(ifaceNames.begin(), ifaceNames.end());
+  }
+
+  d.routes.insert(d.routes.end(),
+                  other.d.routes.begin(), other.d.routes.end());
+  d.services.insert(d.services.end(),
+                    other.d.services.begin(), other.d.services.end());
+  d.vlans.insert(d.vlans.end(), other.d.vlans.begin(), other.d.vlans.end());
+
+  // Same named access-lists continue where this segment's left off
+  for (const auto& [name, book] : other.d.ruleBooks) {
+    std::pair<std::string, RuleBook> temp {name, book};
+    aclRuleBookAdd(temp);
+  }
+  networkBooks.merge(other.networkBooks);
+  serviceBooks.merge(other.serviceBooks);
+
+  globalCdpEnabled        = globalCdpEnabled && other.globalCdpEnabled;
+  globalBpduGuardEnabled  = globalBpduGuardEnabled
+                         || other.globalBpduGuardEnabled;
+  globalBpduFilterEnabled = globalBpduFilterEnabled
+                         || other.globalBpduFilterEnabled;
+  ifaceSpecificCdp.merge(other.ifaceSpecificCdp);
+  ifaceSpecificBpduGuard.merge(other.ifaceSpecificBpduGuard);
+  ifaceSpecificBpduFilter.merge(other.ifaceSpecificBpduFilter);
+
+  ifaceAliases.merge(other.ifaceAliases);
+  postIfaceAliasIpData.insert(postIfaceAliasIpData.end(),
+                              other.postIfaceAliasIpData.begin(),
+                              other.postIfaceAliasIpData.end());
+
+  // Later definitions win, as they would in a whole-file parse
+  for (const auto& [bookName, target] : other.appliedRuleSets) {
+    appliedRuleSets[bookName] = target;
+  }
+  for (const auto& [ifaceName, policyPairs] : other.servicePolicies) {
+    servicePolicies[ifaceName].insert(policyPairs.begin(), policyPairs.end());
+  }
+  for (const auto& [policyName, classNames] : other.policies) {
+    policies[policyName].insert(classNames.begin(), classNames.end());
+  }
+  for (const auto& [className, bookNames] : other.classes) {
+    classes[className].insert(bookNames.begin(), bookNames.end());
+  }
+
+  return true;
+}
+
+Result
+Parser::finalize()
+{
+  partial = false;
+  return getData();
+}
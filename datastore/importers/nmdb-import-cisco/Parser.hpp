@@ -156,6 +156,7 @@ class Parser :
     // Supporting data structures
     Data d;
 
+    bool partial {false};
     bool isNo {false};
 
     nmdo::InterfaceNetwork* tgtIface;
@@ -260,5 +261,12 @@ class Parser :
     void setRuleTargetIface(nmdo::AcRule&, const std::string&,
                             void (nmdo::AcRule::*x)(const std::string&));
     Result getData();
+
+  public: // Methods part of public API
+    // Segmented (parallel) parsing, see nmdp::SegmentedParser
+    static std::vector<std::string> splitSegments(const std::string&, size_t);
+    void setPartial(bool);
+    bool merge(Parser&);
+    Result finalize();
 };
 #endif // PARSER_HPP
@@ -0,0 +1,119 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/parsers/ParserTestHelper.hpp>
+
+#include "Parser.hpp"
+
+namespace nmdp = netmeld::datastore::parsers;
+
+using qi::ascii::blank;
+
+const std::string CONFIG {
+  "hostname fw1\n"
+  "ntp server 10.0.0.5\n"
+  "name 10.1.0.0 inside-net\n"
+  "interface GigabitEthernet0/0\n"
+  " nameif inside\n"
+  " ip address 10.1.0.1 255.255.255.0\n"
+  "!\n"
+  "interface GigabitEthernet0/1\n"
+  " nameif outside\n"
+  " ip address 192.0.2.1 255.255.255.0\n"
+  "!\n"
+  "object-group network INSIDE\n"
+  " network-object inside-net 255.255.0.0\n"
+  " network-object host 10.1.0.10\n"
+  "access-list OUT extended permit tcp any object-group INSIDE eq 443\n"
+  "access-list OUT extended deny ip any any\n"
+  "access-list IN extended permit ip any any\n"
+  "access-group OUT in interface outside\n"
+  "access-group IN in interface inside\n"
+  "logging host inside 10.1.0.20\n"
+  "access-list OUT extended permit udp any any eq 53\n"
+};
+
+BOOST_AUTO_TEST_CASE(testSplitSegments)
+{
+  for (size_t count {1}; count < 8; ++count) {
+    const auto& segments {Parser::splitSegments(CONFIG, count)};
+    BOOST_TEST(count >= segments.size());
+
+    std::string joined;
+    for (const auto& segment : segments) {
+      // Segments start at a top-level line
+      BOOST_TEST(!std::isspace(static_cast<unsigned char>(segment.front())));
+      joined += segment;
+    }
+    BOOST_TEST(CONFIG == joined);
+  }
+
+  {
+    // Runs of the same access-list are kept together
+    const std::string acls {
+      "access-list A extended permit ip any any\n"
+      "access-list A extended deny ip any any\n"
+      "access-list A extended permit tcp any any\n"
+      "access-list B extended permit ip any any\n"
+    };
+    const auto& segments {Parser::splitSegments(acls, 4)};
+    BOOST_TEST_REQUIRE(2 == segments.size());
+    BOOST_TEST(segments[1].starts_with("access-list B "));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSegmentedParse)
+{
+  Result whole;
+  {
+    Parser p;
+    BOOST_TEST_REQUIRE(nmdp::testAttr(CONFIG, p, whole, blank));
+  }
+  BOOST_TEST_REQUIRE(1 == whole.size());
+
+  for (size_t count {2}; count < 8; ++count) {
+    const auto& segments {Parser::splitSegments(CONFIG, count)};
+    const auto& stitched {nmdp::fromSegments<Parser, Result>(segments)};
+    BOOST_TEST_REQUIRE(stitched.has_value());
+    BOOST_TEST((whole == stitched.value()), "segments: " << segments.size());
+  }
+
+  const auto& data {whole.front()};
+  BOOST_TEST("fw1" == data.devInfo.getDeviceId());
+  BOOST_TEST(2 == data.ifaces.size());
+  BOOST_TEST(3 == data.ruleBooks.at("OUT").size());
+  for (const auto& [_, rule] : data.ruleBooks.at("OUT")) {
+    const auto& dbgStr {rule.toDebugString()};
+    nmdp::testInString(dbgStr, "srcIfaces: [gigabitethernet0/1]");
+  }
+  // Mask applied to a named network
+  const auto& dbgStr
+    {data.networkBooks.at("global").at("INSIDE").toDebugString()};
+  nmdp::testInString(dbgStr, "10.1.0.0/16");
+}
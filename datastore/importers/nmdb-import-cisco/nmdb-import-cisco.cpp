@@ -98,7 +98,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
 
         LOG_DEBUG << "Iteration over DNS search domains\n";
         for (auto& dnsSearchDomain : results.dnsSearchDomains) {
-          t.exec_prepared("insert_raw_device_dns_search_domain",
+          nmdu::execPrepared(t, "insert_raw_device_dns_search_domain",
               toolRunId,
               deviceId,
               dnsSearchDomain);
@@ -108,7 +108,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
         for (auto& result : results.aaas) {
           // 04-03-2019 NOTE: Manually saving here because we do not have nor
           // do we want a netmeld datastore object for AAA entries at this time.
-          t.exec_prepared("insert_raw_device_aaa",
+          nmdu::execPrepared(t, "insert_raw_device_aaa",
               toolRunId,
               deviceId,
               result);
@@ -160,7 +160,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
                 vlanIfacePrefix + std::to_string(static_cast<unsigned int>(vlanId))
               };
               if (results.ifaces.contains(vlanIfaceName)) {
-                t.exec_prepared("insert_raw_device_interface_hierarchy",
+                nmdu::execPrepared(t, "insert_raw_device_interface_hierarchy",
                     toolRunId,
                     deviceId,
                     iface.getName(),
@@ -183,7 +183,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
             };
             if (results.ifaces.contains(portChannelIfaceName)) {
               for (const auto& ifaceName : ifaceNames) {
-                t.exec_prepared("insert_raw_device_interface_hierarchy",
+                nmdu::execPrepared(t, "insert_raw_device_interface_hierarchy",
                     toolRunId,
                     deviceId,
                     ifaceName,
@@ -24,19 +24,53 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <future>
+
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
 #include <netmeld/datastore/tools/AbstractImportTool.hpp>
-#include <netmeld/core/utils/ForkExec.hpp>
+#include <netmeld/datastore/tools/ImportRegistry.hpp>
+
+#include "nmdb-import-ip-addr-show/Import.hpp"
+#include "nmdb-import-ip-route-show/Import.hpp"
+#include "nmdb-import-nmap/Import.hpp"
+#include "nmdb-import-ping/Import.hpp"
 
 typedef std::vector<std::string>  Results;
 
 namespace nmdt = netmeld::datastore::tools;
-namespace nmcu = netmeld::core::utils;
+namespace bio  = boost::iostreams;
+
+namespace nmdsiias = netmeld::datastore::importers::ip_addr_show;
+namespace nmdsiirs = netmeld::datastore::importers::ip_route_show;
+namespace nmdsin   = netmeld::datastore::importers::nmap;
+namespace nmdsip   = netmeld::datastore::importers::ping;
 
 
 template<typename P, typename R>
 class Tool : public nmdt::AbstractImportTool<P,R>
 {
   private:
+    // A captured log and the importer which handles it
+    struct SubImport
+    {
+      std::string  importer;
+      sfs::path    path;
+      bool         asMetadata {false};
+
+      std::unique_ptr<nmdt::InProcessImport> import;
+
+      SubImport(const std::string& _importer, const sfs::path& _path,
+                bool _asMetadata = false) :
+        importer(_importer), path(_path), asMetadata(_asMetadata)
+      {}
+    };
+
+    nmdt::ImportRegistry registry;
+    bool                 subImportsSaved {false};
+
     std::string
     readCommandLine(sfs::path const& p) const
     {
@@ -48,10 +82,45 @@ class Tool : public nmdt::AbstractImportTool<P,R>
       return s;
     }
 
+    // clw may have compressed its captured logs, importers expect plain text
+    sfs::path
+    getPlainLog(sfs::path const& p) const
+    {
+      sfs::path gzPath {p};
+      gzPath += ".gz";
+      if (sfs::exists(p) || !sfs::exists(gzPath)) {
+        return p;
+      }
+
+      const sfs::path tmpPath {
+        sfs::temp_directory_path()
+        / (this->getToolRunId().toString() + '_' + p.filename().string())
+      };
+      std::ifstream fin {gzPath.string(), std::ios::binary};
+      std::ofstream fout {tmpPath.string(), std::ios::binary};
+      bio::filtering_istream in;
+      in.push(bio::gzip_decompressor());
+      in.push(fin);
+      try {
+        bio::copy(in, fout);
+      } catch (bio::gzip_error& e) {
+        // Capture did not complete cleanly, use what was recovered
+        LOG_WARN << "Partial compressed log: " << gzPath
+                 << " (" << e.what() << ")\n";
+      }
+
+      return tmpPath;
+    }
+
   public:
     Tool() : nmdt::AbstractImportTool<P,R>
       ("clw", PROGRAM_NAME, PROGRAM_VERSION)
-    {}
+    {
+      nmdsiias::registerImport(registry);
+      nmdsiirs::registerImport(registry);
+      nmdsin::registerImport(registry);
+      nmdsip::registerImport(registry);
+    }
 
     void
     addToolOptions() override
@@ -90,81 +159,91 @@ class Tool : public nmdt::AbstractImportTool<P,R>
         this->helpBlurb.substr(0, this->helpBlurb.find(' '));
     }
 
+    // Sub-imports save their own data, tResults is always empty
+    bool
+    hasStorableData() const override
+    {
+      return subImportsSaved;
+    }
+
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      t.commit(); // commit transaction so called tool processing works
+      subImportsSaved = true;
 
-      const auto& dbName    {this->getDbName()};
-      const auto& severity  {this->opts.template
-                               getValueAs<nmcu::Severity>("verbosity")};
-      const auto& verbosity {nmcu::toString(severity)};
       const auto& toolRunId {this->getToolRunId()};
       const auto& toolName  {this->programName};
       const auto& results   {this->getDataPath()};
 
+      std::vector<SubImport> subImports;
+
       // =======================================================================
       // Local device data collection processing
       // =======================================================================
-      if (true) {
-        std::vector<std::string> args = {
-          "nmdb-import-ip-addr-show",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          "--tool-run-metadata",
-          "--device-id", "__tool-run-metadata__",
-          (results/"ip_addr_show.txt").string()
-        };
-
-        nmcu::forkExecWait(args);
-      }
-
-      if (true) {
-        std::vector<std::string> args = {
-          "nmdb-import-ip-route-show",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          "--tool-run-metadata",
-          "--device-id", "__tool-run-metadata__"
-        };
-
-        // IPv4 routes
-        args.push_back((results/"ip4_route_show.txt").string());
-        nmcu::forkExecWait(args);
-        args.pop_back();
-
-        // IPv6 routes
-        args.push_back((results/"ip6_route_show.txt").string());
-        nmcu::forkExecWait(args);
-        args.pop_back();
-      }
+      subImports.emplace_back("ip-addr-show", results/"ip_addr_show.txt", true);
+      subImports.emplace_back("ip-route-show",
+                              results/"ip4_route_show.txt", true);
+      subImports.emplace_back("ip-route-show",
+                              results/"ip6_route_show.txt", true);
 
       // =======================================================================
       // Remote device data collection processing
       // =======================================================================
       if (toolName == "nmap") {
-        std::vector<std::string> args = {
-          "nmdb-import-nmap",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          (results/"results.xml").string()
-        };
-
-        nmcu::forkExecWait(args);
+        subImports.emplace_back("nmap", results/"results.xml");
       }
       else if ((toolName == "ping") || (toolName == "ping6")) {
-        std::vector<std::string> args = {
-          "nmdb-import-ping",
-          "--db-name", dbName,
-          "--verbosity", verbosity,
-          "--tool-run-id", toolRunId.toString(),
-          (results/"stdout.txt").string()
-        };
-
-        nmcu::forkExecWait(args);
+        subImports.emplace_back("ping", getPlainLog(results/"stdout.txt"));
+      }
+
+      // Parsing is independent per log, so run it concurrently
+      std::vector<std::future<bool>> parsed;
+      for (auto& subImport : subImports) {
+        if (!sfs::exists(subImport.path)) {
+          LOG_DEBUG << "No captured log: " << subImport.path << '\n';
+          parsed.emplace_back();
+          continue;
+        }
+
+        subImport.import = registry.create(subImport.importer);
+        parsed.push_back(std::async(std::launch::async,
+            [&subImport]() { return subImport.import->parse(subImport.path); }
+          ));
+      }
+
+      // Saving shares the tool run's transaction, so stays sequential
+      for (size_t i {0}; i < subImports.size(); ++i) {
+        auto& subImport {subImports[i]};
+        if (!parsed[i].valid()) {
+          continue;
+        }
+
+        bool success {false};
+        try {
+          success = parsed[i].get();
+        } catch (std::exception& e) {
+          LOG_ERROR << "Parsing " << subImport.path << " failed: "
+                    << e.what() << '\n';
+        }
+        if (!success) {
+          LOG_WARN << "Skipping " << subImport.importer << " import of: "
+                   << subImport.path << '\n';
+          continue;
+        }
+
+        LOG_DEBUG << "Saving " << subImport.importer << " import of: "
+                  << subImport.path << '\n';
+        if (subImport.asMetadata) {
+          subImport.import->saveAsMetadata(t, toolRunId);
+        } else {
+          subImport.import->save(t, toolRunId, "");
+        }
+      }
+
+      for (const auto& subImport : subImports) {
+        if (subImport.path.parent_path() != results) {
+          sfs::remove(subImport.path);
+        }
       }
     }
 };
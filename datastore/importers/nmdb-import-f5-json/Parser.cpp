@@ -28,12 +28,14 @@
 #include "Parser.hpp"
 
 #include <netmeld/core/utils/StringUtilities.hpp>
+#include <netmeld/datastore/utils/JsonStream.hpp>
 
 #include <regex>
 
 
 namespace nmcu = netmeld::core::utils;
 namespace nmdo = netmeld::datastore::objects;
+namespace nmdu = netmeld::datastore::utils;
 
 
 Result
@@ -64,6 +66,31 @@ Parser::fromJson(const nlohmann::json &doc)
   }
 }
 
+void
+Parser::fromJsonStream(std::istream& in)
+{
+  // Items are handled as single item documents once the kind is known;
+  // any read before it (not the usual order) wait for the rest of the doc.
+  std::string docKind;
+  json pending = json::array();
+
+  json doc = nmdu::parseJsonStream(in, {"kind", "items"},
+      [&](const std::string& key, const json& value) {
+        if ("kind" == key) {
+          docKind = value.get<std::string>();
+        } else if (docKind.empty()) {
+          pending.push_back(value);
+        } else {
+          fromJson({{"kind", docKind}, {"items", json::array({value})}});
+        }
+      });
+
+  if (!pending.empty()) {
+    doc["items"] = std::move(pending);
+  }
+  fromJson(doc);
+}
+
 
 std::tuple<nmdo::IpAddress, std::string>
 Parser::parseIpAddrVrfStr(const std::string& ipAddrVrfStr) const
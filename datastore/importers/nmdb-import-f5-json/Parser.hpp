@@ -82,6 +82,8 @@ class Parser
     Result getData();
 
     void fromJson(const json&);
+    // Same as fromJson, but reads one of the document's items at a time
+    void fromJsonStream(std::istream&);
 };
 
 #endif  /* PARSER_HPP */
@@ -42,6 +42,7 @@ class TestParser : public Parser
     using Parser::data;
 
     using Parser::fromJson;
+    using Parser::fromJsonStream;
     using Parser::parseIpAddrVrfStr;
     using Parser::parseLtmVirtualAddress;
     using Parser::parseNetArpNdp;
@@ -298,3 +299,42 @@ BOOST_AUTO_TEST_CASE(testWhole)
                     , "unsupportedFeatures: [tm::abc]]"
                     );
 }
+
+BOOST_AUTO_TEST_CASE(testFromJsonStream)
+{
+  const std::string items {R"(
+      [ {"partition": "a1", "name": "s1", "fullPath": "/a1/s1"
+        , "address": "1.2.3.4/24"}
+      , {"partition": "a2", "name": "s2", "fullPath": "/a2/s2"
+        , "address": "1.2.4.4/24"}
+      ]
+    )"};
+  const std::string kind {R"("tm:net:self:selfcollectionstate")"};
+
+  TestParser tev;
+  tev.fromJson(json::parse(R"({"kind": )" + kind + R"(, "items": )" + items
+                           + "}"));
+  BOOST_TEST(2 == tev.data.logicalSystems.size());
+
+  // same result as the whole document, whether the kind is first or last
+  for (const auto& test : { R"({"kind": )" + kind + R"(, "items": )" + items
+                            + "}"
+                          , R"({"items": )" + items + R"(, "kind": )" + kind
+                            + "}"
+                          })
+  {
+    TestParser tp;
+    std::istringstream iss {test};
+    tp.fromJsonStream(iss);
+    BOOST_TEST((tev.data == tp.data));
+  }
+  {
+    TestParser tp;
+    std::istringstream iss {R"({"kind": "tm::abc", "items": [{}]})"};
+    tp.fromJsonStream(iss);
+    BOOST_TEST(tp.data.logicalSystems.empty());
+    nmdp::testInString( tp.data.observations.toDebugString()
+                      , "unsupportedFeatures: [tm::abc]]"
+                      );
+  }
+}
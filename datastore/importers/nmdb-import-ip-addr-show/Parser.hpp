@@ -35,72 +35,76 @@
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
-// =============================================================================
-// Data containers
-// =============================================================================
-struct Data
-{
-  std::vector<nmdo::Interface>  ifaces;
-  nmdo::ToolObservations        observations;
-
-  auto operator<=>(const Data&) const = default;
-  bool operator==(const Data&) const = default;
-};
-typedef std::vector<Data> Result;
-
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class Parser:
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-{
+namespace netmeld::datastore::importers::ip_addr_show {
   // ===========================================================================
-  // Variables
+  // Data containers
   // ===========================================================================
-  private:
-    // Supporting data structures
-    Data d;
-
-  protected:
-    // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-      start;
+  struct Data
+  {
+    std::vector<nmdo::Interface>  ifaces;
+    nmdo::ToolObservations        observations;
 
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
-      config;
+    auto operator<=>(const Data&) const = default;
+    bool operator==(const Data&) const = default;
+  };
+  typedef std::vector<Data> Result;
 
-    qi::rule<nmdp::IstreamIter, nmdo::Interface(), qi::ascii::blank_type>
-      iface;
-
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
-      inetLine;
-
-    qi::rule<nmdp::IstreamIter, std::string()>
-      ifaceName,
-      token;
-
-    qi::rule<nmdp::IstreamIter>
-      garbage;
-
-    nmdp::ParserMacAddress
-      macAddr;
-
-    nmdp::ParserIpAddress
-      ipAddr;
-
-  // ===========================================================================
-  // Constructors
-  // ===========================================================================
-  public: // Constructor is only default and must be public
-    Parser();
 
   // ===========================================================================
-  // Methods
+  // Parser definition
   // ===========================================================================
-  private:
-    void addObservation(const std::vector<std::string>&, const nmdo::Interface&);
-    void addIface(const nmdo::Interface&);
-    Result getData();
-};
+  class Parser:
+    public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      // Supporting data structures
+      Data d;
+
+    protected:
+      // Rules
+      qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+        start;
+
+      qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+        config;
+
+      qi::rule<nmdp::IstreamIter, nmdo::Interface(), qi::ascii::blank_type>
+        iface;
+
+      qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
+        inetLine;
+
+      qi::rule<nmdp::IstreamIter, std::string()>
+        ifaceName,
+        token;
+
+      qi::rule<nmdp::IstreamIter>
+        garbage;
+
+      nmdp::ParserMacAddress
+        macAddr;
+
+      nmdp::ParserIpAddress
+        ipAddr;
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    public: // Constructor is only default and must be public
+      Parser();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      void addObservation(const std::vector<std::string>&, const nmdo::Interface&);
+      void addIface(const nmdo::Interface&);
+      Result getData();
+  };
+}
+
+namespace nmdsiias = netmeld::datastore::importers::ip_addr_show;
 #endif // PARSER_HPP
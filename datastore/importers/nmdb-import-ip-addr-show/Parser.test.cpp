@@ -35,6 +35,7 @@
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
+using nmdsiias::Parser;
 using qi::ascii::blank;
 
 class TestParser : public Parser
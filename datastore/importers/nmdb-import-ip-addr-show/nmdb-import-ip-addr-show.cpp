@@ -30,6 +30,9 @@
 
 namespace nmdt = netmeld::datastore::tools;
 
+using nmdsiias::Parser;
+using nmdsiias::Result;
+
 
 template<typename P, typename R>
 class Tool : public nmdt::AbstractImportSpiritTool<P,R>
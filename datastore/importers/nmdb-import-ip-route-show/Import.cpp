@@ -0,0 +1,88 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include "Import.hpp"
+#include "Parser.hpp"
+#include "RouteScanner.hpp"
+
+#include <netmeld/datastore/utils/InsertCopy.hpp>
+
+
+namespace netmeld::datastore::importers::ip_route_show {
+
+  class Import : public nmdt::AbstractSpiritImport<Parser, Result>
+  {
+    private:
+      RouteScanner  scanner;
+      bool          isScanned {false};
+
+    public:
+      bool
+      parse(const sfs::path& dataPath) override
+      {
+        // As the tool, the grammar only handles what the scanner does not
+        isScanned = scanner.load(dataPath);
+        return isScanned || AbstractSpiritImport::parse(dataPath);
+      }
+
+      void
+      save(pqxx::transaction_base& t, const nmco::Uuid& toolRunId,
+           const std::string& deviceId) override
+      {
+        // Full routing tables are far too large to insert a row at a time
+        nmdu::InsertCopy copy {t};
+        if (isScanned) {
+          scanner.save(t, toolRunId, deviceId);
+        }
+        for (auto& result : results) {
+          result.save(t, toolRunId, deviceId);
+          LOG_DEBUG << result.toDebugString() << std::endl;
+        }
+        copy.flush();
+      }
+
+      void
+      saveAsMetadata(pqxx::transaction_base& t,
+                     const nmco::Uuid& toolRunId) override
+      {
+        nmdu::InsertCopy copy {t};
+        if (isScanned) {
+          scanner.saveAsMetadata(t, toolRunId);
+        }
+        for (auto& result : results) {
+          result.saveAsMetadata(t, toolRunId);
+          LOG_DEBUG << "[TRM] " << result.toDebugString() << std::endl;
+        }
+        copy.flush();
+      }
+  };
+
+  void
+  registerImport(nmdt::ImportRegistry& registry)
+  {
+    registry.add<Import>("ip-route-show");
+  }
+}
@@ -27,96 +27,98 @@
 #include "Parser.hpp"
 
 
-// =============================================================================
-// Parser logic
-// =============================================================================
-Parser::Parser() : Parser::base_type(start)
-{
-  start =
-    *(defaultRoute | route | nullRoute)
-    ;
+namespace netmeld::datastore::importers::ip_route_show {
+  // ===========================================================================
+  // Parser logic
+  // ===========================================================================
+  Parser::Parser() : Parser::base_type(start)
+  {
+    start =
+      *(defaultRoute | route | nullRoute)
+      ;
 
-  defaultRoute =
-    dstIpNet [(pnx::bind(&nmdo::Route::setDstIpNet, &qi::_val, qi::_1))]
-    >> qi::lit("via")
-    >> nextHopIp [(pnx::bind(&nmdo::Route::setNextHopIpAddr, &qi::_val, qi::_1))]
-    >> ifaceName [(pnx::bind(&nmdo::Route::setOutIfaceName, &qi::_val, qi::_1))]
-    >> qi::omit[*token]
-    >> qi::eol [pnx::bind(&Parser::ensureSameFamily, this, qi::_val)]
-    ;
+    defaultRoute =
+      dstIpNet [(pnx::bind(&nmdo::Route::setDstIpNet, &qi::_val, qi::_1))]
+      >> qi::lit("via")
+      >> nextHopIp [(pnx::bind(&nmdo::Route::setNextHopIpAddr, &qi::_val, qi::_1))]
+      >> ifaceName [(pnx::bind(&nmdo::Route::setOutIfaceName, &qi::_val, qi::_1))]
+      >> qi::omit[*token]
+      >> qi::eol [pnx::bind(&Parser::ensureSameFamily, this, qi::_val)]
+      ;
 
-  route =
-    dstIpNet [(pnx::bind(&nmdo::Route::setDstIpNet, &qi::_val, qi::_1))]
-    >> ifaceName
-        [(pnx::bind(&nmdo::Route::setOutIfaceName, &qi::_val, qi::_1)
-        , pnx::bind(&Parser::curNextHop, this) = pnx::bind([&]()
-                        {
-                          if (curDestNet.isV4()) {
-                            return nmdo::IpAddress::getIpv4Default();
-                          } else {
-                            return nmdo::IpAddress::getIpv6Default();
+    route =
+      dstIpNet [(pnx::bind(&nmdo::Route::setDstIpNet, &qi::_val, qi::_1))]
+      >> ifaceName
+          [(pnx::bind(&nmdo::Route::setOutIfaceName, &qi::_val, qi::_1)
+          , pnx::bind(&Parser::curNextHop, this) = pnx::bind([&]()
+                          {
+                            if (curDestNet.isV4()) {
+                              return nmdo::IpAddress::getIpv4Default();
+                            } else {
+                              return nmdo::IpAddress::getIpv6Default();
+                            }
                           }
-                        }
-                   )
-        , pnx::bind(&nmdo::Route::setNextHopIpAddr, &qi::_val
-                   , pnx::bind(&Parser::curNextHop, this)
-                   )
-        )]
-    // IPv6 doesn't seem to do this, so needs to be optional
-    >> -(qi::lit("proto kernel scope link src") >> nextHopIp)
-            [(pnx::bind(&nmdo::Route::setNextHopIpAddr, &qi::_val, qi::_1))]
-    >> qi::omit[*token]
-    >> qi::eol
-    ;
+                     )
+          , pnx::bind(&nmdo::Route::setNextHopIpAddr, &qi::_val
+                     , pnx::bind(&Parser::curNextHop, this)
+                     )
+          )]
+      // IPv6 doesn't seem to do this, so needs to be optional
+      >> -(qi::lit("proto kernel scope link src") >> nextHopIp)
+              [(pnx::bind(&nmdo::Route::setNextHopIpAddr, &qi::_val, qi::_1))]
+      >> qi::omit[*token]
+      >> qi::eol
+      ;
 
-  nullRoute =
-    ( qi::lit("unreachable") | "blackhole" | "prohibit" )
-    > dstIpNet [(pnx::bind(&nmdo::Route::setDstIpNet, &qi::_val, qi::_1))]
-    > qi::omit[*token]
-    > qi::eol [(pnx::bind(&nmdo::Route::setNullRoute, &qi::_val, true))]
-    ;
+    nullRoute =
+      ( qi::lit("unreachable") | "blackhole" | "prohibit" )
+      > dstIpNet [(pnx::bind(&nmdo::Route::setDstIpNet, &qi::_val, qi::_1))]
+      > qi::omit[*token]
+      > qi::eol [(pnx::bind(&nmdo::Route::setNullRoute, &qi::_val, true))]
+      ;
 
-  dstIpNet =
-    ( qi::lit("default")
-      [(pnx::bind(&nmdo::IpAddress::setPrefix, &qi::_val, 0))]
-    | ipAddr [(qi::_val = qi::_1)]
-    ) [( pnx::bind(&nmdo::IpAddress::setReason, &qi::_val, IP_REASON)
-       , pnx::bind(&Parser::curDestNet, this) = qi::_val
-      )]
-    ;
-
-  nextHopIp =
-    ipAddr
-        [( qi::_val = qi::_1
-         , pnx::bind(&nmdo::IpAddress::setReason, &qi::_val, IP_REASON)
-         , pnx::bind(&Parser::curNextHop, this) = qi::_val
+    dstIpNet =
+      ( qi::lit("default")
+        [(pnx::bind(&nmdo::IpAddress::setPrefix, &qi::_val, 0))]
+      | ipAddr [(qi::_val = qi::_1)]
+      ) [( pnx::bind(&nmdo::IpAddress::setReason, &qi::_val, IP_REASON)
+         , pnx::bind(&Parser::curDestNet, this) = qi::_val
         )]
-    ;
+      ;
+
+    nextHopIp =
+      ipAddr
+          [( qi::_val = qi::_1
+           , pnx::bind(&nmdo::IpAddress::setReason, &qi::_val, IP_REASON)
+           , pnx::bind(&Parser::curNextHop, this) = qi::_val
+          )]
+      ;
 
-  ifaceName =
-    qi::lit("dev ") > token
-    ;
+    ifaceName =
+      qi::lit("dev ") > token
+      ;
 
-  token =
-    +qi::ascii::graph
-    ;
+    token =
+      +qi::ascii::graph
+      ;
 
-  BOOST_SPIRIT_DEBUG_NODES(
-      (start)
-      (defaultRoute) (route)
-      (dstIpNet) (nextHopIp)
-      (ifaceName)
-      //(token)
-    );
-}
+    BOOST_SPIRIT_DEBUG_NODES(
+        (start)
+        (defaultRoute) (route)
+        (dstIpNet) (nextHopIp)
+        (ifaceName)
+        //(token)
+      );
+  }
 
-void
-Parser::ensureSameFamily(nmdo::Route& _route)
-{
-  if (curNextHop.isV6() && curDestNet.isV4()) {
-    LOG_DEBUG << "Fixing route destination and next-hop family\n";
-    curDestNet.setAddress("::");
-    curDestNet.setPrefix(0);
-    _route.setDstIpNet(curDestNet);
+  void
+  Parser::ensureSameFamily(nmdo::Route& _route)
+  {
+    if (curNextHop.isV6() && curDestNet.isV4()) {
+      LOG_DEBUG << "Fixing route destination and next-hop family\n";
+      curDestNet.setAddress("::");
+      curDestNet.setPrefix(0);
+      _route.setDstIpNet(curDestNet);
+    }
   }
-}
+} // end of namespace
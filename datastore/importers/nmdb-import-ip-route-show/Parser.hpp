@@ -36,62 +36,66 @@ namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
 
-// =============================================================================
-// Data containers
-// =============================================================================
-typedef std::vector<nmdo::Route>  Result;
-
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-{
+namespace netmeld::datastore::importers::ip_route_show {
   // ===========================================================================
-  // Variables
+  // Data containers
   // ===========================================================================
-  private:
-    nmdo::IpNetwork curDestNet;
-    nmdo::IpAddress curNextHop;
-
-  protected:
-    const std::string IP_REASON {"ip route show"};
-
-    // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-      start;
-
-    qi::rule<nmdp::IstreamIter, nmdo::Route(), qi::ascii::blank_type>
-      defaultRoute, route, nullRoute;
+  typedef std::vector<nmdo::Route>  Result;
 
-    qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
-      dstIpNet, nextHopIp;
-
-    qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
-      ifaceName;
-
-    qi::rule<nmdp::IstreamIter, std::string()>
-      token;
-
-    nmdp::ParserIpAddress
-      ipAddr;
-
-  public:
 
   // ===========================================================================
-  // Constructors
+  // Parser definition
   // ===========================================================================
-  public: // Constructor is only default and must be public
-    Parser();
-
-  // ===========================================================================
-  // Methods
-  // ===========================================================================
-  private:
-  protected:
-    void ensureSameFamily(nmdo::Route&);
-
-  public:
-};
+  class Parser :
+    public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      nmdo::IpNetwork curDestNet;
+      nmdo::IpAddress curNextHop;
+
+    protected:
+      const std::string IP_REASON {"ip route show"};
+
+      // Rules
+      qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+        start;
+
+      qi::rule<nmdp::IstreamIter, nmdo::Route(), qi::ascii::blank_type>
+        defaultRoute, route, nullRoute;
+
+      qi::rule<nmdp::IstreamIter, nmdo::IpAddress(), qi::ascii::blank_type>
+        dstIpNet, nextHopIp;
+
+      qi::rule<nmdp::IstreamIter, std::string(), qi::ascii::blank_type>
+        ifaceName;
+
+      qi::rule<nmdp::IstreamIter, std::string()>
+        token;
+
+      nmdp::ParserIpAddress
+        ipAddr;
+
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    public: // Constructor is only default and must be public
+      Parser();
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+      void ensureSameFamily(nmdo::Route&);
+
+    public:
+  };
+}
+
+namespace nmdsiirs = netmeld::datastore::importers::ip_route_show;
 #endif // PARSER_HPP
@@ -37,6 +37,7 @@
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
+using nmdsiirs::Parser;
 using qi::ascii::blank;
 
 
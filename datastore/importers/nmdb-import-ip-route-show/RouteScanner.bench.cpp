@@ -0,0 +1,143 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+// Compares reading a full (Internet scale) routing table with the Spirit
+// Parser, which builds a Route per line, against RouteScanner.  Given a
+// database connection string, also times saving the scanned routes through
+// InsertCopy, in a transaction which is rolled back afterwards.
+//
+// Usage: <bench> [routes] [connection string, e.g., "dbname=site"]
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include <pqxx/pqxx>
+
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/core/utils/FileManager.hpp>
+#include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+#include "Parser.hpp"
+#include "RouteScanner.hpp"
+
+namespace nmco = netmeld::core::objects;
+namespace nmdp = netmeld::datastore::parsers;
+namespace nmdu = netmeld::datastore::utils;
+
+using nmdsiirs::Parser;
+using nmdsiirs::Result;
+using nmdsiirs::RouteScanner;
+
+namespace {
+  using Clock = std::chrono::steady_clock;
+
+  template<typename Func>
+  void
+  bench(const std::string& name, Func&& func)
+  {
+    const auto start {Clock::now()};
+    const size_t routes {func()};
+    const auto elapsed {std::chrono::duration<double>
+                          (Clock::now() - start).count()};
+
+    std::cout << std::left << std::setw(44) << name
+              << std::right << std::setw(10) << std::fixed
+              << std::setprecision(3) << elapsed << " s"
+              << std::setw(14) << std::setprecision(0)
+              << (routes / elapsed) << " routes/s"
+              << std::setw(10) << routes << " routes\n"
+              << std::flush;
+  }
+
+  // Mostly BGP learned /24s over a handful of peers, as an edge router has
+  void
+  writeRoutes(const sfs::path& path, size_t routes)
+  {
+    std::ofstream out {path};
+    out << "default via 192.0.2.1 dev eth0 proto static metric 10\n"
+        << "192.0.2.0/24 dev eth0 proto kernel scope link src 192.0.2.7\n"
+        << "unreachable 10.0.0.0/8 proto static\n";
+    for (size_t i {3}; i < routes; ++i) {
+      out << (1 + (i >> 16) % 223) << '.' << ((i >> 8) & 0xff) << '.'
+          << (i & 0xff) << ".0/24 via 198.51.100." << (1 + i % 8)
+          << " dev eth" << (1 + i % 2) << " proto bgp metric 20\n";
+    }
+  }
+}
+
+int
+main(int argc, char** argv)
+{
+  const size_t routes {(argc > 1) ? std::stoul(argv[1]) : 1000000};
+  const std::optional<std::string> connect
+    {(argc > 2) ? std::optional<std::string>(argv[2]) : std::nullopt};
+
+  const auto path {sfs::temp_directory_path() / "nmdb-route-bench.txt"};
+  writeRoutes(path, routes);
+  std::cout << "Routes: " << routes << " (" << sfs::file_size(path)
+            << " bytes)\n\n";
+
+  bench("Parser (Route per line)", [&]() {
+      return nmdp::fromFilePath<Parser, Result>(path.string()).size();
+    });
+
+  RouteScanner scanner;
+  bench("RouteScanner::load", [&]() {
+      if (!scanner.load(path)) {
+        std::cerr << "Scanner did not handle the generated routes\n";
+        std::exit(EXIT_FAILURE);
+      }
+      return scanner.size();
+    });
+
+  if (connect) {
+    pqxx::connection db {*connect};
+    nmdu::dbPrepareCommon(db);
+
+    pqxx::work t {db};
+    const nmco::Uuid toolRunId;
+    t.exec_prepared("insert_tool_run", toolRunId, "bench", "bench",
+                    path.string(), nullptr, nullptr);
+
+    bench("RouteScanner::save (InsertCopy)", [&]() {
+        nmdu::InsertCopy copy {t};
+        scanner.save(t, toolRunId, "bench");
+        copy.flush();
+        return scanner.size();
+      });
+
+    t.abort();
+  }
+
+  sfs::remove(path);
+  return 0;
+}
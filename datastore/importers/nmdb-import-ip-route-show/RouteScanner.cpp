@@ -0,0 +1,197 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+#include <netmeld/datastore/parsers/LineScanner.hpp>
+
+#include "RouteScanner.hpp"
+
+namespace nmdp = netmeld::datastore::parsers;
+
+
+namespace netmeld::datastore::importers::ip_route_show {
+  namespace {
+    bool
+    isBlank(std::string_view line)
+    {
+      return std::string_view::npos == line.find_first_not_of(" \t");
+    }
+
+    // As Parser's dstIpNet
+    bool
+    scanDstIpNet(std::string_view token, nmdp::IpPrefixView& ip)
+    {
+      if ("default" == token) {
+        return nmdp::parseIpPrefix("0.0.0.0/0", ip);
+      }
+      return nmdp::parseIpPrefix(token, ip);
+    }
+  }
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  bool
+  RouteScanner::scanLine(std::string_view line, nmdu::ScannedRoute& route)
+  {
+    route = {};
+
+    auto token {nmdp::nextToken(line)};
+
+    // As Parser's nullRoute
+    if ("unreachable" == token || "blackhole" == token || "prohibit" == token) {
+      route.isNullRoute = true;
+      return scanDstIpNet(nmdp::nextToken(line), route.dstIpNet);
+    }
+
+    if (!scanDstIpNet(token, route.dstIpNet)) {
+      return false;
+    }
+
+    // As Parser's defaultRoute, i.e., `<dst> via <next hop> dev <iface> ...`
+    token = nmdp::nextToken(line);
+    if ("via" == token) {
+      if (!nmdp::parseIpPrefix(nmdp::nextToken(line), route.nextHopIpAddr)
+          || "dev" != nmdp::nextToken(line))
+      {
+        return false;
+      }
+      route.hasNextHopIpAddr = true;
+      route.outIfaceName = nmdp::nextToken(line);
+
+      // As Parser::ensureSameFamily()
+      if (route.nextHopIpAddr.isV6 && !route.dstIpNet.isV6) {
+        nmdp::parseIpPrefix("::/0", route.dstIpNet);
+      }
+
+      return !route.outIfaceName.empty();
+    }
+
+    // As Parser's route, i.e., `<dst> dev <iface> ...`, directly connected
+    // unless the kernel's source address is given
+    if ("dev" != token) {
+      return false;
+    }
+    route.outIfaceName = nmdp::nextToken(line);
+    if (route.outIfaceName.empty()) {
+      return false;
+    }
+
+    route.hasNextHopIpAddr = true;
+    nmdp::parseIpPrefix((route.dstIpNet.isV6 ? "::/0" : "0.0.0.0/0"),
+                        route.nextHopIpAddr);
+
+    for (const auto& expected : {"proto", "kernel", "scope", "link", "src"}) {
+      if (expected != nmdp::nextToken(line)) {
+        return true;
+      }
+    }
+    nmdp::IpPrefixView src;
+    if (nmdp::parseIpPrefix(nmdp::nextToken(line), src)) {
+      route.nextHopIpAddr = src;
+    }
+
+    return true;
+  }
+
+  bool
+  RouteScanner::load(const sfs::path& dataPath)
+  {
+    // Left to Parser, which reports on them
+    if (!sfs::is_regular_file(dataPath)) {
+      return false;
+    }
+
+    if (0 == sfs::file_size(dataPath)) {
+      return scan(std::string_view());
+    }
+
+    mapped.open(dataPath.string());
+    return scan(std::string_view(mapped.data(), mapped.size()));
+  }
+
+  bool
+  RouteScanner::scan(std::string_view _data)
+  {
+    data = _data;
+    routeCount = 0;
+
+    size_t lineCount {0};
+    return nmdp::forEachLine(data, [this, &lineCount](std::string_view line)
+        {
+          ++lineCount;
+          if (isBlank(line)) {
+            return true;
+          }
+
+          nmdu::ScannedRoute route;
+          if (!scanLine(line, route)) {
+            LOG_DEBUG << "Route scanner does not handle line " << lineCount
+                      << ": " << line << '\n';
+            return false;
+          }
+
+          ++routeCount;
+          return true;
+        });
+  }
+
+  size_t
+  RouteScanner::size() const
+  {
+    return routeCount;
+  }
+
+  void
+  RouteScanner::save(pqxx::transaction_base& t, const nmco::Uuid& toolRunId,
+                     const std::string& deviceId) const
+  {
+    nmdu::RouteCopy routes {t, toolRunId, deviceId, IP_REASON};
+    nmdp::forEachLine(data, [&routes](std::string_view line)
+        {
+          nmdu::ScannedRoute route;
+          if (scanLine(line, route)) {
+            routes.save(route);
+          }
+          return true;
+        });
+  }
+
+  void
+  RouteScanner::saveAsMetadata(pqxx::transaction_base& t,
+                               const nmco::Uuid& toolRunId) const
+  {
+    nmdu::RouteCopy routes {t, toolRunId, "", IP_REASON};
+    nmdp::forEachLine(data, [&routes](std::string_view line)
+        {
+          nmdu::ScannedRoute route;
+          if (scanLine(line, route)) {
+            routes.saveAsMetadata(route);
+          }
+          return true;
+        });
+  }
+}
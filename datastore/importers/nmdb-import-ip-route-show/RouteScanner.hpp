@@ -0,0 +1,98 @@
+// =============================================================================
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef ROUTE_SCANNER_HPP
+#define ROUTE_SCANNER_HPP
+
+#include <string>
+#include <string_view>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <pqxx/pqxx>
+
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/core/utils/FileManager.hpp>
+#include <netmeld/datastore/utils/RouteCopy.hpp>
+
+namespace nmco = netmeld::core::objects;
+namespace nmdu = netmeld::datastore::utils;
+
+
+namespace netmeld::datastore::importers::ip_route_show {
+  // ===========================================================================
+  // Scanner definition
+  // ===========================================================================
+  /* Scans `ip route show` output in place, a line at a time, for the same
+     routes Parser accepts.  Full routing tables are far too large to build
+     a Route for every line of, so they are scanned (and saved) this way.
+     Inputs with any line it does not handle are left to Parser.
+   */
+  class RouteScanner
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      boost::iostreams::mapped_file_source  mapped;
+      std::string_view                      data;
+      size_t                                routeCount {0};
+
+    protected:
+      const std::string IP_REASON {"ip route show"};
+
+    public:
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public:
+      RouteScanner() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+    protected:
+    public:
+      // Map and scan the whole data file, false if any line is not handled
+      bool load(const sfs::path&);
+      // Scan the data, which must outlive this, false if any line is not
+      // handled
+      bool scan(std::string_view);
+
+      size_t size() const;
+
+      void save(pqxx::transaction_base&, const nmco::Uuid&,
+                const std::string&) const;
+      void saveAsMetadata(pqxx::transaction_base&, const nmco::Uuid&) const;
+
+      // Scan one line as Parser would, false if it is not a route it handles
+      static bool scanLine(std::string_view, nmdu::ScannedRoute&);
+  };
+}
+#endif // ROUTE_SCANNER_HPP
@@ -0,0 +1,157 @@
+// =============================================================================
+// Copyright 2023 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/parsers/ParserTestHelper.hpp>
+#include <netmeld/datastore/objects/Route.hpp>
+
+#include "Parser.hpp"
+#include "RouteScanner.hpp"
+
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdp = netmeld::datastore::parsers;
+namespace nmdu = netmeld::datastore::utils;
+
+using nmdsiirs::Parser;
+using nmdsiirs::Result;
+using nmdsiirs::RouteScanner;
+using qi::ascii::blank;
+
+
+namespace {
+  // The Route Parser would have built for the scanned route
+  nmdo::Route
+  toRoute(const nmdu::ScannedRoute& scanned)
+  {
+    const std::string reason {"ip route show"};
+
+    nmdo::Route route;
+    route.setDstIpNet(
+        nmdo::IpAddress(std::string(scanned.dstIpNet.text), reason));
+    if (scanned.hasNextHopIpAddr) {
+      const auto& nextHop {scanned.nextHopIpAddr};
+      if (nextHop.isUnspecified() && 0 == nextHop.prefix) {
+        route.setNextHopIpAddr(nextHop.isV6
+                               ? nmdo::IpAddress::getIpv6Default()
+                               : nmdo::IpAddress::getIpv4Default());
+      } else {
+        route.setNextHopIpAddr(
+            nmdo::IpAddress(std::string(nextHop.text), reason));
+      }
+    }
+    route.setOutIfaceName(std::string(scanned.outIfaceName));
+    route.setNullRoute(scanned.isNullRoute);
+
+    return route;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testScanLineMatchesParser)
+{
+  std::vector<std::string> testsOk {
+        "default via 1.2.3.4 dev eth0"
+      , "default via 1.2.3.4/32 dev eth0 metric 1 mtu 1 advmss 1"
+      , "default via 1::2 dev eth0 proto static metric 1 mtu 1 advmss 1"
+      , "default dev ppp0 scope link"
+      , "10.0.0.0/8 via 10.1.1.1 dev bond0.12 proto bgp metric 20"
+      , "192.0.2.7 via 10.1.1.1 dev eth1 proto zebra"
+      , "1.2.3.0/24 dev eth0 proto kernel scope link src 1.2.3.4"
+      , "1.2.3.0/24 dev eth0 proto kernel scope link src 1.2.3.4 linkdown"
+      , "1.2.3.0/24 dev eth0 proto static scope link"
+      , "1::2/64 dev eth0 metric 256 mtu 1500 advmss 1440"
+      , "2001:db8::/32 via fe80::1 dev eth0 proto bgp metric 20 pref medium"
+      , "unreachable 10.9.0.0/16"
+      , "blackhole 2001:db8:1::/48 proto bgp metric 20"
+      , "prohibit default"
+    };
+  for (const auto& test : testsOk) {
+    Parser tp;
+    Result parsed;
+    BOOST_TEST_REQUIRE(nmdp::testAttr((test + "\n").c_str(), tp, parsed, blank)
+                      , "Parser: " << test
+                      );
+    BOOST_TEST_REQUIRE(1 == parsed.size());
+
+    nmdu::ScannedRoute scanned;
+    BOOST_TEST_REQUIRE(RouteScanner::scanLine(test, scanned)
+                      , "Scanner: " << test
+                      );
+    BOOST_TEST((parsed[0] == toRoute(scanned)), test);
+    BOOST_TEST(parsed[0].isValid() == nmdu::RouteCopy::isValid(scanned));
+    BOOST_TEST(parsed[0].getNextHopIpAddrString().empty()
+               == (scanned.isNullRoute || !scanned.hasNextHopIpAddr));
+  }
+
+  std::vector<std::string> testsBad {
+        ""
+      , "default"
+      , "default via 1.2.3.4"
+      , "default via 1.2.3.4 proto static"
+      , "10.0.0.0/8 dev"
+      , "10.0.0.0/8 proto bgp metric 20"
+      , "10.0.0.0/8 nexthop via 1.2.3.4 dev eth0 weight 1"
+      , "unreachable"
+      , "local 10.0.0.1 dev eth0 table local proto kernel scope host"
+    };
+  for (const auto& test : testsBad) {
+    nmdu::ScannedRoute scanned;
+    BOOST_TEST(!RouteScanner::scanLine(test, scanned), "Scanner: " << test);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testScan)
+{
+  {
+    const std::string data {
+        "default via 10.0.0.1 dev eth0 proto dhcp metric 100\n"
+        "\n"
+        "10.0.0.0/24 dev eth0 proto kernel scope link src 10.0.0.5\r\n"
+        "unreachable 192.0.2.0/24\n"
+      };
+    RouteScanner scanner;
+    BOOST_TEST(scanner.scan(data));
+    BOOST_TEST(3 == scanner.size());
+  }
+
+  {
+    const std::string data {
+        "default via 10.0.0.1 dev eth0\n"
+        "10.0.0.0/8 proto bgp metric 20\n"
+        "\tnexthop via 10.0.0.2 dev eth1 weight 1\n"
+      };
+    RouteScanner scanner;
+    BOOST_TEST(!scanner.scan(data));
+  }
+
+  {
+    RouteScanner scanner;
+    BOOST_TEST(scanner.scan(std::string_view()));
+    BOOST_TEST(0 == scanner.size());
+  }
+}
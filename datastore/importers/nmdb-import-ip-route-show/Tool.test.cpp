@@ -0,0 +1,94 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+#define UNIT_TESTING
+#include "nmdb-import-ip-route-show.cpp"
+
+class TestTool : public Tool<Parser, Result>
+{
+  public:
+    using Tool::dataPath;
+    using Tool::tResults;
+    using Tool::scanner;
+    using Tool::isScanned;
+
+    using Tool::parseData;
+    using Tool::hasStorableData;
+};
+
+namespace {
+  sfs::path
+  writeTestFile(const std::string& name, const std::string& data)
+  {
+    const auto path {sfs::temp_directory_path()/("ip-route-show-" + name)};
+    std::ofstream f {path};
+    f << data;
+    return path;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testScannedIsStorable)
+{
+  // Handled entirely by the scanner, so nothing is left in tResults and the
+  // routes must still count as data to save (not abort the transaction)
+  const auto path {writeTestFile("scanned.txt",
+        "default via 10.0.0.1 dev eth0 proto dhcp metric 100\n"
+        "10.0.0.0/24 dev eth0 proto kernel scope link src 10.0.0.5\n"
+        "unreachable 192.0.2.0/24\n"
+      )};
+
+  TestTool tt;
+  tt.dataPath = path;
+  tt.parseData();
+
+  BOOST_TEST(tt.isScanned);
+  BOOST_TEST(3 == tt.scanner.size());
+  BOOST_TEST(tt.tResults.empty());
+  BOOST_TEST(tt.hasStorableData());
+
+  sfs::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(testEmptyIsNotStorable)
+{
+  const auto path {writeTestFile("empty.txt", "\n")};
+
+  TestTool tt;
+  tt.dataPath = path;
+  tt.parseData();
+
+  BOOST_TEST(tt.isScanned);
+  BOOST_TEST(0 == tt.scanner.size());
+  BOOST_TEST(!tt.hasStorableData());
+
+  sfs::remove(path);
+}
@@ -25,10 +25,16 @@
 // =============================================================================
 
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
 #include "Parser.hpp"
+#include "RouteScanner.hpp"
 
 namespace nmdt = netmeld::datastore::tools;
 
+using nmdsiirs::Parser;
+using nmdsiirs::Result;
+using nmdsiirs::RouteScanner;
+
 
 // =============================================================================
 // Import tool definition
@@ -41,6 +47,9 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
   // ===========================================================================
   private: // Variables should generally be private
   protected: // Variables intended for internal/subclass API
+    RouteScanner  scanner;
+    bool          isScanned {false};
+
   public: // Variables should rarely appear at this scope
 
 
@@ -63,15 +72,44 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
   // Methods
   // ===========================================================================
   private: // Methods part of internal API
+  protected: // Methods part of subclass API
     // Overriden from AbstractImportSpiritTool
+    void parseData() override
+    {
+      // Full routing tables are scanned in place; the grammar handles (and
+      // reports on) anything the scanner does not
+      this->executionStart = nmco::Time();
+      isScanned = scanner.load(this->dataPath);
+      if (!isScanned) {
+        LOG_DEBUG << "Parsing with the grammar instead of the scanner\n";
+        this->tResults = nmdp::fromFilePath<P,R>(this->dataPath.string());
+      }
+      this->executionStop = nmco::Time();
+    }
+
+    // Overriden from AbstractImportTool
+    bool hasStorableData() const override
+    {
+      // Scanned routes are kept by the scanner, not in tResults
+      if (isScanned) {
+        return 0 < scanner.size();
+      }
+      return nmdt::AbstractImportSpiritTool<P,R>::hasStorableData();
+    }
+
     void toolRunMetadataInserts(pqxx::transaction_base& t) override
     {
       const auto& toolRunId {this->getToolRunId()};
 
+      nmdu::InsertCopy copy {t};
+      if (isScanned) {
+        scanner.saveAsMetadata(t, toolRunId);
+      }
       for (auto& result : this->tResults) {
         result.saveAsMetadata(t, toolRunId);
         LOG_DEBUG << "[TRM] " << result.toDebugString() << std::endl;
       }
+      copy.flush();
     }
 
     void specificInserts(pqxx::transaction_base& t) override
@@ -79,13 +117,18 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& deviceId  {this->getDeviceId()};
 
+      // Full routing tables are far too large to insert a row at a time
+      nmdu::InsertCopy copy {t};
+      if (isScanned) {
+        scanner.save(t, toolRunId, deviceId);
+      }
       for (auto& result : this->tResults) {
         result.save(t, toolRunId, deviceId);
         LOG_DEBUG << result.toDebugString() << std::endl;
       }
+      copy.flush();
     }
 
-  protected: // Methods part of subclass API
   public: // Methods part of public API
 };
 
@@ -93,9 +136,11 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
 // =============================================================================
 // Program entry point
 // =============================================================================
+#ifndef UNIT_TESTING
 int
 main(int argc, char** argv)
 {
   Tool<Parser, Result> tool;
   return tool.start(argc, argv);
 }
+#endif
@@ -0,0 +1,397 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+#include <future>
+#include <sstream>
+#include <tuple>
+
+#include "ChainGraph.hpp"
+
+
+// =============================================================================
+// Helper logic
+// =============================================================================
+namespace {
+  const std::string ANY {"any"};
+  const std::set<std::string> TERMINAL_TARGETS {"ACCEPT", "DROP", "REJECT"};
+
+  // Match values, across conditions, which are part of the rule's conditions
+  // (i.e., not "any" or a comment)
+  std::vector<std::string>
+  conditionsOf(const std::vector<std::string>& values)
+  {
+    std::vector<std::string> conditions;
+    for (const auto& value : values) {
+      if (ANY != value && 0 != value.find("comment ")) {
+        conditions.push_back(value);
+      }
+    }
+    return conditions;
+  }
+
+  bool
+  isAny(const std::vector<std::string>& values)
+  {
+    return values.empty() || (1 == values.size() && ANY == values.front());
+  }
+
+  // Values satisfying both, if expressible as a single set
+  std::optional<std::vector<std::string>>
+  conjoin(const std::vector<std::string>& outer,
+          const std::vector<std::string>& inner)
+  {
+    if (isAny(outer)) {
+      return inner;
+    }
+    if (isAny(inner) || outer == inner) {
+      return outer;
+    }
+    return std::nullopt;
+  }
+
+  // A rule's services must all match, so requiring both is their union
+  std::vector<std::string>
+  combine(const std::vector<std::string>& outer,
+          const std::vector<std::string>& inner)
+  {
+    if (isAny(outer)) {
+      return inner;
+    }
+    auto combined {outer};
+    if (!isAny(inner)) {
+      for (const auto& value : inner) {
+        if (std::find(combined.begin(), combined.end(), value)
+            == combined.end())
+        {
+          combined.push_back(value);
+        }
+      }
+    }
+    return combined;
+  }
+
+  // The inner rule, as placed in bookName, only applying when the outer
+  // rule's conditions also hold
+  std::optional<nmdo::AcRule>
+  conjoin(const nmdo::AcRule& outer, const nmdo::AcRule& inner,
+          const std::string& bookName, const std::string& description)
+  {
+    const auto& srcs      {conjoin(outer.getSrcs(), inner.getSrcs())};
+    const auto& srcIfaces {conjoin(outer.getSrcIfaces(),
+                                   inner.getSrcIfaces())};
+    const auto& dsts      {conjoin(outer.getDsts(), inner.getDsts())};
+    const auto& dstIfaces {conjoin(outer.getDstIfaces(),
+                                   inner.getDstIfaces())};
+    if (!srcs || !srcIfaces || !dsts || !dstIfaces) {
+      return std::nullopt;
+    }
+
+    nmdo::AcRule rule;
+    rule.setSrcId(bookName);
+    rule.setDstId(bookName);
+    rule.setRuleDescription(description);
+    for (const auto& value : *srcs) {
+      rule.addSrc(value);
+    }
+    for (const auto& value : *srcIfaces) {
+      rule.addSrcIface(value);
+    }
+    for (const auto& value : *dsts) {
+      rule.addDst(value);
+    }
+    for (const auto& value : *dstIfaces) {
+      rule.addDstIface(value);
+    }
+    for (const auto& value : combine(outer.getServices(),
+                                     inner.getServices()))
+    {
+      rule.addService(value);
+    }
+    for (const auto& value : inner.getActions()) {
+      rule.addAction(value);
+    }
+
+    return rule;
+  }
+
+  // (verb, target) of an action, e.g., ("jump", "ACCEPT")
+  std::pair<std::string, std::string>
+  splitAction(const nmdo::AcRule& rule)
+  {
+    std::string verb;
+    std::string target;
+    if (!rule.getActions().empty()) {
+      std::istringstream iss {rule.getActions().front()};
+      iss >> verb >> target;
+    }
+    return {verb, target};
+  }
+
+  bool
+  isTerminal(const nmdo::AcRule& rule)
+  {
+    const auto& [verb, target] {splitAction(rule)};
+    return "jump" == verb && TERMINAL_TARGETS.contains(target);
+  }
+
+  // Identifies rules matching the same packets
+  using MatchKey = std::tuple< std::vector<std::string>
+                             , std::vector<std::string>
+                             , std::vector<std::string>
+                             , std::vector<std::string>
+                             , std::vector<std::string>
+                             >;
+
+  MatchKey
+  matchKeyOf(const nmdo::AcRule& rule)
+  {
+    return { conditionsOf(rule.getSrcs())
+           , conditionsOf(rule.getSrcIfaces())
+           , conditionsOf(rule.getDsts())
+           , conditionsOf(rule.getDstIfaces())
+           , conditionsOf(rule.getServices())
+           };
+  }
+}
+
+
+// =============================================================================
+// Constructors
+// =============================================================================
+ChainGraph::ChainGraph(const Data& _data)
+{
+  for (const auto& [bookName, book] : _data.ruleBooks) {
+    auto& chain {chains[bookName]};
+    for (const auto& [id, rule] : book) {
+      if (SIZE_MAX == id) {
+        chain.policy = rule;
+      } else {
+        auto& compiled {chain.rules.emplace_back()};
+        compiled.rule = rule;
+      }
+    }
+  }
+
+  // Resolve targets once every chain is known
+  for (auto& [bookName, chain] : chains) {
+    const auto& table {bookName.substr(0, bookName.find(':') + 1)};
+    for (auto& compiled : chain.rules) {
+      const auto& [verb, target] {splitAction(compiled.rule)};
+      const auto& targetBook {table + target};
+
+      if ("goto" == verb) {
+        compiled.target = Target::GOTO;
+        compiled.chainName = targetBook;
+      } else if ("jump" != verb) {
+        compiled.target = Target::NONE;
+      } else if ("RETURN" == target) {
+        compiled.target = Target::RETURN;
+      } else if (chains.contains(targetBook)) {
+        compiled.target = Target::CHAIN;
+        compiled.chainName = targetBook;
+      } else if (TERMINAL_TARGETS.contains(target)) {
+        compiled.target = Target::TERMINAL;
+      } else {
+        compiled.target = Target::OTHER;
+      }
+
+      compiled.unconditional = (MatchKey() == matchKeyOf(compiled.rule));
+    }
+  }
+}
+
+
+// =============================================================================
+// Methods
+// =============================================================================
+/* Append the chain's rules, each conjoined with the via rule, to out;
+ * returning false if that can not be done exactly.  At the top level (i.e.,
+ * the hook itself) RETURN and goto keep their meaning and are left as is.
+ */
+bool
+ChainGraph::expand(const Chain& chain, const nmdo::AcRule& via,
+                   const std::string& description, bool topLevel,
+                   std::vector<nmdo::AcRule>& out,
+                   std::set<std::string>& path) const
+{
+  // The via rule is always placed in the hook's book
+  const auto& hookName {via.getSrcId()};
+
+  for (const auto& compiled : chain.rules) {
+    auto joined {conjoin(via, compiled.rule, hookName, description)};
+    if (!joined) {
+      return false;
+    }
+
+    if (Target::RETURN == compiled.target && !topLevel) {
+      // The rest of the chain is only skipped for some packets
+      return compiled.unconditional;
+    }
+    if (Target::GOTO == compiled.target && !topLevel) {
+      return false;
+    }
+    if (  Target::CHAIN == compiled.target
+       && !path.contains(compiled.chainName)
+       )
+    {
+      const auto& name {compiled.chainName};
+      const auto& chainName {name.substr(name.find(':') + 1)};
+
+      std::vector<nmdo::AcRule> inlined;
+      path.insert(name);
+      const bool exact {
+        expand(chains.at(name), *joined,
+               description.empty() ? chainName
+                                   : description + " > " + chainName,
+               false, inlined, path)
+      };
+      path.erase(name);
+
+      if (exact) {
+        out.insert(out.end(),
+                   std::make_move_iterator(inlined.begin()),
+                   std::make_move_iterator(inlined.end()));
+        continue;
+      }
+    }
+
+    out.push_back(std::move(*joined));
+
+    // Nothing after an unconditional verdict is reachable
+    if (Target::TERMINAL == compiled.target && compiled.unconditional) {
+      break;
+    }
+  }
+
+  return true;
+}
+
+RuleBook
+ChainGraph::flattenHook(const std::string& bookName, const Chain& chain) const
+{
+  nmdo::AcRule any;
+  any.setSrcId(bookName);
+
+  std::vector<nmdo::AcRule> rules;
+  std::set<std::string> path {bookName};
+  expand(chain, any, "", true, rules, path);
+
+  // Drop rules shadowed by an earlier verdict on the same packets
+  RuleBook book;
+  std::set<MatchKey> decided;
+  size_t id {0};
+  for (auto& rule : rules) {
+    const auto& key {matchKeyOf(rule)};
+    if (decided.contains(key)) {
+      continue;
+    }
+    if (isTerminal(rule)) {
+      decided.insert(key);
+    }
+    rule.setRuleId(id);
+    book.emplace(id, std::move(rule));
+    ++id;
+  }
+  if (chain.policy) {
+    book.emplace(SIZE_MAX, *chain.policy);
+  }
+
+  return book;
+}
+
+Data
+ChainGraph::flatten() const
+{
+  Data flattened;
+
+  // Hooks are independent of each other, so flatten them in parallel
+  std::map<std::string, std::future<RuleBook>> hooks;
+  for (const auto& [bookName, chain] : chains) {
+    if (chain.policy) {
+      hooks.emplace(bookName,
+          std::async(std::launch::async, &ChainGraph::flattenHook, this,
+                     std::cref(bookName), std::cref(chain)));
+    }
+  }
+  for (auto& [bookName, hook] : hooks) {
+    flattened.ruleBooks[bookName] = hook.get();
+  }
+
+  // Keep, as parsed, user defined chains still jumped (or gone) to
+  std::vector<std::string> referenced;
+  auto addTargets = [&](const RuleBook& book) {
+    for (const auto& [id, rule] : book) {
+      const auto& bookName {rule.getSrcId()};
+      const auto& [verb, target] {splitAction(rule)};
+      const auto& targetBook {
+        bookName.substr(0, bookName.find(':') + 1) + target};
+      if (  ("jump" == verb || "goto" == verb)
+         && chains.contains(targetBook)
+         && !flattened.ruleBooks.contains(targetBook)
+         )
+      {
+        referenced.push_back(targetBook);
+      }
+    }
+  };
+  for (const auto& [bookName, book] : flattened.ruleBooks) {
+    addTargets(book);
+  }
+  while (!referenced.empty()) {
+    const auto bookName {referenced.back()};
+    referenced.pop_back();
+    if (flattened.ruleBooks.contains(bookName)) {
+      continue;
+    }
+
+    auto& book {flattened.ruleBooks[bookName]};
+    for (const auto& compiled : chains.at(bookName).rules) {
+      book.emplace(book.size(), compiled.rule);
+    }
+    addTargets(book);
+  }
+
+  // Only the values the remaining rules use
+  for (const auto& [bookName, book] : flattened.ruleBooks) {
+    for (const auto& [id, rule] : book) {
+      for (const auto* values : {&rule.getSrcs(), &rule.getDsts()}) {
+        for (const auto& value : *values) {
+          if (ANY != value) {
+            flattened.networkBooks[bookName][value];
+          }
+        }
+      }
+      for (const auto& value : rule.getServices()) {
+        if (ANY != value) {
+          flattened.serviceBooks[bookName][value];
+        }
+      }
+    }
+  }
+
+  return flattened;
+}
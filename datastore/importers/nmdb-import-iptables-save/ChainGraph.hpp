@@ -0,0 +1,94 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef CHAIN_GRAPH_HPP
+#define CHAIN_GRAPH_HPP
+
+#include <optional>
+#include <set>
+
+#include "Parser.hpp"
+
+
+// =============================================================================
+// Chain graph definition
+// =============================================================================
+/* Compiled form of the parsed chains, with each rule's jump, goto, or RETURN
+ * resolved, used to flatten the user defined chains into the built-in
+ * chains (the netfilter hooks) which reach them.  Each hook's rule book then
+ * holds its effective policy and user defined chains are only kept while
+ * something still jumps to them.
+ *
+ * A jump is only inlined when the result is exact.  That is, each field of
+ * the jumping and inlined rule are "any" or equal (services, which must all
+ * match, are combined), and the target chain has no goto or conditional
+ * RETURN; otherwise the jump is kept as is.
+ */
+class ChainGraph
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private:
+    enum class Target { NONE, CHAIN, RETURN, TERMINAL, GOTO, OTHER };
+
+    struct CompiledRule
+    {
+      nmdo::AcRule  rule;
+      Target        target      {Target::NONE};
+      std::string   chainName;   // book name of CHAIN and GOTO targets
+      bool          unconditional {false};
+    };
+
+    struct Chain
+    {
+      std::vector<CompiledRule>   rules;
+      std::optional<nmdo::AcRule> policy; // only built-in chains have one
+    };
+
+    std::map<std::string, Chain>  chains; // by book name (i.e., table:chain)
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  public:
+    explicit ChainGraph(const Data&);
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private:
+    bool expand( const Chain&, const nmdo::AcRule&, const std::string&
+               , bool, std::vector<nmdo::AcRule>&, std::set<std::string>&
+               ) const;
+    RuleBook flattenHook(const std::string&, const Chain&) const;
+
+  public:
+    // Rule, network, and service books of the flattened hooks and any
+    // user defined chains still jumped to
+    Data flatten() const;
+};
+#endif // CHAIN_GRAPH_HPP
@@ -0,0 +1,166 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <netmeld/datastore/parsers/ParserTestHelper.hpp>
+
+#include "ChainGraph.hpp"
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdp = netmeld::datastore::parsers;
+
+using qi::ascii::blank;
+
+Data
+parseAndFlatten(const std::string& chains, const std::string& rules)
+{
+  const std::string test {
+      "# comment\n"
+      "*filter\n"
+    + chains
+    + rules
+    + "COMMIT\n"
+      "# comment\n"
+    };
+
+  Parser tp;
+  Result result;
+  BOOST_TEST_REQUIRE(nmdp::testAttr(test.c_str(), tp, result, blank));
+  BOOST_TEST_REQUIRE(1 == result.size());
+
+  return ChainGraph(result.at(0)).flatten();
+}
+
+std::vector<std::string>
+actionsOf(const RuleBook& book)
+{
+  std::vector<std::string> actions;
+  for (const auto& [id, rule] : book) {
+    actions.push_back(rule.getActions().at(0));
+  }
+  return actions;
+}
+
+BOOST_AUTO_TEST_CASE(testInlineJumps)
+{
+  const auto& flattened {parseAndFlatten(
+      ":INPUT DROP [0:0]\n"
+      ":SSH - [0:0]\n"
+      ":TRUSTED - [0:0]\n"
+    ,
+      "-A INPUT -i lo -j ACCEPT\n"
+      "-A INPUT -p tcp -m tcp --dport 22 -j SSH\n"
+      "-A INPUT -j LOG\n"
+      "-A SSH -j TRUSTED\n"
+      "-A SSH -j RETURN\n"
+      "-A SSH -j DROP\n"
+      "-A TRUSTED -s 10.0.0.0/8 -j ACCEPT\n"
+    )};
+
+  // User defined chains are fully inlined, the unconditional RETURN drops
+  // the remainder of SSH
+  BOOST_TEST(1 == flattened.ruleBooks.size());
+  const auto& input {flattened.ruleBooks.at("filter:INPUT")};
+  std::vector<std::string> expected {
+      "jump ACCEPT", "jump ACCEPT", "jump LOG", "DROP"};
+  BOOST_TEST(expected == actionsOf(input), boost::test_tools::per_element());
+
+  const auto& inlined {input.at(1)};
+  BOOST_TEST(std::vector<std::string>{"10.0.0.0/8"} == inlined.getSrcs());
+  BOOST_TEST(std::vector<std::string>{"tcp::22"} == inlined.getServices());
+  BOOST_TEST(std::vector<std::string>{"any"} == inlined.getSrcIfaces());
+  BOOST_TEST("filter:INPUT" == inlined.getSrcId());
+  BOOST_TEST(inlined.toDebugString().find("description: SSH > TRUSTED")
+             != std::string::npos);
+
+  BOOST_TEST(!flattened.networkBooks.at("filter:INPUT")
+                .contains("any"));
+  BOOST_TEST(flattened.networkBooks.at("filter:INPUT")
+                .contains("10.0.0.0/8"));
+  BOOST_TEST(flattened.serviceBooks.at("filter:INPUT").contains("tcp::22"));
+}
+
+BOOST_AUTO_TEST_CASE(testKeepInexactJumps)
+{
+  const auto& flattened {parseAndFlatten(
+      ":FORWARD ACCEPT [0:0]\n"
+      ":CONDITIONAL - [0:0]\n"
+      ":CONFLICTING - [0:0]\n"
+      ":GOING - [0:0]\n"
+      ":GONE - [0:0]\n"
+    ,
+      "-A FORWARD -j CONDITIONAL\n"
+      "-A FORWARD -s 10.0.0.0/8 -j CONFLICTING\n"
+      "-A FORWARD -j GOING\n"
+      "-A CONDITIONAL -s 10.1.0.0/16 -j RETURN\n"
+      "-A CONDITIONAL -j DROP\n"
+      "-A CONFLICTING -s 10.2.0.0/16 -j DROP\n"
+      "-A GOING -g GONE\n"
+      "-A GONE -j ACCEPT\n"
+    )};
+
+  // Conditional RETURN, conflicting sources, and goto are not inlined
+  const auto& books {flattened.ruleBooks};
+  BOOST_TEST(5 == books.size());
+  std::vector<std::string> expected {
+      "jump CONDITIONAL", "jump CONFLICTING", "jump GOING", "ACCEPT"};
+  BOOST_TEST( expected == actionsOf(books.at("filter:FORWARD"))
+            , boost::test_tools::per_element()
+            );
+  BOOST_TEST(2 == books.at("filter:CONDITIONAL").size());
+  BOOST_TEST(1 == books.at("filter:GONE").size());
+  BOOST_TEST(flattened.networkBooks.at("filter:CONFLICTING")
+                .contains("10.2.0.0/16"));
+}
+
+BOOST_AUTO_TEST_CASE(testDropShadowedRules)
+{
+  const auto& flattened {parseAndFlatten(
+      ":OUTPUT ACCEPT [0:0]\n"
+      ":ONE - [0:0]\n"
+      ":TWO - [0:0]\n"
+    ,
+      "-A OUTPUT -j ONE\n"
+      "-A OUTPUT -j TWO\n"
+      "-A ONE -d 192.0.2.1/32 -m comment --comment \"one\" -j REJECT\n"
+      "-A TWO -d 192.0.2.1/32 -m comment --comment \"two\" -j ACCEPT\n"
+      "-A TWO -d 192.0.2.2/32 -j ACCEPT\n"
+      "-A TWO -j DROP\n"
+      "-A TWO -d 192.0.2.3/32 -j ACCEPT\n"
+    )};
+
+  // Same match as an earlier verdict (comments aside), or after an
+  // unconditional verdict, is never reached
+  const auto& output {flattened.ruleBooks.at("filter:OUTPUT")};
+  std::vector<std::string> expected {
+      "jump REJECT", "jump ACCEPT", "jump DROP", "ACCEPT"};
+  BOOST_TEST(expected == actionsOf(output), boost::test_tools::per_element());
+  BOOST_TEST(std::vector<std::string>{"192.0.2.2/32"}
+             == output.at(1).getDsts());
+}
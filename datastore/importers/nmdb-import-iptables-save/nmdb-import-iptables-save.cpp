@@ -26,6 +26,7 @@
 
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
 
+#include "ChainGraph.hpp"
 #include "Parser.hpp"
 
 namespace nmdo = netmeld::datastore::objects;
@@ -64,6 +65,18 @@ class Tool : public nmdt::AbstractImportSpiritTool<P, R>
   // Methods
   // ===========================================================================
   private: // Methods part of internal API
+    // Overriden from AbstractImportSpiritTool
+    void
+    addToolOptions() override
+    {
+      this->opts.addOptionalOption("no-flatten", std::make_tuple(
+            "no-flatten",
+            NULL_SEMANTIC,
+            "Store every chain as parsed, instead of inlining user defined"
+            " chains into the built-in chains which jump to them.")
+          );
+    }
+
     // Overriden from AbstractImportSpiritTool
     void
     specificInserts(pqxx::transaction_base& t) override
@@ -71,6 +84,17 @@ class Tool : public nmdt::AbstractImportSpiritTool<P, R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& deviceId  {this->devInfo.getDeviceId()};
 
+      if (!this->opts.exists("no-flatten")) {
+        for (auto& results : this->tResults) {
+          const auto parsed {countRules(results)};
+          results = ChainGraph(results).flatten();
+          const auto flattened {countRules(results)};
+          LOG_INFO << "Flattened " << parsed.first << " rules in "
+                   << parsed.second << " chains to " << flattened.first
+                   << " rules in " << flattened.second << " chains\n";
+        }
+      }
+
       LOG_DEBUG << "Iterating over results" << std::endl;
       for (auto& results : this->tResults) {
 
@@ -109,6 +133,17 @@ class Tool : public nmdt::AbstractImportSpiritTool<P, R>
       }
     }
 
+    // (rules, chains) across the rule books
+    std::pair<size_t, size_t>
+    countRules(const Data& results) const
+    {
+      size_t rules {0};
+      for (const auto& [name, book] : results.ruleBooks) {
+        rules += book.size();
+      }
+      return {rules, results.ruleBooks.size()};
+    }
+
   protected: // Methods part of subclass API
   public: // Methods part of public API
 };
@@ -866,6 +866,8 @@ Parser::unsup(const std::string& _value)
 Result
 Parser::getData()
 {
+  if (partial) { return Result(); } // Segment state is kept until finalize()
+
   for (auto& device : devices) {
     for (const auto& [nsi, nsb] : device.networkBooks) {
       for (const auto& [ns, nsd] : nsb) {
@@ -923,3 +925,66 @@ Parser::getData()
 
   return devices;
 }
+
+
+// Segmented (parallel) parsing
+std::vector<std::string>
+Parser::splitSegments(const std::string& data, size_t count)
+{
+  return nmdp::splitBlocks(data, count);
+}
+
+void
+Parser::setPartial(bool _partial)
+{
+  partial = _partial;
+}
+
+bool
+Parser::merge(Parser& other)
+{
+  // The first entry is the root device, others (e.g., logical-systems) are
+  // distinct devices in the order they were defined
+  auto& root       {devices.front()};
+  auto& otherRoot  {other.devices.front()};
+
+  for (const auto& [name, _] : otherRoot.ifaces) {
+    if (root.ifaces.contains(name)) { return false; }
+  }
+  for (const auto& [name, _] : otherRoot.vlans) {
+    if (root.vlans.contains(name)) { return false; }
+  }
+  for (const auto& [name, _] : otherRoot.ruleBooks) {
+    if (root.ruleBooks.contains(name)) { return false; }
+  }
+  for (const auto& [name, _] : other.deviceMetadata) {
+    if (deviceMetadata.contains(name)) { return false; }
+  }
+
+  root.ifaces.merge(otherRoot.ifaces);
+  root.vlans.merge(otherRoot.vlans);
+  root.ruleBooks.merge(otherRoot.ruleBooks);
+  root.routes.insert(root.routes.end(),
+                     otherRoot.routes.begin(), otherRoot.routes.end());
+  nmdu::mergeBooks(root.networkBooks, otherRoot.networkBooks);
+  nmdu::mergeBooks(root.serviceBooks, otherRoot.serviceBooks);
+  root.observations.merge(otherRoot.observations);
+
+  devices.insert(devices.end(),
+                 std::make_move_iterator(other.devices.begin() + 1),
+                 std::make_move_iterator(other.devices.end()));
+  d = &devices.front();
+
+  deviceMetadata.merge(other.deviceMetadata);
+  ruleIds.merge(other.ruleIds);
+  ifaceVlanMembers.merge(other.ifaceVlanMembers);
+
+  return true;
+}
+
+Result
+Parser::finalize()
+{
+  partial = false;
+  return getData();
+}
@@ -154,6 +154,8 @@ class Parser:
 
     std::multimap<std::string, std::string> ifaceVlanMembers;
 
+    bool partial {false};
+
     const std::string DEFAULT_VRF_ID {""};//{"master"};
 
   // ===========================================================================
@@ -204,5 +206,12 @@ class Parser:
     void unsup(const std::string&);
 
     Result getData();
+
+  public:
+    // Segmented (parallel) parsing, see nmdp::SegmentedParser
+    static std::vector<std::string> splitSegments(const std::string&, size_t);
+    void setPartial(bool);
+    bool merge(Parser&);
+    Result finalize();
 };
 #endif // PARSER_HPP
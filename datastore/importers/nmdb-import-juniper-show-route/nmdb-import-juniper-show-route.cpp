@@ -26,6 +26,7 @@
 
 #include <netmeld/datastore/objects/DeviceInformation.hpp>
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
+#include <netmeld/datastore/utils/InsertCopy.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "Parser.hpp"
@@ -68,6 +69,9 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& baseDeviceId  {this->getDeviceId()};
 
+      // Full routing tables are far too large to insert a row at a time
+      nmdu::InsertCopy copy {t};
+
       LOG_DEBUG << "Iterating over results\n";
       for (auto& [logicalSystemId, routingInstances] : this->tResults) {
         for (auto& [routingInstanceId, routes] : routingInstances) {
@@ -86,6 +90,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
           }
         }
       }
+      copy.flush();
     }
 
   protected: // Methods part of subclass API
@@ -52,6 +52,286 @@ namespace nmdp = netmeld::datastore::parsers;
 namespace nmdu = netmeld::datastore::utils;
 
 
+namespace {
+  // XPath expressions are compiled once, instead of on every select call,
+  // and are read-only when evaluated so logical systems can share them.
+  namespace xq {
+    const pugi::xpath_query activeName {"name[not(@inactive='inactive')]"};
+    const pugi::xpath_query activeTag {"active-tag"};
+    const pugi::xpath_query address {"address[not(@inactive='inactive')]"};
+    const pugi::xpath_query addressBooks {
+        "(security/address-book[not(@inactive='inactive')])"
+        "|(security/zones[not(@inactive='inactive')]"
+        "/security-zone[not(@inactive='inactive')]"
+        "/address-book[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query addressSet {
+        "address-set[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query application {
+        "application[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query applicationOrSet {
+        "application[not(@inactive='inactive')]|"
+        "application-set[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query applications {
+        "applications[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query applicationSet {
+        "application-set[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query arp {"arp[not(@inactive='inactive')]"};
+    const pugi::xpath_query arpTableEntry {"arp-table-entry"};
+    const pugi::xpath_query description {"description"};
+    const pugi::xpath_query destinationPort {
+        "destination-port[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query disable {"disable"};
+    const pugi::xpath_query discard {"discard[not(@inactive='inactive')]"};
+    const pugi::xpath_query dnsName {"dns-name[not(@inactive='inactive')]"};
+    const pugi::xpath_query etherOptions {
+        "(gigether-options[not(@inactive='inactive')])|"
+        "(ether-options[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query fabricOptions {
+        "fabric-options[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query familyAddress {
+        "(family[not(@inactive='inactive')]/inet[not(@inactive='inactive')]/"
+        "address[not(@inactive='inactive')])|"
+        "(family[not(@inactive='inactive')]/inet6[not(@inactive='inactive')]/"
+        "address[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query fromZone {
+        "(../from-zone-name[not(@inactive='inactive')])|"
+        "(match[not(@inactive='inactive')]/"
+        "from-zone[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query globalPolicy {
+        "global/policy[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query groups {"groups"};
+    const pugi::xpath_query instance {"instance[not(@inactive='inactive')]"};
+    const pugi::xpath_query interface {"interface[not(@inactive='inactive')]"};
+    const pugi::xpath_query interfaceName {"interface-name"};
+    const pugi::xpath_query interfaceRange {
+        "interface-range[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query interfaces {
+        "interfaces[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query ipAddress {"ip-address"};
+    const pugi::xpath_query ipPrefix {"ip-prefix[not(@inactive='inactive')]"};
+    const pugi::xpath_query ipv6NdEntry {"ipv6-nd-entry"};
+    const pugi::xpath_query ipv6NdInterfaceName {"ipv6-nd-interface-name"};
+    const pugi::xpath_query ipv6NdNeighborAddress {"ipv6-nd-neighbor-address"};
+    const pugi::xpath_query ipv6NdNeighborL2Address {
+        "ipv6-nd-neighbor-l2-address"
+      };
+    const pugi::xpath_query l2ngEntry {
+        "l2ng-l2rtb-evpn-arp-entry|"
+        "l2ng-l2rtb-evpn-nd-entry|"
+        "l2ng-l2ald-mac-entry-vlan|"
+        "l2ng-l2ald-mac-ip-entry"
+      };
+    const pugi::xpath_query l2ngIpAddress {
+        "l2ng-l2-ip-address|"
+        "l2ng-l2-evpn-arp-inet-address|"
+        "l2ng-l2-evpn-nd-inet6-address"
+      };
+    const pugi::xpath_query l2ngL2MacAddress {"l2ng-l2-mac-address"};
+    const pugi::xpath_query l2ngL2MacLogicalInterface {
+        "l2ng-l2-mac-logical-interface"
+      };
+    const pugi::xpath_query l2ngL2VlanId {"l2ng-l2-vlan-id"};
+    const pugi::xpath_query lldpLocalParentInterfaceName {
+        "lldp-local-parent-interface-name"
+      };
+    const pugi::xpath_query lldpLocalPortId {"lldp-local-port-id"};
+    const pugi::xpath_query lldpNeighborInformation {
+        "lldp-neighbor-information[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query lldpRemoteChassisId {"lldp-remote-chassis-id"};
+    const pugi::xpath_query lldpRemoteChassisIdSubtype {
+        "lldp-remote-chassis-id-subtype"
+      };
+    const pugi::xpath_query lldpRemotePortId {"lldp-remote-port-id"};
+    const pugi::xpath_query lldpRemotePortIdSubtype {
+        "lldp-remote-port-id-subtype"
+      };
+    const pugi::xpath_query logicalSystems {
+        "logical-systems[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query mac {"mac[not(@inactive='inactive')]"};
+    const pugi::xpath_query macAddress {"mac-address"};
+    const pugi::xpath_query matchApplication {
+        "match[not(@inactive='inactive')]/"
+        "application[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query matchDestinationAddress {
+        "match[not(@inactive='inactive')]/"
+        "destination-address[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query matchSourceAddress {
+        "match[not(@inactive='inactive')]/"
+        "source-address[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query member {"member[not(@inactive='inactive')]"};
+    const pugi::xpath_query memberInterfacesName {
+        "member-interfaces[not(@inactive='inactive')]/name"
+      };
+    const pugi::xpath_query message {"message"};
+    const pugi::xpath_query metric {"metric[not(@inactive='inactive')]"};
+    const pugi::xpath_query name {"name"};
+    const pugi::xpath_query nextHop {"next-hop[not(@inactive='inactive')]"};
+    const pugi::xpath_query nextTable {"next-table[not(@inactive='inactive')]"};
+    const pugi::xpath_query nhNhTable {
+        "nh[not(@inactive='inactive')]/nh-table[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query nhTo {
+        "nh[not(@inactive='inactive')]/to[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query nhType {"nh-type[not(@inactive='inactive')]"};
+    const pugi::xpath_query nhVia {
+        "(nh[not(@inactive='inactive')]/via[not(@inactive='inactive')])|"
+        "(nh[not(@inactive='inactive')]/"
+        "nh-local-interface[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query parentGlobal {"parent::global"};
+    const pugi::xpath_query parentSecurityZone {
+        "parent::security-zone[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query preference {
+        "preference[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query protocol {"protocol[not(@inactive='inactive')]"};
+    const pugi::xpath_query protocolName {
+        "protocol-name[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query routeTable {
+        "route-table[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query routingInstances {
+        "routing-instances[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query routingOptions {
+        "routing-options[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query rpcReply {"/rpc-reply"};
+    const pugi::xpath_query rt {"rt[not(@inactive='inactive')]"};
+    const pugi::xpath_query rtDestination {"rt-destination"};
+    const pugi::xpath_query rtEntry {"rt-entry[not(@inactive='inactive')]"};
+    const pugi::xpath_query rtPrefixLength {"rt-prefix-length"};
+    const pugi::xpath_query securityPolicies {
+        "security/policies[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query securityZone {
+        "security-zone[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query securityZones {
+        "security/zones[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query server {"server[not(@inactive='inactive')]"};
+    const pugi::xpath_query siblingEtherOptions {
+        "(../gigether-options[not(@inactive='inactive')])"
+        "|(../ether-options[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query sourceAddress {
+        "source-address[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query sourcePort {
+        "source-port[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query staticRoute {
+        "(static[not(@inactive='inactive')]/route[not(@inactive='inactive')])"
+        "|(static[not(@inactive='inactive')]/rib[not(@inactive='inactive')]/"
+        "route[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query systemDomainSearch {
+        "/rpc-reply/configuration/system"
+        "/domain-search[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query systemNameServer {
+        "/rpc-reply/configuration/system"
+        "/name-server[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query systemNtp {
+        "/rpc-reply/configuration/system"
+        "/ntp[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query systemTacplusServer {
+        "/rpc-reply/configuration/system"
+        "/tacplus-server[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query tableName {"table-name"};
+    const pugi::xpath_query term {"term[not(@inactive='inactive')]"};
+    const pugi::xpath_query thenBlock {
+        "(then[not(@inactive='inactive')]/deny[not(@inactive='inactive')])|"
+        "(then[not(@inactive='inactive')]/reject[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query thenPermit {
+        "then[not(@inactive='inactive')]/permit[not(@inactive='inactive')]"
+      };
+    const pugi::xpath_query toZone {
+        "(../to-zone-name[not(@inactive='inactive')])|"
+        "(match[not(@inactive='inactive')]/"
+        "to-zone[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query unit {"unit[not(@inactive='inactive')]"};
+    const pugi::xpath_query unitDisable {"(disable)|(../disable)"};
+    const pugi::xpath_query virtualIfaces {
+        "(redundant-parent[not(@inactive='inactive')]"
+        "/parent[not(@inactive='inactive')])"
+        "|(ieee-802.3ad[not(@inactive='inactive')]"
+        "/bundle[not(@inactive='inactive')])"
+      };
+    const pugi::xpath_query vlanId {"vlan-id[not(@inactive='inactive')]"};
+    const pugi::xpath_query zoneAddressBook {
+        "../../../zones/security-zone/address-book"
+      };
+    const pugi::xpath_query zonePolicy {
+        "policy[not(@inactive='inactive')]/policy[not(@inactive='inactive')]"
+      };
+  }
+
+  template<typename T>
+  void
+  mergeWithWarning(T& into, T& from, const std::string& type)
+  {
+    into.merge(from);
+    for (const auto& [conflictName, conflict] : from) {
+      LOG_WARN << type << " merge conflict: " << conflictName << std::endl;
+    }
+  }
+
+  template<typename T>
+  void
+  append(std::vector<T>& into, const std::vector<T>& from)
+  {
+    into.insert(into.end(), from.begin(), from.end());
+  }
+
+  void
+  mergeLogicalSystem(LogicalSystem& into, LogicalSystem& from)
+  {
+    mergeWithWarning(into.ifaces, from.ifaces, "ifaces");
+    append(into.ifaceHierarchies, from.ifaceHierarchies);
+    into.vrfs.merge(from.vrfs);
+    for (const auto& [vrfId, vrfConflict] : from.vrfs) {
+      into.vrfs[vrfId].merge(vrfConflict);
+    }
+    append(into.services, from.services);
+    append(into.dnsResolvers, from.dnsResolvers);
+    append(into.dnsSearchDomains, from.dnsSearchDomains);
+    mergeWithWarning(into.aclZones, from.aclZones, "aclZones");
+    mergeWithWarning(into.aclIpNetSets, from.aclIpNetSets, "aclIpNetSets");
+    append(into.aclServices, from.aclServices);
+    append(into.aclRules, from.aclRules);
+  }
+}
+
+
 Results
 Parser::getData()
 {
@@ -61,10 +341,112 @@ Parser::getData()
 }
 
 
+void
+Parser::setParseJobs(size_t jobs)
+{
+  parseJobs = jobs;
+}
+
+
+const SystemSettings&
+Parser::getSystemSettings(const pugi::xml_node& anyNode)
+{
+  // Built once per document, then shared with any sub-parsers
+  if (systemSettings && anyNode.root() == systemSettingsRoot) {
+    return *systemSettings;
+  }
+
+  auto settings {std::make_shared<SystemSettings>()};
+  for ( const auto& nameServerMatch
+      : anyNode.select_nodes(xq::systemNameServer)
+      )
+  {
+    const pugi::xml_node nameServerNode {nameServerMatch.node()};
+    nmdo::IpAddress dnsResolverIpAddr {
+        nameServerNode.select_node(xq::name).node().text().as_string()
+      };
+    // Service version
+    auto dnsService {nmdu::ServiceFactory::makeDns()};
+    dnsService.setDstAddress(dnsResolverIpAddr);
+    settings->services.emplace_back(dnsService);
+    // DnsResolver version
+    nmdo::DnsResolver dnsResolver;
+    dnsResolver.setDstAddress(dnsResolverIpAddr);
+    settings->dnsResolvers.emplace_back(dnsResolver);
+  }
+
+  for ( const auto& domainSearchMatch
+      : anyNode.select_nodes(xq::systemDomainSearch)
+      )
+  {
+    const pugi::xml_node domainSearchNode {domainSearchMatch.node()};
+    const std::string dnsSearchDomain {domainSearchNode.text().as_string()};
+    settings->dnsSearchDomains.emplace_back(dnsSearchDomain);
+  }
+
+  for ( const auto& tacplusServerMatch
+      : anyNode.select_nodes(xq::systemTacplusServer)
+      )
+  {
+    const pugi::xml_node tacplusServerNode {tacplusServerMatch.node()};
+    nmdo::IpAddress tacplusServerIpAddr {
+      tacplusServerNode.select_node(xq::name).node().text().as_string()
+    };
+    auto tacplusService {nmdu::ServiceFactory::makeTacacsPlus()};
+    tacplusService.setDstAddress(tacplusServerIpAddr);
+    settings->services.emplace_back(tacplusService);
+  }
+
+  for ( const auto& ntpMatch
+      : anyNode.select_nodes(xq::systemNtp)
+      )
+  {
+    const pugi::xml_node ntpNode {ntpMatch.node()};
+    const auto ntpSrcAddrMatch {
+        ntpNode.select_node(xq::sourceAddress)
+      };
+    for ( const auto& ntpServerMatch
+        : ntpNode.select_nodes(xq::server)
+        )
+    {
+      const pugi::xml_node ntpServerNode {ntpServerMatch.node()};
+      nmdo::IpAddress ntpServerIpAddr {
+          ntpServerNode.select_node(xq::name).node().text().as_string()
+        };
+      auto ntpService {nmdu::ServiceFactory::makeNtp()};
+      ntpService.setDstAddress(ntpServerIpAddr);
+      if (ntpSrcAddrMatch) {
+        const pugi::xml_node ntpSrcAddrNode {ntpSrcAddrMatch.node()};
+        nmdo::IpAddress ntpSrcIpAddr {
+            ntpSrcAddrNode.select_node(xq::name).node().text().as_string()
+          };
+        ntpService.setSrcAddress(ntpSrcIpAddr);
+      }
+      settings->services.emplace_back(ntpService);
+    }
+  }
+
+  systemSettings = settings;
+  systemSettingsRoot = anyNode.root();
+
+  return *systemSettings;
+}
+
+
+void
+Parser::mergeData(Data& other)
+{
+  for (auto& [name, logicalSystem] : other.logicalSystems) {
+    mergeLogicalSystem(data.logicalSystems[name], logicalSystem);
+  }
+  data.observations.merge(other.observations);
+}
+
+
 void
 Parser::handleXML(const pugi::xml_document& doc)
 {
-  const pugi::xml_node rpcReplyNode {doc.select_node("/rpc-reply").node()};
+  const pugi::xml_node rpcReplyNode {doc.select_node(xq::rpcReply).node()};
   if (!rpcReplyNode) {
     LOG_ERROR << "Could not find XML element: /rpc-reply"
               << std::endl;
@@ -116,10 +498,10 @@ Parser::handleXML(const pugi::xml_document& doc)
 void
 Parser::parseConfig(const pugi::xml_node& configNode)
 {
-  for (const auto& groupsMatch : configNode.select_nodes("groups")) {
+  for (const auto& groupsMatch : configNode.select_nodes(xq::groups)) {
     const pugi::xml_node groupsNode {groupsMatch.node()};
     const std::string groupName {
-        groupsNode.select_node("name").node().text().as_string()
+        groupsNode.select_node(xq::name).node().text().as_string()
       };
 
     if ("junos-defaults" == groupName) {
@@ -138,7 +520,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   // Initialize logical system.
   std::string logicalSystemName;
-  const auto nameMatch {configNode.select_node("name")};
+  const auto nameMatch {configNode.select_node(xq::name)};
   if (nameMatch) {
     logicalSystemName = nmcu::toLower(nameMatch.node().text().as_string());
   }
@@ -149,88 +531,16 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   auto& logicalSystem {data.logicalSystems[logicalSystemName]};
 
   // Parse system settings. Only copy is at global system scope:
-  for ( const auto& nameServerMatch
-      : configNode.select_nodes("/rpc-reply/configuration/system"
-                                  "/name-server[not(@inactive='inactive')]"
-                               )
-      )
-  {
-    const pugi::xml_node nameServerNode {nameServerMatch.node()};
-    nmdo::IpAddress dnsResolverIpAddr {
-        nameServerNode.select_node("name").node().text().as_string()
-      };
-    // Service version
-    auto dnsService {nmdu::ServiceFactory::makeDns()};
-    dnsService.setDstAddress(dnsResolverIpAddr);
-    logicalSystem.services.emplace_back(dnsService);
-    // DnsResolver version
-    nmdo::DnsResolver dnsResolver;
-    dnsResolver.setDstAddress(dnsResolverIpAddr);
-    logicalSystem.dnsResolvers.emplace_back(dnsResolver);
-  }
-
-  for ( const auto& domainSearchMatch
-      : configNode.select_nodes("/rpc-reply/configuration/system"
-                                  "/domain-search[not(@inactive='inactive')]"
-                               )
-      )
-  {
-    const pugi::xml_node domainSearchNode {domainSearchMatch.node()};
-    const std::string dnsSearchDomain {domainSearchNode.text().as_string()};
-    logicalSystem.dnsSearchDomains.emplace_back(dnsSearchDomain);
-  }
-
-  for ( const auto& tacplusServerMatch
-      : configNode.select_nodes("/rpc-reply/configuration/system"
-                                  "/tacplus-server[not(@inactive='inactive')]"
-                               )
-      )
-  {
-    const pugi::xml_node tacplusServerNode {tacplusServerMatch.node()};
-    nmdo::IpAddress tacplusServerIpAddr {
-      tacplusServerNode.select_node("name").node().text().as_string()
-    };
-    auto tacplusService {nmdu::ServiceFactory::makeTacacsPlus()};
-    tacplusService.setDstAddress(tacplusServerIpAddr);
-    logicalSystem.services.emplace_back(tacplusService);
-  }
-
-  for ( const auto& ntpMatch
-      : configNode.select_nodes("/rpc-reply/configuration/system"
-                                  "/ntp[not(@inactive='inactive')]"
-                               )
-      )
-  {
-    const pugi::xml_node ntpNode {ntpMatch.node()};
-    const auto ntpSrcAddrMatch {
-        ntpNode.select_node("source-address[not(@inactive='inactive')]")
-      };
-    for ( const auto& ntpServerMatch
-        : ntpNode.select_nodes("server[not(@inactive='inactive')]")
-        )
-    {
-      const pugi::xml_node ntpServerNode {ntpServerMatch.node()};
-      nmdo::IpAddress ntpServerIpAddr {
-          ntpServerNode.select_node("name").node().text().as_string()
-        };
-      auto ntpService {nmdu::ServiceFactory::makeNtp()};
-      ntpService.setDstAddress(ntpServerIpAddr);
-      if (ntpSrcAddrMatch) {
-        const pugi::xml_node ntpSrcAddrNode {ntpSrcAddrMatch.node()};
-        nmdo::IpAddress ntpSrcIpAddr {
-            ntpSrcAddrNode.select_node("name").node().text().as_string()
-          };
-        ntpService.setSrcAddress(ntpSrcIpAddr);
-      }
-      logicalSystem.services.emplace_back(ntpService);
-    }
-  }
+  const auto& settings {getSystemSettings(configNode)};
+  append(logicalSystem.services, settings.services);
+  append(logicalSystem.dnsResolvers, settings.dnsResolvers);
+  append(logicalSystem.dnsSearchDomains, settings.dnsSearchDomains);
 
 
   // Parse networking settings:
   logicalSystem.ifaces["_self_"].setName("_self_");
   for ( const auto& interfacesMatch
-      : configNode.select_nodes("interfaces[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::interfaces)
       )
   {
     const pugi::xml_node interfacesNode {interfacesMatch.node()};
@@ -247,7 +557,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for ( const auto& routingInstancesMatch
-      : configNode.select_nodes("routing-instances[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::routingInstances)
       )
   {
     const pugi::xml_node routingInstancesNode {routingInstancesMatch.node()};
@@ -259,7 +569,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for ( const auto& routingOptionsMatch
-      : configNode.select_nodes("routing-options[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::routingOptions)
       )
   {
     const pugi::xml_node routingOptionsNode {routingOptionsMatch.node()};
@@ -271,7 +581,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 
   // Parse firewall settings:
   for ( const auto& zonesMatch
-      : configNode.select_nodes("security/zones[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::securityZones)
       )
   {
     const pugi::xml_node zonesNode {zonesMatch.node()};
@@ -291,11 +601,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for ( const auto& addressBookMatch
-      : configNode.select_nodes("(security/address-book[not(@inactive='inactive')])"
-                                "|(security/zones[not(@inactive='inactive')]"
-                                  "/security-zone[not(@inactive='inactive')]"
-                                  "/address-book[not(@inactive='inactive')])"
-                               )
+      : configNode.select_nodes(xq::addressBooks)
       )
   {
     const pugi::xml_node addressBookNode {addressBookMatch.node()};
@@ -320,7 +626,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for ( const auto& applicationsMatch
-      : configNode.select_nodes("applications[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::applications)
       )
   {
     const pugi::xml_node applicationsNode {applicationsMatch.node()};
@@ -333,7 +639,7 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   for ( const auto& policiesMatch
-      : configNode.select_nodes("security/policies[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::securityPolicies)
       )
   {
     const pugi::xml_node policiesNode {policiesMatch.node()};
@@ -343,12 +649,29 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   }
 
   // Parse logical-systems:
+  // Each is independent of the others, so parse them in parallel and merge
+  // the results back in document order.
+  std::vector<pugi::xml_node> logicalSystemNodes;
   for ( const auto& logicalSystemMatch
-      : configNode.select_nodes("logical-systems[not(@inactive='inactive')]")
+      : configNode.select_nodes(xq::logicalSystems)
       )
   {
-    const pugi::xml_node logicalSystemNode {logicalSystemMatch.node()};
-    parseConfig(logicalSystemNode);
+    logicalSystemNodes.emplace_back(logicalSystemMatch.node());
+  }
+
+  auto parsedLogicalSystems {nmdp::parseInParallel(
+      logicalSystemNodes.size(), parseJobs,
+      [this, &logicalSystemNodes](size_t idx)
+      {
+        Parser parser;
+        parser.systemSettingsRoot = systemSettingsRoot;
+        parser.systemSettings = systemSettings;
+        parser.parseJobs = 1; // already on a worker; stay within the bound
+        parser.parseConfig(logicalSystemNodes[idx]);
+        return parser.data;
+      })};
+  for (auto& logicalSystemData : parsedLogicalSystems) {
+    mergeData(logicalSystemData);
   }
 }
 
@@ -364,20 +687,20 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
   std::smatch mediaTypeMatch;
 
   for ( const auto& interfaceRangeMatch
-      : interfacesNode.select_nodes("interface-range[not(@inactive='inactive')]")
+      : interfacesNode.select_nodes(xq::interfaceRange)
       )
   {
     const pugi::xml_node ifaceRangeNode {interfaceRangeMatch.node()};
     const std::string ifaceRangeName {
-        ifaceRangeNode.select_node("name").node().text().as_string()
+        ifaceRangeNode.select_node(xq::name).node().text().as_string()
       };
     for ( const auto& memberMatch
-        : ifaceRangeNode.select_nodes("member[not(@inactive='inactive')]")
+        : ifaceRangeNode.select_nodes(xq::member)
         )
     {
       const pugi::xml_node memberNode {memberMatch.node()};
       const std::string ifaceName {
-          memberNode.select_node("name").node().text().as_string()
+          memberNode.select_node(xq::name).node().text().as_string()
         };
       ifaces[ifaceName].setName(ifaceName);
       ifaces[ifaceName].setDescription(ifaceRangeName);
@@ -386,20 +709,12 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
       }
 
       for ( const auto optionsMatch
-          : memberNode.select_nodes(
-             "(../gigether-options[not(@inactive='inactive')])"
-             "|(../ether-options[not(@inactive='inactive')])"
-            )
+          : memberNode.select_nodes(xq::siblingEtherOptions)
           )
       {
         const pugi::xml_node optionsNode {optionsMatch.node()};
         for ( const auto virtualIfaceMatch
-            : optionsNode.select_nodes(
-               "(redundant-parent[not(@inactive='inactive')]"
-                   "/parent[not(@inactive='inactive')])"
-               "|(ieee-802.3ad[not(@inactive='inactive')]"
-                   "/bundle[not(@inactive='inactive')])"
-              )
+            : optionsNode.select_nodes(xq::virtualIfaces)
             )
         {
           const std::string virtualIfaceName {
@@ -413,10 +728,10 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
   }
 
   for (const auto& interfaceMatch :
-       interfacesNode.select_nodes("interface[not(@inactive='inactive')]")) {
+       interfacesNode.select_nodes(xq::interface)) {
     const pugi::xml_node ifaceNode {interfaceMatch.node()};
     const std::string ifaceName {
-      ifaceNode.select_node("name").node().text().as_string()
+      ifaceNode.select_node(xq::name).node().text().as_string()
     };
 
     // Physical interface
@@ -426,22 +741,18 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
         ifaces[ifaceName].setMediaType(mediaTypeMatch[1]);
       }
 
-      const auto descriptionMatch {ifaceNode.select_node("description")};
+      const auto descriptionMatch {ifaceNode.select_node(xq::description)};
       if (descriptionMatch) {
         ifaces[ifaceName].setDescription(descriptionMatch.node().text().as_string());
       }
-      const auto disableMatch {ifaceNode.select_node("disable")};
+      const auto disableMatch {ifaceNode.select_node(xq::disable)};
       if (disableMatch) {
         ifaces[ifaceName].setState(false);
       }
 
-      for (const auto optionsMatch : ifaceNode.select_nodes(
-             "(gigether-options[not(@inactive='inactive')])|"
-             "(ether-options[not(@inactive='inactive')])")) {
+      for (const auto optionsMatch : ifaceNode.select_nodes(xq::etherOptions)) {
         const pugi::xml_node optionsNode {optionsMatch.node()};
-        for (const auto virtualIfaceMatch : optionsNode.select_nodes(
-               "(redundant-parent[not(@inactive='inactive')]/parent[not(@inactive='inactive')])|"
-               "(ieee-802.3ad[not(@inactive='inactive')]/bundle[not(@inactive='inactive')])")) {
+        for (const auto virtualIfaceMatch : optionsNode.select_nodes(xq::virtualIfaces)) {
           const std::string virtualIfaceName {
             virtualIfaceMatch.node().text().as_string()
           };
@@ -450,11 +761,9 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
         }
       }
 
-      for (const auto optionsMatch : ifaceNode.select_nodes(
-             "fabric-options[not(@inactive='inactive')]")) {
+      for (const auto optionsMatch : ifaceNode.select_nodes(xq::fabricOptions)) {
         const pugi::xml_node optionsNode {optionsMatch.node()};
-        for (const auto underlyingIfaceMatch : optionsNode.select_nodes(
-             "member-interfaces[not(@inactive='inactive')]/name")) {
+        for (const auto underlyingIfaceMatch : optionsNode.select_nodes(xq::memberInterfacesName)) {
           const std::string underlyingIfaceName {
             underlyingIfaceMatch.node().text().as_string()
           };
@@ -466,10 +775,10 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
 
     // Logical interface units
     for (const auto& unitMatch :
-         ifaceNode.select_nodes("unit[not(@inactive='inactive')]")) {
+         ifaceNode.select_nodes(xq::unit)) {
       const pugi::xml_node unitNode {unitMatch.node()};
       const std::string unitName {
-        unitNode.select_node("name").node().text().as_string()
+        unitNode.select_node(xq::name).node().text().as_string()
       };
       const std::string ifaceUnitId {ifaceName + "." + unitName};
 
@@ -480,15 +789,15 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
         ifaces[ifaceUnitId].setMediaType(mediaTypeMatch[1]);
       }
 
-      const auto descriptionMatch {unitNode.select_node("description")};
+      const auto descriptionMatch {unitNode.select_node(xq::description)};
       if (descriptionMatch) {
         ifaces[ifaceUnitId].setDescription(descriptionMatch.node().text().as_string());
       }
-      const auto disableMatch {unitNode.select_node("(disable)|(../disable)")};
+      const auto disableMatch {unitNode.select_node(xq::unitDisable)};
       if (disableMatch) {
         ifaces[ifaceUnitId].setState(false);
       }
-      const auto vlanMatch {unitNode.select_node("vlan-id[not(@inactive='inactive')]")};
+      const auto vlanMatch {unitNode.select_node(xq::vlanId)};
       if (vlanMatch) {
         const uint16_t vlanId {
           static_cast<uint16_t>(vlanMatch.node().text().as_uint())
@@ -497,20 +806,18 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
       }
 
       for (const auto& addressMatch :
-           unitNode.select_nodes(
-             "(family[not(@inactive='inactive')]/inet[not(@inactive='inactive')]/address[not(@inactive='inactive')])|"
-             "(family[not(@inactive='inactive')]/inet6[not(@inactive='inactive')]/address[not(@inactive='inactive')])")) {
+           unitNode.select_nodes(xq::familyAddress)) {
         const pugi::xml_node addressNode {addressMatch.node()};
         nmdo::IpAddress ipAddr {
-          addressNode.select_node("name").node().text().as_string()
+          addressNode.select_node(xq::name).node().text().as_string()
         };
         ifaces[ifaceUnitId].addIpAddress(ipAddr);
 
         for (const auto& arpMatch :
-             addressNode.select_nodes("arp[not(@inactive='inactive')]")) {
+             addressNode.select_nodes(xq::arp)) {
           const pugi::xml_node arpNode {arpMatch.node()};
           const auto peerMacAddrMatch {
-            arpNode.select_node("mac[not(@inactive='inactive')]")
+            arpNode.select_node(xq::mac)
           };
           if (peerMacAddrMatch &&
               nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -521,7 +828,7 @@ Parser::parseConfigInterfaces(const pugi::xml_node& interfacesNode)
             peerMacAddr.setResponding(true);
 
             const auto peerIpAddrMatch {
-              arpNode.select_node("name[not(@inactive='inactive')]")
+              arpNode.select_node(xq::activeName)
             };
             if (peerIpAddrMatch &&
                 nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -555,18 +862,18 @@ Parser::parseConfigRoutingInstances(const pugi::xml_node& routingInstancesNode,
   }
 
   for (const auto& routingInstanceMatch :
-       routingInstancesNode.select_nodes("instance[not(@inactive='inactive')]")) {
+       routingInstancesNode.select_nodes(xq::instance)) {
     const pugi::xml_node routingInstanceNode {routingInstanceMatch.node()};
     const std::string vrfId {
-      routingInstanceNode.select_node("name").node().text().as_string()
+      routingInstanceNode.select_node(xq::name).node().text().as_string()
     };
     vrfs[vrfId].setId(vrfId);
 
     for (const auto& interfaceMatch :
-         routingInstanceNode.select_nodes("interface[not(@inactive='inactive')]")) {
+         routingInstanceNode.select_nodes(xq::interface)) {
       const pugi::xml_node interfaceNode {interfaceMatch.node()};
       const std::string ifaceName {
-        interfaceNode.select_node("name").node().text().as_string()
+        interfaceNode.select_node(xq::name).node().text().as_string()
       };
       if (ifaces.end() != ifaces.find(ifaceName)) {
         vrfs[vrfId].addIface(ifaceName);
@@ -582,7 +889,7 @@ Parser::parseConfigRoutingInstances(const pugi::xml_node& routingInstancesNode,
     }
 
     for (const auto& routingOptionsMatch :
-         routingInstanceNode.select_nodes("routing-options[not(@inactive='inactive')]")) {
+         routingInstanceNode.select_nodes(xq::routingOptions)) {
       const pugi::xml_node routingOptionsNode {routingOptionsMatch.node()};
       for (auto& route : parseConfigRoutingOptions(routingOptionsNode)) {
         route.setVrfId(vrfId);
@@ -601,10 +908,7 @@ Parser::parseConfigRoutingOptions(const pugi::xml_node& routingOptionsNode)
   nmdo::RoutingTable routes;
 
   for ( const auto& routeMatch
-      : routingOptionsNode.select_nodes(
-          "(static[not(@inactive='inactive')]/route[not(@inactive='inactive')])"
-          "|(static[not(@inactive='inactive')]/rib[not(@inactive='inactive')]/route[not(@inactive='inactive')])"
-        )
+      : routingOptionsNode.select_nodes(xq::staticRoute)
       )
   {
     const pugi::xml_node routeNode {routeMatch.node()};
@@ -612,26 +916,26 @@ Parser::parseConfigRoutingOptions(const pugi::xml_node& routingOptionsNode)
     route.setProtocol("static");
     route.setAdminDistance(5);  // Default for static routes
 
-    const auto nameMatch {routeNode.select_node("name")};
+    const auto nameMatch {routeNode.select_node(xq::name)};
     if (nameMatch) {
       const nmdo::IpAddress dstIpNet {nameMatch.node().text().as_string()};
       route.setDstIpNet(dstIpNet);
     }
 
-    const auto discardMatch {routeNode.select_node("discard[not(@inactive='inactive')]")};
+    const auto discardMatch {routeNode.select_node(xq::discard)};
     if (discardMatch) {
       const std::string outgoingIfaceName {discardMatch.node().name()};
       route.setOutIfaceName(outgoingIfaceName);
       route.setNullRoute(true);
     }
 
-    const auto nextHopMatch {routeNode.select_node("next-hop[not(@inactive='inactive')]")};
+    const auto nextHopMatch {routeNode.select_node(xq::nextHop)};
     if (nextHopMatch) {
       const nmdo::IpAddress nextHopIpAddr {nextHopMatch.node().text().as_string()};
       route.setNextHopIpAddr(nextHopIpAddr);
     }
 
-    const auto nextTableMatch {routeNode.select_node("next-table[not(@inactive='inactive')]")};
+    const auto nextTableMatch {routeNode.select_node(xq::nextTable)};
     if (nextTableMatch) {
       const std::string nextRouteTableName {
         nextTableMatch.node().text().as_string()
@@ -644,7 +948,7 @@ Parser::parseConfigRoutingOptions(const pugi::xml_node& routingOptionsNode)
     }
 
     if ("rib" == routeNode.parent().name()) {
-      route.setTableId(routeNode.parent().select_node("name").node().text().as_string());
+      route.setTableId(routeNode.parent().select_node(xq::name).node().text().as_string());
     } else if (route.isV4()) {
       route.setTableId("inet.0");
     } else if (route.isV6()) {
@@ -664,18 +968,18 @@ Parser::parseConfigZones(const pugi::xml_node& zonesNode)
   std::map<std::string, nmdo::AclZone> aclZones;
 
   for (const auto& zoneMatch :
-       zonesNode.select_nodes("security-zone[not(@inactive='inactive')]")) {
+       zonesNode.select_nodes(xq::securityZone)) {
     const pugi::xml_node zoneNode {zoneMatch.node()};
     const std::string zoneName {
-      zoneNode.select_node("name").node().text().as_string()
+      zoneNode.select_node(xq::name).node().text().as_string()
     };
     aclZones[zoneName].setId(zoneName);
 
     for (const auto& interfacesMatch :
-         zoneNode.select_nodes("interfaces[not(@inactive='inactive')]")) {
+         zoneNode.select_nodes(xq::interfaces)) {
       const pugi::xml_node interfacesNode {interfacesMatch.node()};
       const std::string ifaceName {
-        interfacesNode.select_node("name").node().text().as_string()
+        interfacesNode.select_node(xq::name).node().text().as_string()
       };
       aclZones[zoneName].addIface(ifaceName);
     }
@@ -692,36 +996,36 @@ Parser::parseConfigAddressBook(const pugi::xml_node& addressBookNode)
 
   std::string addressBookNamespace;
   const auto& securityZoneMatch {
-    addressBookNode.select_node("parent::security-zone[not(@inactive='inactive')]")
+    addressBookNode.select_node(xq::parentSecurityZone)
   };
   if (securityZoneMatch) {
     const pugi::xml_node securityZoneNode {securityZoneMatch.node()};
-    addressBookNamespace = securityZoneNode.select_node("name").node().text().as_string();
+    addressBookNamespace = securityZoneNode.select_node(xq::name).node().text().as_string();
   }
   else {
-    addressBookNamespace = addressBookNode.select_node("name").node().text().as_string();
+    addressBookNamespace = addressBookNode.select_node(xq::name).node().text().as_string();
   }
   aclIpNetSets[addressBookNamespace];
 
   for (const auto& addressMatch :
-       addressBookNode.select_nodes("address[not(@inactive='inactive')]")) {
+       addressBookNode.select_nodes(xq::address)) {
     const pugi::xml_node addressNode {addressMatch.node()};
     const std::string ipNetName {
-      addressNode.select_node("name").node().text().as_string()
+      addressNode.select_node(xq::name).node().text().as_string()
     };
     aclIpNetSets[addressBookNamespace][ipNetName].setId(ipNetName, addressBookNamespace);
 
     for (const auto& ipPrefixMatch :
-         addressNode.select_nodes("ip-prefix[not(@inactive='inactive')]")) {
+         addressNode.select_nodes(xq::ipPrefix)) {
       const nmdo::IpNetwork ipNet {ipPrefixMatch.node().text().as_string()};
       aclIpNetSets[addressBookNamespace][ipNetName].addIpNet(ipNet);
     }
 
     for (const auto& dnsNameMatch :
-         addressNode.select_nodes("dns-name[not(@inactive='inactive')]")) {
+         addressNode.select_nodes(xq::dnsName)) {
       const pugi::xml_node dnsNameNode {dnsNameMatch.node()};
       const std::string dnsName {
-        dnsNameNode.select_node("name").node().text().as_string()
+        dnsNameNode.select_node(xq::name).node().text().as_string()
       };
       data.observations.addNotable("FQDNs are used that must be resolved");
       aclIpNetSets[addressBookNamespace][ipNetName].addHostname(dnsName);
@@ -729,18 +1033,18 @@ Parser::parseConfigAddressBook(const pugi::xml_node& addressBookNode)
   }
 
   for (const auto& addressSetMatch :
-       addressBookNode.select_nodes("address-set[not(@inactive='inactive')]")) {
+       addressBookNode.select_nodes(xq::addressSet)) {
     const pugi::xml_node addressSetNode {addressSetMatch.node()};
     const std::string ipNetSetName {
-      addressSetNode.select_node("name").node().text().as_string()
+      addressSetNode.select_node(xq::name).node().text().as_string()
     };
     aclIpNetSets[addressBookNamespace][ipNetSetName].setId(ipNetSetName, addressBookNamespace);
 
     for (const auto& addressMatch :
-         addressSetNode.select_nodes("address[not(@inactive='inactive')]")) {
+         addressSetNode.select_nodes(xq::address)) {
       const pugi::xml_node addressNode {addressMatch.node()};
       const std::string ipNetName {
-        addressNode.select_node("name").node().text().as_string()
+        addressNode.select_node(xq::name).node().text().as_string()
       };
       aclIpNetSets[addressBookNamespace][ipNetSetName].addIncludedId(ipNetName);
     }
@@ -756,7 +1060,7 @@ Parser::parseConfigApplications(const pugi::xml_node& applicationsNode)
   std::vector<nmdo::AclService> aclServices;
 
   for (const auto& applicationMatch :
-       applicationsNode.select_nodes("application[not(@inactive='inactive')]")) {
+       applicationsNode.select_nodes(xq::application)) {
     const pugi::xml_node applicationNode {applicationMatch.node()};
 
     auto aclServicesToAdd =
@@ -769,23 +1073,20 @@ Parser::parseConfigApplications(const pugi::xml_node& applicationsNode)
   }
 
   for (const auto& applicationSetMatch :
-       applicationsNode.select_nodes("application-set[not(@inactive='inactive')]")) {
+       applicationsNode.select_nodes(xq::applicationSet)) {
     const pugi::xml_node applicationSetNode {applicationSetMatch.node()};
     nmdo::AclService aclService;
 
     const std::string applicationSetName {
-      applicationSetNode.select_node("name").node().text().as_string()
+      applicationSetNode.select_node(xq::name).node().text().as_string()
     };
     aclService.setId(applicationSetName);
 
-    const pugi::xpath_query query {
-        "application[not(@inactive='inactive')]|"
-        "application-set[not(@inactive='inactive')]"
-      };
-    for (const auto& applicationMatch : applicationSetNode.select_nodes(query)) {
+    for (const auto& applicationMatch :
+         applicationSetNode.select_nodes(xq::applicationOrSet)) {
       const pugi::xml_node applicationNode {applicationMatch.node()};
       const std::string applicationName {
-        applicationNode.select_node("name").node().text().as_string()
+        applicationNode.select_node(xq::name).node().text().as_string()
       };
       aclService.addIncludedId(applicationName);
     }
@@ -803,11 +1104,11 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
   std::vector<nmdo::AclService> aclServices;
 
   const std::string applicationName {
-    applicationNode.select_node("name").node().text().as_string()
+    applicationNode.select_node(xq::name).node().text().as_string()
   };
 
   const auto protocolMatch {
-    applicationNode.select_node("protocol[not(@inactive='inactive')]")
+    applicationNode.select_node(xq::protocol)
   };
   if (protocolMatch) {
     nmdo::AclService aclService;
@@ -832,7 +1133,7 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
     aclService.setProtocol(protocol);
 
     const auto srcPortMatch {
-      applicationNode.select_node("source-port[not(@inactive='inactive')]")
+      applicationNode.select_node(xq::sourcePort)
     };
     if (srcPortMatch) {
       const nmdo::PortRange srcPortRange {
@@ -847,7 +1148,7 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
     }
 
     const auto dstPortMatch {
-      applicationNode.select_node("destination-port[not(@inactive='inactive')]")
+      applicationNode.select_node(xq::destinationPort)
     };
     if (dstPortMatch) {
       const nmdo::PortRange dstPortRange {
@@ -865,7 +1166,7 @@ Parser::parseConfigApplicationOrTerm(const pugi::xml_node& applicationNode)
   }
 
   for (const auto& termMatch :
-       applicationNode.select_nodes("term[not(@inactive='inactive')]")) {
+       applicationNode.select_nodes(xq::term)) {
     const pugi::xml_node termNode {termMatch.node()};
     for (auto& aclService : parseConfigApplicationOrTerm(termNode)) {
       aclService.setId(applicationName);
@@ -885,8 +1186,7 @@ Parser::parseConfigPolicies(const pugi::xml_node& policiesNode)
 
   ruleId = 0;
   for (const auto& policyMatch :
-       policiesNode.select_nodes(
-         "policy[not(@inactive='inactive')]/policy[not(@inactive='inactive')]")) {
+       policiesNode.select_nodes(xq::zonePolicy)) {
     const pugi::xml_node policyNode {policyMatch.node()};
     auto rulesToAdd = parseConfigPolicy(policyNode, ruleId);
     std::copy(
@@ -899,7 +1199,7 @@ Parser::parseConfigPolicies(const pugi::xml_node& policiesNode)
 
   ruleId = 0;
   for (const auto& policyMatch :
-       policiesNode.select_nodes("global/policy[not(@inactive='inactive')]")) {
+       policiesNode.select_nodes(xq::globalPolicy)) {
     const pugi::xml_node policyNode {policyMatch.node()};
     auto rulesToAdd = parseConfigPolicy(policyNode, ruleId);
     std::copy(
@@ -920,14 +1220,12 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   std::vector<nmdo::AclRuleService> rules;
 
   const std::string description {
-    policyNode.select_node("name").node().text().as_string()
+    policyNode.select_node(xq::name).node().text().as_string()
   };
 
   std::vector<std::string> incomingZoneIds;
 
-  const auto &incomingZoneNodes = policyNode.select_nodes
-       ("(../from-zone-name[not(@inactive='inactive')])|"
-        "(match[not(@inactive='inactive')]/from-zone[not(@inactive='inactive')])");
+  const auto &incomingZoneNodes = policyNode.select_nodes(xq::fromZone);
   std::transform(incomingZoneNodes.begin(), incomingZoneNodes.end(),
       std::back_inserter(incomingZoneIds),
       [](auto& incomingZoneMatch){return incomingZoneMatch.node().text().as_string();});
@@ -936,9 +1234,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   }
 
   std::vector<std::string> outgoingZoneIds;
-  const auto &outgoingZoneNodes = policyNode.select_nodes
-       ("(../to-zone-name[not(@inactive='inactive')])|"
-        "(match[not(@inactive='inactive')]/to-zone[not(@inactive='inactive')])");
+  const auto &outgoingZoneNodes = policyNode.select_nodes(xq::toZone);
   std::transform(outgoingZoneNodes.begin(), outgoingZoneNodes.end(),
       std::back_inserter(outgoingZoneIds),
       [](auto& outgoingZoneMatch){return outgoingZoneMatch.node().text().as_string();});
@@ -947,8 +1243,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   }
 
   std::vector<std::string> srcIpNetSetIds;
-  const auto &srcAddressNodes = policyNode.select_nodes(
-      "match[not(@inactive='inactive')]/source-address[not(@inactive='inactive')]");
+  const auto &srcAddressNodes = policyNode.select_nodes(xq::matchSourceAddress);
   std::transform(srcAddressNodes.begin(), srcAddressNodes.end(),
       std::back_inserter(srcIpNetSetIds),
       [](auto& srcAddressMatch){return srcAddressMatch.node().text().as_string();});
@@ -957,8 +1252,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   }
 
   std::vector<std::string> dstIpNetSetIds;
-  const auto &dstAddressNodes = policyNode.select_nodes(
-         "match[not(@inactive='inactive')]/destination-address[not(@inactive='inactive')]");
+  const auto &dstAddressNodes = policyNode.select_nodes(xq::matchDestinationAddress);
   std::transform(dstAddressNodes.begin(), dstAddressNodes.end(),
       std::back_inserter(dstIpNetSetIds),
       [](auto& dstAddressMatch){return dstAddressMatch.node().text().as_string();});
@@ -967,8 +1261,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   }
 
   std::vector<std::string> serviceIds;
-  const auto &serviceIdNodes = policyNode.select_nodes(
-         "match[not(@inactive='inactive')]/application[not(@inactive='inactive')]");
+  const auto &serviceIdNodes = policyNode.select_nodes(xq::matchApplication);
   std::transform(serviceIdNodes.begin(), serviceIdNodes.end(),
       std::back_inserter(serviceIds),
       [](auto& serviceIdMatch){return serviceIdMatch.node().text().as_string();});
@@ -978,22 +1271,23 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
   }
 
   std::string action;
-  if (policyNode.select_node(
-        "then[not(@inactive='inactive')]/permit[not(@inactive='inactive')]")) {
+  if (policyNode.select_node(xq::thenPermit)) {
     action = "allow";
   }
-  else if (policyNode.select_node(
-        "(then[not(@inactive='inactive')]/deny[not(@inactive='inactive')])|"
-        "(then[not(@inactive='inactive')]/reject[not(@inactive='inactive')])")) {
+  else if (policyNode.select_node(xq::thenBlock)) {
     action = "block";
   }
 
+  const bool hasZoneAddressBooks {
+    policyNode.select_node(xq::zoneAddressBook)
+  };
+  const bool isGlobalPolicy {policyNode.select_node(xq::parentGlobal)};
   for (const auto& incomingZoneId : incomingZoneIds) {
     for (const auto& outgoingZoneId : outgoingZoneIds) {
       // Initially default to global address-book.
       std::string srcIpNetSetNamespace {"global"};
       std::string dstIpNetSetNamespace {"global"};
-      if (policyNode.select_node("../../../zones/security-zone/address-book")) {
+      if (hasZoneAddressBooks) {
         // Use per-zone address-books instead of global address-book.
         // However, leave "any" zones on the global address-book.
         if ("any" != incomingZoneId) {
@@ -1008,7 +1302,7 @@ Parser::parseConfigPolicy(const pugi::xml_node& policyNode, const size_t ruleId)
       if (false) {
         ruleIdBase = 5000000;  // Default Policies
       }
-      else if (policyNode.select_node("parent::global")) {
+      else if (isGlobalPolicy) {
         ruleIdBase = 4000000;  // Global Policies
       }
       else if (incomingZoneId != outgoingZoneId) {
@@ -1056,7 +1350,7 @@ Parser::parseRouteInfo(const pugi::xml_node& routeInfoNode)
   auto& logicalSystem {data.logicalSystems[logicalSystemName]};
 
   for (const auto& routeTableMatch :
-       routeInfoNode.select_nodes("route-table[not(@inactive='inactive')]")) {
+       routeInfoNode.select_nodes(xq::routeTable)) {
     const pugi::xml_node routeTableNode {routeTableMatch.node()};
     auto parsedVrfs {parseRouteTable(routeTableNode)};
     logicalSystem.vrfs.merge(parsedVrfs);
@@ -1092,7 +1386,7 @@ std::map<std::string, nmdo::Vrf>
 Parser::parseRouteTable(const pugi::xml_node& routeTableNode)
 {
   const std::string routeTableName {
-    routeTableNode.select_node("table-name").node().text().as_string()
+    routeTableNode.select_node(xq::tableName).node().text().as_string()
   };
   const auto [vrfId, tableId]{
     extractVrfIdTableId(routeTableName)
@@ -1113,7 +1407,7 @@ Parser::parseRouteTable(const pugi::xml_node& routeTableNode)
 
   vrfs[vrfId].setId(vrfId);
 
-  for (const auto& routeMatch : routeTableNode.select_nodes("rt[not(@inactive='inactive')]")) {
+  for (const auto& routeMatch : routeTableNode.select_nodes(xq::rt)) {
     const pugi::xml_node routeNode {routeMatch.node()};
     for (auto& route : parseRoute(routeNode)) {
       route.setVrfId(vrfId);
@@ -1133,10 +1427,10 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
   bool ignoreRoute {false};
 
   const std::string dstIpString {
-    routeNode.select_node("rt-destination").node().text().as_string()
+    routeNode.select_node(xq::rtDestination).node().text().as_string()
   };
   const std::string prefixString {
-    routeNode.select_node("rt-prefix-length").node().text().as_string()
+    routeNode.select_node(xq::rtPrefixLength).node().text().as_string()
   };
 
   // Ignore ephemeral multicast routes where the destination
@@ -1157,7 +1451,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
   };
 
   for (const auto& routeEntryMatch :
-       routeNode.select_nodes("rt-entry[not(@inactive='inactive')]")) {
+       routeNode.select_nodes(xq::rtEntry)) {
     const pugi::xml_node routeEntryNode {routeEntryMatch.node()};
 
     nmdo::Route route;
@@ -1172,14 +1466,14 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const std::string activeTag {
-      routeEntryNode.select_node("active-tag").node().text().as_string()
+      routeEntryNode.select_node(xq::activeTag).node().text().as_string()
     };
     if ("*" != activeTag) {
       route.setActive(false);
     }
 
     const auto protocolMatch {
-      routeEntryNode.select_node("protocol-name[not(@inactive='inactive')]")
+      routeEntryNode.select_node(xq::protocolName)
     };
     if (protocolMatch) {
       const std::string protocol {
@@ -1189,7 +1483,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto preferenceMatch {
-      routeEntryNode.select_node("preference[not(@inactive='inactive')]")
+      routeEntryNode.select_node(xq::preference)
     };
     if (preferenceMatch) {
       const size_t adminDistance {
@@ -1199,7 +1493,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto metricMatch {
-      routeEntryNode.select_node("metric[not(@inactive='inactive')]")
+      routeEntryNode.select_node(xq::metric)
     };
     if (metricMatch) {
       const size_t metric {
@@ -1209,7 +1503,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto nhTypeMatch {
-      routeEntryNode.select_node("nh-type[not(@inactive='inactive')]")
+      routeEntryNode.select_node(xq::nhType)
     };
     if (nhTypeMatch) {
       const std::string nhType {
@@ -1226,8 +1520,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto nextHopTableMatch {
-      routeEntryNode.select_node(
-          "nh[not(@inactive='inactive')]/nh-table[not(@inactive='inactive')]")
+      routeEntryNode.select_node(xq::nhNhTable)
     };
     if (nextHopTableMatch) {
       const std::string nextRouteTableName {
@@ -1241,8 +1534,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto nextHopRtrMatch {
-      routeEntryNode.select_node(
-          "nh[not(@inactive='inactive')]/to[not(@inactive='inactive')]")
+      routeEntryNode.select_node(xq::nhTo)
     };
     if (nextHopRtrMatch) {
       const nmdo::IpAddress nextHopIpAddr {
@@ -1252,9 +1544,7 @@ Parser::parseRoute(const pugi::xml_node& routeNode)
     }
 
     const auto nextHopViaMatch {
-      routeEntryNode.select_node
-        ("(nh[not(@inactive='inactive')]/via[not(@inactive='inactive')])|"
-         "(nh[not(@inactive='inactive')]/nh-local-interface[not(@inactive='inactive')])")
+      routeEntryNode.select_node(xq::nhVia)
     };
     if (nextHopViaMatch) {
       const std::string ifaceName {
@@ -1277,11 +1567,11 @@ Parser::parseArpTableInfo(const pugi::xml_node& arpTableInfoNode)
   auto& ifaces {data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& arpTableEntryMatch :
-       arpTableInfoNode.select_nodes("arp-table-entry")) {
+       arpTableInfoNode.select_nodes(xq::arpTableEntry)) {
     const pugi::xml_node arpTableEntryNode {arpTableEntryMatch.node()};
 
     const auto ifaceNameMatch {
-      arpTableEntryNode.select_node("interface-name")
+      arpTableEntryNode.select_node(xq::interfaceName)
     };
     if (ifaceNameMatch) {
       std::string ifaceName {
@@ -1295,7 +1585,7 @@ Parser::parseArpTableInfo(const pugi::xml_node& arpTableInfoNode)
       ifaces[ifaceName].setPartial(true);
 
       const auto peerMacAddrMatch {
-        arpTableEntryNode.select_node("mac-address")
+        arpTableEntryNode.select_node(xq::macAddress)
       };
       if (peerMacAddrMatch &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1306,7 +1596,7 @@ Parser::parseArpTableInfo(const pugi::xml_node& arpTableInfoNode)
         peerMacAddr.setResponding(true);
 
         const auto peerIpAddrMatch {
-          arpTableEntryNode.select_node("ip-address")
+          arpTableEntryNode.select_node(xq::ipAddress)
         };
         if (peerIpAddrMatch &&
             nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -1331,11 +1621,11 @@ Parser::parseIpv6NeighborInfo(const pugi::xml_node& ipv6NeighborInfoNode)
   auto& ifaces {data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& ipv6NdEntryMatch :
-       ipv6NeighborInfoNode.select_nodes("ipv6-nd-entry")) {
+       ipv6NeighborInfoNode.select_nodes(xq::ipv6NdEntry)) {
     const pugi::xml_node ipv6NdEntryNode {ipv6NdEntryMatch.node()};
 
     const auto ifaceNameMatch {
-      ipv6NdEntryNode.select_node("ipv6-nd-interface-name")
+      ipv6NdEntryNode.select_node(xq::ipv6NdInterfaceName)
     };
     if (ifaceNameMatch) {
       std::string ifaceName {
@@ -1349,7 +1639,7 @@ Parser::parseIpv6NeighborInfo(const pugi::xml_node& ipv6NeighborInfoNode)
       ifaces[ifaceName].setPartial(true);
 
       const auto peerMacAddrMatch {
-        ipv6NdEntryNode.select_node("ipv6-nd-neighbor-l2-address")
+        ipv6NdEntryNode.select_node(xq::ipv6NdNeighborL2Address)
       };
       if (peerMacAddrMatch &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1360,7 +1650,7 @@ Parser::parseIpv6NeighborInfo(const pugi::xml_node& ipv6NeighborInfoNode)
         peerMacAddr.setResponding(true);
 
         const auto peerIpAddrMatch {
-          ipv6NdEntryNode.select_node("ipv6-nd-neighbor-address")
+          ipv6NdEntryNode.select_node(xq::ipv6NdNeighborAddress)
         };
         if (peerIpAddrMatch &&
             nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -1385,11 +1675,11 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
   auto& ifaces {data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& infoMatch :
-       lldpNeighborInfoNode.select_nodes("lldp-neighbor-information[not(@inactive='inactive')]")) {
+       lldpNeighborInfoNode.select_nodes(xq::lldpNeighborInformation)) {
     const pugi::xml_node infoNode {infoMatch.node()};
 
     const auto localPortIdMatch {
-      infoNode.select_node("lldp-local-port-id")
+      infoNode.select_node(xq::lldpLocalPortId)
     };
     std::string localIfaceName;
     if (localPortIdMatch) {
@@ -1404,7 +1694,7 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
     }
 
     const auto localParentIfaceMatch {
-      infoNode.select_node("lldp-local-parent-interface-name")
+      infoNode.select_node(xq::lldpLocalParentInterfaceName)
     };
     std::string localParentIfaceName;
     if (localParentIfaceMatch) {
@@ -1419,14 +1709,14 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
     }
 
     const auto remoteChassisIdSubtypeMatch {
-      infoNode.select_node("lldp-remote-chassis-id-subtype")
+      infoNode.select_node(xq::lldpRemoteChassisIdSubtype)
     };
     if (remoteChassisIdSubtypeMatch) {
       const std::string remoteChassisIdSubtype {
         remoteChassisIdSubtypeMatch.node().text().as_string()
       };
       const std::string remoteChassisId {
-        infoNode.select_node("lldp-remote-chassis-id").node().text().as_string()
+        infoNode.select_node(xq::lldpRemoteChassisId).node().text().as_string()
       };
       if (("Mac address" == remoteChassisIdSubtype) &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1442,14 +1732,14 @@ Parser::parseLldpNeighborInfo(const pugi::xml_node& lldpNeighborInfoNode)
     }
 
     const auto remotePortIdSubtypeMatch {
-      infoNode.select_node("lldp-remote-port-id-subtype")
+      infoNode.select_node(xq::lldpRemotePortIdSubtype)
     };
     if (remotePortIdSubtypeMatch) {
       const std::string remotePortIdSubtype {
         remotePortIdSubtypeMatch.node().text().as_string()
       };
       const std::string remotePortId {
-        infoNode.select_node("lldp-remote-port-id").node().text().as_string()
+        infoNode.select_node(xq::lldpRemotePortId).node().text().as_string()
       };
       if (("Mac address" == remotePortIdSubtype) &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1474,15 +1764,11 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
   auto& ifaces {data.logicalSystems[logicalSystemId].ifaces};
 
   for (const auto& l2ngEntryMatch :
-       l2ngNode.select_nodes(
-         "l2ng-l2rtb-evpn-arp-entry|"
-         "l2ng-l2rtb-evpn-nd-entry|"
-         "l2ng-l2ald-mac-entry-vlan|"
-         "l2ng-l2ald-mac-ip-entry")) {
+       l2ngNode.select_nodes(xq::l2ngEntry)) {
     const pugi::xml_node l2ngEntryNode {l2ngEntryMatch.node()};
 
     const auto ifaceMatch {
-      l2ngEntryNode.select_node("l2ng-l2-mac-logical-interface")
+      l2ngEntryNode.select_node(xq::l2ngL2MacLogicalInterface)
     };
     const std::string ifaceName {
       ifaceMatch.node().text().as_string()
@@ -1491,7 +1777,7 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
       ifaces[ifaceName].setName(ifaceName);
 
       const auto vlanMatch {
-        l2ngEntryNode.select_node("l2ng-l2-vlan-id")
+        l2ngEntryNode.select_node(xq::l2ngL2VlanId)
       };
       if (vlanMatch &&
           (std::string("none") != vlanMatch.node().text().as_string())) {
@@ -1502,7 +1788,7 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
       }
 
       const auto macAddrMatch {
-        l2ngEntryNode.select_node("l2ng-l2-mac-address")
+        l2ngEntryNode.select_node(xq::l2ngL2MacAddress)
       };
       if (macAddrMatch &&
           nmdp::matchString<nmdp::ParserMacAddress, nmdo::MacAddress>
@@ -1512,10 +1798,7 @@ Parser::parseEthernetSwitching(const pugi::xml_node& l2ngNode)
         };
 
         const auto ipAddrMatch {
-          l2ngEntryNode.select_node(
-              "l2ng-l2-ip-address|"
-              "l2ng-l2-evpn-arp-inet-address|"
-              "l2ng-l2-evpn-nd-inet6-address")
+          l2ngEntryNode.select_node(xq::l2ngIpAddress)
         };
         if (ipAddrMatch &&
             nmdp::matchString<nmdp::ParserIpAddress, nmdo::IpAddress>
@@ -1537,7 +1820,7 @@ void
 Parser::parseError(const pugi::xml_node& errorNode)
 {
   const std::string message {
-    errorNode.select_node("message").node().text().as_string()
+    errorNode.select_node(xq::message).node().text().as_string()
   };
   data.observations.addNotable(message);
 }
@@ -1547,7 +1830,7 @@ void
 Parser::parseWarning(const pugi::xml_node& warningNode)
 {
   const std::string message {
-    warningNode.select_node("message").node().text().as_string()
+    warningNode.select_node(xq::message).node().text().as_string()
   };
   data.observations.addNotable(message);
 }
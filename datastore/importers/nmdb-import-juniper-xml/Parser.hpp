@@ -46,6 +46,7 @@
 #include <pugixml.hpp>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -87,6 +88,16 @@ struct Data
 typedef std::vector<Data> Results;
 
 
+// Settings under /rpc-reply/configuration/system, resolved once per document
+// and applied to every logical system
+struct SystemSettings
+{
+  std::vector<nmdo::Service> services;
+  std::vector<nmdo::DnsResolver> dnsResolvers;
+  std::vector<std::string> dnsSearchDomains;
+};
+
+
 class Parser
 {
   // Variables
@@ -96,12 +107,21 @@ class Parser
 
     const std::string DEFAULT_VRF_ID {""};//{"master"};
 
+    pugi::xml_node systemSettingsRoot;
+    std::shared_ptr<const SystemSettings> systemSettings;
+
+    size_t parseJobs {0};
+
   public:
 
   // Functions
   public:
     Results getData();
 
+    // Parse logical systems on at most this many (0 = number of cores)
+    // threads
+    void setParseJobs(size_t);
+
     void handleXML(const pugi::xml_document& doc);
     void parseConfig(const pugi::xml_node& configNode);
     void parseRouteInfo(const pugi::xml_node& routeInfoNode);
@@ -114,6 +134,10 @@ class Parser
     void parseWarning(const pugi::xml_node& warningNode);
 
   protected:
+    const SystemSettings& getSystemSettings(const pugi::xml_node&);
+
+    void mergeData(Data&);
+
     std::tuple<std::map<std::string, nmdo::InterfaceNetwork>,
                std::vector<InterfaceHierarchy>>
     parseConfigInterfaces(const pugi::xml_node& interfacesNode);
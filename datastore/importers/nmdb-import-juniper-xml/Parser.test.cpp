@@ -2146,3 +2146,57 @@ BOOST_AUTO_TEST_CASE(testParseConfig)
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(testParseConfigLogicalSystemsParallel)
+{
+  // Logical systems ls0 and ls1 each appear twice so their parts must be
+  // merged back in document order regardless of which thread parsed them.
+  std::string xml {"<configuration>"};
+  for (size_t i {0}; i < 6; ++i) {
+    xml += std::format(R"(
+        <logical-systems>
+          <name>LS{}</name>
+          <interfaces>
+            <interface>
+              <name>ge-0/0/{}</name>
+              <unit> <name>0</name> </unit>
+            </interface>
+          </interfaces>
+        </logical-systems>
+      )", i % 3, i);
+  }
+  xml += "</configuration>";
+
+  const auto parse = [&xml](size_t jobs)
+  {
+    TestParser tp;
+    tp.setParseJobs(jobs);
+    tp.parseConfig(tp.getNode(xml.c_str()));
+    return tp.data;
+  };
+
+  const auto serial {parse(1)};
+
+  BOOST_TEST(4 == serial.logicalSystems.size());
+  for (size_t i {0}; i < 3; ++i) {
+    const auto name {std::format("ls{}", i)};
+    BOOST_TEST_REQUIRE(serial.logicalSystems.contains(name));
+    const auto& ls {serial.logicalSystems.at(name)};
+
+    const std::vector<InterfaceHierarchy> expected {
+        {std::format("ge-0/0/{}", i), std::format("ge-0/0/{}.0", i)},
+        {std::format("ge-0/0/{}", i+3), std::format("ge-0/0/{}.0", i+3)},
+      };
+    BOOST_TEST((expected == ls.ifaceHierarchies));
+    for (const auto& [iface, unit] : expected) {
+      BOOST_TEST(ls.ifaces.contains(iface));
+      BOOST_TEST(ls.ifaces.contains(unit));
+    }
+  }
+
+  for (size_t run {0}; run < 5; ++run) {
+    for (const size_t jobs : {0, 2, 8}) {
+      BOOST_TEST((serial == parse(jobs)));
+    }
+  }
+}
@@ -77,7 +77,7 @@ class Tool : public nmdt::AbstractImportXmlTool<P,R>
 
           LOG_DEBUG << "Iterating over interface hierarchies" << std::endl;
           for (auto& [underlyingIfaceName, virtualIfaceName] : logicalSystem.ifaceHierarchies) {
-            t.exec_prepared("insert_raw_device_interface_hierarchy",
+            nmdu::execPrepared(t, "insert_raw_device_interface_hierarchy",
                 toolRunId,
                 deviceId,
                 underlyingIfaceName,
@@ -105,7 +105,7 @@ class Tool : public nmdt::AbstractImportXmlTool<P,R>
           LOG_DEBUG << "Iterating over DNS search domains:" << std::endl;
           for (auto& dnsSearchDomain : logicalSystem.dnsSearchDomains) {
             LOG_DEBUG << dnsSearchDomain << std::endl;
-            t.exec_prepared("insert_raw_device_dns_search_domain",
+            nmdu::execPrepared(t, "insert_raw_device_dns_search_domain",
                 toolRunId,
                 deviceId,
                 dnsSearchDomain);
@@ -140,7 +140,7 @@ class Tool : public nmdt::AbstractImportXmlTool<P,R>
         // Insert virtualization relationship after all devices have been inserted.
         for (auto& [logicalSystemName, logicalSystem] : result.logicalSystems) {
           if (!logicalSystemName.empty()) {
-            t.exec_prepared("insert_raw_device_virtualization",
+            nmdu::execPrepared(t, "insert_raw_device_virtualization",
                 toolRunId,
                 baseDeviceId,
                 baseDeviceId + ":" + logicalSystemName);
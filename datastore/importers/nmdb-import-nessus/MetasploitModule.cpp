@@ -44,14 +44,14 @@ MetasploitModule::save( pqxx::transaction_base& t
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared("insert_raw_nessus_result_metasploit_module"
-                 , toolRunId
-                 , port.getIpAddress().toString()
-                 , port.getProtocol()
-                 , port.getPort()
-                 , pluginId
-                 , name
-                 );
+  nmdu::execPrepared(t, "insert_raw_nessus_result_metasploit_module"
+                      , toolRunId
+                      , port.getIpAddress().toString()
+                      , port.getProtocol()
+                      , port.getPort()
+                      , pluginId
+                      , name
+                      );
 }
 
 std::string
@@ -45,20 +45,20 @@ NessusResult::save( pqxx::transaction_base& t
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared( "insert_raw_nessus_result"
-                 , toolRunId
-                 , port.getIpAddress().toString()
-                 , port.getProtocol()
-                 , port.getPort()
-                 , pluginId
-                 , pluginName
-                 , pluginFamily
-                 , pluginType
-                 , pluginOutput
-                 , severity
-                 , description
-                 , solution
-                 );
+  nmdu::execPrepared(t, "insert_raw_nessus_result"
+                      , toolRunId
+                      , port.getIpAddress().toString()
+                      , port.getProtocol()
+                      , port.getPort()
+                      , pluginId
+                      , pluginName
+                      , pluginFamily
+                      , pluginType
+                      , pluginOutput
+                      , severity
+                      , description
+                      , solution
+                      );
 }
 
 std::string
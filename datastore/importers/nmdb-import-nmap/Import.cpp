@@ -0,0 +1,145 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include "Import.hpp"
+
+
+namespace netmeld::datastore::importers::nmap {
+
+  class Import : public nmdt::InProcessImport
+  {
+    private:
+      Data data;
+
+    public:
+      bool
+      parse(const sfs::path& dataPath) override
+      {
+        pugi::xml_document doc;
+        if (!doc.load_file(dataPath.string().c_str())) {
+          LOG_ERROR << "Could not open XML: " << dataPath.string()
+                    << std::endl;
+          return false;
+        }
+
+        pugi::xml_node const nmapNode = doc.select_node("/nmaprun").node();
+        if (!nmapNode) {
+          LOG_ERROR << "Could not find XML element: /nmaprun" << std::endl;
+          return false;
+        }
+
+        ParserNmapXml nxp;
+        nxp.extractMacAndIpAddrs(nmapNode, data);
+        nxp.extractHostnames(nmapNode, data);
+        nxp.extractOperatingSystems(nmapNode, data);
+        nxp.extractTraceRoutes(nmapNode, data);
+        nxp.extractPortsAndServices(nmapNode, data);
+        nxp.extractNseAndSsh(nmapNode, data);
+
+        return true;
+      }
+
+      void
+      save(pqxx::transaction_base& t, const nmco::Uuid& toolRunId,
+           const std::string&) override
+      {
+        saveData(t, data, toolRunId, nmdo::IpAddress::getIpv4Default());
+      }
+  };
+
+
+  void
+  saveData(pqxx::transaction_base& t, Data& results,
+           const nmco::Uuid& toolRunId, const nmdo::IpAddress& scanOriginIp)
+  {
+    LOG_DEBUG << "Iterating over macAddrs\n";
+    for (auto& result : results.macAddrs) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over ipAddrs\n";
+    for (auto& result : results.ipAddrs) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over oses\n";
+    for (auto& result : results.oses) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over tracerouteHops\n";
+    for (auto& result : results.tracerouteHops) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over ports\n";
+    for (auto& result : results.ports) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toDebugString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over services\n";
+    for (auto& result : results.services) {
+      if (scanOriginIp.isValid()) {
+        result.setSrcAddress(scanOriginIp);
+      }
+      LOG_DEBUG << result.toDebugString() << std::endl;
+      result.save(t, toolRunId, "");
+    }
+
+    LOG_DEBUG << "Iterating over nseResults\n";
+    for (auto& result : results.nseResults) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over sshKeys\n";
+    for (auto& result : results.sshKeys) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over sshAlgorithms\n";
+    for (auto& result : results.sshAlgorithms) {
+      result.save(t, toolRunId, "");
+      LOG_DEBUG << result.toString() << std::endl;
+    }
+
+    LOG_DEBUG << "Iterating over Observations\n";
+    results.observations.save(t, toolRunId, "");
+    LOG_DEBUG << results.observations.toDebugString() << '\n';
+  }
+
+  void
+  registerImport(nmdt::ImportRegistry& registry)
+  {
+    registry.add<Import>("nmap");
+  }
+}
@@ -0,0 +1,48 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef NMAP_IMPORT_HPP
+#define NMAP_IMPORT_HPP
+
+#include <netmeld/datastore/objects/IpAddress.hpp>
+#include <netmeld/datastore/tools/ImportRegistry.hpp>
+
+#include "ParserNmapXml.hpp"
+
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdt = netmeld::datastore::tools;
+
+
+namespace netmeld::datastore::importers::nmap {
+  // Save one parsed scan, marking services as seen from the scan origin
+  void saveData(pqxx::transaction_base&, Data&, const nmco::Uuid&,
+                const nmdo::IpAddress&);
+
+  // Make this importer available to composite tools (e.g., nmdb-import-clw)
+  // as "nmap", without spawning a separate process
+  void registerImport(nmdt::ImportRegistry&);
+}
+#endif // NMAP_IMPORT_HPP
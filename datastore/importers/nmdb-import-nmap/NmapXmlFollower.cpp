@@ -0,0 +1,148 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include "NmapXmlFollower.hpp"
+
+namespace {
+  // Whether the text starts with the named element's start tag, given it
+  // contains at least that tag's closing '>'
+  bool
+  isElement(std::string_view text, std::string_view name)
+  {
+    if (!text.starts_with('<') || !text.substr(1).starts_with(name)) {
+      return false;
+    }
+    const char next {text.at(name.size() + 1)};
+    return ' ' == next || '>' == next || '/' == next
+        || '\n' == next || '\t' == next || '\r' == next;
+  }
+}
+
+// =============================================================================
+// Constructors
+// =============================================================================
+NmapXmlFollower::NmapXmlFollower()
+{}
+
+
+// =============================================================================
+// Methods
+// =============================================================================
+void
+NmapXmlFollower::append(std::string_view text)
+{
+  buffer.append(text);
+}
+
+std::vector<std::string>
+NmapXmlFollower::takeHostDocuments()
+{
+  std::vector<std::string> documents;
+
+  size_t offset {0};
+  if (!isStarted) {
+    const auto start {buffer.find("<nmaprun")};
+    const auto end   {buffer.find('>', start)};
+    if (std::string::npos == end) {
+      return documents;
+    }
+    header    = buffer.substr(start, end + 1 - start);
+    isStarted = true;
+    offset    = end + 1;
+  }
+
+  // Consume complete top level elements, stopping at the first partial one
+  while (!isFinished) {
+    const auto tagStart {buffer.find('<', offset)};
+    if (std::string::npos == tagStart
+        || std::string::npos == buffer.find('>', tagStart))
+    {
+      break;
+    }
+    const std::string_view tag {std::string_view(buffer).substr(tagStart)};
+
+    std::string_view endMarker {">"};
+    if (tag.starts_with("<!--")) {
+      endMarker = "-->";
+    } else if (isElement(tag, "host")) {
+      endMarker = "</host>";
+    } else if (isElement(tag, "runstats")) {
+      endMarker = "</runstats>";
+    }
+
+    const auto tagEnd {buffer.find(endMarker, tagStart)};
+    if (std::string::npos == tagEnd) {
+      break;
+    }
+    const auto next {tagEnd + endMarker.size()};
+    const std::string element {buffer.substr(tagStart, next - tagStart)};
+
+    if (isElement(tag, "host")) {
+      documents.push_back(toDocument(element));
+    } else if (isElement(tag, "scaninfo")) {
+      header += element;
+    } else if (isElement(tag, "runstats")) {
+      runstats = element;
+    } else if (tag.starts_with("</nmaprun")) {
+      isFinished = true;
+    }
+
+    offset = next;
+  }
+  buffer.erase(0, offset);
+
+  return documents;
+}
+
+bool
+NmapXmlFollower::hasStarted() const
+{
+  return isStarted;
+}
+
+bool
+NmapXmlFollower::hasFinished() const
+{
+  return isFinished;
+}
+
+std::string
+NmapXmlFollower::getStartDocument() const
+{
+  return toDocument("");
+}
+
+std::string
+NmapXmlFollower::getFinishDocument() const
+{
+  return toDocument(runstats);
+}
+
+std::string
+NmapXmlFollower::toDocument(const std::string& element) const
+{
+  return header + element + "</nmaprun>";
+}
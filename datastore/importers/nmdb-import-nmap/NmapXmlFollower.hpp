@@ -0,0 +1,93 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef NMAP_XML_FOLLOWER_HPP
+#define NMAP_XML_FOLLOWER_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+// =============================================================================
+// Follower definition
+// =============================================================================
+/* Splits Nmap XML output, as it is being written, into standalone documents.
+
+   Each completed `<host>` becomes its own `<nmaprun>` document, with the
+   scan's `<nmaprun>` attributes and `<scaninfo>` elements, so it can be
+   handed to ParserNmapXml as soon as Nmap finishes writing it.
+ */
+class NmapXmlFollower
+{
+  // ===========================================================================
+  // Variables
+  // ===========================================================================
+  private:
+    std::string buffer;     // Text read, but not yet consumed
+    std::string header;     // `<nmaprun>` start tag and `<scaninfo>` elements
+    std::string runstats;   // `<runstats>` element, once written
+
+    bool        isStarted   {false};
+    bool        isFinished  {false};
+
+  protected:
+  public:
+
+  // ===========================================================================
+  // Constructors
+  // ===========================================================================
+  private:
+  protected:
+  public:
+    NmapXmlFollower();
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  private:
+    std::string toDocument(const std::string&) const;
+
+  protected:
+  public:
+    // Add text newly written to the XML file
+    void append(std::string_view);
+
+    // Documents for the hosts completed since the last call
+    std::vector<std::string> takeHostDocuments();
+
+    // Whether the `<nmaprun>` start tag has been read
+    bool hasStarted() const;
+    // Whether the `</nmaprun>` end tag has been read
+    bool hasFinished() const;
+
+    // Documents of the scan's start (`<nmaprun>` and `<scaninfo>`) and, once
+    // finished, its end (`<runstats>`), for ParserNmapXml's timing
+    std::string getStartDocument() const;
+    std::string getFinishDocument() const;
+};
+
+#endif // NMAP_XML_FOLLOWER_HPP
@@ -0,0 +1,129 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include "NmapXmlFollower.hpp"
+
+const std::string XML_START {
+    R"STR(<?xml version="1.0" encoding="UTF-8"?>)STR" "\n"
+    R"STR(<!DOCTYPE nmaprun>)STR" "\n"
+    R"STR(<!-- Nmap 7.94 scan initiated as: nmap -oX scan.xml 1.2.3.0/30 -->)STR"
+    "\n"
+    R"STR(<nmaprun scanner="nmap" start="1598302716">)STR" "\n"
+    R"STR(<scaninfo type="syn" protocol="tcp"/>)STR" "\n"
+    R"STR(<verbose level="0"/>)STR" "\n"
+  };
+const std::string XML_HOST1 {
+    R"STR(<hosthint><status state="up"/><address addr="1.2.3.1"/></hosthint>)STR"
+    "\n"
+    R"STR(<host starttime="1598302720"><status state="up"/>)STR"
+    R"STR(<address addr="1.2.3.1" addrtype="ipv4"/><hostnames>)STR"
+    R"STR(<hostname name="a"/></hostnames></host>)STR" "\n"
+  };
+const std::string XML_HOST2 {
+    R"STR(<host><address addr="1.2.3.2" addrtype="ipv4"/></host>)STR" "\n"
+  };
+const std::string XML_END {
+    R"STR(<runstats><finished time="1598303089"/></runstats>)STR" "\n"
+    R"STR(</nmaprun>)STR" "\n"
+  };
+
+BOOST_AUTO_TEST_CASE(testWhole)
+{
+  NmapXmlFollower follower;
+  follower.append(XML_START + XML_HOST1 + XML_HOST2 + XML_END);
+
+  const auto& documents {follower.takeHostDocuments()};
+  BOOST_TEST(follower.hasStarted());
+  BOOST_TEST(follower.hasFinished());
+
+  const std::string header {
+      R"STR(<nmaprun scanner="nmap" start="1598302716">)STR"
+      R"STR(<scaninfo type="syn" protocol="tcp"/>)STR"
+    };
+  BOOST_TEST(2 == documents.size());
+  BOOST_TEST(header
+             + R"STR(<host starttime="1598302720"><status state="up"/>)STR"
+               R"STR(<address addr="1.2.3.1" addrtype="ipv4"/><hostnames>)STR"
+               R"STR(<hostname name="a"/></hostnames></host>)STR"
+             + "</nmaprun>"
+             == documents.at(0));
+  BOOST_TEST(header
+             + R"STR(<host><address addr="1.2.3.2" addrtype="ipv4"/></host>)STR"
+             + "</nmaprun>"
+             == documents.at(1));
+
+  BOOST_TEST(header + "</nmaprun>" == follower.getStartDocument());
+  BOOST_TEST(header
+             + R"STR(<runstats><finished time="1598303089"/></runstats>)STR"
+             + "</nmaprun>"
+             == follower.getFinishDocument());
+}
+
+BOOST_AUTO_TEST_CASE(testGrowing)
+{
+  const std::string xml {XML_START + XML_HOST1 + XML_HOST2 + XML_END};
+  const std::string end {"</nmaprun>"};
+  const auto finishedAt {xml.rfind(end) + end.size()};
+
+  // Any split point must give the same hosts, once everything is written
+  for (size_t i {0}; i <= xml.size(); ++i) {
+    NmapXmlFollower follower;
+    std::vector<std::string> documents;
+
+    follower.append(xml.substr(0, i));
+    for (const auto& document : follower.takeHostDocuments()) {
+      documents.push_back(document);
+    }
+    BOOST_TEST((finishedAt <= i) == follower.hasFinished());
+
+    follower.append(xml.substr(i));
+    for (const auto& document : follower.takeHostDocuments()) {
+      documents.push_back(document);
+    }
+    BOOST_TEST(follower.hasFinished());
+    BOOST_TEST(2 == documents.size(), "split at " << i);
+  }
+
+  {
+    NmapXmlFollower follower;
+    follower.append(XML_START.substr(0, XML_START.find("<nmaprun") + 5));
+    BOOST_TEST(follower.takeHostDocuments().empty());
+    BOOST_TEST(!follower.hasStarted());
+
+    follower.append(XML_START.substr(XML_START.find("<nmaprun") + 5));
+    follower.append(XML_HOST1.substr(0, XML_HOST1.size() - 9));
+    BOOST_TEST(follower.takeHostDocuments().empty());
+    BOOST_TEST(follower.hasStarted());
+
+    follower.append(XML_HOST1.substr(XML_HOST1.size() - 9));
+    BOOST_TEST(1 == follower.takeHostDocuments().size());
+    BOOST_TEST(follower.takeHostDocuments().empty());
+  }
+}
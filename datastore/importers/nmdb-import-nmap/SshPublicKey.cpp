@@ -47,7 +47,7 @@ SshPublicKey::save(pqxx::transaction_base& t,
 
   port.save(t, toolRunId, deviceId);
 
-  t.exec_prepared("insert_raw_ssh_host_public_key",
+  nmdu::execPrepared(t, "insert_raw_ssh_host_public_key",
       toolRunId,
       port.getIpAddress().toString(),
       port.getProtocol(),
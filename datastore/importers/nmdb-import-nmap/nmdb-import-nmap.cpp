@@ -24,7 +24,11 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <array>
+#include <chrono>
+#include <fstream>
 #include <regex>
+#include <thread>
 
 #include <pugixml.hpp>
 
@@ -32,12 +36,15 @@
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
 
+#include "Import.hpp"
+#include "NmapXmlFollower.hpp"
 #include "ParserNmapXml.hpp"
 
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
 namespace nmdu = netmeld::datastore::utils;
+namespace nmdsin = netmeld::datastore::importers::nmap;
 
 
 template<typename P, typename R>
@@ -66,6 +73,29 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
           po::value<std::string>(),
           "IP address of device where Nmap scan originated")
         );
+
+      this->opts.addOptionalOption("follow", std::make_tuple(
+          "follow",
+          NULL_SEMANTIC,
+          "Follow an XML file Nmap is still writing, committing each host"
+          " as it completes, until the scan finishes")
+        );
+      this->opts.addAdvancedOption("follow-idle", std::make_tuple(
+          "follow-idle",
+          po::value<size_t>()->default_value(0),
+          "With --follow, give up after this many seconds without new"
+          " output.  0 waits indefinitely.")
+        );
+    }
+
+    int
+    runTool() override
+    {
+      if (!this->opts.exists("follow")) {
+        return nmdt::AbstractImportSpiritTool<P,R>::runTool();
+      }
+
+      return followData();
     }
 
     void
@@ -111,78 +141,165 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
     void
     specificInserts(pqxx::transaction_base& t) override
     {
-      const auto& toolRunId {this->getToolRunId()};
-
       for (auto& results : this->tResults) {
-        LOG_DEBUG << "Iterating over macAddrs\n";
-        for (auto& result : results.macAddrs) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+        saveData(t, results);
+      }
+    }
 
-        LOG_DEBUG << "Iterating over ipAddrs\n";
-        for (auto& result : results.ipAddrs) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+  private:
+    void
+    saveData(pqxx::transaction_base& t, Data& results)
+    {
+      const auto& scanOriginIp {
+        this->opts.exists("scan-origin-ip")
+          ? this->opts.template getValueAs<nmdo::IpAddress>("scan-origin-ip")
+          : nmdo::IpAddress::getIpv4Default()
+      };
 
-        LOG_DEBUG << "Iterating over oses\n";
-        for (auto& result : results.oses) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
-        }
+      nmdsin::saveData(t, results, this->getToolRunId(), scanOriginIp);
+    }
 
-        LOG_DEBUG << "Iterating over tracerouteHops\n";
-        for (auto& result : results.tracerouteHops) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
+    // Import hosts as Nmap writes them, each poll's batch in its own
+    // transaction (saved via insertResults(), as for a whole file), all
+    // under the same tool run
+    int
+    followData()
+    {
+      this->profilePhase("startup");
+      this->setToolRunId();
+
+      const sfs::path dataPath {this->opts.getValue("data-path")};
+      const std::chrono::seconds maxIdle
+        {this->opts.template getValueAs<size_t>("follow-idle")};
+      const std::chrono::seconds pollDelay {1};
+
+      auto lastActive {std::chrono::steady_clock::now()};
+      auto isIdle = [&](){
+        return 0 < maxIdle.count()
+            && maxIdle < std::chrono::steady_clock::now() - lastActive;
+      };
+
+      std::ifstream in;
+      while (!in.is_open()) {
+        in.open(dataPath, std::ios::binary);
+        if (!in.is_open()) {
+          if (isIdle()) {
+            LOG_ERROR << "Could not open XML: " << dataPath.string()
+                      << std::endl;
+            return nmcu::Exit::FAILURE;
+          }
+          std::this_thread::sleep_for(pollDelay);
         }
-
-        LOG_DEBUG << "Iterating over ports\n";
-        for (auto& result : results.ports) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toDebugString() << std::endl;
+      }
+      this->dataPath = sfs::canonical(dataPath);
+
+      pqxx::connection db {this->getDbConnectString()};
+      nmdu::dbPrepareCommon(db);
+      this->profilePhase("connect");
+
+      NmapXmlFollower follower;
+      bool isToolRunSaved {false};
+      size_t hostCount {0};
+      std::array<char, 65536> chunk;
+      while (!follower.hasFinished()) {
+        while (in.read(chunk.data(), chunk.size()) || 0 < in.gcount()) {
+          follower.append({chunk.data(), static_cast<size_t>(in.gcount())});
+          lastActive = std::chrono::steady_clock::now();
         }
-
-        LOG_DEBUG << "Iterating over services\n";
-        const auto& scanOriginIp {
-          this->opts.exists("scan-origin-ip")
-            ? this->opts.template getValueAs<nmdo::IpAddress>("scan-origin-ip")
-            : nmdo::IpAddress::getIpv4Default()
-        };
-        for (auto& result : results.services) {
-          if (scanOriginIp.isValid()) {
-            result.setSrcAddress(scanOriginIp);
+        in.clear(); // Clear EOF, to read what is written next
+
+        const auto& documents {follower.takeHostDocuments()};
+        if (!follower.hasStarted()
+            || (documents.empty() && !follower.hasFinished()))
+        {
+          if (isIdle()) {
+            LOG_WARN << "No new Nmap output in " << maxIdle.count()
+                     << " seconds, stopping" << std::endl;
+            break;
           }
-          LOG_DEBUG << result.toDebugString() << std::endl;
-          result.save(t, toolRunId, "");
+          std::this_thread::sleep_for(pollDelay);
+          continue;
         }
 
-        LOG_DEBUG << "Iterating over nseResults\n";
-        for (auto& result : results.nseResults) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toString() << std::endl;
+        this->profilePhase("follow-wait");
+        if (!isToolRunSaved) {
+          readExecutionTiming(follower.getStartDocument());
         }
 
-        LOG_DEBUG << "Iterating over sshKeys\n";
-        for (auto& result : results.sshKeys) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toString() << std::endl;
+        this->tResults.clear();
+        for (const auto& document : documents) {
+          pugi::xml_document doc;
+          if (!doc.load_string(document.c_str())) {
+            LOG_WARN << "Skipping unparsable host XML: " << document
+                     << std::endl;
+            continue;
+          }
+          const auto& nmapNode {doc.child("nmaprun")};
+
+          ParserNmapXml nxp;
+          Data data;
+          nxp.extractMacAndIpAddrs(nmapNode, data);
+          nxp.extractHostnames(nmapNode, data);
+          nxp.extractOperatingSystems(nmapNode, data);
+          nxp.extractTraceRoutes(nmapNode, data);
+          nxp.extractPortsAndServices(nmapNode, data);
+          nxp.extractNseAndSsh(nmapNode, data);
+          this->tResults.push_back(data);
         }
-
-        LOG_DEBUG << "Iterating over sshAlgorithms\n";
-        for (auto& result : results.sshAlgorithms) {
-          result.save(t, toolRunId, "");
-          LOG_DEBUG << result.toString() << std::endl;
+        this->profilePhase("parse");
+
+        // As a whole file import would, so the same write options apply
+        pqxx::work t {db};
+        this->insertResults(t, !isToolRunSaved);
+        isToolRunSaved = true;
+        hostCount += documents.size();
+
+        // Extend the tool run to now (or the scan's finish), so it covers
+        // the new hosts
+        this->executionStop = nmco::Time();
+        if (follower.hasFinished()) {
+          readExecutionTiming(follower.getFinishDocument());
         }
-
-        LOG_DEBUG << "Iterating over Observations\n";
-        results.observations.save(t, toolRunId, "");
-        LOG_DEBUG << results.observations.toDebugString() << '\n';
+        t.exec_prepared("update_tool_run", this->getToolRunId(),
+                        this->executionStart, this->executionStop);
+        this->profileBatch(t);
+        t.commit();
+        this->profilePhase("commit");
+
+        LOG_DEBUG << "Committed " << documents.size() << " hosts ("
+                  << hostCount << " total)\n";
       }
+      this->profilePhase("follow-wait");
+      nmdu::ParseCacheStats::logStats();
+
+      if (!isToolRunSaved) {
+        LOG_WARN << "Parsed data contained no storable information.\n";
+      } else {
+        this->profileCommitted(this->getToolRunId());
+        if (!this->opts.exists("tool-run-id")) {
+          LOG_INFO << "tool-run-id: " << this->getToolRunId() << '\n';
+        }
+      }
+
+      return nmcu::Exit::SUCCESS;
     }
 
-  private:
+    void
+    readExecutionTiming(const std::string& document)
+    {
+      pugi::xml_document doc;
+      doc.load_string(document.c_str());
+
+      ParserNmapXml nxp;
+      const auto& [start, stop]
+        {nxp.extractExecutionTiming(doc.child("nmaprun"))};
+      if (!start.empty()) {
+        this->executionStart.readUnixTimestamp(start);
+      }
+      if (!stop.empty()) {
+        this->executionStop.readUnixTimestamp(stop);
+      }
+    }
 };
 
 
@@ -42,6 +42,135 @@ namespace nmdp = netmeld::datastore::parsers;
 namespace nmdu = netmeld::datastore::utils;
 
 
+namespace {
+  // XPath expressions are compiled once, instead of on every select call.
+  // Compiled queries are read-only when evaluated, so they are safe to share
+  // between the threads parsing independent subtrees.
+  namespace xq {
+    const pugi::xpath_query action {"action"};
+    const pugi::xpath_query address {"address"};
+    const pugi::xpath_query addressEntry {"//address/entry"};
+    const pugi::xpath_query addressGroup {"address-group"};
+    const pugi::xpath_query defaultSecurityRules {
+        "default-security-rules/rules"
+      };
+    const pugi::xpath_query destination {"destination"};
+    const pugi::xpath_query destinationMember {"destination/member"};
+    const pugi::xpath_query deviceconfig {"deviceconfig"};
+    const pugi::xpath_query devicesEntry {"devices/entry"};
+    const pugi::xpath_query dnsServers {"system/dns-setting/servers/*"};
+    const pugi::xpath_query entry {"entry"};
+    const pugi::xpath_query ethernetEntry {"ethernet/entry"};
+    const pugi::xpath_query ethernetUnitsEntry {
+        "ethernet/entry/layer3/units/entry"
+      };
+    const pugi::xpath_query fqdn {"fqdn"};
+    const pugi::xpath_query fromMember {"from/member"};
+    const pugi::xpath_query importInterfaceMember {
+        "import/network/interface/member"
+      };
+    const pugi::xpath_query interface {"interface"};
+    const pugi::xpath_query interfaceMember {"interface/member"};
+    const pugi::xpath_query ipEntry {"(ip/entry)|(ipv6/entry)"};
+    const pugi::xpath_query ipNetmask {"ip-netmask"};
+    const pugi::xpath_query layer3Member {"network/layer3/member"};
+    const pugi::xpath_query loopback {"loopback"};
+    const pugi::xpath_query membersMember {"members/member"};
+    const pugi::xpath_query metric {"metric"};
+    const pugi::xpath_query networkInterface {"network/interface"};
+    const pugi::xpath_query networkVirtualRouter {"network/virtual-router"};
+    const pugi::xpath_query nexthop {
+        "(nexthop/ip-address)|"
+        "(nexthop/ipv6-address)"
+      };
+    const pugi::xpath_query ntpServerAddress {"ntp-server-address"};
+    const pugi::xpath_query ntpServers {"system/ntp-servers/*"};
+    const pugi::xpath_query parentDeviceconfig {"../../deviceconfig"};
+    const pugi::xpath_query port {"port"};
+    const pugi::xpath_query protocolChild {"protocol/child::*"};
+    const pugi::xpath_query ruleType {"rule-type"};
+    const pugi::xpath_query rulebase {"rulebase"};
+    const pugi::xpath_query securityRules {"security/rules"};
+    const pugi::xpath_query service {"service"};
+    const pugi::xpath_query serviceGroup {"service-group"};
+    const pugi::xpath_query serviceMember {"service/member"};
+    const pugi::xpath_query shared {"/config/shared"};
+    const pugi::xpath_query sourceMember {"source/member"};
+    const pugi::xpath_query staticMember {"static/member"};
+    const pugi::xpath_query staticRouteEntry {
+        "(routing-table/ip/static-route/entry)|"
+        "(routing-table/ipv6/static-route/entry)"
+      };
+    const pugi::xpath_query systemDomain {"system/domain"};
+    const pugi::xpath_query toMember {"to/member"};
+    const pugi::xpath_query tunnelUnitsEntry {"tunnel/units/entry"};
+    const pugi::xpath_query vsys {"vsys"};
+    const pugi::xpath_query zone {"zone"};
+  }
+
+  // True if `a` is before `b` in document order
+  bool
+  precedes(const pugi::xml_node& a, const pugi::xml_node& b)
+  {
+    std::vector<pugi::xml_node> aPath, bPath;
+    for (auto node {a}; node; node = node.parent()) {
+      aPath.push_back(node);
+    }
+    for (auto node {b}; node; node = node.parent()) {
+      bPath.push_back(node);
+    }
+
+    auto aIt {aPath.rbegin()};
+    auto bIt {bPath.rbegin()};
+    while (aIt != aPath.rend() && bIt != bPath.rend() && *aIt == *bIt) {
+      ++aIt;
+      ++bIt;
+    }
+    if (aIt == aPath.rend()) { return true; }   // `a` is an ancestor
+    if (bIt == bPath.rend()) { return false; }  // `b` is an ancestor
+
+    for (auto node {*aIt}; node; node = node.next_sibling()) {
+      if (node == *bIt) { return true; }
+    }
+    return false;
+  }
+
+  template<typename T>
+  void
+  mergeWithWarning(T& into, T& from, const std::string& type)
+  {
+    into.merge(from);
+    for (const auto& [conflictName, conflict] : from) {
+      LOG_WARN << type << " merge conflict: " << conflictName << std::endl;
+    }
+  }
+
+  template<typename T>
+  void
+  append(std::vector<T>& into, const std::vector<T>& from)
+  {
+    into.insert(into.end(), from.begin(), from.end());
+  }
+
+  void
+  mergeLogicalSystem(LogicalSystem& into, LogicalSystem& from)
+  {
+    if (into.name.empty()) {
+      into.name = from.name;
+    }
+    mergeWithWarning(into.ifaces, from.ifaces, "ifaces");
+    mergeWithWarning(into.vrfs, from.vrfs, "vrfs");
+    append(into.services, from.services);
+    append(into.dnsResolvers, from.dnsResolvers);
+    append(into.dnsSearchDomains, from.dnsSearchDomains);
+    mergeWithWarning(into.aclZones, from.aclZones, "aclZones");
+    mergeWithWarning(into.aclIpNetSets, from.aclIpNetSets, "aclIpNetSets");
+    append(into.aclServices, from.aclServices);
+    append(into.aclRules, from.aclRules);
+  }
+}
+
+
 Data
 Parser::getData()
 {
@@ -49,6 +178,44 @@ Parser::getData()
 }
 
 
+void
+Parser::setParseJobs(size_t jobs)
+{
+  parseJobs = jobs;
+}
+
+
+const AddressIndex&
+Parser::getAddressIndex(const pugi::xml_node& anyNode)
+{
+  // Built once per document, then shared with any sub-parsers
+  if (!addressIndex || anyNode.root() != addressIndexRoot) {
+    auto index {std::make_shared<AddressIndex>()};
+    for (const auto& entryMatch : anyNode.select_nodes(xq::addressEntry)) {
+      const pugi::xml_node entryNode{entryMatch.node()};
+      auto& ipNetmasks{(*index)[entryNode.attribute("name").value()]};
+      for (const auto& ipNetmaskMatch : entryNode.select_nodes(xq::ipNetmask)) {
+        ipNetmasks.emplace_back(ipNetmaskMatch.node().text().as_string());
+      }
+    }
+    addressIndex = index;
+    addressIndexRoot = anyNode.root();
+  }
+
+  return *addressIndex;
+}
+
+
+void
+Parser::mergeData(Data& other)
+{
+  for (auto& [name, logicalSystem] : other.logicalSystems) {
+    mergeLogicalSystem(data.logicalSystems[name], logicalSystem);
+  }
+  data.observations.merge(other.observations);
+}
+
+
 void
 Parser::parseConfig(const pugi::xml_node& configNode)
 {
@@ -56,41 +223,36 @@ Parser::parseConfig(const pugi::xml_node& configNode)
   auto& logicalSystem{data.logicalSystems[vsysName]};
   logicalSystem.name = vsysName;
 
+  // Resolve the document wide address lookups before splitting the work
+  getAddressIndex(configNode);
+
+  // Each device entry is independent, so parse them in parallel and merge
+  // the results back in document order
+  std::vector<pugi::xml_node> devicesEntryNodes;
   for (const auto& devicesEntryMatch :
-       configNode.select_nodes("devices/entry")) {
-    const pugi::xml_node devicesEntryNode{devicesEntryMatch.node()};
-    //const std::string deviceName {
-    //  devicesEntryNode.attribute("name").value()
-    //};
-
-    for (const auto& deviceconfigMatch :
-         devicesEntryNode.select_nodes("deviceconfig")) {
-      const pugi::xml_node deviceconfigNode{deviceconfigMatch.node()};
-      parseConfigDeviceconfig(deviceconfigNode, logicalSystem);
-    }
-
-    for (const auto& interfaceMatch :
-         devicesEntryNode.select_nodes("network/interface")) {
-      const pugi::xml_node interfaceNode{interfaceMatch.node()};
-      auto parsedIfaces{parseConfigInterface(interfaceNode)};
-      logicalSystem.ifaces.merge(parsedIfaces);
-      for (const auto& [conflictName, conflict] : parsedIfaces) {
-        LOG_WARN << "ifaces merge conflict: " << conflictName << std::endl;
-      }
-    }
+       configNode.select_nodes(xq::devicesEntry)) {
+    devicesEntryNodes.emplace_back(devicesEntryMatch.node());
+  }
 
-    for (const auto& virtualRouterMatch :
-         devicesEntryNode.select_nodes("network/virtual-router")) {
-      const pugi::xml_node virtualRouterNode{virtualRouterMatch.node()};
-      auto parsedVrfs{parseConfigVirtualRouter(virtualRouterNode)};
-      logicalSystem.vrfs.merge(parsedVrfs);
-      for (const auto& [conflictName, conflict] : parsedVrfs) {
-        LOG_WARN << "ifaces merge conflict: " << conflictName << std::endl;
-      }
-    }
+  auto parsedDevices {nmdp::parseInParallel(devicesEntryNodes.size(),
+      parseJobs,
+      [this, &devicesEntryNodes](size_t idx)
+      {
+        Parser parser;
+        parser.addressIndexRoot = addressIndexRoot;
+        parser.addressIndex = addressIndex;
+        auto& deviceSystem{parser.data.logicalSystems[""]};
+        parser.parseConfigDevicesEntry(devicesEntryNodes[idx], deviceSystem);
+        return parser.getData();
+      })};
+  for (auto& deviceData : parsedDevices) {
+    mergeData(deviceData);
+  }
 
+  // Virtual systems import from the now complete base system
+  for (const auto& devicesEntryNode : devicesEntryNodes) {
     for (const auto& vsysMatch :
-         devicesEntryNode.select_nodes("vsys")) {
+         devicesEntryNode.select_nodes(xq::vsys)) {
       const pugi::xml_node vsysNode{vsysMatch.node()};
       parseConfigVsys(vsysNode);
     }
@@ -98,12 +260,42 @@ Parser::parseConfig(const pugi::xml_node& configNode)
 }
 
 
+void
+Parser::parseConfigDevicesEntry(const pugi::xml_node& devicesEntryNode,
+                                LogicalSystem& logicalSystem)
+{
+  //const std::string deviceName {
+  //  devicesEntryNode.attribute("name").value()
+  //};
+
+  for (const auto& deviceconfigMatch :
+       devicesEntryNode.select_nodes(xq::deviceconfig)) {
+    const pugi::xml_node deviceconfigNode{deviceconfigMatch.node()};
+    parseConfigDeviceconfig(deviceconfigNode, logicalSystem);
+  }
+
+  for (const auto& interfaceMatch :
+       devicesEntryNode.select_nodes(xq::networkInterface)) {
+    const pugi::xml_node interfaceNode{interfaceMatch.node()};
+    auto parsedIfaces{parseConfigInterface(interfaceNode)};
+    mergeWithWarning(logicalSystem.ifaces, parsedIfaces, "ifaces");
+  }
+
+  for (const auto& virtualRouterMatch :
+       devicesEntryNode.select_nodes(xq::networkVirtualRouter)) {
+    const pugi::xml_node virtualRouterNode{virtualRouterMatch.node()};
+    auto parsedVrfs{parseConfigVirtualRouter(virtualRouterNode)};
+    mergeWithWarning(logicalSystem.vrfs, parsedVrfs, "vrfs");
+  }
+}
+
+
 void
 Parser::parseConfigDeviceconfig(const pugi::xml_node& deviceconfigNode,
                                 LogicalSystem& logicalSystem)
 {
   for (const auto& dnsServerMatch :
-       deviceconfigNode.select_nodes("system/dns-setting/servers/*")) {
+       deviceconfigNode.select_nodes(xq::dnsServers)) {
     const pugi::xml_node dnsServerNode{dnsServerMatch.node()};
     nmdo::IpAddress dnsServerIpAddr{dnsServerNode.text().as_string()};
     // Service version
@@ -116,17 +308,17 @@ Parser::parseConfigDeviceconfig(const pugi::xml_node& deviceconfigNode,
     logicalSystem.dnsResolvers.emplace_back(dnsResolver);
   }
   for (const auto& dnsDomainMatch :
-       deviceconfigNode.select_nodes("system/domain")) {
+       deviceconfigNode.select_nodes(xq::systemDomain)) {
     const pugi::xml_node dnsDomainNode{dnsDomainMatch.node()};
     const std::string dnsSearchDomain{dnsDomainNode.text().as_string()};
     logicalSystem.dnsSearchDomains.emplace_back(dnsSearchDomain);
   }
 
   for (const auto& ntpServerMatch :
-       deviceconfigNode.select_nodes("system/ntp-servers/*")) {
+       deviceconfigNode.select_nodes(xq::ntpServers)) {
     const pugi::xml_node ntpServerNode{ntpServerMatch.node()};
     for (const auto& ntpServerAddrMatch :
-         ntpServerNode.select_nodes("ntp-server-address")) {
+         ntpServerNode.select_nodes(xq::ntpServerAddress)) {
       const pugi::xml_node ntpServerAddrNode{ntpServerAddrMatch.node()};
       nmdo::IpAddress ntpServerIpAddr{ntpServerAddrNode.text().as_string()};
       nmdo::Service ntpService{nmdu::ServiceFactory::makeNtp()};
@@ -137,99 +329,221 @@ Parser::parseConfigDeviceconfig(const pugi::xml_node& deviceconfigNode,
 }
 
 
+SharedObjects
+Parser::parseConfigShared(const pugi::xml_node& anyNode)
+{
+  SharedObjects shared;
+
+  for (const auto& sharedMatch : anyNode.select_nodes(xq::shared)) {
+    const pugi::xml_node sharedNode{sharedMatch.node()};
+    if (!shared.node) {
+      shared.node = sharedNode;
+    }
+
+    for (const auto& importInterfaceMatch :
+         sharedNode.select_nodes(xq::importInterfaceMember)) {
+      shared.importIfaceNames.emplace_back(
+          importInterfaceMatch.node().text().as_string());
+    }
+    for (const auto& zoneMatch : sharedNode.select_nodes(xq::zone)) {
+      shared.aclZones.emplace_back(parseConfigZone(zoneMatch.node()));
+    }
+    for (const auto& addressMatch : sharedNode.select_nodes(xq::address)) {
+      shared.addresses.emplace_back(parseConfigAddress(addressMatch.node()));
+    }
+    for (const auto& addressGroupMatch :
+         sharedNode.select_nodes(xq::addressGroup)) {
+      shared.addressGroups.emplace_back(
+          parseConfigAddressGroup(addressGroupMatch.node()));
+    }
+    for (const auto& serviceMatch : sharedNode.select_nodes(xq::service)) {
+      shared.services.emplace_back(parseConfigService(serviceMatch.node()));
+    }
+    for (const auto& serviceGroupMatch :
+         sharedNode.select_nodes(xq::serviceGroup)) {
+      shared.serviceGroups.emplace_back(
+          parseConfigServiceGroup(serviceGroupMatch.node()));
+    }
+    for (const auto& rulebaseMatch : sharedNode.select_nodes(xq::rulebase)) {
+      shared.rulebases.emplace_back(rulebaseMatch.node());
+    }
+  }
+
+  return shared;
+}
+
+
 void
 Parser::parseConfigVsys(const pugi::xml_node& vsysNode)
 {
-  for (const auto& entryMatch : vsysNode.select_nodes("entry")) {
-    const pugi::xml_node entryNode{entryMatch.node()};
-    const std::string vsysName{
-      entryNode.attribute("name").value()
-    };
-    auto& baseSystem{data.logicalSystems[""]};
-    auto& logicalSystem{data.logicalSystems[vsysName]};
-    logicalSystem.name = vsysName;
+  // Shared objects are the same for every virtual system, so only resolve
+  // and parse them once
+  const auto shared{parseConfigShared(vsysNode)};
+  const auto& baseSystem{data.logicalSystems[""]};
+
+  // Each virtual system is parsed into its own results, in parallel
+  std::vector<pugi::xml_node> entryNodes;
+  for (const auto& entryMatch : vsysNode.select_nodes(xq::entry)) {
+    entryNodes.emplace_back(entryMatch.node());
+  }
 
-    // Pull in the parent device config.
-    for (const auto& deviceconfigMatch :
-         entryNode.select_nodes("../../deviceconfig")) {
-      const pugi::xml_node deviceconfigNode{deviceconfigMatch.node()};
-      parseConfigDeviceconfig(deviceconfigNode, logicalSystem);
-    }
+  // All are parsed before merging, as they reference the base system
+  auto parsedVsyses {nmdp::parseInParallel(entryNodes.size(), parseJobs,
+      [this, &entryNodes, &baseSystem, &shared](size_t idx)
+      {
+        Parser parser;
+        parser.addressIndexRoot = addressIndexRoot;
+        parser.addressIndex = addressIndex;
+        parser.parseConfigVsysEntry(entryNodes[idx], baseSystem, shared);
+        return parser.getData();
+      })};
+  for (auto& vsysData : parsedVsyses) {
+    mergeData(vsysData);
+  }
+}
 
-    // For each virtual system, parse the child element objects
-    // and also parse any "shared" objects of the same type.
 
-    for (const auto& importInterfaceMatch :
-         entryNode.select_nodes(
-           "(import/network/interface/member)|(/config/shared/import/network/interface/member)")) {
-      const std::string ifaceName{
-        importInterfaceMatch.node().text().as_string()
-      };
+void
+Parser::parseConfigVsysEntry(const pugi::xml_node& entryNode,
+                             const LogicalSystem& baseSystem,
+                             const SharedObjects& shared)
+{
+  const std::string vsysName{
+    entryNode.attribute("name").value()
+  };
+  auto& logicalSystem{data.logicalSystems[vsysName]};
+  logicalSystem.name = vsysName;
+
+  // Pull in the parent device config.
+  for (const auto& deviceconfigMatch :
+       entryNode.select_nodes(xq::parentDeviceconfig)) {
+    const pugi::xml_node deviceconfigNode{deviceconfigMatch.node()};
+    parseConfigDeviceconfig(deviceconfigNode, logicalSystem);
+  }
+
+  // For each virtual system, parse the child element objects
+  // and also apply any "shared" objects of the same type.  These are
+  // applied in document order, as was done when they were selected together.
+  const bool sharedFirst{shared.node && precedes(shared.node, entryNode)};
+
+  auto importIface = [&](const std::string& ifaceName)
+    {
       // Import copy of iface from base system.
       if (baseSystem.ifaces.contains(ifaceName)) {
         logicalSystem.ifaces[ifaceName] = baseSystem.ifaces.at(ifaceName);
       } else {
         LOG_WARN << "baseSystem does not contain interface: " << ifaceName << std::endl;
       }
-    }
+    };
+  if (sharedFirst) {
+    std::for_each(shared.importIfaceNames.begin(),
+                  shared.importIfaceNames.end(), importIface);
+  }
+  for (const auto& importInterfaceMatch :
+       entryNode.select_nodes(xq::importInterfaceMember)) {
+    importIface(importInterfaceMatch.node().text().as_string());
+  }
+  if (!sharedFirst) {
+    std::for_each(shared.importIfaceNames.begin(),
+                  shared.importIfaceNames.end(), importIface);
+  }
 
-    for (const auto& zoneMatch :
-         entryNode.select_nodes("(zone)|(/config/shared/zone)")) {
-      const pugi::xml_node zoneNode{zoneMatch.node()};
-      auto parsedZones{parseConfigZone(zoneNode)};
-      logicalSystem.aclZones.merge(parsedZones);
-      for (const auto& [conflictName, conflict] : parsedZones) {
-        LOG_WARN << "aclZones merge conflict: " << conflictName << std::endl;
-      }
-    }
-    // Due to how intrazone and interzone rules work in Palo Alto,
-    // "any" zones need to be expanded to a list where used.
-    // So don't create an "any" zone in aclZones.
-
-    for (const auto& addressMatch :
-         entryNode.select_nodes("(address)|(/config/shared/address)")) {
-      const pugi::xml_node addressNode{addressMatch.node()};
-      auto parsedAclIpNetSets{parseConfigAddress(addressNode)};
-      logicalSystem.aclIpNetSets.merge(parsedAclIpNetSets);
-      for (const auto& [conflictName, conflict] : parsedAclIpNetSets) {
-        LOG_WARN << "aclIpNetSets merge conflict: " << conflictName << std::endl;
+  auto mergeShared = [&](auto& into, const auto& sharedParsed,
+                         const std::string& type)
+    {
+      for (auto parsed : sharedParsed) {
+        mergeWithWarning(into, parsed, type);
       }
-    }
-    for (const auto& addressGroupMatch :
-         entryNode.select_nodes("(address-group)|(/config/shared/address-group)")) {
-      const pugi::xml_node addressGroupNode{addressGroupMatch.node()};
-      auto parsedAclIpNetSets{parseConfigAddressGroup(addressGroupNode)};
-      logicalSystem.aclIpNetSets.merge(parsedAclIpNetSets);
-      for (const auto& [conflictName, conflict] : parsedAclIpNetSets) {
-        LOG_WARN << "aclIpNetSets merge conflict: " << conflictName << std::endl;
-      }
-    }
-    logicalSystem.aclIpNetSets["any"].setId("any");
-    logicalSystem.aclIpNetSets["any"].addIpNet(nmdo::IpNetwork("0.0.0.0/0"));
-    logicalSystem.aclIpNetSets["any"].addIpNet(nmdo::IpNetwork("::/0"));
+    };
 
-    for (const auto& serviceMatch :
-         entryNode.select_nodes("(service)|(/config/shared/service)")) {
-      const pugi::xml_node serviceNode{serviceMatch.node()};
-      for (const auto& aclService : parseConfigService(serviceNode)) {
-        logicalSystem.aclServices.emplace_back(aclService);
-      }
-    }
-    for (const auto& serviceGroupMatch :
-         entryNode.select_nodes("(service-group)|(/config/shared/service-group)")) {
-      const pugi::xml_node serviceGroupNode{serviceGroupMatch.node()};
-      for (const auto& aclService : parseConfigServiceGroup(serviceGroupNode)) {
-        logicalSystem.aclServices.emplace_back(aclService);
-      }
-    }
+  if (sharedFirst) {
+    mergeShared(logicalSystem.aclZones, shared.aclZones, "aclZones");
+  }
+  for (const auto& zoneMatch : entryNode.select_nodes(xq::zone)) {
+    const pugi::xml_node zoneNode{zoneMatch.node()};
+    auto parsedZones{parseConfigZone(zoneNode)};
+    mergeWithWarning(logicalSystem.aclZones, parsedZones, "aclZones");
+  }
+  if (!sharedFirst) {
+    mergeShared(logicalSystem.aclZones, shared.aclZones, "aclZones");
+  }
+  // Due to how intrazone and interzone rules work in Palo Alto,
+  // "any" zones need to be expanded to a list where used.
+  // So don't create an "any" zone in aclZones.
 
-    for (const auto& rulebaseMatch :
-         entryNode.select_nodes("(rulebase)|(/config/shared/rulebase)")) {
-      const pugi::xml_node rulebaseNode{rulebaseMatch.node()};
-      for (const auto& aclRuleService : parseConfigRulebase(rulebaseNode, logicalSystem)) {
-        logicalSystem.aclRules.emplace_back(aclRuleService);
+  if (sharedFirst) {
+    mergeShared(logicalSystem.aclIpNetSets, shared.addresses, "aclIpNetSets");
+  }
+  for (const auto& addressMatch : entryNode.select_nodes(xq::address)) {
+    const pugi::xml_node addressNode{addressMatch.node()};
+    auto parsedAclIpNetSets{parseConfigAddress(addressNode)};
+    mergeWithWarning(logicalSystem.aclIpNetSets, parsedAclIpNetSets,
+                     "aclIpNetSets");
+  }
+  if (!sharedFirst) {
+    mergeShared(logicalSystem.aclIpNetSets, shared.addresses, "aclIpNetSets");
+  }
+  if (sharedFirst) {
+    mergeShared(logicalSystem.aclIpNetSets, shared.addressGroups,
+                "aclIpNetSets");
+  }
+  for (const auto& addressGroupMatch :
+       entryNode.select_nodes(xq::addressGroup)) {
+    const pugi::xml_node addressGroupNode{addressGroupMatch.node()};
+    auto parsedAclIpNetSets{parseConfigAddressGroup(addressGroupNode)};
+    mergeWithWarning(logicalSystem.aclIpNetSets, parsedAclIpNetSets,
+                     "aclIpNetSets");
+  }
+  if (!sharedFirst) {
+    mergeShared(logicalSystem.aclIpNetSets, shared.addressGroups,
+                "aclIpNetSets");
+  }
+  logicalSystem.aclIpNetSets["any"].setId("any");
+  logicalSystem.aclIpNetSets["any"].addIpNet(nmdo::IpNetwork("0.0.0.0/0"));
+  logicalSystem.aclIpNetSets["any"].addIpNet(nmdo::IpNetwork("::/0"));
+
+  auto appendShared = [&](const auto& sharedParsed)
+    {
+      for (const auto& parsed : sharedParsed) {
+        append(logicalSystem.aclServices, parsed);
       }
-    }
+    };
+
+  if (sharedFirst) {
+    appendShared(shared.services);
+  }
+  for (const auto& serviceMatch : entryNode.select_nodes(xq::service)) {
+    const pugi::xml_node serviceNode{serviceMatch.node()};
+    append(logicalSystem.aclServices, parseConfigService(serviceNode));
+  }
+  if (!sharedFirst) {
+    appendShared(shared.services);
+  }
+  if (sharedFirst) {
+    appendShared(shared.serviceGroups);
+  }
+  for (const auto& serviceGroupMatch :
+       entryNode.select_nodes(xq::serviceGroup)) {
+    const pugi::xml_node serviceGroupNode{serviceGroupMatch.node()};
+    append(logicalSystem.aclServices,
+           parseConfigServiceGroup(serviceGroupNode));
+  }
+  if (!sharedFirst) {
+    appendShared(shared.serviceGroups);
+  }
+
+  // Rules expand against this virtual system's zones, so shared rulebases
+  // are only resolved once but parsed per virtual system
+  std::vector<pugi::xml_node> rulebaseNodes;
+  for (const auto& rulebaseMatch : entryNode.select_nodes(xq::rulebase)) {
+    rulebaseNodes.emplace_back(rulebaseMatch.node());
+  }
+  rulebaseNodes.insert(sharedFirst ? rulebaseNodes.begin()
+                                   : rulebaseNodes.end(),
+                       shared.rulebases.begin(), shared.rulebases.end());
+  for (const auto& rulebaseNode : rulebaseNodes) {
+    append(logicalSystem.aclRules,
+           parseConfigRulebase(rulebaseNode, logicalSystem));
   }
 }
 
@@ -240,7 +554,7 @@ Parser::parseConfigInterface(const pugi::xml_node& interfaceNode)
   std::map<std::string, nmdo::InterfaceNetwork> ifaces;
 
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("loopback")) {
+       interfaceNode.select_nodes(xq::loopback)) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     iface.setMediaType("loopback");
@@ -248,20 +562,20 @@ Parser::parseConfigInterface(const pugi::xml_node& interfaceNode)
   }
 
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("ethernet/entry")) {
+       interfaceNode.select_nodes(xq::ethernetEntry)) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     ifaces[iface.getName()] = iface;
   }
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("ethernet/entry/layer3/units/entry")) {
+       interfaceNode.select_nodes(xq::ethernetUnitsEntry)) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     ifaces[iface.getName()] = iface;
   }
 
   for (const auto& entryMatch :
-       interfaceNode.select_nodes("tunnel/units/entry")) {
+       interfaceNode.select_nodes(xq::tunnelUnitsEntry)) {
     const pugi::xml_node entryNode{entryMatch.node()};
     nmdo::InterfaceNetwork iface{parseConfigInterfaceEntry(entryNode)};
     iface.setMediaType("tunnel");
@@ -286,9 +600,7 @@ Parser::parseConfigInterfaceEntry(const pugi::xml_node& ifaceEntryNode)
   iface.setName(ifaceName);
 
   for (const auto& ipEntryMatch :
-       ifaceEntryNode.select_nodes(
-         "(ip/entry)|"
-         "(ipv6/entry)")) {
+       ifaceEntryNode.select_nodes(xq::ipEntry)) {
     std::string ipName{
       ipEntryMatch.node().attribute("name").value()
     };
@@ -299,12 +611,13 @@ Parser::parseConfigInterfaceEntry(const pugi::xml_node& ifaceEntryNode)
     }
     else {
       bool ipFound{false};
-      for (const auto& ipNetmaskMatch :
-           ifaceEntryNode.select_nodes(
-             ("//address/entry[@name='" + ipName + "']/ip-netmask").c_str())) {
-        nmdo::IpAddress ipAddr{ipNetmaskMatch.node().text().as_string()};
-        iface.addIpAddress(ipAddr);
-        ipFound = true;
+      const auto& index{getAddressIndex(ifaceEntryNode)};
+      if (const auto it{index.find(ipName)}; it != index.end()) {
+        for (const auto& ipNetmask : it->second) {
+          nmdo::IpAddress ipAddr{ipNetmask};
+          iface.addIpAddress(ipAddr);
+          ipFound = true;
+        }
       }
       if (!ipFound) {
         LOG_WARN << "Could not find IP for: " << ipName << std::endl;
@@ -322,7 +635,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
   std::map<std::string, nmdo::Vrf> vrfs;
 
   for (const auto& virtualRouterEntryMatch :
-       virtualRouterNode.select_nodes("entry")) {
+       virtualRouterNode.select_nodes(xq::entry)) {
     const pugi::xml_node virtualRouterEntryNode{virtualRouterEntryMatch.node()};
     const std::string vrfName{
       virtualRouterEntryNode.attribute("name").value()
@@ -330,7 +643,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
     vrfs[vrfName].setId(vrfName);
 
     for (const auto& interfaceMemberMatch :
-         virtualRouterEntryNode.select_nodes("interface/member")) {
+         virtualRouterEntryNode.select_nodes(xq::interfaceMember)) {
       const pugi::xml_node interfaceMemberNode{interfaceMemberMatch.node()};
       const std::string ifaceName{
         interfaceMemberNode.text().as_string()
@@ -339,9 +652,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
     }
 
     for (const auto& staticRouteEntryMatch :
-         virtualRouterEntryNode.select_nodes(
-           "(routing-table/ip/static-route/entry)|"
-           "(routing-table/ipv6/static-route/entry)")) {
+         virtualRouterEntryNode.select_nodes(xq::staticRouteEntry)) {
       const pugi::xml_node staticRouteEntryNode{staticRouteEntryMatch.node()};
       const std::string staticRouteName{
         staticRouteEntryNode.attribute("name").value()
@@ -353,7 +664,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
       route.setDescription(staticRouteName);
 
       const auto destinationMatch{
-        staticRouteEntryNode.select_node("destination")
+        staticRouteEntryNode.select_node(xq::destination)
       };
       if (destinationMatch) {
         const nmdo::IpAddress dstIpNet{destinationMatch.node().text().as_string()};
@@ -361,9 +672,7 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
       }
 
       const auto nextHopIpMatch{
-        staticRouteEntryNode.select_node(
-            "(nexthop/ip-address)|"
-            "(nexthop/ipv6-address)")
+        staticRouteEntryNode.select_node(xq::nexthop)
       };
       if (nextHopIpMatch) {
         const nmdo::IpAddress rtrIpAddr{nextHopIpMatch.node().text().as_string()};
@@ -371,14 +680,14 @@ Parser::parseConfigVirtualRouter(const pugi::xml_node& virtualRouterNode)
       }
 
       const auto interfaceMatch{
-        staticRouteEntryNode.select_node("interface")
+        staticRouteEntryNode.select_node(xq::interface)
       };
       if (interfaceMatch) {
         route.setOutIfaceName(interfaceMatch.node().text().as_string());
       }
 
       const auto metricMatch{
-        staticRouteEntryNode.select_node("metric")
+        staticRouteEntryNode.select_node(xq::metric)
       };
       if (metricMatch) {
         route.setMetric(metricMatch.node().text().as_uint());
@@ -398,7 +707,7 @@ Parser::parseConfigZone(const pugi::xml_node& zoneNode)
   std::map<std::string, nmdo::AclZone> aclZones;
 
   for (const auto& zoneEntryMatch :
-       zoneNode.select_nodes("entry")) {
+       zoneNode.select_nodes(xq::entry)) {
     const pugi::xml_node zoneEntryNode{zoneEntryMatch.node()};
     const std::string zoneName{
       zoneEntryNode.attribute("name").value()
@@ -406,7 +715,7 @@ Parser::parseConfigZone(const pugi::xml_node& zoneNode)
     aclZones[zoneName].setId(zoneName);
 
     for (const auto& memberMatch :
-         zoneEntryNode.select_nodes("network/layer3/member")) {
+         zoneEntryNode.select_nodes(xq::layer3Member)) {
       const pugi::xml_node memberNode{memberMatch.node()};
       const std::string ifaceName{
         memberNode.text().as_string()
@@ -424,19 +733,19 @@ Parser::parseConfigAddress(const pugi::xml_node& addressNode)
 {
   std::map<std::string, nmdo::AclIpNetSet> aclIpNetSets;
 
-  for (const auto& entryMatch : addressNode.select_nodes("entry")) {
+  for (const auto& entryMatch : addressNode.select_nodes(xq::entry)) {
     const pugi::xml_node entryNode{entryMatch.node()};
     const std::string ipNetSetName{
       entryNode.attribute("name").value()
     };
     aclIpNetSets[ipNetSetName].setId(ipNetSetName);
 
-    for (const auto& ipNetmaskMatch : entryNode.select_nodes("ip-netmask")) {
+    for (const auto& ipNetmaskMatch : entryNode.select_nodes(xq::ipNetmask)) {
       const nmdo::IpNetwork ipNet{ipNetmaskMatch.node().text().as_string()};
       aclIpNetSets[ipNetSetName].addIpNet(ipNet);
     }
 
-    for (const auto& fqdnMatch : entryNode.select_nodes("fqdn")) {
+    for (const auto& fqdnMatch : entryNode.select_nodes(xq::fqdn)) {
       const pugi::xml_node fqdnNode{fqdnMatch.node()};
       const std::string dnsName{fqdnNode.text().as_string()};
       data.observations.addNotable("FQDNs are used that must be resolved");
@@ -453,14 +762,14 @@ Parser::parseConfigAddressGroup(const pugi::xml_node& addressGroupNode)
 {
   std::map<std::string, nmdo::AclIpNetSet> aclIpNetSets;
 
-  for (const auto& entryMatch : addressGroupNode.select_nodes("entry")) {
+  for (const auto& entryMatch : addressGroupNode.select_nodes(xq::entry)) {
     const pugi::xml_node entryNode{entryMatch.node()};
     const std::string ipNetSetName{
       entryNode.attribute("name").value()
     };
     aclIpNetSets[ipNetSetName].setId(ipNetSetName);
 
-    for (const auto& memberMatch : entryNode.select_nodes("static/member")) {
+    for (const auto& memberMatch : entryNode.select_nodes(xq::staticMember)) {
       const std::string ipNetName{
         memberMatch.node().text().as_string()
       };
@@ -491,7 +800,7 @@ Parser::parseConfigService(const pugi::xml_node& serviceNode)
   }
 
   for (const auto& serviceEntryMatch :
-       serviceNode.select_nodes("entry")) {
+       serviceNode.select_nodes(xq::entry)) {
     const pugi::xml_node serviceEntryNode{serviceEntryMatch.node()};
     nmdo::AclService aclService;
 
@@ -501,7 +810,7 @@ Parser::parseConfigService(const pugi::xml_node& serviceNode)
     aclService.setId(serviceName);
 
     for (const auto& protocolMatch :
-         serviceEntryNode.select_nodes("protocol/child::*")) {
+         serviceEntryNode.select_nodes(xq::protocolChild)) {
       const pugi::xml_node protocolNode{protocolMatch.node()};
       const std::string protocol{protocolNode.name()};
       aclService.setProtocol(protocol);
@@ -512,7 +821,7 @@ Parser::parseConfigService(const pugi::xml_node& serviceNode)
         aclService.addSrcPortRange(srcPortRange);
       }
 
-      const auto portMatch{protocolNode.select_node("port")};
+      const auto portMatch{protocolNode.select_node(xq::port)};
       if (portMatch) {
         const nmdo::PortRange dstPortRange{
           portMatch.node().text().as_string()
@@ -539,7 +848,7 @@ Parser::parseConfigServiceGroup(const pugi::xml_node& serviceGroupNode)
   std::vector<nmdo::AclService> aclServices;
 
   for (const auto& serviceGroupEntryMatch :
-       serviceGroupNode.select_nodes("entry")) {
+       serviceGroupNode.select_nodes(xq::entry)) {
     const pugi::xml_node serviceGroupEntryNode{serviceGroupEntryMatch.node()};
     nmdo::AclService aclService;
 
@@ -549,7 +858,7 @@ Parser::parseConfigServiceGroup(const pugi::xml_node& serviceGroupNode)
     aclService.setId(serviceGroupName);
 
     for (const auto& memberMatch :
-         serviceGroupEntryNode.select_nodes("members/member")) {
+         serviceGroupEntryNode.select_nodes(xq::membersMember)) {
       const std::string memberName{
         memberMatch.node().text().as_string()
       };
@@ -569,7 +878,7 @@ Parser::parseConfigRulebase(const pugi::xml_node& rulebaseNode,
 {
   std::vector<nmdo::AclRuleService> aclRules;
 
-  for (const auto& rulesMatch : rulebaseNode.select_nodes("security/rules")) {
+  for (const auto& rulesMatch : rulebaseNode.select_nodes(xq::securityRules)) {
     const pugi::xml_node rulesNode{rulesMatch.node()};
     auto aclRulesToAdd = parseConfigRules(rulesNode, 1000000, logicalSystem);
     std::copy(
@@ -579,7 +888,7 @@ Parser::parseConfigRulebase(const pugi::xml_node& rulebaseNode,
         );
   }
 
-  for (const auto& rulesMatch : rulebaseNode.select_nodes("default-security-rules/rules")) {
+  for (const auto& rulesMatch : rulebaseNode.select_nodes(xq::defaultSecurityRules)) {
     const pugi::xml_node rulesNode{rulesMatch.node()};
     auto aclRulesToAdd = parseConfigRules(rulesNode, 2000000, logicalSystem);
     std::copy(
@@ -614,7 +923,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
   std::vector<nmdo::AclRuleService> aclRules;
 
   size_t ruleId{ruleIdBase};
-  for (const auto& rulesEntryMatch : rulesNode.select_nodes("entry")) {
+  for (const auto& rulesEntryMatch : rulesNode.select_nodes(xq::entry)) {
     const pugi::xml_node rulesEntryNode{rulesEntryMatch.node()};
 
     const std::string description{
@@ -623,7 +932,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
 
     std::vector<std::string> ruleTypes;
     for (const auto& ruleTypeMatch :
-         rulesEntryNode.select_nodes("rule-type")) {
+         rulesEntryNode.select_nodes(xq::ruleType)) {
       const std::string ruleType{
         ruleTypeMatch.node().text().as_string()
       };
@@ -643,7 +952,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
 
     std::vector<std::string> incomingZoneIds;
     for (const auto& incomingZoneMatch :
-         rulesEntryNode.select_nodes("from/member")) {
+         rulesEntryNode.select_nodes(xq::fromMember)) {
       const std::string incomingZoneId{
         incomingZoneMatch.node().text().as_string()
       };
@@ -666,7 +975,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
 
     std::vector<std::string> outgoingZoneIds;
     for (const auto& outgoingZoneMatch :
-         rulesEntryNode.select_nodes("to/member")) {
+         rulesEntryNode.select_nodes(xq::toMember)) {
       const std::string outgoingZoneId {
         outgoingZoneMatch.node().text().as_string()
       };
@@ -688,7 +997,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::vector<std::string> srcIpNetSetIds;
-    const auto sourceMatches = rulesEntryNode.select_nodes("source/member");
+    const auto sourceMatches = rulesEntryNode.select_nodes(xq::sourceMember);
     std::transform(sourceMatches.begin(), sourceMatches.end(),
         std::back_inserter(srcIpNetSetIds),
         [](const auto& sourceMatch){return sourceMatch.node().text().as_string();}
@@ -699,7 +1008,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::vector<std::string> dstIpNetSetIds;
-    const auto&destinationMatches = rulesEntryNode.select_nodes("destination/member");
+    const auto&destinationMatches = rulesEntryNode.select_nodes(xq::destinationMember);
     std::transform(destinationMatches.begin(), destinationMatches.end(),
         std::back_inserter(dstIpNetSetIds),
         [](const auto& destinationMatch){return destinationMatch.node().text().as_string();}
@@ -709,7 +1018,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::vector<std::string> serviceIds;
-    const auto& serviceMatches = rulesEntryNode.select_nodes("service/member");
+    const auto& serviceMatches = rulesEntryNode.select_nodes(xq::serviceMember);
     std::transform(serviceMatches.begin(), serviceMatches.end(),
         std::back_inserter(serviceIds),
         [](const auto& serviceMatch){return serviceMatch.node().text().as_string();}
@@ -719,7 +1028,7 @@ Parser::parseConfigRules(const pugi::xml_node& rulesNode, const size_t ruleIdBas
     }
 
     std::string action;
-    auto actionMatch{rulesEntryNode.select_node("action")};
+    auto actionMatch{rulesEntryNode.select_node(xq::action)};
     if (actionMatch) {
       const std::string actionValue{actionMatch.node().text().as_string()};
       // Normalize Palo Alto actions to Netmeld actions.
@@ -46,6 +46,7 @@
 #include <pugixml.hpp>
 
 #include <map>
+#include <memory>
 #include <vector>
 
 namespace nmdo = netmeld::datastore::objects;
@@ -69,6 +70,24 @@ struct LogicalSystem
 };
 
 
+// Objects under /config/shared, resolved once and applied to every vsys
+struct SharedObjects
+{
+  pugi::xml_node node;
+  std::vector<std::string> importIfaceNames;
+  std::vector<std::map<std::string, nmdo::AclZone>> aclZones;
+  std::vector<std::map<std::string, nmdo::AclIpNetSet>> addresses;
+  std::vector<std::map<std::string, nmdo::AclIpNetSet>> addressGroups;
+  std::vector<std::vector<nmdo::AclService>> services;
+  std::vector<std::vector<nmdo::AclService>> serviceGroups;
+  std::vector<pugi::xml_node> rulebases;
+};
+
+
+// Address entry name to its ip-netmask values
+typedef std::map<std::string, std::vector<std::string>> AddressIndex;
+
+
 struct Data
 {
   std::map<std::string, LogicalSystem> logicalSystems;
@@ -84,14 +103,36 @@ class Parser
   protected:
     Data data;
 
+    pugi::xml_node addressIndexRoot;
+    std::shared_ptr<const AddressIndex> addressIndex;
+
+    size_t parseJobs {0};
+
   public:
     Data getData();
 
+    // Parse devices and virtual systems on at most this many (0 = number
+    // of cores) threads
+    void setParseJobs(size_t);
+
   protected:
+    const AddressIndex& getAddressIndex(const pugi::xml_node&);
+
+    void mergeData(Data&);
+
+    void parseConfigDevicesEntry(const pugi::xml_node&, LogicalSystem&);
+
     void parseConfigDeviceconfig(const pugi::xml_node&, LogicalSystem&);
 
+    SharedObjects parseConfigShared(const pugi::xml_node&);
+
     void parseConfigVsys(const pugi::xml_node&);
 
+    void parseConfigVsysEntry( const pugi::xml_node&
+                             , const LogicalSystem&
+                             , const SharedObjects&
+                             );
+
     std::map<std::string, nmdo::InterfaceNetwork>
       parseConfigInterface(const pugi::xml_node&);
 
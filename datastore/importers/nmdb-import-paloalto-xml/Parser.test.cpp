@@ -1120,3 +1120,82 @@ BOOST_AUTO_TEST_CASE(testParseConfig)
   dbgStr = out2.aclRules[0].toDebugString();
   nmdp::testInString(dbgStr, "action: block,");
 }
+
+BOOST_AUTO_TEST_CASE(testParseConfigParallel)
+{
+  // Several devices, each with several virtual systems, so the per device
+  // and per vsys parses can land on different threads
+  std::string xml {"<config><devices>"};
+  for (size_t d {1}; d <= 4; ++d) {
+    xml += std::format(R"(
+          <entry name="dev{0}">
+            <deviceconfig>
+              <system>
+                <dns-setting>
+                  <servers> <primary>10.0.0.{0}</primary> </servers>
+                </dns-setting>
+              </system>
+            </deviceconfig>
+            <network>
+              <interface>
+                <ethernet>
+                  <entry name="eth{0}">
+                    <ip> <entry name="192.168.{0}.1"/> </ip>
+                  </entry>
+                </ethernet>
+              </interface>
+            </network>
+            <vsys>
+              <entry name="vsys{0}a">
+                <import>
+                  <network>
+                    <interface> <member>eth{0}</member> </interface>
+                  </network>
+                </import>
+              </entry>
+              <entry name="vsys{0}b"/>
+            </vsys>
+          </entry>
+      )", d);
+  }
+  xml += "</devices></config>";
+
+  const auto parse = [&xml](size_t jobs)
+  {
+    TestParser tp;
+    tp.setParseJobs(jobs);
+    tp.parseConfig(tp.getFirstNode(xml.c_str()));
+    return tp.getData();
+  };
+
+  const auto serial {parse(1)};
+
+  // Base system parts are merged in device order
+  BOOST_TEST_REQUIRE(serial.logicalSystems.contains(""));
+  const auto& base {serial.logicalSystems.at("")};
+  BOOST_TEST_REQUIRE(4 == base.dnsResolvers.size());
+  for (size_t i {0}; i < base.dnsResolvers.size(); ++i) {
+    nmdp::testInString(base.dnsResolvers[i].toDebugString(),
+        std::format("dstIpAddr: [ipAddress: 10.0.0.{}/32,", i+1));
+  }
+  BOOST_TEST(4 == base.ifaces.size());
+
+  BOOST_TEST(9 == serial.logicalSystems.size());
+  for (size_t d {1}; d <= 4; ++d) {
+    for (const auto& suffix : {"a", "b"}) {
+      const auto name {std::format("vsys{}{}", d, suffix)};
+      BOOST_TEST_REQUIRE(serial.logicalSystems.contains(name));
+      BOOST_TEST(name == serial.logicalSystems.at(name).name);
+    }
+    const auto& vsys {serial.logicalSystems.at(std::format("vsys{}a", d))};
+    BOOST_TEST_REQUIRE(1 == vsys.ifaces.size());
+    BOOST_TEST(vsys.ifaces.contains(std::format("eth{}", d)));
+  }
+
+  // Any number of workers merges to the same result
+  for (size_t run {0}; run < 5; ++run) {
+    for (const size_t jobs : {0, 2, 8}) {
+      BOOST_TEST((serial == parse(jobs)));
+    }
+  }
+}
@@ -0,0 +1,109 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+#define UNIT_TESTING
+#include "nmdb-import-paloalto-xml.cpp"
+
+// Runs the tool as from the command line, stopping after the parse
+class TestTool : public Tool<nmdp::DummyParser, Results>
+{
+  public:
+    using Tool::opts;
+    using Tool::tResults;
+
+    int
+    runTool() override
+    {
+      this->dataPath = sfs::canonical(this->opts.getValue("data-path"));
+      this->parseData();
+      return nmcu::Exit::SUCCESS;
+    }
+};
+
+namespace {
+  sfs::path
+  writeTestFile(const std::string& name, const std::string& data)
+  {
+    const auto path {sfs::temp_directory_path()/("paloalto-xml-" + name)};
+    std::ofstream f {path};
+    f << data;
+    return path;
+  }
+
+  int
+  startTool(TestTool& tt, std::vector<std::string> args)
+  {
+    std::vector<char*> argv;
+    for (auto& arg : args) {
+      argv.push_back(arg.data());
+    }
+    return tt.start(static_cast<int>(argv.size()), argv.data());
+  }
+
+  const std::string CONFIG {
+    R"(<config>
+         <devices>
+           <entry name="localhost.localdomain">
+             <vsys><entry name="vsys1"/></vsys>
+           </entry>
+         </devices>
+       </config>
+    )"};
+}
+
+BOOST_AUTO_TEST_CASE(testParseJobsOption)
+{
+  const auto path {writeTestFile("config.xml", CONFIG)};
+
+  // Registered, with its default, whether given or not
+  {
+    TestTool tt;
+    BOOST_TEST(nmcu::Exit::SUCCESS
+        == startTool(tt, {"nmdb-import-paloalto-xml",
+                          "--device-id", "fw", path.string()}));
+    BOOST_TEST(0 == tt.opts.getValueAs<size_t>("parse-jobs"));
+    BOOST_TEST(1 == tt.tResults.size());
+    BOOST_TEST(tt.tResults.at(0).logicalSystems.contains(""));
+    BOOST_TEST(tt.tResults.at(0).logicalSystems.contains("vsys1"));
+  }
+  {
+    TestTool tt;
+    BOOST_TEST(nmcu::Exit::SUCCESS
+        == startTool(tt, {"nmdb-import-paloalto-xml",
+                          "--device-id", "fw", "--parse-jobs", "1",
+                          path.string()}));
+    BOOST_TEST(1 == tt.opts.getValueAs<size_t>("parse-jobs"));
+    BOOST_TEST(1 == tt.tResults.size());
+  }
+
+  sfs::remove(path);
+}
@@ -47,6 +47,20 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       this->devInfo.setVendor("Palo Alto");
     }
 
+    void
+    addToolOptions() override
+    {
+      nmdt::AbstractImportSpiritTool<P,R>::addToolOptions();
+
+      // Parsed with pugixml directly, so not added by AbstractImportXmlTool
+      this->opts.addAdvancedOption("parse-jobs", std::make_tuple(
+            "parse-jobs",
+            po::value<size_t>()->default_value(0),
+            "Parse independent sections (e.g., devices and virtual systems)"
+            " on up to this many threads; 0 uses one per core, 1 disables.")
+          );
+    }
+
     void
     parseData() override
     {
@@ -67,6 +81,8 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       }
 
       Parser parser;
+      parser.setParseJobs(
+          this->opts.template getValueAs<size_t>("parse-jobs"));
 
       parser.parseConfig(configNode);
 
@@ -122,11 +138,11 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
           LOG_DEBUG << "Iterating over DNS search domains:" << std::endl;
           for (auto& dnsSearchDomain : logicalSystem.dnsSearchDomains) {
             LOG_DEBUG << dnsSearchDomain << std::endl;
-            t.exec_prepared("insert_raw_device_dns_search_domain",
+            nmdu::execPrepared(t, "insert_raw_device_dns_search_domain",
                 toolRunId,
                 deviceId,
                 dnsSearchDomain
-                );
+                     );
           }
 
           LOG_DEBUG << "Iterating over ACL zones:" << std::endl;
@@ -159,10 +175,12 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
 };
 
 
+#ifndef UNIT_TESTING
 int
 main(int argc, char** argv)
 {
   Tool<nmdp::DummyParser, Results> tool;
   return tool.start(argc, argv);
 }
+#endif
 
@@ -26,12 +26,14 @@
 
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/utils/MacVendorTrie.hpp>
 
 #include "Parser.hpp"
 
 namespace nmco = netmeld::core::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
 
 
 template<typename P, typename R>
@@ -72,8 +74,12 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& deviceId  {this->getDeviceId()};
 
+      nmdu::MacVendorTrie vendors;
+      vendors.load(t);
+
       for (auto& results : this->tResults) {
         for (auto& [_, result]: results.macAddrs) {
+          result.setVendor(vendors.lookup(result));
           result.save(t, toolRunId, deviceId);
           LOG_DEBUG << result.toDebugString() << std::endl;
         }
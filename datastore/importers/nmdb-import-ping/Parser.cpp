@@ -26,134 +26,136 @@
 
 #include "Parser.hpp"
 
-// =============================================================================
-// Parser logic
-// =============================================================================
-Parser::Parser() : Parser::base_type(start)
-{
-  start =
-    *(pingLinux | pingWindows | ignoredLine)
-      [(qi::_val = pnx::bind(&Parser::getData, this))]
-    ;
-
-
-  // Linux
-  pingLinux =
-    linuxHeader
-    > *((!linuxFooter) > (linuxResponse | ignoredLine))
-    > linuxFooter
-    ;
-
-  linuxHeader =
-    qi::lit("PING")
-    >> (ipValue | hostname)
-    >> qi::lit('(') >> -(hostname >> qi::lit('(')) >> ipValue >> +qi::lit(')')
-    > +token > qi::eol
-      [(pnx::bind(&Parser::finalize, this))]
-    ;
-
-  linuxResponse =
-    ((qi::uint_ >> qi::lit("bytes from")) | (qi::lit("From")))
-    >> ((ipValue) | (hostname > qi::lit('(') > ipValue > qi::lit(')')))
-    > +token > qi::eol
-      [(pnx::bind(&Parser::responsive, this) = true,
-        pnx::bind(&Parser::finalize, this))]
-    ;
-
-  linuxFooter =
-    qi::lit("---") > +token > qi::eol
-    > qi::uint_ > qi::lit("packets") > +token > -qi::eol
-    > -(qi::lit("rtt") > +token > -qi::eol)
-    ;
-
-
-  // Windows
-  pingWindows =
-    windowsHeader
-    > *((!windowsFooter) > (windowsResponse | ignoredLine))
-    > windowsFooter
-    ;
-
-  windowsHeader =
-    qi::lit("Pinging")
-    > ((ipValue) | (hostname > qi::lit('[') > ipValue > qi::lit(']')))
-    > +token > qi::eol
-      [(pnx::bind(&Parser::finalize, this))]
-    ;
-
-  windowsResponse =
-    qi::lit("Reply from") > ipValue > +token > qi::eol
-      [(pnx::bind(&Parser::responsive, this) = true,
-        pnx::bind(&Parser::finalize, this))]
-    ;
-
-  windowsFooter =
-    qi::lit("Ping statistics") > +token > -qi::eol
-    > -(qi::lit("Packets:") > +token > -qi::eol)
-    > -(qi::lit("Approximate") >+token > -qi::eol)
-    > -(qi::lit("Minimum") > +token > -qi::eol)
-    ;
-
-
-  // General
-  ipValue =
-    ipAddr [(pnx::bind(&Parser::tgtIp, this) = qi::_1)]
-    > -ifaceName
-    ;
-
-  hostname =
-    (!ipAddr) > domainName
-      [(pnx::bind([&](const std::string& val) {tgtAliases.push_back(val);},
-                  qi::_1))]
-    > -ifaceName
-    ;
-
-  ifaceName =
-    qi::lit('%') > +(qi::ascii::alnum | qi::ascii::char_("-_.@"))
-    ;
-
-  token =
-    +qi::ascii::graph
-    ;
-
-  ignoredLine =
-    (+token > -qi::eol) | +qi::eol
-    ;
-
-  BOOST_SPIRIT_DEBUG_NODES(
-      (start)
-      (pingLinux)(linuxHeader)(linuxResponse)(linuxFooter)
-      (pingWindows)(windowsHeader)(windowsResponse)(windowsFooter)
-      (ignoredLine)
-      (ipValue)(hostname)(ifaceName)
-      //(token)
-      );
-}
-
-// =============================================================================
-// Parser helper methods
-// =============================================================================
-void
-Parser::finalize()
-{
-  for (const auto& alias : tgtAliases) {
-    tgtIp.addAlias(alias, REASON);
+namespace netmeld::datastore::importers::ping {
+  // ===========================================================================
+  // Parser logic
+  // ===========================================================================
+  Parser::Parser() : Parser::base_type(start)
+  {
+    start =
+      *(pingLinux | pingWindows | ignoredLine)
+        [(qi::_val = pnx::bind(&Parser::getData, this))]
+      ;
+
+
+    // Linux
+    pingLinux =
+      linuxHeader
+      > *((!linuxFooter) > (linuxResponse | ignoredLine))
+      > linuxFooter
+      ;
+
+    linuxHeader =
+      qi::lit("PING")
+      >> (ipValue | hostname)
+      >> qi::lit('(') >> -(hostname >> qi::lit('(')) >> ipValue >> +qi::lit(')')
+      > +token > qi::eol
+        [(pnx::bind(&Parser::finalize, this))]
+      ;
+
+    linuxResponse =
+      ((qi::uint_ >> qi::lit("bytes from")) | (qi::lit("From")))
+      >> ((ipValue) | (hostname > qi::lit('(') > ipValue > qi::lit(')')))
+      > +token > qi::eol
+        [(pnx::bind(&Parser::responsive, this) = true,
+          pnx::bind(&Parser::finalize, this))]
+      ;
+
+    linuxFooter =
+      qi::lit("---") > +token > qi::eol
+      > qi::uint_ > qi::lit("packets") > +token > -qi::eol
+      > -(qi::lit("rtt") > +token > -qi::eol)
+      ;
+
+
+    // Windows
+    pingWindows =
+      windowsHeader
+      > *((!windowsFooter) > (windowsResponse | ignoredLine))
+      > windowsFooter
+      ;
+
+    windowsHeader =
+      qi::lit("Pinging")
+      > ((ipValue) | (hostname > qi::lit('[') > ipValue > qi::lit(']')))
+      > +token > qi::eol
+        [(pnx::bind(&Parser::finalize, this))]
+      ;
+
+    windowsResponse =
+      qi::lit("Reply from") > ipValue > +token > qi::eol
+        [(pnx::bind(&Parser::responsive, this) = true,
+          pnx::bind(&Parser::finalize, this))]
+      ;
+
+    windowsFooter =
+      qi::lit("Ping statistics") > +token > -qi::eol
+      > -(qi::lit("Packets:") > +token > -qi::eol)
+      > -(qi::lit("Approximate") >+token > -qi::eol)
+      > -(qi::lit("Minimum") > +token > -qi::eol)
+      ;
+
+
+    // General
+    ipValue =
+      ipAddr [(pnx::bind(&Parser::tgtIp, this) = qi::_1)]
+      > -ifaceName
+      ;
+
+    hostname =
+      (!ipAddr) > domainName
+        [(pnx::bind([&](const std::string& val) {tgtAliases.push_back(val);},
+                    qi::_1))]
+      > -ifaceName
+      ;
+
+    ifaceName =
+      qi::lit('%') > +(qi::ascii::alnum | qi::ascii::char_("-_.@"))
+      ;
+
+    token =
+      +qi::ascii::graph
+      ;
+
+    ignoredLine =
+      (+token > -qi::eol) | +qi::eol
+      ;
+
+    BOOST_SPIRIT_DEBUG_NODES(
+        (start)
+        (pingLinux)(linuxHeader)(linuxResponse)(linuxFooter)
+        (pingWindows)(windowsHeader)(windowsResponse)(windowsFooter)
+        (ignoredLine)
+        (ipValue)(hostname)(ifaceName)
+        //(token)
+        );
   }
-  tgtAliases.clear();
-
-  tgtIp.setResponding(responsive);
-  responsive = false;
 
-  if (tgtIp != nmdo::IpAddress()) {
-    data.push_back(tgtIp);
+  // ===========================================================================
+  // Parser helper methods
+  // ===========================================================================
+  void
+  Parser::finalize()
+  {
+    for (const auto& alias : tgtAliases) {
+      tgtIp.addAlias(alias, REASON);
+    }
+    tgtAliases.clear();
+
+    tgtIp.setResponding(responsive);
+    responsive = false;
+
+    if (tgtIp != nmdo::IpAddress()) {
+      data.push_back(tgtIp);
+    }
   }
-}
 
-// Object return
-Result
-Parser::getData()
-{
-  Result r {data};
+  // Object return
+  Result
+  Parser::getData()
+  {
+    Result r {data};
 
-  return r;
-}
+    return r;
+  }
+} // end of namespace
@@ -34,73 +34,77 @@
 namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 
-// =============================================================================
-// Data containers
-// =============================================================================
-typedef std::vector<nmdo::IpAddress>  Result;
-
-
-// =============================================================================
-// Parser definition
-// =============================================================================
-class Parser :
-  public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-{
-  // ===========================================================================
-  // Variables
-  // ===========================================================================
-  private:
-    Result data;
-
-    const std::string REASON  {"ping"};
-
-    nmdo::IpAddress tgtIp;
-    std::vector<std::string> tgtAliases;
-    bool responsive {false};
-
-  protected:
-    // Rules
-    qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
-      start;
-
-    qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
-      pingLinux, linuxHeader, linuxResponse, linuxFooter,
-      pingWindows, windowsHeader, windowsResponse, windowsFooter,
-      ignoredLine;
-
-    qi::rule<nmdp::IstreamIter>
-      ipValue,
-      hostname,
-      ifaceName,
-      token;
-
-    nmdp::ParserDomainName
-      domainName;
-
-    nmdp::ParserIpAddress
-      ipAddr;
-
-  public:
-
-
+namespace netmeld::datastore::importers::ping {
   // ===========================================================================
-  // Constructors
+  // Data containers
   // ===========================================================================
-  private:
-  protected:
-  public: // Constructor is only default and must be public
-    Parser();
+  typedef std::vector<nmdo::IpAddress>  Result;
 
 
   // ===========================================================================
-  // Methods
+  // Parser definition
   // ===========================================================================
-  private:
-    void finalize();
-
-  protected:
-  public:
-    // Object return
-    Result getData();
-};
+  class Parser :
+    public qi::grammar<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private:
+      Result data;
+
+      const std::string REASON  {"ping"};
+
+      nmdo::IpAddress tgtIp;
+      std::vector<std::string> tgtAliases;
+      bool responsive {false};
+
+    protected:
+      // Rules
+      qi::rule<nmdp::IstreamIter, Result(), qi::ascii::blank_type>
+        start;
+
+      qi::rule<nmdp::IstreamIter, qi::ascii::blank_type>
+        pingLinux, linuxHeader, linuxResponse, linuxFooter,
+        pingWindows, windowsHeader, windowsResponse, windowsFooter,
+        ignoredLine;
+
+      qi::rule<nmdp::IstreamIter>
+        ipValue,
+        hostname,
+        ifaceName,
+        token;
+
+      nmdp::ParserDomainName
+        domainName;
+
+      nmdp::ParserIpAddress
+        ipAddr;
+
+    public:
+
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private:
+    protected:
+    public: // Constructor is only default and must be public
+      Parser();
+
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private:
+      void finalize();
+
+    protected:
+    public:
+      // Object return
+      Result getData();
+  };
+}
+
+namespace nmdsip = netmeld::datastore::importers::ping;
 #endif // PARSER_HPP
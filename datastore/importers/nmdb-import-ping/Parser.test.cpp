@@ -34,6 +34,7 @@
 
 namespace nmdp = netmeld::datastore::parsers;
 
+using nmdsip::Parser;
 using qi::ascii::blank;
 
 class TestParser : public Parser {
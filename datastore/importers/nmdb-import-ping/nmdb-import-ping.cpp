@@ -32,6 +32,9 @@ namespace nmdo = netmeld::datastore::objects;
 namespace nmdp = netmeld::datastore::parsers;
 namespace nmdt = netmeld::datastore::tools;
 
+using nmdsip::Parser;
+using nmdsip::Result;
+
 // =============================================================================
 // Import tool definition
 // =============================================================================
@@ -154,6 +154,8 @@ Parser::disableIface()
 Result
 Parser::getData()
 {
+  if (partial) { return Result(); } // Segment state is kept until finalize()
+
   Result r;
 
   if (d != Data()) {
@@ -162,3 +164,48 @@ Parser::getData()
 
   return r;
 }
+
+
+// Segmented (parallel) parsing
+std::vector<std::string>
+Parser::splitSegments(const std::string& data, size_t count)
+{
+  // Interface settings are not indented, but an interface block can only
+  // be followed by another block or top-level line after its "exit"
+  return nmdp::splitLines(data, count,
+      [](std::string_view, std::string_view line) {
+        return line.starts_with("interface ");
+      });
+}
+
+void
+Parser::setPartial(bool _partial)
+{
+  partial = _partial;
+}
+
+bool
+Parser::merge(Parser& other)
+{
+  for (const auto& [name, _] : other.d.ifaces) {
+    if (d.ifaces.contains(name)) { return false; }
+  }
+  for (const auto& [name, _] : other.d.routes) {
+    if (d.routes.contains(name)) { return false; }
+  }
+
+  if (d.devInfo.getDeviceId().empty()) {
+    d.devInfo.setDeviceId(other.d.devInfo.getDeviceId());
+  }
+  d.ifaces.merge(other.d.ifaces);
+  d.routes.merge(other.d.routes);
+
+  return true;
+}
+
+Result
+Parser::finalize()
+{
+  partial = false;
+  return getData();
+}
@@ -79,6 +79,8 @@ class Parser :
     // Helpers
     Data d;
 
+    bool partial {false};
+
     std::string tgtIfaceName;
 
   // ===========================================================================
@@ -104,5 +106,12 @@ class Parser :
 
     // Object return
     Result getData();
+
+  public:
+    // Segmented (parallel) parsing, see nmdp::SegmentedParser
+    static std::vector<std::string> splitSegments(const std::string&, size_t);
+    void setPartial(bool);
+    bool merge(Parser&);
+    Result finalize();
 };
 #endif // PARSER_HPP
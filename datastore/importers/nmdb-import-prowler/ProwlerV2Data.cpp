@@ -86,22 +86,22 @@ namespace netmeld::datastore::objects::prowler {
     //         accountNumber, timestamp, region, level, controlId, service,
     //         resourceId
     //       However, resourceId can be NULL so problematic for the DB
-    t.exec_prepared("insert_raw_prowler_v2_check",
+    nmdu::execPrepared(t, "insert_raw_prowler_v2_check",
           toolRunId
-        , accountNumber
-        , timestamp
-        , region
-        , level
-        , controlId
-        , service
-        , status
-        , severity
-        , control
-        , risk
-        , remediation
-        , documentationLink
-        , resourceId
-      );
+             , accountNumber
+             , timestamp
+             , region
+             , level
+             , controlId
+             , service
+             , status
+             , severity
+             , control
+             , risk
+             , remediation
+             , documentationLink
+             , resourceId
+           );
   }
 
   std::string
@@ -179,38 +179,38 @@ namespace netmeld::datastore::objects::prowler {
 
     // NOTE: The following are the suspected minimum for unique:
     //         timestamp, findingUniqueId
-    t.exec_prepared("insert_raw_prowler_v3_check",
+    nmdu::execPrepared(t, "insert_raw_prowler_v3_check",
           toolRunId
-        , assessmentStartTime
-        , findingUniqueId
-        , provider
-        , profile
-        , accountId
-        , organizationsInfo
-        , region
-        , checkId
-        , checkTitle
-        , checkTypes
-        , serviceName
-        , subServiceName
-        , status
-        , statusExtended
-        , severity
-        , resourceId
-        , resourceArn
-        , resourceTags
-        , resourceType
-        , resourceDetails
-        , description
-        , risk
-        , relatedUrl
-        , recommendation
-        , recommendationUrl
-        , remediationCode
-        , categories
-        , notes
-        , compliance
-      );
+             , assessmentStartTime
+             , findingUniqueId
+             , provider
+             , profile
+             , accountId
+             , organizationsInfo
+             , region
+             , checkId
+             , checkTitle
+             , checkTypes
+             , serviceName
+             , subServiceName
+             , status
+             , statusExtended
+             , severity
+             , resourceId
+             , resourceArn
+             , resourceTags
+             , resourceType
+             , resourceDetails
+             , description
+             , risk
+             , relatedUrl
+             , recommendation
+             , recommendationUrl
+             , remediationCode
+             , categories
+             , notes
+             , compliance
+           );
   }
 
   std::string
@@ -26,12 +26,14 @@
 
 #include <netmeld/core/utils/StringUtilities.hpp>
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
+#include <netmeld/datastore/utils/MacVendorTrie.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "Parser.hpp"
 
 namespace nmcu = netmeld::core::utils;
 namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
 
 
 template<typename P, typename R>
@@ -67,8 +69,16 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
       const auto& toolRunId {this->getToolRunId()};
       const auto& deviceId  {this->getDeviceId()};
 
+      nmdu::MacVendorTrie vendors;
+      vendors.load(t);
+
       LOG_DEBUG << "Iterating over results\n";
       for (auto& iface : this->tResults) {
+        iface.setReachableMacVendors(
+            [&vendors](const nmdo::MacAddress& _macAddr) {
+              return vendors.lookup(_macAddr);
+            });
+
         // The network port name is sometimes a list that must be expanded
         std::vector<std::string> ifaceNames;
         boost::split(ifaceNames, iface.getName(), boost::is_any_of(","));
@@ -78,7 +78,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
         if (results.os.isValid()) {
           std::sort(results.hotfixes.begin(), results.hotfixes.end());
           LOG_DEBUG << results.hotfixes << '\n';
-          t.exec_prepared("insert_raw_hotfixes", toolRunId, results.hotfixes);
+          nmdu::execPrepared(t, "insert_raw_hotfixes", toolRunId, results.hotfixes);
         } else {
           LOG_DEBUG << "Skipped as OperatingSystem not valid\n";
         }
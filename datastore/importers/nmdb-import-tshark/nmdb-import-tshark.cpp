@@ -30,6 +30,7 @@
 #include <netmeld/datastore/objects/DeviceInformation.hpp>
 #include <netmeld/datastore/tools/AbstractImportSpiritTool.hpp>
 #include <netmeld/datastore/parsers/ParserHelper.hpp>
+#include <netmeld/datastore/utils/MacVendorTrie.hpp>
 
 #include "Parser.hpp"
 #include "DataContainerSingleton.hpp"
@@ -161,6 +162,9 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
 
       auto quiet {this->opts.exists("quiet")};
 
+      nmdu::MacVendorTrie vendors;
+      vendors.load(t);
+
       // Commit transaction, use tool run entry per data set transaction
       t.commit();
       this->preCommitTool = true;
@@ -187,6 +191,7 @@ class Tool : public nmdt::AbstractImportSpiritTool<P,R>
 
             LOG_DEBUG << "Iterating over MACs\n";
             for (auto& [id, result] : results.macAddrs) {
+              result.setVendor(vendors.lookup(result));
               result.save(pt, toolRunId, deviceId);
               LOG_DEBUG << id << "--" << result.toDebugString() << "\n";
             }
@@ -26,9 +26,12 @@
 
 #include <netmeld/core/utils/StringUtilities.hpp>
 #include <netmeld/core/utils/ContainerUtilities.hpp>
+#include <netmeld/datastore/utils/AcBookUtilities.hpp>
 
 #include "Parser.hpp"
 
+namespace nmdu = netmeld::datastore::utils;
+
 // =============================================================================
 // Parser logic
 // =============================================================================
@@ -330,6 +333,7 @@ Parser::ruleAddDstIface(const std::string& _tgtZone)
   for (auto& [_, rbRule] : d.ruleBooks[_tgtZone]) {
     rbRule.addDstIface(tgtIface->getName());
   }
+  appliedRuleSets.emplace_back(tgtIface->getName(), _tgtZone, true);
 }
 
 void
@@ -338,6 +342,7 @@ Parser::ruleAddSrcIface(const std::string& _tgtZone)
   for (auto& [_, rbRule] : d.ruleBooks[_tgtZone]) {
     rbRule.addSrcIface(tgtIface->getName());
   }
+  appliedRuleSets.emplace_back(tgtIface->getName(), _tgtZone, false);
 }
 
 void
@@ -375,6 +380,8 @@ Parser::unsup(const std::string& _value)
 Result
 Parser::getData()
 {
+  if (partial) { return Result(); } // Segment state is kept until finalize()
+
   for (auto& [zone, ruleBook] : d.ruleBooks) {
     for (auto& [ruleId, rbRule] : ruleBook) {
       if (0 == rbRule.getSrcs().size()) {
@@ -401,3 +408,69 @@ Parser::getData()
 
   return r;
 }
+
+
+// Segmented (parallel) parsing
+std::vector<std::string>
+Parser::splitSegments(const std::string& data, size_t count)
+{
+  return nmdp::splitBlocks(data, count);
+}
+
+void
+Parser::setPartial(bool _partial)
+{
+  partial = _partial;
+}
+
+bool
+Parser::merge(Parser& other)
+{
+  for (const auto& [name, _] : other.d.ifaces) {
+    if (d.ifaces.contains(name)) { return false; }
+  }
+  // Referencing a rule set creates it empty, so only defined ones conflict
+  for (const auto& [zone, book] : other.d.ruleBooks) {
+    if (!book.empty() && d.ruleBooks.contains(zone)
+        && !d.ruleBooks.at(zone).empty())
+    {
+      return false;
+    }
+  }
+
+  // Interfaces of the later segment apply to the rule sets seen before them
+  for (const auto& [ifaceName, zone, isDst] : other.appliedRuleSets) {
+    for (auto& [_, rbRule] : d.ruleBooks[zone]) {
+      if (isDst) {
+        rbRule.addDstIface(ifaceName);
+      } else {
+        rbRule.addSrcIface(ifaceName);
+      }
+    }
+  }
+  appliedRuleSets.insert(appliedRuleSets.end(),
+                         other.appliedRuleSets.begin(),
+                         other.appliedRuleSets.end());
+
+  for (auto& [zone, book] : other.d.ruleBooks) {
+    auto& tgtBook {d.ruleBooks[zone]};
+    if (tgtBook.empty()) {
+      tgtBook = std::move(book);
+    }
+  }
+
+  d.ifaces.merge(other.d.ifaces);
+  d.services.insert(d.services.end(),
+                    other.d.services.begin(), other.d.services.end());
+  nmdu::mergeBooks(d.networkBooks, other.d.networkBooks);
+  d.observations.merge(other.d.observations);
+
+  return true;
+}
+
+Result
+Parser::finalize()
+{
+  partial = false;
+  return getData();
+}
@@ -27,6 +27,8 @@
 #ifndef PARSER_HPP
 #define PARSER_HPP
 
+#include <tuple>
+
 #include <netmeld/datastore/objects/AcNetworkBook.hpp>
 #include <netmeld/datastore/objects/AcRule.hpp>
 #include <netmeld/datastore/objects/AcServiceBook.hpp>
@@ -101,6 +103,11 @@ class Parser :
     // Supporting data structures
     Data d;
 
+    bool partial {false};
+
+    // (iface, rule set, applied to destination) as seen in the config
+    std::vector<std::tuple<std::string, std::string, bool>> appliedRuleSets;
+
     nmdo::InterfaceNetwork*  tgtIface;
     std::string              tgtIfaceName;
 
@@ -147,5 +154,12 @@ class Parser :
     void unsup(const std::string&);
 
     Result getData();
+
+  public:
+    // Segmented (parallel) parsing, see nmdp::SegmentedParser
+    static std::vector<std::string> splitSegments(const std::string&, size_t);
+    void setPartial(bool);
+    bool merge(Parser&);
+    Result finalize();
 };
 #endif // PARSER_HPP
@@ -24,11 +24,23 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <set>
+#include <thread>
 #include <yaml-cpp/yaml.h>
 
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
 #include <netmeld/core/utils/CmdExec.hpp>
+#include <netmeld/core/utils/SpawnExec.hpp>
 
 //namespace nmcu = netmeld::core::utils;
 namespace nmdt = netmeld::datastore::tools;
@@ -42,11 +54,37 @@ class Tool : public nmdt::AbstractDatastoreTool
     const std::string CMDS_ENTRY  {"procedures"};
     const std::string NAME        {"name"};
     const std::string CMDS        {"cmds"};
+    const std::string SQL         {"sql"};
+    const std::string DEPENDS_ON  {"depends-on"};
+
+    // A single `procedures` entry and, once ran, its results
+    struct Procedure
+    {
+      std::string               name;
+      std::string               cmds;
+      std::string               sql;
+      std::vector<std::string>  dependsOn;
+
+      // Scheduling state, guarded by the scheduler's mutex
+      std::vector<size_t> dependents;
+      size_t              waitingOn   {0};
+      bool                done        {false};
+      bool                skipped     {false};
+
+      // Only read by others once done
+      bool                          succeeded {false};
+      bool                          cached    {false};
+      std::string                   output;
+      std::chrono::duration<double> duration  {0};
+    };
 
     nmcu::FileManager& nmfm {nmcu::FileManager::getInstance()};
 
     std::vector<std::tuple<std::regex, std::string>> regexes;
 
+    // Datastore state cached `sql` results must match, if caching
+    std::string runKey;
+
   protected: // Variables intended for internal/subclass API
   public: // Variables should rarely appear at this scope
 
@@ -86,12 +124,28 @@ class Tool : public nmdt::AbstractDatastoreTool
           "Generates an example command file.")
         );
 
+      opts.addOptionalOption("jobs", std::make_tuple(
+          "jobs,j",
+          po::value<size_t>()->default_value(1),
+          "Run up to this many procedures at once; 0 uses one per core."
+          " Above 1, only `depends-on` orders the procedures.")
+        );
+
+      opts.addOptionalOption("result-cache", std::make_tuple(
+          "result-cache",
+          NULL_SEMANTIC,
+          "Reuse the prior output of `sql` procedures, until the data store"
+          " changes.")
+        );
+
       opts.addPositionalOption("cmds-file", -1);
     }
 
     int
     runTool() override
     {
+      profilePhase("startup");
+
       const auto& cmdsFile {opts.getValue("cmds-file")};
 
       if (opts.exists("example")) {
@@ -101,7 +155,7 @@ class Tool : public nmdt::AbstractDatastoreTool
                              getDbConnectString());
         //regexes.emplace_back({std::regex(r"(\{\{\}\})"), R"()"});
 
-        actions(cmdsFile);
+        return actions(cmdsFile);
       }
 
       return nmcu::Exit::SUCCESS;
@@ -175,6 +229,25 @@ class Tool : public nmdt::AbstractDatastoreTool
         };
       lflit(R"(Prior example as literal (i.e., no escaping))", s);
 
+      out << YAML::BeginMap
+          << YAML::Key << NAME
+          << YAML::Value << R"(Prior example in process (i.e., no `psql`))"
+          << YAML::Key << SQL
+          << YAML::Value << R"(SELECT * FROM ip_addrs LIMIT 5)"
+          << YAML::EndMap
+          ;
+      out << YAML::BeginMap
+          << YAML::Key << NAME
+          << YAML::Value << R"(Ordered, runs after the named procedure(s))"
+          << YAML::Key << DEPENDS_ON
+          << YAML::Value << YAML::BeginSeq
+          << R"(Simple, singular command)"
+          << YAML::EndSeq
+          << YAML::Key << CMDS
+          << YAML::Value << R"(echo "after ls")"
+          << YAML::EndMap
+          ;
+
       out << YAML::EndSeq
           << YAML::EndMap
           << YAML::EndDoc
@@ -183,49 +256,427 @@ class Tool : public nmdt::AbstractDatastoreTool
       LOG_INFO << out.c_str() << std::endl;
     }
 
-    void
+    int
     actions(const std::string& cmdsFile)
     {
-      YAML::Node yConfig {YAML::LoadFile(cmdsFile)};
+      auto procedures {loadProcedures(cmdsFile)};
+      if (!orderProcedures(procedures)) {
+        return nmcu::Exit::FAILURE;
+      }
+      profilePhase("load");
 
-      const auto& yProcedures {yConfig[CMDS_ENTRY]};
+      if (opts.exists("result-cache")) {
+        pqxx::connection db {getDbConnectString()};
+        pqxx::read_transaction t {db};
+        runKey = t.exec1("SELECT snapshot_data_key()")[0]
+                  .as<std::string>();
+      }
 
-      size_t totalProcedures  {yProcedures.size()};
-      size_t successes        {0};
+      size_t jobs {opts.getValueAs<size_t>("jobs")};
+      if (0 == jobs) {
+        jobs = std::max(1U, std::thread::hardware_concurrency());
+      }
+      jobs = std::min(jobs, std::max(size_t {1}, procedures.size()));
+
+      std::mutex mutex;
+      std::condition_variable changed;
+      std::set<size_t> ready; // ran in file order, when able
+      size_t remaining {procedures.size()};
+      for (size_t i {0}; i < procedures.size(); ++i) {
+        if (0 == procedures[i].waitingOn) {
+          ready.insert(i);
+        }
+      }
 
-      for (const auto& yProcedure : yProcedures) {
-        // get procedure name
-        const auto& name {yProcedure[NAME].as<std::string>()};
-
-        // build command chain
-        const auto& yCmds {yProcedure[CMDS]};
-        std::ostringstream oss;
-        if (yCmds.IsScalar()) {
-          oss << yCmds.as<std::string>();
-        } else if (yCmds.IsSequence()) {
-          for (const auto& yCmd : yCmds) {
-            oss << yCmd.as<std::string>();
+      // Caller holds the mutex for these
+      std::function<void(size_t)> skip = [&](size_t i) {
+        auto& procedure {procedures[i]};
+        if (procedure.done) {
+          return;
+        }
+        procedure.done    = true;
+        procedure.skipped = true;
+        --remaining;
+        for (const auto d : procedure.dependents) {
+          skip(d);
+        }
+      };
+      auto finish = [&](size_t i) {
+        auto& procedure {procedures[i]};
+        procedure.done = true;
+        --remaining;
+        for (const auto d : procedure.dependents) {
+          if (!procedure.succeeded) {
+            skip(d);
+          } else if (0 == --procedures[d].waitingOn
+                     && !procedures[d].skipped)
+          {
+            ready.insert(d);
           }
-        } else {
-          LOG_INFO << "# Skipping unknown `cmds` node type\n";
         }
+      };
 
-        // do command chain variable substitution
-        const auto cmds {regexReplace(oss.str())};
-        LOG_INFO << "# Start -- " << name << '\n'
-                 << "# Executing: `" << cmds << "`\n";
+      const auto wallStart {std::chrono::steady_clock::now()};
+
+      // Each worker keeps its own connection, opened on first `sql` use
+      std::vector<std::thread> workers;
+      for (size_t w {0}; w < jobs; ++w) {
+        workers.emplace_back([&]() {
+          std::unique_ptr<pqxx::connection> db;
+          std::unique_lock<std::mutex> lock {mutex};
+          while (true) {
+            changed.wait(lock, [&]() {
+                return !ready.empty() || 0 == remaining;
+              });
+            if (ready.empty()) {
+              break;
+            }
+            const size_t i {*ready.begin()};
+            ready.erase(ready.begin());
+
+            lock.unlock();
+            run(procedures[i], db);
+            lock.lock();
+
+            finish(i);
+            changed.notify_all();
+          }
+        });
+      }
 
-        // exec commands
-        LOG_INFO << "# Results:" << std::endl;
-        int success {nmcu::cmdExecOrExit(cmds)};
-        if (0 == success) {
+      // Report in file order, as soon as each procedure and those prior
+      // to it are done
+      size_t successes {0};
+      for (size_t next {0}; next < procedures.size(); ++next) {
+        {
+          std::unique_lock<std::mutex> lock {mutex};
+          changed.wait(lock, [&]() { return procedures[next].done; });
+        }
+        const auto& procedure {procedures[next]};
+        report(procedure);
+        if (procedure.succeeded) {
           ++successes;
         }
-        LOG_INFO << "# End -- " << name << "\n\n";
       }
-      LOG_INFO << "# Success counts: "
-               << successes << '/' << totalProcedures
+
+      for (auto& worker : workers) {
+        worker.join();
+      }
+      profilePhase("run");
+
+      const std::chrono::duration<double> wallTime {
+        std::chrono::steady_clock::now() - wallStart};
+
+      std::vector<const Procedure*> slowest;
+      for (const auto& procedure : procedures) {
+        if (!procedure.skipped) {
+          slowest.push_back(&procedure);
+        }
+      }
+      std::sort(slowest.begin(), slowest.end(),
+          [](const auto* a, const auto* b) {
+            return a->duration > b->duration;
+          });
+
+      LOG_INFO << "# Durations (slowest first):\n";
+      for (const auto* procedure : slowest) {
+        LOG_INFO << "#   " << formatDuration(procedure->duration)
+                 << (procedure->cached ? " (cached)" : "")
+                 << " -- " << procedure->name << '\n';
+      }
+      LOG_INFO << "# Total time: " << formatDuration(wallTime)
+               << " with " << jobs << " job(s)\n"
+               << "# Success counts: "
+               << successes << '/' << procedures.size()
                << '\n';
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+    std::vector<Procedure>
+    loadProcedures(const std::string& cmdsFile) const
+    {
+      YAML::Node yConfig {YAML::LoadFile(cmdsFile)};
+
+      std::vector<Procedure> procedures;
+      for (const auto& yProcedure : yConfig[CMDS_ENTRY]) {
+        Procedure procedure;
+
+        // get procedure name
+        procedure.name = yProcedure[NAME].as<std::string>();
+
+        // build command chain or query
+        const auto& ySql {yProcedure[SQL]};
+        if (ySql) {
+          procedure.sql = regexReplace(join(ySql, "\n"));
+        } else {
+          procedure.cmds = regexReplace(join(yProcedure[CMDS], ""));
+        }
+
+        const auto& yDependsOn {yProcedure[DEPENDS_ON]};
+        if (yDependsOn.IsScalar()) {
+          procedure.dependsOn.push_back(yDependsOn.as<std::string>());
+        } else if (yDependsOn.IsSequence()) {
+          for (const auto& yName : yDependsOn) {
+            procedure.dependsOn.push_back(yName.as<std::string>());
+          }
+        }
+
+        procedures.push_back(std::move(procedure));
+      }
+
+      return procedures;
+    }
+
+    std::string
+    join(const YAML::Node& yNode, const std::string& separator) const
+    {
+      std::ostringstream oss;
+      if (yNode.IsScalar()) {
+        oss << yNode.as<std::string>();
+      } else if (yNode.IsSequence()) {
+        std::string sep;
+        for (const auto& yPart : yNode) {
+          oss << sep << yPart.as<std::string>();
+          sep = separator;
+        }
+      } else {
+        LOG_INFO << "# Skipping unknown `cmds` node type\n";
+      }
+
+      return oss.str();
+    }
+
+    // Link each procedure to those depending on it (a name refers to every
+    // procedure with it), rejecting unknown names and cycles
+    bool
+    orderProcedures(std::vector<Procedure>& procedures) const
+    {
+      std::map<std::string, std::vector<size_t>> byName;
+      for (size_t i {0}; i < procedures.size(); ++i) {
+        byName[procedures[i].name].push_back(i);
+      }
+
+      for (size_t i {0}; i < procedures.size(); ++i) {
+        auto& procedure {procedures[i]};
+        for (const auto& dependsOn : procedure.dependsOn) {
+          const auto& found {byName.find(dependsOn)};
+          if (byName.end() == found) {
+            LOG_ERROR << "Procedure `" << procedure.name
+                      << "` depends on unknown procedure `" << dependsOn
+                      << "`\n";
+            return false;
+          }
+          for (const auto j : found->second) {
+            procedures[j].dependents.push_back(i);
+            ++procedure.waitingOn;
+          }
+        }
+      }
+
+      // Every procedure is reachable from those without dependencies,
+      // unless part of (or after) a cycle
+      std::vector<size_t> waitingOn;
+      std::vector<size_t> ready;
+      for (size_t i {0}; i < procedures.size(); ++i) {
+        waitingOn.push_back(procedures[i].waitingOn);
+        if (0 == waitingOn[i]) {
+          ready.push_back(i);
+        }
+      }
+      size_t reached {0};
+      while (!ready.empty()) {
+        const auto i {ready.back()};
+        ready.pop_back();
+        ++reached;
+        for (const auto d : procedures[i].dependents) {
+          if (0 == --waitingOn[d]) {
+            ready.push_back(d);
+          }
+        }
+      }
+      if (reached != procedures.size()) {
+        for (size_t i {0}; i < procedures.size(); ++i) {
+          if (0 != waitingOn[i]) {
+            LOG_ERROR << "Procedure `" << procedures[i].name
+                      << "` is part of, or after, a `depends-on` cycle\n";
+          }
+        }
+        return false;
+      }
+
+      return true;
+    }
+
+    void
+    run(Procedure& procedure, std::unique_ptr<pqxx::connection>& db) const
+    {
+      const auto start {std::chrono::steady_clock::now()};
+      if (procedure.sql.empty()) {
+        runCmds(procedure);
+      } else {
+        runSql(procedure, db);
+      }
+      procedure.duration = std::chrono::steady_clock::now() - start;
+    }
+
+    void
+    runCmds(Procedure& procedure) const
+    {
+      LOG_DEBUG << procedure.cmds << '\n';
+
+      // Interleaved, as they would be on a terminal
+      auto collect = [&procedure](std::string_view data) {
+        procedure.output.append(data);
+      };
+      const auto& result {
+        nmcu::SpawnExec::shell(procedure.cmds)
+          .setStdout(nmcu::SpawnStream::CAPTURE, collect)
+          .setStderr(nmcu::SpawnStream::CAPTURE, collect)
+          .run()
+      };
+
+      procedure.succeeded = (0 == result.exitStatus);
+      if (-1 == result.exitStatus) {
+        LOG_ERROR << "Failure: " << procedure.cmds << '\n';
+      } else if (0 != result.exitStatus) {
+        LOG_WARN << "Non-Zero: " << procedure.cmds << '\n';
+      }
+    }
+
+    void
+    runSql(Procedure& procedure, std::unique_ptr<pqxx::connection>& db) const
+    {
+      try {
+        if (!db) {
+          db = std::make_unique<pqxx::connection>(getDbConnectString());
+          db->prepare("select_analyze_result", R"(
+              SELECT output
+              FROM snapshot.analyze_results
+              WHERE procedure_key = MD5($1)
+                AND run_key = $2
+              )");
+          db->prepare("track_analyze_result", R"(
+              SELECT snapshot_track_changes($1)
+              )");
+          db->prepare("upsert_analyze_result", R"(
+              INSERT INTO snapshot.analyze_results
+                (procedure_key, run_key, output, refreshed)
+              VALUES (MD5($1), $2, $3, NOW())
+              ON CONFLICT (procedure_key) DO UPDATE
+              SET run_key   = EXCLUDED.run_key
+                , output    = EXCLUDED.output
+                , refreshed = EXCLUDED.refreshed
+              )");
+        }
+
+        pqxx::work t {*db};
+        const bool useCache {!runKey.empty()};
+        if (useCache) {
+          // Any output stored is then outdated by writes to what it read
+          t.exec_prepared("track_analyze_result", procedure.sql);
+          const auto& rows {
+            t.exec_prepared("select_analyze_result", procedure.sql, runKey)};
+          if (!rows.empty()) {
+            procedure.output    = rows[0][0].as<std::string>();
+            procedure.cached    = true;
+            procedure.succeeded = true;
+            return;
+          }
+        }
+
+        procedure.output = formatResult(t.exec(procedure.sql));
+        if (useCache) {
+          t.exec_prepared("upsert_analyze_result",
+              procedure.sql, runKey, procedure.output);
+        }
+        t.commit();
+        procedure.succeeded = true;
+      } catch (const pqxx::broken_connection& e) {
+        procedure.output = e.what();
+        db.reset();
+      } catch (const std::exception& e) {
+        procedure.output = e.what();
+      }
+
+      if (!procedure.succeeded) {
+        LOG_WARN << "Query failed: " << procedure.name << '\n';
+      }
+    }
+
+    // Similar to `psql`'s aligned output
+    std::string
+    formatResult(const pqxx::result& rows) const
+    {
+      const pqxx::row_size_type columns {rows.columns()};
+      if (0 == columns) { // e.g., a statement not returning rows
+        return "";
+      }
+
+      std::vector<size_t> widths;
+      for (pqxx::row_size_type i {0}; i < columns; ++i) {
+        widths.push_back(std::strlen(rows.column_name(i)));
+      }
+      for (const auto& row : rows) {
+        for (pqxx::row_size_type i {0}; i < columns; ++i) {
+          widths[i] = std::max(widths[i], row[i].size());
+        }
+      }
+
+      std::ostringstream oss;
+      auto line = [&](const auto& value) {
+        for (pqxx::row_size_type i {0}; i < columns; ++i) {
+          oss << (0 == i ? " " : " | ")
+              << std::left << std::setw(static_cast<int>(widths[i]))
+              << value(i);
+        }
+        oss << '\n';
+      };
+
+      line([&](auto i) { return rows.column_name(i); });
+      for (pqxx::row_size_type i {0}; i < columns; ++i) {
+        oss << (0 == i ? "-" : "-+-") << std::string(widths[i], '-');
+      }
+      oss << "-\n";
+      for (const auto& row : rows) {
+        line([&](auto i) { return row[i].c_str(); });
+      }
+      oss << '(' << rows.size() << (1 == rows.size() ? " row" : " rows")
+          << ")\n";
+
+      return oss.str();
+    }
+
+    void
+    report(const Procedure& procedure) const
+    {
+      LOG_INFO << "# Start -- " << procedure.name << '\n';
+      if (procedure.skipped) {
+        LOG_INFO << "# Skipped, a `depends-on` procedure failed\n"
+                 << "# End -- " << procedure.name << "\n\n";
+        return;
+      }
+
+      if (procedure.sql.empty()) {
+        LOG_INFO << "# Executing: `" << procedure.cmds << "`\n";
+      } else {
+        LOG_INFO << "# Querying: `" << procedure.sql << "`\n";
+      }
+      LOG_INFO << "# Results:" << (procedure.cached ? " (cached)" : "")
+               << '\n' << procedure.output;
+      if (!procedure.output.empty() && '\n' != procedure.output.back()) {
+        LOG_INFO << '\n';
+      }
+      LOG_INFO << "# End -- " << procedure.name
+               << " (" << formatDuration(procedure.duration) << ")\n\n";
+    }
+
+    std::string
+    formatDuration(const std::chrono::duration<double>& duration) const
+    {
+      std::ostringstream oss;
+      oss << std::fixed << std::setprecision(3) << duration.count() << 's';
+      return oss.str();
     }
 
     std::string
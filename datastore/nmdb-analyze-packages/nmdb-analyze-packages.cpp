@@ -0,0 +1,238 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <fstream>
+#include <future>
+#include <thread>
+
+#include <netmeld/core/objects/Time.hpp>
+#include <netmeld/core/objects/Uuid.hpp>
+#include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
+#include <netmeld/datastore/utils/CveFeed.hpp>
+#include <netmeld/datastore/utils/NetmeldPostgresConversions.hpp>
+#include <netmeld/datastore/utils/QueriesCommon.hpp>
+
+
+namespace nmco = netmeld::core::objects;
+namespace nmcu = netmeld::core::utils;
+namespace nmdo = netmeld::datastore::objects;
+namespace nmdt = netmeld::datastore::tools;
+namespace nmdu = netmeld::datastore::utils;
+
+
+class Tool : public nmdt::AbstractDatastoreTool
+{
+  private:
+    // A distinct installed package version, across all devices
+    struct Package
+    {
+      nmdu::PackageManager  manager;
+      std::string           name;
+      std::string           version;
+    };
+
+    // (index into the packages, affecting CVE)
+    using Matches = std::vector<std::pair<size_t, nmdo::Cve>>;
+
+  public:
+    Tool() : nmdt::AbstractDatastoreTool
+      ("Correlate installed packages against a local CVE feed",
+       PROGRAM_NAME, PROGRAM_VERSION)
+    {}
+
+    void
+    addToolOptions() override
+    {
+      opts.addRequiredOption("feed", std::make_tuple(
+          "feed",
+          po::value<std::string>()->required(),
+          "Vulnerability feed (JSON) to correlate against."
+          " Either --feed param or implicit last argument.")
+        );
+
+      opts.addPositionalOption("feed", -1);
+
+      opts.addAdvancedOption("jobs", std::make_tuple(
+          "jobs",
+          po::value<size_t>()->default_value(0),
+          "Evaluate packages in this many parallel jobs;"
+          " 0 uses one per core.")
+        );
+    }
+
+    int
+    runTool() override
+    {
+      profilePhase("startup");
+
+      const nmco::Time executionStart;
+
+      const auto& feedPath {opts.getValue("feed")};
+      std::ifstream feedStream {feedPath};
+      if (!feedStream) {
+        LOG_ERROR << "Could not open feed: " << feedPath << '\n';
+        return nmcu::Exit::FAILURE;
+      }
+
+      nmdu::CveFeed feed;
+      feed.load(feedStream);
+      LOG_INFO << "Loaded " << feed.size() << " feed entries, skipped "
+               << feed.skippedEntries() << '\n';
+      profilePhase("parse");
+
+      pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
+
+      nmdu::dbPrepareCommon(db);
+      profilePhase("prepare");
+
+      pqxx::work t {db};
+
+      const auto& packages {getPackages(t)};
+      LOG_INFO << "Evaluating " << packages.size()
+               << " distinct package versions\n";
+
+      const auto& matches {evaluate(feed, packages)};
+      profilePhase("evaluate");
+
+      const nmco::Uuid toolRunId;
+      t.exec_prepared("insert_tool_run",
+          toolRunId,
+          programName,
+          opts.getCommandLine(),
+          sfs::absolute(feedPath).string(),
+          executionStart,
+          nmco::Time());
+
+      auto stream = pqxx::stream_to::table(
+          t
+        , "raw_package_cves"
+        , std::vector<std::string>
+            { "tool_run_id", "package_manager", "package_name"
+            , "package_version", "cve_id"
+            }
+        );
+      for (const auto& [index, cve] : matches) {
+        const auto& package {packages[index]};
+        stream << std::make_tuple(toolRunId.toString(),
+                                  nmdu::toString(package.manager),
+                                  package.name,
+                                  package.version,
+                                  cve);
+      }
+      stream.complete();
+      profilePhase("insert");
+
+      t.commit();
+      profilePhase("commit");
+
+      LOG_INFO << "Stored " << matches.size() << " package CVE matches\n"
+               << "tool-run-id: " << toolRunId << '\n';
+
+      return nmcu::Exit::SUCCESS;
+    }
+
+  private:
+    // Each distinct package version imported by a package manager's tool
+    std::vector<Package>
+    getPackages(pqxx::transaction_base& t) const
+    {
+      const auto& rows {t.exec(R"(
+          SELECT DISTINCT
+              package_manager_of_tool(tr.tool_name),
+              rp.package_name,
+              rp.package_version
+          FROM raw_packages AS rp
+          JOIN tool_runs AS tr
+              ON (rp.tool_run_id = tr.id)
+          WHERE package_manager_of_tool(tr.tool_name) IS NOT NULL
+          )")};
+
+      std::vector<Package> packages;
+      packages.reserve(rows.size());
+      for (const auto& row : rows) {
+        const auto& manager {
+          nmdu::toPackageManager(row[0].as<std::string>())};
+        if (manager) {
+          packages.push_back({*manager,
+                              row[1].as<std::string>(),
+                              row[2].as<std::string>()});
+        }
+      }
+
+      return packages;
+    }
+
+    // Match every package against the feed, in contiguous parallel slices
+    Matches
+    evaluate(const nmdu::CveFeed& feed,
+             const std::vector<Package>& packages) const
+    {
+      size_t jobs {opts.getValueAs<size_t>("jobs")};
+      if (0 == jobs) {
+        jobs = std::max(1U, std::thread::hardware_concurrency());
+      }
+      const size_t sliceSize {(packages.size() + jobs - 1) / jobs};
+
+      std::vector<std::future<Matches>> slices;
+      for (size_t begin {0}; begin < packages.size(); begin += sliceSize) {
+        const size_t end {std::min(begin + sliceSize, packages.size())};
+        slices.push_back(std::async(std::launch::async,
+            [&feed, &packages, begin, end]() {
+              Matches found;
+              for (size_t i {begin}; i < end; ++i) {
+                const auto& package {packages[i]};
+                for (const auto& cve : feed.matches(package.manager,
+                                                    package.name,
+                                                    package.version))
+                {
+                  found.emplace_back(i, cve);
+                }
+              }
+              return found;
+            }
+          ));
+      }
+
+      Matches matches;
+      for (auto& slice : slices) {
+        auto found {slice.get()};
+        matches.insert(matches.end(),
+                       std::make_move_iterator(found.begin()),
+                       std::make_move_iterator(found.end()));
+      }
+
+      return matches;
+    }
+};
+
+
+int
+main(int argc, char** argv)
+{
+  Tool tool;
+  return tool.start(argc, argv);
+}
@@ -81,7 +81,10 @@ class Tool : public nmdt::AbstractDatastoreTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       pqxx::connection db {getDbConnectString()};
+      profilePhase("connect");
 
       nmdu::dbPrepareCommon(db);
 
@@ -146,6 +149,7 @@ class Tool : public nmdt::AbstractDatastoreTool
       // INSERT queries against the new *_acl_* tables
 
       pqxx::work t{db};
+      profilePhase("prepare");
 
       // Back-propagate guest device IDs into parent tool runs.
       t.exec(
@@ -554,9 +558,10 @@ class Tool : public nmdt::AbstractDatastoreTool
         " )"
         " ON CONFLICT DO NOTHING"
       );
-
+      profilePhase("convert");
 
       t.commit();
+      profilePhase("commit");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -26,6 +26,9 @@
 
 #include <regex>
 
+#include <boost/algorithm/string.hpp>
+#include <boost/uuid/name_generator_sha1.hpp>
+#include <boost/uuid/uuid_io.hpp>
 #include <pqxx/pqxx>
 
 #include <netmeld/datastore/tools/AbstractDatastoreTool.hpp>
@@ -45,6 +48,7 @@ class Tool : public nmdt::AbstractDatastoreTool
     const std::string MAC_PREFIX_FILE  {"/usr/share/nmap/nmap-mac-prefixes"};
     const std::string SCHEMA_PATH      {nmfm.getConfPath().string()
                                        + '/' + NETMELD_SCHEMA_DIR};
+    const std::string TEMPLATE_PREFIX  {"netmeld_template_"};
 
   public:
     Tool() : nmdt::AbstractDatastoreTool
@@ -62,8 +66,10 @@ class Tool : public nmdt::AbstractDatastoreTool
           );
       opts.addRequiredOption("mac-prefix-file", std::make_tuple(
             "mac-prefix-file",
-            po::value<std::string>()->default_value(MAC_PREFIX_FILE),
-            "Location of mac prefix file")
+            po::value<std::vector<std::string>>()->multitoken()->
+              default_value({MAC_PREFIX_FILE}, MAC_PREFIX_FILE),
+            "Location of mac prefix files; nmap format (MA-L, MA-M, and MA-S"
+            " prefixes) or IEEE registry CSV (oui.csv, mam.csv, oui36.csv)")
           );
 
       opts.addOptionalOption("delete", std::make_tuple(
@@ -76,16 +82,43 @@ class Tool : public nmdt::AbstractDatastoreTool
             po::value<std::vector<std::string>>()->multitoken(),
             "Additional .sql files to populate the database with")
           );
+
+      opts.addAdvancedOption("no-template", std::make_tuple(
+            "no-template",
+            NULL_SEMANTIC,
+            "Load the schema and MAC prefixes directly instead of cloning"
+            " a cached template database")
+          );
     }
 
     int
     runTool() override
     {
+      profilePhase("startup");
+
       const auto& dbConnectString {getDbConnectString()};
       const auto shouldDelete     {opts.exists("delete")};
 
       // Initialize DB to consistent state
       initDbState(dbConnectString, shouldDelete);
+      profilePhase("reset");
+
+      // Clone a template already holding the schema and MAC prefixes
+      if (!shouldDelete && !opts.exists("no-template")) {
+        createDbFromTemplate();
+        profilePhase("create");
+
+        pqxx::connection db {dbConnectString};
+        nmdu::dbPrepareCommon(db);
+        profilePhase("prepare");
+
+        return nmcu::Exit::SUCCESS;
+      }
+
+      if (!shouldDelete) {
+        createDb();
+      }
+      profilePhase("create");
 
       LOG_DEBUG << "(runTool) dbConnectString: " << dbConnectString
                 << std::endl;
@@ -101,8 +134,10 @@ class Tool : public nmdt::AbstractDatastoreTool
       loadMacPrefixes(work);
 
       work.commit();
+      profilePhase("load");
 
       nmdu::dbPrepareCommon(db);
+      profilePhase("prepare");
 
       return nmcu::Exit::SUCCESS;
     }
@@ -112,11 +147,7 @@ class Tool : public nmdt::AbstractDatastoreTool
     {
       const auto& dbName  {getDbName()};
 
-      const auto& pgDbConnectString
-        {"dbname=" + POSTGRES_DB_NAME + ' ' + getDbArgs()};
-
-      LOG_DEBUG << "postgresDb: " << pgDbConnectString << std::endl;
-      pqxx::connection postgresDb {pgDbConnectString};
+      pqxx::connection postgresDb {getPostgresDbConnectString()};
 
       try {
         // If DB already exists, either quick or full erase
@@ -141,10 +172,13 @@ class Tool : public nmdt::AbstractDatastoreTool
           LOG_INFO << "Cleaning tool_runs\n";
           ntWork.exec("TRUNCATE FROM tool_runs RESTART IDENTITY CASCADE");
 
+          // Snapshot tables (see --snapshot-cache) are left for their
+          // tools to rebuild, since the data has changed.
           pqxx::result tables = ntWork.exec(
               "SELECT relname AS populated_table"
               " FROM pg_catalog.pg_stat_user_tables"
               " WHERE n_live_tup > 0"
+              "   AND schemaname = 'public'"
               );
           for (const auto& tableRow : tables) {
             std::string populatedTable;
@@ -173,15 +207,166 @@ class Tool : public nmdt::AbstractDatastoreTool
       // If DB doesn't exists, nothing special
       catch (const std::exception& e) { }
 
-      pqxx::nontransaction ntWork{postgresDb};
+      postgresDb.close();
+    }
+
+    void
+    createDb(const std::string& templateName = "")
+    {
+      const auto& dbName  {getDbName()};
+
+      pqxx::connection postgresDb {getPostgresDbConnectString()};
+      pqxx::nontransaction ntWork {postgresDb};
       LOG_INFO << "Creating database '" << dbName << "'..." << std::endl;
-      ntWork.exec("CREATE DATABASE " + dbName);
+      if (templateName.empty()) {
+        ntWork.exec("CREATE DATABASE " + dbName);
+      } else {
+        ntWork.exec("CREATE DATABASE " + dbName
+                   + " TEMPLATE " + templateName
+                   );
+      }
 
       postgresDb.close();
     }
 
+    std::string
+    getPostgresDbConnectString() const
+    {
+      const auto& pgDbConnectString
+        {"dbname=" + POSTGRES_DB_NAME + ' ' + getDbArgs()};
+
+      LOG_DEBUG << "postgresDb: " << pgDbConnectString << std::endl;
+
+      return pgDbConnectString;
+    }
+
+    // Name of the template database for the current inputs.  It is keyed on
+    // the tool version and the name and content of every schema file and the
+    // MAC prefix files, so any change to those yields a new template.
+    std::string
+    getTemplateName()
+    {
+      std::ostringstream oss;
+      oss << PROGRAM_VERSION << '\0';
+
+      std::vector<std::string> files {getSchemaFiles()};
+      for (const auto& file : opts.getValues("mac-prefix-file")) {
+        files.push_back(file);
+      }
+      for (const auto& file : files) {
+        oss << sfs::path(file).filename().string() << '\0';
+        std::ifstream fileStream {file, std::ios::binary};
+        if (fileStream) {
+          oss << fileStream.rdbuf();
+        }
+        oss << '\0';
+      }
+
+      const boost::uuids::name_generator_sha1 generator
+        {boost::uuids::ns::oid()};
+      const auto key {generator(oss.str())};
+
+      std::string hash {boost::uuids::to_string(key)};
+      std::erase(hash, '-');
+
+      return TEMPLATE_PREFIX + hash.substr(0, 16);
+    }
+
+    // Create the data store from the template for the current inputs.  The
+    // template is built, cloned, and stale ones dropped while holding a
+    // cluster wide advisory lock, so concurrent initializations (e.g., CI
+    // jobs sharing a server) neither race on the build nor drop a template
+    // another is about to clone.  The lock is tied to the session, so it is
+    // also released should this process fail part way.
     void
-    loadSchema(pqxx::work& work)
+    createDbFromTemplate()
+    {
+      pqxx::connection postgresDb {getPostgresDbConnectString()};
+      pqxx::nontransaction ntWork {postgresDb};
+
+      const auto& lockKey {"hashtext(" + ntWork.quote(TEMPLATE_PREFIX) + ")"};
+      LOG_DEBUG << "Waiting for template lock" << std::endl;
+      ntWork.exec("SELECT pg_advisory_lock(" + lockKey + ")");
+
+      const auto templateName {prepareTemplate(ntWork)};
+      createDb(templateName);
+      dropStaleTemplates(ntWork, templateName);
+
+      ntWork.exec("SELECT pg_advisory_unlock(" + lockKey + ")");
+      postgresDb.close();
+    }
+
+    // Ensure a template database exists for the current inputs, building it
+    // (under a temporary name, then renamed) when needed.  Callers must hold
+    // the template lock.
+    std::string
+    prepareTemplate(pqxx::nontransaction& ntWork)
+    {
+      const auto templateName {getTemplateName()};
+      const auto partialName  {templateName + "_partial"};
+
+      const auto existing {ntWork.exec(
+          "SELECT 1 FROM pg_catalog.pg_database"
+          " WHERE datname = " + ntWork.quote(templateName)
+        )};
+      if (!existing.empty()) {
+        LOG_INFO << "Using template database '" << templateName << "'"
+                 << std::endl;
+        return templateName;
+      }
+
+      LOG_INFO << "Building template database '" << templateName << "'..."
+               << std::endl;
+      ntWork.exec("DROP DATABASE IF EXISTS " + partialName);
+      ntWork.exec("CREATE DATABASE " + partialName);
+      {
+        pqxx::connection db {"dbname=" + partialName + ' ' + getDbArgs()};
+        pqxx::work work     {db};
+
+        loadSchema(work);
+        loadMacPrefixes(work);
+
+        work.commit();
+        db.close();
+      }
+      ntWork.exec("ALTER DATABASE " + partialName
+                 + " RENAME TO " + templateName
+                 );
+      ntWork.exec("ALTER DATABASE " + templateName
+                 + " WITH IS_TEMPLATE true ALLOW_CONNECTIONS false"
+                 );
+
+      return templateName;
+    }
+
+    // Drop templates (and partial builds) left over from other inputs, once
+    // the current one is in place.  Callers must hold the template lock.
+    void
+    dropStaleTemplates(pqxx::nontransaction& ntWork,
+                       const std::string& templateName)
+    {
+      const auto templates {ntWork.exec(
+          "SELECT datname FROM pg_catalog.pg_database"
+          " WHERE datname LIKE " + ntWork.quote(TEMPLATE_PREFIX + '%') +
+          "   AND datname <> " + ntWork.quote(templateName)
+        )};
+      for (const auto& row : templates) {
+        const std::string name {row.at("datname").c_str()};
+
+        LOG_DEBUG << "Dropping stale template: " << name << std::endl;
+        try {
+          ntWork.exec("ALTER DATABASE " + name + " IS_TEMPLATE false");
+          ntWork.exec("DROP DATABASE " + name);
+        } catch (const std::exception& e) {
+          LOG_DEBUG << "Failed to drop stale template: " << name
+                    << '\n' << e.what()
+                    << std::endl;
+        }
+      }
+    }
+
+    std::vector<std::string>
+    getSchemaFiles()
     {
       std::vector<std::string> schemas;
 
@@ -206,8 +391,14 @@ class Tool : public nmdt::AbstractDatastoreTool
       LOG_DEBUG << "Sorting schema imports" << std::endl;
       std::sort(schemas.begin(), schemas.end());
 
+      return schemas;
+    }
+
+    void
+    loadSchema(pqxx::work& work)
+    {
       LOG_INFO << "Importing schema(s)" << std::endl;
-      for (const auto& schema : schemas) {
+      for (const auto& schema : getSchemaFiles()) {
         importFile(work, schema);
       }
     }
@@ -233,52 +424,94 @@ class Tool : public nmdt::AbstractDatastoreTool
       }
     }
 
+    // Parse a MAC prefix file into `prefixes`, keyed on the prefix (padded to
+    // a full MAC) and its length in bits.  Handles nmap's format of 6, 7, or
+    // 9 hex digits followed by the vendor, as well as IEEE registry CSVs.
     void
-    loadMacPrefixes(pqxx::work& work)
+    parseMacPrefixFile(const std::string& macPrefixPath,
+                       std::map<std::pair<std::string, size_t>,
+                                std::string>& prefixes)
     {
-      const auto macPrefixPath = opts.getValue("mac-prefix-file");
-
       if (!sfs::exists(sfs::path(macPrefixPath))) {
         LOG_WARN << "MAC prefix file not found: " << macPrefixPath << std::endl;
         return;
       }
 
-      std::map<std::string, std::string> macs;
       std::ifstream macPrefixStream(macPrefixPath);
       std::string line;
 
-      LOG_DEBUG << "Parsing MAC prefixes" << std::endl;
+      LOG_DEBUG << "Parsing MAC prefixes: " << macPrefixPath << std::endl;
 
-      std::regex macRegex("^[0-9A-F]{6} .*");
-      std::regex trim("^[ ]+|[ ]+$");
+      std::regex nmapRegex("^([0-9A-Fa-f]{6}|[0-9A-Fa-f]{7}|[0-9A-Fa-f]{9})"
+                           "[ \t]+(.*)$");
+      std::regex ieeeRegex("^MA-[LMS],([0-9A-Fa-f]{6}|[0-9A-Fa-f]{7}"
+                           "|[0-9A-Fa-f]{9}),(.*)$");
+      std::regex trim("^[ \t\r]+|[ \t\r]+$");
+      std::smatch match;
       while(std::getline(macPrefixStream, line)) {
-        // Only process MAC Vendor lines
-        if (!std::regex_match(line, macRegex)) { continue; }
-
-        std::istringstream splitter(line);
         std::string mac, vendor;
 
-        splitter >> mac;
-        std::getline(splitter, vendor);
+        // Only process MAC Vendor lines
+        if (std::regex_match(line, match, nmapRegex)) {
+          mac    = match[1];
+          vendor = match[2];
+        } else if (std::regex_match(line, match, ieeeRegex)) {
+          mac = match[1];
+          const std::string rest {match[2]};
+          if (!rest.empty() && '"' == rest[0]) {
+            // quoted, with "" as an escaped quote
+            for (size_t i {1}; i < rest.size(); ++i) {
+              if ('"' == rest[i]) {
+                if (i+1 < rest.size() && '"' == rest[i+1]) {
+                  ++i;
+                } else {
+                  break;
+                }
+              }
+              vendor += rest[i];
+            }
+          } else {
+            vendor = rest.substr(0, rest.find(','));
+          }
+        } else {
+          continue;
+        }
         vendor = std::regex_replace(vendor, trim, ""); // trim whitespace
-
-        if (macs.count(mac)) {
-          macs[mac] = macs[mac] + " | " + vendor;
+        if (vendor.empty()) { continue; }
+
+        const std::pair<std::string, size_t> key
+          {boost::to_upper_copy(mac) + std::string(12 - mac.size(), '0'),
+           mac.size() * 4};
+        if (prefixes.count(key)) {
+          auto& vendors {prefixes[key]};
+          if (vendors != vendor) {
+            vendors = vendors + " | " + vendor;
+          }
         }
         else {
-          macs[mac] = vendor;
+          prefixes[key] = vendor;
         }
       }
+    }
+
+    void
+    loadMacPrefixes(pqxx::work& work)
+    {
+      std::map<std::pair<std::string, size_t>, std::string> prefixes;
+      for (const auto& macPrefixPath : opts.getValues("mac-prefix-file")) {
+        parseMacPrefixFile(macPrefixPath, prefixes);
+      }
 
       try {
         auto stream = pqxx::stream_to::table(
             work
           , "vendor_mac_prefixes"
-          , std::vector<std::string>{"mac_prefix", "vendor_name"}
+          , std::vector<std::string>
+              {"mac_prefix", "prefix_length", "vendor_name"}
           );
         LOG_INFO << "Inserting MAC prefixes" << std::endl;
-        for (const auto& entry : macs) {
-          stream << std::make_tuple(entry.first + ":000000", entry.second);
+        for (const auto& [key, vendor] : prefixes) {
+          stream << std::make_tuple(key.first, key.second, vendor);
         }
         stream.complete();
       } catch(const std::exception& e) {
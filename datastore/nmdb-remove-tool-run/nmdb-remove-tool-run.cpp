@@ -58,11 +58,14 @@ class Tool : public nmdt::AbstractDatastoreTool
     int
     runTool() override
     {
+      profilePhase("startup");
+
       if (!opts.exists("tool-run-id")) {
         LOG_WARN << "UUID not given; not running"
                  << std::endl;
       } else {
         pqxx::connection db {getDbConnectString()};
+        profilePhase("connect");
 
         db.prepare("delete_tool_run", R"(
               DELETE FROM tool_runs
@@ -85,8 +88,10 @@ class Tool : public nmdt::AbstractDatastoreTool
                      << std::endl;
           }
         }
+        profilePhase("delete");
 
         t.commit();
+        profilePhase("commit");
       }
 
       return nmcu::Exit::SUCCESS;
@@ -24,6 +24,7 @@
 // Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
 // =============================================================================
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <regex>
@@ -82,6 +83,12 @@ namespace netmeld::playbook {
     return true;
   }
 
+  bool
+  CommandRunnerSingleton::willRun() const
+  {
+    return execute && isEnabled(commandIdNumber + 1);
+  }
+
   bool
   CommandRunnerSingleton::systemExec(std::string const& command)
   {
@@ -95,13 +102,31 @@ namespace netmeld::playbook {
     return true;
   }
 
-  void
+  bool
+  CommandRunnerSingleton::nativeExec(std::string const& description,
+      std::function<bool()> const& action)
+  {
+    if (isEnabled(++commandIdNumber)) {
+      LOG_INFO << commandIdNumber << ": " << description << std::endl;
+      if (execute) {
+        return action();
+      }
+    }
+
+    return true;
+  }
+
+  bool
   CommandRunnerSingleton::threadExec(
       std::vector<std::tuple<std::string, std::string>> const& commands)
   {
     std::vector<std::thread> threadVector;
+    std::vector<int> results(commands.size(), 0);
+    bool allRan {true};
 
-    for (const auto& [commandTitle, command]: commands) {
+    for (size_t i {0}; i < commands.size(); ++i) {
+      const auto& [commandTitle, command] {commands[i]};
+      allRan = allRan && willRun();
       if (isEnabled(++commandIdNumber)) {
         LOG_DEBUG << "# " << commandTitle << std::endl;
         LOG_INFO << commandIdNumber << ": " << command << std::endl;
@@ -111,7 +136,12 @@ namespace netmeld::playbook {
           if(headless) {
             threadActions = &CommandRunnerSingleton::tmuxThreadActions;
           }
-          threadVector.emplace_back(threadActions, this, commandTitle, command);
+          threadVector.emplace_back(
+              [this, threadActions, &result = results[i],
+               commandTitle, command]()
+              {
+                result = (this->*threadActions)(commandTitle, command);
+              });
         }
       }
     }
@@ -119,6 +149,10 @@ namespace netmeld::playbook {
     for (auto& tv : threadVector) {
       tv.join();
     }
+
+    return allRan
+        && std::all_of(results.begin(), results.end(),
+                       [](int result) { return 0 == result; });
   }
 
   void
@@ -134,7 +168,7 @@ namespace netmeld::playbook {
     }
   }
 
-  void
+  int
   CommandRunnerSingleton::xtermThreadActions(std::string const& title,
       std::string const& command) const
   {
@@ -148,10 +182,10 @@ namespace netmeld::playbook {
       "-e", command  // "-e command" must be the last option.
     };
 
-    nmcu::forkExecWait(xtermArgs);
+    return nmcu::forkExecWait(xtermArgs);
   }
 
-  void
+  int
   CommandRunnerSingleton::tmuxThreadActions(std::string const& title,
       std::string const& command) const
   {
@@ -188,7 +222,7 @@ namespace netmeld::playbook {
       "wait",
       tmuxSafeTitle + "-session"
     };
-    nmcu::forkExecWait(tmuxWaitArgs);
+    return nmcu::forkExecWait(tmuxWaitArgs);
   }
 
   // ===========================================================================
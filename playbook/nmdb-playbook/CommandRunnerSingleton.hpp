@@ -28,6 +28,7 @@
 #define COMMAND_RUNNER_SINGLETON_HPP
 
 #include <cstdint>
+#include <functional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -64,8 +65,8 @@ namespace netmeld::playbook {
     // =========================================================================
     private: // Methods which should be hidden from API users
     protected: // Methods part of subclass API
-      void xtermThreadActions(std::string const&, std::string const&) const;
-      void tmuxThreadActions(std::string const&, std::string const&) const;
+      int xtermThreadActions(std::string const&, std::string const&) const;
+      int tmuxThreadActions(std::string const&, std::string const&) const;
 
     public: // Methods part of public API
       static CommandRunnerSingleton& getInstance();
@@ -75,9 +76,13 @@ namespace netmeld::playbook {
       void setHeadless(bool const);
 
       bool isEnabled(size_t const) const;
+      // Whether the next command will actually be executed
+      bool willRun() const;
 
       bool systemExec(std::string const&);
-      void threadExec(std::vector<std::tuple<std::string, std::string>> const&);
+      bool nativeExec(std::string const&, std::function<bool()> const&);
+      // Returns whether every command ran and its terminal exited cleanly
+      bool threadExec(std::vector<std::tuple<std::string, std::string>> const&);
 
       void scheduleSleep(uint64_t const);
 
@@ -0,0 +1,445 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#include <algorithm>
+
+#include <boost/asio/ip/address.hpp>
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+
+#include "TargetGenerator.hpp"
+
+namespace bai = boost::asio::ip;
+
+
+namespace netmeld::playbook {
+
+  // ===========================================================================
+  // IpPrefix
+  // ===========================================================================
+  std::optional<IpPrefix>
+  IpPrefix::fromString(const std::string& value)
+  {
+    const auto pos {value.find('/')};
+    boost::system::error_code ec;
+    const auto addr {bai::make_address(value.substr(0, pos), ec)};
+    if (ec) {
+      return std::nullopt;
+    }
+
+    IpPrefix prefix;
+    if (addr.is_v4()) {
+      const auto octets {addr.to_v4().to_bytes()};
+      std::copy(octets.begin(), octets.end(), prefix.bytes.begin());
+      prefix.family = 4;
+    } else {
+      const auto octets {addr.to_v6().to_bytes()};
+      std::copy(octets.begin(), octets.end(), prefix.bytes.begin());
+      prefix.family = 6;
+    }
+
+    prefix.length = prefix.maxLength();
+    if (pos != std::string::npos) {
+      size_t length {0};
+      try {
+        length = std::stoul(value.substr(pos+1));
+      } catch (const std::exception&) {
+        return std::nullopt;
+      }
+      if (length > prefix.maxLength()) {
+        return std::nullopt;
+      }
+      prefix.length = static_cast<uint8_t>(length);
+    }
+
+    // Normalize; clear any host bits
+    for (size_t bit {prefix.length}; bit < prefix.maxLength(); ++bit) {
+      prefix.bytes[bit/8] &= static_cast<uint8_t>(~(0x80 >> (bit%8)));
+    }
+
+    return prefix;
+  }
+
+  uint8_t
+  IpPrefix::maxLength() const
+  {
+    return (4 == family) ? 32 : 128;
+  }
+
+  bool
+  IpPrefix::contains(const IpPrefix& other) const
+  {
+    if (family != other.family || length > other.length) {
+      return false;
+    }
+
+    const size_t fullBytes {length/8u};
+    if (!std::equal(bytes.begin(), bytes.begin()+fullBytes,
+                    other.bytes.begin()))
+    {
+      return false;
+    }
+
+    const size_t bits {length%8u};
+    if (0 == bits) {
+      return true;
+    }
+    const uint8_t mask {static_cast<uint8_t>(0xFF << (8 - bits))};
+    return (bytes[fullBytes] & mask) == (other.bytes[fullBytes] & mask);
+  }
+
+  std::pair<IpPrefix, IpPrefix>
+  IpPrefix::split() const
+  {
+    IpPrefix lower {*this};
+    ++lower.length;
+
+    IpPrefix upper {lower};
+    upper.bytes[length/8] |= static_cast<uint8_t>(0x80 >> (length%8));
+
+    return {lower, upper};
+  }
+
+  std::string
+  IpPrefix::toString() const
+  {
+    std::string out;
+    if (4 == family) {
+      bai::address_v4::bytes_type octets;
+      std::copy_n(bytes.begin(), octets.size(), octets.begin());
+      out = bai::address_v4(octets).to_string();
+    } else {
+      bai::address_v6::bytes_type octets;
+      std::copy_n(bytes.begin(), octets.size(), octets.begin());
+      out = bai::address_v6(octets).to_string();
+    }
+
+    if (length != maxLength()) {
+      out += "/" + std::to_string(length);
+    }
+
+    return out;
+  }
+
+
+  // ===========================================================================
+  // TargetGenerator
+  // ===========================================================================
+  namespace {
+    // Address order; a prefix sorts before everything it contains
+    bool
+    addressOrder(const IpPrefix& a, const IpPrefix& b)
+    {
+      return std::tie(a.family, a.bytes, a.length)
+           < std::tie(b.family, b.bytes, b.length);
+    }
+  }
+
+  std::vector<IpPrefix>
+  TargetGenerator::collapse(std::vector<IpPrefix> prefixes)
+  {
+    std::sort(prefixes.begin(), prefixes.end(), addressOrder);
+
+    std::vector<IpPrefix> out;
+    for (const auto& prefix : prefixes) {
+      if (!out.empty() && out.back().contains(prefix)) {
+        continue;
+      }
+      out.push_back(prefix);
+    }
+
+    return out;
+  }
+
+  std::vector<IpPrefix>
+  TargetGenerator::subtract(const std::vector<IpPrefix>& includes,
+                            const std::vector<IpPrefix>& excludes)
+  {
+    std::vector<IpPrefix> out;
+
+    std::vector<IpPrefix> work;
+    for (const auto& include : collapse(includes)) {
+      work.push_back(include);
+      while (!work.empty()) {
+        const auto prefix {work.back()};
+        work.pop_back();
+
+        bool removed {false};
+        bool overlaps {false};
+        for (const auto& exclude : excludes) {
+          if (exclude.contains(prefix)) {
+            removed = true;
+            break;
+          }
+          if (prefix.contains(exclude)) {
+            overlaps = true;
+          }
+        }
+
+        if (removed) {
+          continue;
+        }
+        if (overlaps) {
+          const auto& [lower, upper] {prefix.split()};
+          work.push_back(upper);
+          work.push_back(lower);
+          continue;
+        }
+        out.push_back(prefix);
+      }
+    }
+
+    return collapse(out);
+  }
+
+  bool
+  TargetGenerator::isInScope(const IpPrefix& host) const
+  {
+    // roeInScope is collapsed (sorted, disjoint) so only the closest
+    // preceding prefix can contain the host
+    auto it {std::upper_bound(roeInScope.begin(), roeInScope.end(),
+                              host, addressOrder)};
+    if (it == roeInScope.begin()) {
+      return false;
+    }
+    return std::prev(it)->contains(host);
+  }
+
+  void
+  TargetGenerator::loadRoe(pqxx::connection& db)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+    if (roeLoaded) {
+      return;
+    }
+
+    pqxx::read_transaction t {db};
+    pqxx::result rows {t.exec_prepared("select_playbook_roe_ip_nets")};
+    t.commit();
+
+    for (const auto& row : rows) {
+      std::string ipNet;
+      row.at("ip_net").to(ipNet);
+      bool inScope;
+      row.at("in_scope").to(inScope);
+
+      const auto& prefix {IpPrefix::fromString(ipNet)};
+      if (!prefix) {
+        LOG_WARN << "Skipping unparsable RoE network: " << ipNet << '\n';
+        continue;
+      }
+      (inScope ? roeIncludes : roeExcludes).push_back(*prefix);
+    }
+
+    roeExcludes = collapse(roeExcludes);
+    roeIncludes = collapse(roeIncludes);
+    roeInScope  = subtract(roeIncludes, roeExcludes);
+    roeLoaded   = true;
+
+    LOG_DEBUG << "RoE networks loaded; includes: " << roeIncludes.size()
+              << ", excludes: " << roeExcludes.size()
+              << ", in scope: " << roeInScope.size()
+              << '\n';
+  }
+
+  void
+  TargetGenerator::refreshRespondingHosts(pqxx::connection& db)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    pqxx::read_transaction t {db};
+    pqxx::result rows {
+        t.exec_prepared("select_playbook_responding_hosts_since",
+                        lastObserved)
+      };
+    t.commit();
+
+    // Rows at exactly the previous mark, and those of untimed tool runs, are
+    // re-read; the sets dedupe them
+    std::string newestObserved {lastObserved};
+    for (const auto& row : rows) {
+      std::string ipAddr;
+      row.at("ip_addr").to(ipAddr);
+      std::string commandLine;
+      row.at("command_line").to(commandLine);
+      std::string observed; // none for untimed (e.g., human) tool runs
+      row.at("observed_at").to(observed);
+
+      const auto& host {IpPrefix::fromString(ipAddr)};
+      if (!host) {
+        continue;
+      }
+      respondingHosts.insert(*host);
+      if (!commandLine.empty()) {
+        nmapRunHosts[commandLine].insert(*host);
+      }
+
+      if (   !observed.empty()
+          && ("-infinity" == newestObserved || observed > newestObserved))
+      {
+        newestObserved = observed;
+      }
+    }
+    lastObserved = newestObserved;
+
+    LOG_DEBUG << "Responding hosts refreshed; new rows: " << rows.size()
+              << ", known hosts: " << respondingHosts.size()
+              << '\n';
+  }
+
+  std::vector<std::string>
+  TargetGenerator::filterHosts(const std::set<IpPrefix>& hosts,
+                               uint8_t family,
+                               const std::optional<IpPrefix>& scope,
+                               bool delta, const std::string& path)
+  {
+    std::set<IpPrefix>* pending {nullptr};
+    if (delta) {
+      pending = &pendingHosts[path];
+    }
+
+    std::vector<std::string> out;
+    for (const auto& host : hosts) {
+      if (   (family != host.family)
+          || (scope && !scope->contains(host))
+          || !isInScope(host))
+      {
+        continue;
+      }
+      if (   pending
+          && (emittedHosts.count(host) || !pending->insert(host).second))
+      {
+        continue;
+      }
+      out.push_back(host.toString());
+    }
+
+    if (pending && pending->empty()) {
+      pendingHosts.erase(path);
+    }
+
+    return out;
+  }
+
+  std::vector<std::string>
+  TargetGenerator::getRoeExcludes(uint8_t family) const
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    std::vector<std::string> out;
+    for (const auto& prefix : roeExcludes) {
+      if (family == prefix.family) {
+        out.push_back(prefix.toString());
+      }
+    }
+
+    return out;
+  }
+
+  std::vector<std::string>
+  TargetGenerator::getRoeIncludes(uint8_t family) const
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    std::vector<std::string> out;
+    for (const auto& prefix : roeInScope) {
+      if (family == prefix.family) {
+        out.push_back(prefix.toString());
+      }
+    }
+
+    return out;
+  }
+
+  std::vector<std::string>
+  TargetGenerator::getRespondingHosts(uint8_t family,
+                                      const std::string& ipNet, bool delta,
+                                      const std::string& path)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    std::optional<IpPrefix> scope;
+    if (!ipNet.empty()) {
+      scope = IpPrefix::fromString(ipNet);
+    }
+
+    return filterHosts(respondingHosts, family, scope, delta, path);
+  }
+
+  std::vector<std::string>
+  TargetGenerator::getNmapRespondingHosts(uint8_t family,
+                                          const std::string& savePath,
+                                          bool delta,
+                                          const std::string& path)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    std::set<IpPrefix> hosts;
+    for (const auto& [commandLine, runHosts] : nmapRunHosts) {
+      if (   (commandLine.find(savePath) != std::string::npos)
+          && (commandLine.find("RoE-") != std::string::npos))
+      {
+        hosts.insert(runHosts.begin(), runHosts.end());
+      }
+    }
+
+    return filterHosts(hosts, family, std::nullopt, delta, path);
+  }
+
+  std::vector<std::string>
+  TargetGenerator::getPendingPaths() const
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    std::vector<std::string> out;
+    for (const auto& [path, _] : pendingHosts) {
+      out.push_back(path);
+    }
+
+    return out;
+  }
+
+  void
+  TargetGenerator::confirmHosts(const std::string& path)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    const auto it {pendingHosts.find(path)};
+    if (it == pendingHosts.end()) {
+      return;
+    }
+    emittedHosts.insert(it->second.begin(), it->second.end());
+    pendingHosts.erase(it);
+  }
+
+  void
+  TargetGenerator::discardHosts(const std::string& path)
+  {
+    std::lock_guard<std::mutex> lock {mutex};
+
+    pendingHosts.erase(path);
+  }
+}
@@ -0,0 +1,146 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#ifndef TARGET_GENERATOR_HPP
+#define TARGET_GENERATOR_HPP
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+
+namespace netmeld::playbook {
+
+  // Compact CIDR prefix used for in-memory RoE set arithmetic
+  struct IpPrefix
+  {
+    uint8_t                   family  {0}; // 4 or 6
+    uint8_t                   length  {0};
+    std::array<uint8_t, 16>   bytes   {};
+
+    static std::optional<IpPrefix> fromString(const std::string&);
+
+    uint8_t maxLength() const;
+    bool contains(const IpPrefix&) const;
+    std::pair<IpPrefix, IpPrefix> split() const;
+
+    std::string toString() const;
+
+    auto operator<=>(const IpPrefix&) const = default;
+  };
+
+
+  /* Generates playbook target lists natively instead of via per-phase psql
+     runs.  The RoE networks are queried once and kept in memory, responding
+     hosts are pulled incrementally (only rows from tool runs newer than the
+     last pull, plus the untimed ones), and responding host lists can be
+     emitted as deltas so hosts already handed to an earlier phase are not
+     re-targeted.  Delta hosts stay pending for their target file until a
+     command reading that file succeeds (see confirmHosts()), so a failed
+     or skipped scan does not drop them from later phases.
+  */
+  class TargetGenerator
+  {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      mutable std::mutex mutex;
+
+      bool roeLoaded {false};
+
+      std::vector<IpPrefix> roeIncludes;
+      std::vector<IpPrefix> roeExcludes;
+
+      std::string lastObserved {"-infinity"};
+      std::map<std::string, std::set<IpPrefix>> nmapRunHosts;
+
+    protected: // Variables intended for internal/subclass API
+      std::vector<IpPrefix> roeInScope; // includes minus excludes
+
+      std::set<IpPrefix> respondingHosts;
+
+      // Delta hosts handed to a command that succeeded
+      std::set<IpPrefix> emittedHosts;
+      // Delta hosts written to a target file, keyed by its path
+      std::map<std::string, std::set<IpPrefix>> pendingHosts;
+
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors part of public API
+      TargetGenerator() = default;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+    protected: // Methods part of subclass API
+      bool isInScope(const IpPrefix&) const;
+      std::vector<std::string>
+        filterHosts(const std::set<IpPrefix>&, uint8_t,
+                    const std::optional<IpPrefix>&, bool,
+                    const std::string&);
+
+    public: // Methods part of public API
+      static std::vector<IpPrefix> collapse(std::vector<IpPrefix>);
+      static std::vector<IpPrefix>
+        subtract(const std::vector<IpPrefix>&, const std::vector<IpPrefix>&);
+
+      void loadRoe(pqxx::connection&);
+      void refreshRespondingHosts(pqxx::connection&);
+
+      std::vector<std::string> getRoeExcludes(uint8_t) const;
+      std::vector<std::string> getRoeIncludes(uint8_t) const;
+
+      // Hosts for the target file at the given (last) path; with delta,
+      // those not yet emitted and now pending for that path
+      std::vector<std::string>
+        getRespondingHosts(uint8_t, const std::string&, bool,
+                           const std::string&);
+      std::vector<std::string>
+        getNmapRespondingHosts(uint8_t, const std::string&, bool,
+                               const std::string&);
+
+      // Paths of target files with pending delta hosts
+      std::vector<std::string> getPendingPaths() const;
+      // Mark the file's pending hosts emitted, after its command succeeded
+      void confirmHosts(const std::string&);
+      // Drop the file's pending hosts, so later phases target them again
+      void discardHosts(const std::string&);
+  };
+}
+#endif // TARGET_GENERATOR_HPP
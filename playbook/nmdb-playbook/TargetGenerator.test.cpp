@@ -0,0 +1,249 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+// =============================================================================
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include "TargetGenerator.hpp"
+
+namespace nmpb = netmeld::playbook;
+
+using nmpb::IpPrefix;
+
+
+class TestTargetGenerator : public nmpb::TargetGenerator {
+  public:
+    using TargetGenerator::roeInScope;
+    using TargetGenerator::respondingHosts;
+    using TargetGenerator::emittedHosts;
+    using TargetGenerator::pendingHosts;
+
+    using TargetGenerator::isInScope;
+    using TargetGenerator::filterHosts;
+};
+
+IpPrefix
+toPrefix(const std::string& value)
+{
+  const auto& prefix {IpPrefix::fromString(value)};
+  BOOST_REQUIRE_MESSAGE(prefix, "Failed to parse: " + value);
+  return *prefix;
+}
+
+std::vector<IpPrefix>
+toPrefixes(const std::vector<std::string>& values)
+{
+  std::vector<IpPrefix> out;
+  for (const auto& value : values) {
+    out.push_back(toPrefix(value));
+  }
+  return out;
+}
+
+std::vector<std::string>
+toStrings(const std::vector<IpPrefix>& prefixes)
+{
+  std::vector<std::string> out;
+  for (const auto& prefix : prefixes) {
+    out.push_back(prefix.toString());
+  }
+  return out;
+}
+
+BOOST_AUTO_TEST_CASE(testIpPrefixFromString)
+{
+  {
+    const auto& prefix {toPrefix("10.1.2.3/16")};
+    BOOST_TEST(4 == prefix.family);
+    BOOST_TEST(16 == prefix.length);
+    BOOST_TEST("10.1.0.0/16" == prefix.toString());
+  }
+  {
+    const auto& prefix {toPrefix("10.1.2.3")};
+    BOOST_TEST(32 == prefix.length);
+    BOOST_TEST("10.1.2.3" == prefix.toString());
+  }
+  {
+    const auto& prefix {toPrefix("2001:db8::1/33")};
+    BOOST_TEST(6 == prefix.family);
+    BOOST_TEST(33 == prefix.length);
+    BOOST_TEST("2001:db8::/33" == prefix.toString());
+  }
+  {
+    const auto& prefix {toPrefix("::1")};
+    BOOST_TEST(128 == prefix.length);
+    BOOST_TEST("::1" == prefix.toString());
+  }
+
+  for (const auto& bad : {"", "10.1.2", "10.1.2.3/33", "2001:db8::/129",
+                          "10.1.2.3/x", "host.example"})
+  {
+    BOOST_TEST(!IpPrefix::fromString(bad), bad);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIpPrefixContainsAndSplit)
+{
+  const auto& net {toPrefix("10.0.0.0/24")};
+  BOOST_TEST(net.contains(net));
+  BOOST_TEST(net.contains(toPrefix("10.0.0.255")));
+  BOOST_TEST(net.contains(toPrefix("10.0.0.128/25")));
+  BOOST_TEST(!net.contains(toPrefix("10.0.1.0")));
+  BOOST_TEST(!net.contains(toPrefix("10.0.0.0/23")));
+  BOOST_TEST(!net.contains(toPrefix("::a00:0")));
+  BOOST_TEST(toPrefix("0.0.0.0/0").contains(toPrefix("192.0.2.1")));
+
+  const auto& [lower, upper] {net.split()};
+  BOOST_TEST("10.0.0.0/25" == lower.toString());
+  BOOST_TEST("10.0.0.128/25" == upper.toString());
+
+  const auto& [lower6, upper6] {toPrefix("2001:db8::/32").split()};
+  BOOST_TEST("2001:db8::/33" == lower6.toString());
+  BOOST_TEST("2001:db8:8000::/33" == upper6.toString());
+}
+
+BOOST_AUTO_TEST_CASE(testCollapse)
+{
+  BOOST_TEST(toStrings(nmpb::TargetGenerator::collapse({})).empty());
+
+  const auto& out {nmpb::TargetGenerator::collapse(toPrefixes({
+      "10.0.1.0/24", "10.0.0.5", "2001:db8::/32", "10.0.0.0/16",
+      "192.0.2.0/24", "10.0.0.0/16", "2001:db8:1::1", "192.0.2.0/25",
+    }))};
+  const std::vector<std::string> expected {
+      "10.0.0.0/16", "192.0.2.0/24", "2001:db8::/32",
+    };
+  BOOST_TEST(expected == toStrings(out), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(testSubtract)
+{
+  {
+    const auto& out {nmpb::TargetGenerator::subtract(
+        toPrefixes({"10.0.0.0/24"}), toPrefixes({"10.0.0.0/26"}))};
+    const std::vector<std::string> expected {
+        "10.0.0.64/26", "10.0.0.128/25",
+      };
+    BOOST_TEST(expected == toStrings(out), boost::test_tools::per_element());
+  }
+  {
+    const auto& out {nmpb::TargetGenerator::subtract(
+        toPrefixes({"10.0.0.0/30", "192.0.2.0/24"}),
+        toPrefixes({"10.0.0.2", "10.0.0.0/8", "198.51.100.0/24"}))};
+    const std::vector<std::string> expected {"192.0.2.0/24"};
+    BOOST_TEST(expected == toStrings(out), boost::test_tools::per_element());
+  }
+  {
+    const auto& out {nmpb::TargetGenerator::subtract(
+        toPrefixes({"10.0.0.0/30", "2001:db8::/126"}),
+        toPrefixes({"10.0.0.1", "2001:db8::3"}))};
+    const std::vector<std::string> expected {
+        "10.0.0.0", "10.0.0.2/31", "2001:db8::/127", "2001:db8::2",
+      };
+    BOOST_TEST(expected == toStrings(out), boost::test_tools::per_element());
+  }
+  {
+    const auto& out {nmpb::TargetGenerator::subtract(
+        toPrefixes({"10.0.0.0/24"}), {})};
+    const std::vector<std::string> expected {"10.0.0.0/24"};
+    BOOST_TEST(expected == toStrings(out), boost::test_tools::per_element());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testIsInScope)
+{
+  TestTargetGenerator tg;
+  BOOST_TEST(!tg.isInScope(toPrefix("10.0.0.1")));
+
+  tg.roeInScope = nmpb::TargetGenerator::subtract(
+      toPrefixes({"10.0.0.0/24", "192.0.2.0/24", "2001:db8::/64"}),
+      toPrefixes({"10.0.0.0/26", "192.0.2.128/25"}));
+
+  for (const auto& host : {"10.0.0.64", "10.0.0.255", "192.0.2.0",
+                           "192.0.2.127", "2001:db8::1"})
+  {
+    BOOST_TEST(tg.isInScope(toPrefix(host)), host);
+  }
+  for (const auto& host : {"10.0.0.0", "10.0.0.63", "10.0.1.0", "9.255.255.255",
+                           "192.0.2.128", "192.0.3.0", "2001:db8:0:1::1",
+                           "::a00:40"})
+  {
+    BOOST_TEST(!tg.isInScope(toPrefix(host)), host);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testDeltaPendingUntilConfirmed)
+{
+  TestTargetGenerator tg;
+  tg.roeInScope = toPrefixes({"10.0.0.0/24", "2001:db8::/64"});
+  for (const auto& host : toPrefixes({"10.0.0.1", "10.0.0.2", "10.0.1.1",
+                                      "2001:db8::1"}))
+  {
+    tg.respondingHosts.insert(host);
+  }
+
+  const std::vector<std::string> expected {"10.0.0.1", "10.0.0.2"};
+  const std::vector<std::string> none;
+
+  // Without delta, everything in scope and nothing pending
+  BOOST_TEST(expected == tg.getRespondingHosts(4, "", false, "a"),
+             boost::test_tools::per_element());
+  BOOST_TEST(tg.getPendingPaths().empty());
+
+  // Written hosts are pending, not emitted, for their file
+  BOOST_TEST(expected == tg.getRespondingHosts(4, "", true, "a"),
+             boost::test_tools::per_element());
+  BOOST_TEST(none == tg.getRespondingHosts(4, "", true, "a"),
+             boost::test_tools::per_element());
+  BOOST_TEST(tg.emittedHosts.empty());
+  BOOST_TEST(std::vector<std::string>{"a"} == tg.getPendingPaths(),
+             boost::test_tools::per_element());
+
+  // A failed (discarded) consumer leaves them for later phases
+  tg.discardHosts("a");
+  BOOST_TEST(tg.getPendingPaths().empty());
+  BOOST_TEST(std::vector<std::string>{"10.0.0.2"}
+               == tg.getRespondingHosts(4, "10.0.0.2/31", true, "b"),
+             boost::test_tools::per_element());
+
+  // A successful consumer emits them
+  tg.confirmHosts("b");
+  BOOST_TEST(tg.getPendingPaths().empty());
+  BOOST_TEST(1 == tg.emittedHosts.size());
+  BOOST_TEST(std::vector<std::string>{"10.0.0.1"}
+               == tg.getRespondingHosts(4, "", true, "c"),
+             boost::test_tools::per_element());
+  BOOST_TEST(std::vector<std::string>{"2001:db8::1"}
+               == tg.getRespondingHosts(6, "", true, "c"),
+             boost::test_tools::per_element());
+  tg.confirmHosts("c");
+  BOOST_TEST(none == tg.getRespondingHosts(4, "", true, "d"),
+             boost::test_tools::per_element());
+  BOOST_TEST(none == tg.getRespondingHosts(6, "", true, "d"),
+             boost::test_tools::per_element());
+  BOOST_TEST(tg.getPendingPaths().empty());
+}
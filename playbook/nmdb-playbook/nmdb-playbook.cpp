@@ -43,6 +43,7 @@
 #include "RaiiIpLink.hpp"
 #include "RaiiMacAddr.hpp"
 #include "RaiiVlan.hpp"
+#include "TargetGenerator.hpp"
 
 namespace nmco = netmeld::core::objects;
 namespace nmcu = netmeld::core::utils;
@@ -52,6 +53,7 @@ namespace nmpbu = netmeld::playbook::utils;
 
 // Start of OLD PLAYBOOK DATA
 
+#include <fstream>
 #include <map>
 #include <mutex>
 #include <thread>
@@ -214,6 +216,8 @@ class Tool : public nmdt::AbstractDatastoreTool
         nmpb::CommandRunnerSingleton::getInstance()
       };
 
+    nmpb::TargetGenerator targetGenerator;
+
   protected: // Variables intended for internal/subclass API
   public: // Variables should rarely appear at this scope
 
@@ -490,6 +494,9 @@ class Tool : public nmdt::AbstractDatastoreTool
       pqxx::connection db {getDbConnectString()};
       queriesPb.dbPrepare(db);
 
+      // RoE is static for the run, so only query it once
+      targetGenerator.loadRoe(db);
+
       std::string query;
       switch (playbookScope) {
         case PlaybookScope::INTRA_NETWORK:
@@ -977,13 +984,28 @@ class Tool : public nmdt::AbstractDatastoreTool
             continue;
           }
 
+          if (yCmdSet["targets"].IsDefined()) {
+            stageEnabled = runPhaseTargets(db, yCmdSet, phaseConf);
+            continue;
+          }
+
           auto addrFamily {phaseConf.familyTarget()};
 
           std::vector<std::tuple<std::string, std::string>> commands;
           addPhaseCommands(commands, yCmdSet["always"], phaseConf);
           addPhaseCommands(commands, yCmdSet[addrFamily], phaseConf);
 
-          stageEnabled = runPhaseCommands(commands, yCmdSet);
+          bool succeeded {false};
+          stageEnabled = runPhaseCommands(commands, yCmdSet, succeeded);
+          if (succeeded) {
+            confirmConsumedTargets(commands);
+          }
+        }
+
+        // Targets no command consumed are offered again in later phases
+        for (const auto& path : targetGenerator.getPendingPaths()) {
+          LOG_DEBUG << "Discarding unconsumed targets: " << path << '\n';
+          targetGenerator.discardHosts(path);
         }
 
         // update in case of alternate logic
@@ -1016,10 +1038,26 @@ class Tool : public nmdt::AbstractDatastoreTool
       }
     }
 
+    // Delta targets count as handed out once a command reading their file
+    // succeeded, not when the file was written
+    void
+    confirmConsumedTargets(
+      const std::vector<std::tuple<std::string, std::string>>& commands)
+    {
+      for (const auto& path : targetGenerator.getPendingPaths()) {
+        for (const auto& [_, cmd] : commands) {
+          if (cmd.find(path) != std::string::npos) {
+            targetGenerator.confirmHosts(path);
+            break;
+          }
+        }
+      }
+    }
+
     bool
     runPhaseCommands(
       const std::vector<std::tuple<std::string, std::string>>& commands,
-      const YAML::Node& yCmdSet)
+      const YAML::Node& yCmdSet, bool& succeeded)
     {
       bool stageEnabled       {true};
       const auto& cmdSetName  {yCmdSet["name"].as<std::string>()};
@@ -1037,8 +1075,11 @@ class Tool : public nmdt::AbstractDatastoreTool
         LOG_INFO << "\n## " << cmdSetName
                  << std::endl;
 
+        succeeded = true;
         for (const auto& [_, cmd] : commands) {
+          succeeded = succeeded && cmdRunner.willRun();
           bool execSuccess {cmdRunner.systemExec(cmd)};
+          succeeded = succeeded && execSuccess;
           const auto& disableType {getDisableType(yFailMap)};
           if (!execSuccess) {
             if ("stage" == disableType) {
@@ -1056,7 +1097,78 @@ class Tool : public nmdt::AbstractDatastoreTool
         LOG_DEBUG << "# Ran in parallel";
         LOG_INFO << "\n## " << cmdSetName
                  << std::endl;
-        cmdRunner.threadExec(commands);
+        succeeded = cmdRunner.threadExec(commands);
+      }
+
+      return stageEnabled;
+    }
+
+    bool
+    runPhaseTargets(pqxx::connection& db, const YAML::Node& yCmdSet,
+                    const PhaseConfig& phaseConf)
+    {
+      bool stageEnabled       {true};
+      const auto& cmdSetName  {yCmdSet["name"].as<std::string>()};
+      const auto& yFailMap    {yCmdSet["on-fail"]};
+      const auto& yTargets    {yCmdSet["targets"]};
+
+      const auto& type  {yTargets["type"].as<std::string>()};
+      const auto& path  {
+          phaseConf.regexReplace(yTargets["path"].as<std::string>())
+        };
+      const bool delta  {yIs<bool>(yTargets, "delta", true)};
+      const auto family {
+          static_cast<uint8_t>(std::stoi(phaseConf.family))
+        };
+
+      std::lock_guard<std::mutex> coutLock {nmpb::coutMutex};
+      LOG_DEBUG << "# Ran natively";
+      LOG_INFO << "\n## " << cmdSetName
+               << std::endl;
+
+      std::ostringstream ossDesc;
+      ossDesc << "generate " << type << " targets"
+              << (delta ? " (delta)" : "")
+              << " >> " << path;
+
+      auto generate = [&, this]() -> bool
+        {
+          std::vector<std::string> targets;
+          if ("roe-exclude" == type) {
+            targets = targetGenerator.getRoeExcludes(family);
+          } else if ("roe-include" == type) {
+            targets = targetGenerator.getRoeIncludes(family);
+          } else if ("responding-hosts-intra" == type) {
+            targetGenerator.refreshRespondingHosts(db);
+            targets = targetGenerator.getRespondingHosts(
+                family, phaseConf.ipNet, delta, path);
+          } else if ("responding-hosts-inter" == type) {
+            targetGenerator.refreshRespondingHosts(db);
+            targets = targetGenerator.getNmapRespondingHosts(
+                family, phaseConf.savePath, delta, path);
+          } else {
+            LOG_ERROR << "Unknown target type: " << type << '\n';
+            return false;
+          }
+
+          std::ofstream ofs {path, std::ios::app};
+          for (const auto& target : targets) {
+            ofs << target << '\n';
+          }
+          LOG_DEBUG << "Wrote " << targets.size() << " targets\n";
+
+          return ofs.good();
+        };
+
+      if (!cmdRunner.nativeExec(ossDesc.str(), generate)
+          && yFailMap.IsDefined())
+      {
+        if ("stage" == getDisableType(yFailMap)) {
+          stageEnabled = false;
+        }
+        LOG_WARN << '\n' << yFailMap["msg"].as<std::string>()
+                 << std::endl;
+        cmdRunner.setExecute(false); // disable to maintain count
       }
 
       return stageEnabled;
@@ -0,0 +1,179 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+extern "C" {
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+
+#include "LogSink.hpp"
+
+
+namespace netmeld::tools::clw {
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  LogSink::LogSink(const std::filesystem::path& _path,
+                   LogCompression _compression,
+                   std::chrono::milliseconds _flushInterval) :
+    path(_path),
+    flushInterval(_flushInterval),
+    lastFlush(std::chrono::steady_clock::now())
+  {
+    if (LogCompression::GZIP == _compression) {
+      path += ".gz";
+    }
+
+    fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (-1 == fd) {
+      LOG_ERROR << "Failed to open log (" << errno << ": "
+                << std::strerror(errno) << "): " << path << std::endl;
+      return;
+    }
+
+    if (LogCompression::GZIP == _compression) {
+      gz = gzdopen(fd, "wb");
+      if (nullptr == gz) {
+        LOG_ERROR << "Failed to initialize compression: " << path << std::endl;
+        ::close(fd);
+        fd = -1;
+        return;
+      }
+      gzbuffer(gz, 128 * 1024);
+    }
+  }
+
+  LogSink::~LogSink()
+  {
+    close();
+  }
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  bool
+  LogSink::isCompressed() const
+  {
+    return nullptr != gz;
+  }
+
+  const std::filesystem::path&
+  LogSink::getPath() const
+  {
+    return path;
+  }
+
+  int
+  LogSink::getRawFd() const
+  {
+    return isCompressed() ? -1 : fd;
+  }
+
+  void
+  LogSink::write(const char* _data, size_t _size)
+  {
+    if (isCompressed()) {
+      if (0 == gzwrite(gz, _data, static_cast<unsigned>(_size))) {
+        LOG_WARN << "Compressed log write failure: " << path << std::endl;
+      }
+      pendingFlush = true;
+      flush();
+      return;
+    }
+
+    while (-1 != fd && 0 < _size) {
+      ssize_t count {::write(fd, _data, _size)};
+      if (0 > count) {
+        if (EINTR == errno) { continue; }
+        LOG_WARN << "Log write failure (" << errno << ": "
+                 << std::strerror(errno) << "): " << path << std::endl;
+        return;
+      }
+      _data += count;
+      _size -= static_cast<size_t>(count);
+    }
+  }
+
+  void
+  LogSink::flush(bool _force)
+  {
+    if (!(isCompressed() && pendingFlush)) { return; }
+
+    const auto now {std::chrono::steady_clock::now()};
+    if (_force || (now - lastFlush) >= flushInterval) {
+      gzflush(gz, Z_SYNC_FLUSH);
+      lastFlush     = now;
+      pendingFlush  = false;
+    }
+  }
+
+  void
+  LogSink::close()
+  {
+    if (isCompressed()) {
+      // Also closes the underlying descriptor
+      gzclose(gz);
+      gz = nullptr;
+      fd = -1;
+    } else if (-1 != fd) {
+      ::close(fd);
+      fd = -1;
+    }
+  }
+
+  // ===========================================================================
+  // Friends
+  // ===========================================================================
+  std::istream&
+  operator>>(std::istream& is, LogCompression& compression)
+  {
+    std::string value;
+    is >> value;
+    if ("none" == value) {
+      compression = LogCompression::NONE;
+    } else if ("gzip" == value) {
+      compression = LogCompression::GZIP;
+    } else {
+      is.setstate(std::ios::failbit);
+    }
+    return is;
+  }
+
+  std::ostream&
+  operator<<(std::ostream& os, const LogCompression& compression)
+  {
+    switch (compression) {
+      case LogCompression::GZIP: return os << "gzip";
+      default:                   return os << "none";
+    }
+  }
+}
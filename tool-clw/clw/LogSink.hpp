@@ -0,0 +1,100 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#ifndef CLW_LOG_SINK_HPP
+#define CLW_LOG_SINK_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+
+#include <zlib.h>
+
+namespace netmeld::tools::clw {
+
+  enum class LogCompression {
+    NONE = 0,
+    GZIP
+  };
+
+  std::istream& operator>>(std::istream&, LogCompression&);
+  std::ostream& operator<<(std::ostream&, const LogCompression&);
+
+  /*
+    Destination for a captured stream.
+
+    Uncompressed logs are written straight to the file descriptor, so there
+    is no user space buffering to lose.  Compressed logs are periodically
+    sync flushed so a partial log remains readable (e.g., via `zcat`) even if
+    the capture terminates unexpectedly.
+  */
+  class LogSink {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      int     fd  {-1};
+      gzFile  gz  {nullptr};
+
+      std::filesystem::path                 path;
+      std::chrono::milliseconds             flushInterval;
+      std::chrono::steady_clock::time_point lastFlush;
+      bool                                  pendingFlush {false};
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors and destructors part of public API
+      LogSink() = delete;
+      LogSink(const std::filesystem::path&, LogCompression,
+              std::chrono::milliseconds = std::chrono::seconds(1));
+      ~LogSink();
+
+      LogSink(const LogSink&) = delete;
+      void operator=(const LogSink&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      bool isCompressed() const;
+      const std::filesystem::path& getPath() const;
+
+      // Raw descriptor for zero copy writes, -1 when compressed
+      int getRawFd() const;
+
+      void write(const char*, size_t);
+      void flush(bool = false);
+      void close();
+  };
+}
+#endif  /* CLW_LOG_SINK_HPP */
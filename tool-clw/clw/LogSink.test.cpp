@@ -0,0 +1,134 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include "LogSink.hpp"
+
+namespace nmtc = netmeld::tools::clw;
+
+
+namespace {
+  std::filesystem::path
+  getTestPath(const std::string& _name)
+  {
+    return std::filesystem::temp_directory_path()/("clw-unit-test-" + _name);
+  }
+
+  std::string
+  readPlain(const std::filesystem::path& _path)
+  {
+    std::ifstream f {_path};
+    std::ostringstream oss;
+    oss << f.rdbuf();
+    return oss.str();
+  }
+
+  std::string
+  readGzip(const std::filesystem::path& _path)
+  {
+    std::string data;
+    gzFile gz {gzopen(_path.c_str(), "rb")};
+    char buffer[256];
+    for (int count; 0 < (count = gzread(gz, buffer, sizeof(buffer)));) {
+      data.append(buffer, static_cast<size_t>(count));
+    }
+    gzclose(gz);
+    return data;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLogCompressionStreams)
+{
+  {
+    nmtc::LogCompression lc;
+    std::istringstream iss {"gzip"};
+    iss >> lc;
+    BOOST_TEST(!iss.fail());
+    BOOST_TEST(nmtc::LogCompression::GZIP == lc);
+
+    std::ostringstream oss;
+    oss << lc;
+    BOOST_TEST("gzip" == oss.str());
+  }
+  {
+    nmtc::LogCompression lc;
+    std::istringstream iss {"none"};
+    iss >> lc;
+    BOOST_TEST(!iss.fail());
+    BOOST_TEST(nmtc::LogCompression::NONE == lc);
+  }
+  {
+    nmtc::LogCompression lc;
+    std::istringstream iss {"zip"};
+    iss >> lc;
+    BOOST_TEST(iss.fail());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLogSinkPlain)
+{
+  const auto path {getTestPath("plain.txt")};
+  {
+    nmtc::LogSink sink {path, nmtc::LogCompression::NONE};
+    BOOST_TEST(!sink.isCompressed());
+    BOOST_TEST(-1 != sink.getRawFd());
+    BOOST_TEST(path == sink.getPath());
+
+    sink.write("abc", 3);
+    // unbuffered, so visible immediately
+    BOOST_TEST("abc" == readPlain(path));
+    sink.write("def", 3);
+  }
+  BOOST_TEST("abcdef" == readPlain(path));
+  std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE(testLogSinkGzip)
+{
+  const auto path {getTestPath("gzip.txt")};
+  auto gzPath {path};
+  gzPath += ".gz";
+  {
+    nmtc::LogSink sink {path, nmtc::LogCompression::GZIP,
+                        std::chrono::milliseconds(0)};
+    BOOST_TEST(sink.isCompressed());
+    BOOST_TEST(-1 == sink.getRawFd());
+    BOOST_TEST(gzPath == sink.getPath());
+
+    sink.write("abc", 3);
+    // zero interval flush means the partial stream is already readable
+    BOOST_TEST("abc" == readGzip(gzPath));
+    sink.write("def", 3);
+  }
+  BOOST_TEST(!std::filesystem::exists(path));
+  BOOST_TEST("abcdef" == readGzip(gzPath));
+  std::filesystem::remove(gzPath);
+}
@@ -0,0 +1,264 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+extern "C" {
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/stat.h>
+}
+
+#include <netmeld/core/utils/LoggerSingleton.hpp>
+
+#include "StreamForwarder.hpp"
+
+
+namespace netmeld::tools::clw {
+
+  // Unnamed namespace to hide helper logic
+  namespace {
+    void
+    closePipe(int (&fds)[2])
+    {
+      for (auto& fd : fds) {
+        if (-1 != fd) {
+          close(fd);
+          fd = -1;
+        }
+      }
+    }
+
+    bool
+    isUnsupported(int err)
+    {
+      return EINVAL == err || ENOSYS == err || EOPNOTSUPP == err;
+    }
+  }
+
+  // ===========================================================================
+  // Constructors and Destructors
+  // ===========================================================================
+  StreamForwarder::StreamForwarder(int _srcFd, int _dstFd, LogSink& _log,
+                                   size_t _bufferSize, bool _zeroCopy) :
+    srcFd(_srcFd),
+    dstFd(_dstFd),
+    log(_log),
+    buffer(std::max<size_t>(1, _bufferSize))
+  {
+    if (!_zeroCopy || -1 == log.getRawFd()) { return; }
+
+    struct stat srcStat;
+    srcIsPipe = (0 == fstat(srcFd, &srcStat)) && S_ISFIFO(srcStat.st_mode);
+
+    if (-1 == pipe2(logPipe, O_CLOEXEC)
+        || (!srcIsPipe && -1 == pipe2(stagePipe, O_CLOEXEC)))
+    {
+      LOG_DEBUG << "Zero copy pipe creation failure: "
+                << std::strerror(errno) << std::endl;
+      closePipe(logPipe);
+      closePipe(stagePipe);
+      return;
+    }
+
+    // Staged data must always fit in the log pipe, so a tee is never partial
+    const int pipeSize {static_cast<int>(buffer.size())};
+    for (int fd : {logPipe[1], stagePipe[1]}) {
+      if (-1 != fd) {
+        fcntl(fd, F_SETPIPE_SZ, pipeSize);
+      }
+    }
+    const int logPipeSize {fcntl(logPipe[1], F_GETPIPE_SZ)};
+    if (0 < logPipeSize && static_cast<size_t>(logPipeSize) < buffer.size()) {
+      buffer.resize(static_cast<size_t>(logPipeSize));
+    }
+
+    zeroCopy = true;
+  }
+
+  StreamForwarder::~StreamForwarder()
+  {
+    closePipe(logPipe);
+    closePipe(stagePipe);
+  }
+
+  // ===========================================================================
+  // Methods
+  // ===========================================================================
+  bool
+  StreamForwarder::isZeroCopy() const
+  {
+    return zeroCopy;
+  }
+
+  void
+  StreamForwarder::disableZeroCopy()
+  {
+    if (zeroCopy) {
+      LOG_DEBUG << "Zero copy unsupported, using buffered forwarding"
+                << std::endl;
+    }
+    zeroCopy = false;
+  }
+
+  ssize_t
+  StreamForwarder::forward()
+  {
+    return zeroCopy ? forwardSpliced() : forwardBuffered();
+  }
+
+  ssize_t
+  StreamForwarder::forwardBuffered()
+  {
+    ssize_t readCount {read(srcFd, buffer.data(), buffer.size())};
+    if (0 < readCount) {
+      const auto count {static_cast<size_t>(readCount)};
+      writeAll(dstFd, buffer.data(), count);
+      log.write(buffer.data(), count);
+    }
+    return readCount;
+  }
+
+  ssize_t
+  StreamForwarder::forwardSpliced()
+  {
+    // Get the data into a pipe (if needed) and duplicate it for the log
+    int stageFd {srcFd};
+    ssize_t staged {0};
+    if (srcIsPipe) {
+      staged = tee(srcFd, logPipe[1], buffer.size(), SPLICE_F_NONBLOCK);
+      if (0 > staged && isUnsupported(errno)) {
+        disableZeroCopy();
+        return forwardBuffered();
+      }
+      if (0 >= staged) { return staged; }
+    } else {
+      staged = splice(srcFd, nullptr, stagePipe[1], nullptr, buffer.size(),
+                      SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+      if (0 > staged && isUnsupported(errno)) {
+        disableZeroCopy();
+        return forwardBuffered();
+      }
+      if (0 >= staged) { return staged; }
+
+      stageFd = stagePipe[0];
+      const ssize_t teed {tee(stageFd, logPipe[1],
+                              static_cast<size_t>(staged),
+                              SPLICE_F_NONBLOCK)};
+      if (teed != staged) {
+        // Should not happen as sized, but do not lose data if it does
+        disableZeroCopy();
+        const auto teedCount {static_cast<size_t>(std::max<ssize_t>(0, teed))};
+        const auto remaining {static_cast<size_t>(staged) - teedCount};
+        moveAll(stageFd, dstFd, teedCount);
+        moveAll(logPipe[0], log.getRawFd(), teedCount);
+        ssize_t readCount {read(stageFd, buffer.data(), remaining)};
+        if (0 < readCount) {
+          const auto count {static_cast<size_t>(readCount)};
+          writeAll(dstFd, buffer.data(), count);
+          log.write(buffer.data(), count);
+        }
+        return staged;
+      }
+    }
+
+    const auto count {static_cast<size_t>(staged)};
+    if (!moveAll(stageFd, dstFd, count)) {
+      LOG_WARN << "Forwarding failure (" << errno << ": "
+               << std::strerror(errno) << ")" << std::endl;
+    }
+    if (!moveAll(logPipe[0], log.getRawFd(), count)) {
+      LOG_WARN << "Log write failure (" << errno << ": "
+               << std::strerror(errno) << "): " << log.getPath()
+               << std::endl;
+    }
+
+    return staged;
+  }
+
+  bool
+  StreamForwarder::moveAll(int _inFd, int _outFd, size_t _count)
+  {
+    while (0 < _count) {
+      if (zeroCopy) {
+        ssize_t moved {splice(_inFd, nullptr, _outFd, nullptr, _count,
+                              SPLICE_F_MOVE)};
+        if (0 < moved) {
+          _count -= static_cast<size_t>(moved);
+          continue;
+        }
+        if (0 > moved && EINTR == errno) { continue; }
+        if (0 > moved && (EAGAIN == errno || EWOULDBLOCK == errno)) {
+          pollfd pfd {_outFd, POLLOUT, 0};
+          poll(&pfd, 1, -1);
+          continue;
+        }
+        if (0 > moved && isUnsupported(errno)) {
+          // Finish this, and future, transfers through user space
+          disableZeroCopy();
+          continue;
+        }
+        return false;
+      }
+
+      ssize_t readCount {read(_inFd, buffer.data(),
+                              std::min(_count, buffer.size()))};
+      if (0 > readCount && EINTR == errno) { continue; }
+      if (0 >= readCount) { return false; }
+
+      const auto count {static_cast<size_t>(readCount)};
+      if (!writeAll(_outFd, buffer.data(), count)) { return false; }
+      _count -= count;
+    }
+
+    return true;
+  }
+
+  bool
+  StreamForwarder::writeAll(int _fd, const char* _data, size_t _size)
+  {
+    while (0 < _size) {
+      ssize_t writeCount {write(_fd, _data, _size)};
+      if (0 > writeCount) {
+        if (EINTR == errno) { continue; }
+        if (EAGAIN == errno || EWOULDBLOCK == errno) {
+          pollfd pfd {_fd, POLLOUT, 0};
+          poll(&pfd, 1, -1);
+          continue;
+        }
+        LOG_WARN << "Write failure, " << _size << " bytes dropped"
+                 << " (" << errno << ": " << std::strerror(errno) << ")"
+                 << std::endl;
+        return false;
+      }
+      _data += writeCount;
+      _size -= static_cast<size_t>(writeCount);
+    }
+    return true;
+  }
+}
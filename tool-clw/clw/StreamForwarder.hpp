@@ -0,0 +1,100 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#ifndef CLW_STREAM_FORWARDER_HPP
+#define CLW_STREAM_FORWARDER_HPP
+
+#include <vector>
+
+extern "C" {
+#include <sys/types.h>
+}
+
+#include "LogSink.hpp"
+
+namespace netmeld::tools::clw {
+
+  /*
+    Forwards data from one descriptor to another while logging a copy.
+
+    When zero copy is requested and the log is uncompressed, `splice` and
+    `tee` are used so the data never enters user space.  Descriptors which do
+    not support splicing (this varies by kernel and descriptor type) cause
+    an automatic, transparent, fall back to buffered `read`/`write`.
+  */
+  class StreamForwarder {
+    // =========================================================================
+    // Variables
+    // =========================================================================
+    private: // Variables will probably rarely appear at this scope
+      int       srcFd;
+      int       dstFd;
+      LogSink&  log;
+
+      std::vector<char> buffer;
+
+      bool  zeroCopy  {false};
+      bool  srcIsPipe {false};
+      int   stagePipe[2]  {-1, -1};
+      int   logPipe[2]    {-1, -1};
+
+    protected: // Variables intended for internal/subclass API
+    public: // Variables should rarely appear at this scope
+
+    // =========================================================================
+    // Constructors and Destructors
+    // =========================================================================
+    private: // Constructors which should be hidden from API users
+    protected: // Constructors part of subclass API
+    public: // Constructors and destructors part of public API
+      StreamForwarder() = delete;
+      StreamForwarder(int, int, LogSink&, size_t, bool = false);
+      ~StreamForwarder();
+
+      StreamForwarder(const StreamForwarder&) = delete;
+      void operator=(const StreamForwarder&) = delete;
+
+    // =========================================================================
+    // Methods
+    // =========================================================================
+    private: // Methods which should be hidden from API users
+      ssize_t forwardBuffered();
+      ssize_t forwardSpliced();
+
+      bool moveAll(int, int, size_t);
+      bool writeAll(int, const char*, size_t);
+
+      void disableZeroCopy();
+
+    protected: // Methods part of subclass API
+    public: // Methods part of public API
+      bool isZeroCopy() const;
+
+      // Forward what is currently available; bytes forwarded, 0 on EOF, or
+      // -1 on error
+      ssize_t forward();
+  };
+}
+#endif  /* CLW_STREAM_FORWARDER_HPP */
@@ -0,0 +1,135 @@
+// =============================================================================
+// Copyright 2024 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// =============================================================================
+// Maintained by Sandia National Laboratories <Netmeld@sandia.gov>
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+#include <sstream>
+
+extern "C" {
+#include <fcntl.h>
+#include <unistd.h>
+}
+
+#include "StreamForwarder.hpp"
+
+namespace nmtc = netmeld::tools::clw;
+
+
+namespace {
+  std::filesystem::path
+  getTestPath(const std::string& _name)
+  {
+    return std::filesystem::temp_directory_path()/("clw-unit-test-" + _name);
+  }
+
+  std::string
+  readPlain(const std::filesystem::path& _path)
+  {
+    std::ifstream f {_path};
+    std::ostringstream oss;
+    oss << f.rdbuf();
+    return oss.str();
+  }
+
+  std::string
+  readAvailable(int fd)
+  {
+    std::string data;
+    char buffer[4096];
+    for (ssize_t count; 0 < (count = read(fd, buffer, sizeof(buffer)));) {
+      data.append(buffer, static_cast<size_t>(count));
+    }
+    return data;
+  }
+
+  void
+  testForwarding(size_t bufferSize, bool zeroCopy)
+  {
+    const auto path {getTestPath("forward.txt")};
+
+    int src[2];
+    int dst[2];
+    BOOST_TEST_REQUIRE(0 == pipe(src));
+    BOOST_TEST_REQUIRE(0 == pipe(dst));
+    fcntl(dst[0], F_SETFL, O_NONBLOCK);
+
+    std::string expected;
+    for (size_t i {0}; i < 1000; ++i) {
+      expected += "line " + std::to_string(i) + '\n';
+    }
+    BOOST_TEST_REQUIRE(0 < write(src[1], expected.data(), 8000));
+    close(src[1]);
+
+    std::string forwarded;
+    {
+      nmtc::LogSink sink {path, nmtc::LogCompression::NONE};
+      nmtc::StreamForwarder fwd {src[0], dst[1], sink, bufferSize, zeroCopy};
+      while (0 < fwd.forward()) {
+        forwarded += readAvailable(dst[0]);
+      }
+    }
+    forwarded += readAvailable(dst[0]);
+
+    BOOST_TEST(expected.substr(0, 8000) == forwarded);
+    BOOST_TEST(expected.substr(0, 8000) == readPlain(path));
+
+    for (int fd : {src[0], dst[0], dst[1]}) {
+      close(fd);
+    }
+    std::filesystem::remove(path);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testForwardBuffered)
+{
+  testForwarding(160, false);
+}
+
+BOOST_AUTO_TEST_CASE(testForwardZeroCopy)
+{
+  // Falls back transparently if the kernel refuses any of the calls
+  testForwarding(64 * 1024, true);
+}
+
+BOOST_AUTO_TEST_CASE(testForwardZeroCopyCompressed)
+{
+  // Compressed logs always require user space copies
+  const auto path {getTestPath("compressed.txt")};
+  int src[2];
+  BOOST_TEST_REQUIRE(0 == pipe(src));
+  {
+    nmtc::LogSink sink {path, nmtc::LogCompression::GZIP};
+    nmtc::StreamForwarder fwd {src[0], STDOUT_FILENO, sink, 4096, true};
+    BOOST_TEST(!fwd.isZeroCopy());
+  }
+  close(src[0]);
+  close(src[1]);
+  auto gzPath {path};
+  gzPath += ".gz";
+  std::filesystem::remove(gzPath);
+}
@@ -32,6 +32,8 @@
 #include <netmeld/core/objects/Uuid.hpp>
 
 #include "AugmentArgs.hpp"
+#include "LogSink.hpp"
+#include "StreamForwarder.hpp"
 
 extern "C" {
 #include <fcntl.h>
@@ -46,6 +48,7 @@ extern "C" {
 namespace nmct = netmeld::core::tools;
 namespace nmcu = netmeld::core::utils;
 namespace nmco = netmeld::core::objects;
+namespace nmtc = netmeld::tools::clw;
 
 
 class Tool : public nmct::AbstractTool
@@ -124,6 +127,28 @@ class Tool : public nmct::AbstractTool
           , "Command to wrap")
         );
       opts.addPositionalOption("command", -1);
+
+      opts.addOptionalOption("high-throughput", std::make_tuple(
+            "high-throughput"
+          , NULL_SEMANTIC
+          , "Forward output using large buffers and, where the kernel"
+            " supports it, zero copy splice/tee.  Intended for long running"
+            " or chatty commands.")
+        );
+      opts.addOptionalOption("compress-logs", std::make_tuple(
+            "compress-logs"
+          , po::value<nmtc::LogCompression>()->default_value(
+              nmtc::LogCompression::NONE)
+          , "Compress captured stdin/stdout/stderr logs while capturing;"
+            " none or gzip.")
+        );
+      opts.addAdvancedOption("log-flush-interval", std::make_tuple(
+            "log-flush-interval"
+          , po::value<unsigned int>()->default_value(1)
+          , "Seconds between flushes of compressed logs, bounding the data"
+            " lost if the capture terminates unexpectedly; 0 flushes on every"
+            " write.")
+        );
     }
 
     template<typename Data>
@@ -364,14 +389,18 @@ class Tool : public nmct::AbstractTool
           }
         default:
           {  // In parent.
-            std::ofstream logChildStdIn
-              {(toolRunResults/"stdin.txt").string()};
-
-            std::ofstream logChildStdOut
-              {(toolRunResults/"stdout.txt").string()};
-
-            std::ofstream logChildStdErr
-              {(toolRunResults/"stderr.txt").string()};
+            const auto compression {
+              opts.getValueAs<nmtc::LogCompression>("compress-logs")
+            };
+            const std::chrono::seconds flushInterval {
+              opts.getValueAs<unsigned int>("log-flush-interval")
+            };
+            nmtc::LogSink logChildStdIn
+              {toolRunResults/"stdin.txt", compression, flushInterval};
+            nmtc::LogSink logChildStdOut
+              {toolRunResults/"stdout.txt", compression, flushInterval};
+            nmtc::LogSink logChildStdErr
+              {toolRunResults/"stderr.txt", compression, flushInterval};
 
             // Store copy of terminal setting to be restored later.
             termios ptySettingsOriginal;
@@ -402,60 +431,51 @@ class Tool : public nmct::AbstractTool
             pfds[2].events = (POLLIN | POLLPRI | POLLERR | POLLHUP | POLLNVAL);
 
 
-            size_t const bufferSize = 160;
-            char buffer[bufferSize];
-
-            while (0 < poll(pfds, 3, -1)) {
+            const bool highThroughput {opts.exists("high-throughput")};
+            size_t const bufferSize {highThroughput ? (256U * 1024U) : 160U};
+
+            nmtc::StreamForwarder fwdStdIn
+              {STDIN_FILENO, ptmInOut, logChildStdIn, bufferSize,
+               highThroughput};
+            nmtc::StreamForwarder fwdStdOut
+              {ptmInOut, STDOUT_FILENO, logChildStdOut, bufferSize,
+               highThroughput};
+            nmtc::StreamForwarder fwdStdErr
+              {ptErr[0], STDERR_FILENO, logChildStdErr, bufferSize,
+               highThroughput};
+
+            // Compressed logs need a periodic wake up to be flushed, unless
+            // each write already flushes (a zero timeout would busy-spin)
+            const int pollTimeout {
+              (  nmtc::LogCompression::NONE == compression
+              || 0 == flushInterval.count())
+              ? -1
+              : static_cast<int>(
+                  std::chrono::milliseconds(flushInterval).count())
+            };
+
+            int pollResult;
+            while (0 <= (pollResult = poll(pfds, 3, pollTimeout))) {
+              if (0 == pollResult) {
+                logChildStdIn.flush();
+                logChildStdOut.flush();
+                logChildStdErr.flush();
+                continue;
+              }
 
               // Forward parent's stdin -> child's stdin (pty) and log files.
               if (pfds[0].revents & (POLLIN | POLLPRI)) {
-                ssize_t readCount = read(pfds[0].fd, buffer, bufferSize);
-                if (0 < readCount) {
-                  ssize_t writeCount =
-                    write(ptmInOut, buffer, static_cast<size_t>(readCount));
-                  if (writeCount != readCount) {
-                    LOG_WARN << "STDIN read and write counts do not match,"
-                             << " r:" << readCount << " vs w:" << writeCount
-                             << std::endl;
-                  }
-
-                  logChildStdIn.write(buffer, readCount);
-                  logChildStdIn.flush();
-                }
+                fwdStdIn.forward();
               }
 
               // Forward child's stdout (pty) -> parent's stdout and log files.
               if (pfds[1].revents & (POLLIN | POLLPRI)) {
-                ssize_t readCount = read(pfds[1].fd, buffer, bufferSize);
-                if (0 < readCount) {
-                  ssize_t writeCount =
-                    write(STDOUT_FILENO, buffer, static_cast<size_t>(readCount));
-                  if (writeCount != readCount) {
-                    LOG_WARN << "STDOUT read and write counts do not match,"
-                             << " r:" << readCount << " vs w:" << writeCount
-                             << std::endl;
-                  }
-
-                  logChildStdOut.write(buffer, readCount);
-                  logChildStdOut.flush();
-                }
+                fwdStdOut.forward();
               }
 
               // Forward child's stderr (pipe) -> parent's stderr and log files.
               if (pfds[2].revents & (POLLIN | POLLPRI)) {
-                ssize_t readCount = read(pfds[2].fd, buffer, bufferSize);
-                if (0 < readCount) {
-                  ssize_t writeCount =
-                    write(STDERR_FILENO, buffer, static_cast<size_t>(readCount));
-                  if (writeCount != readCount) {
-                    LOG_WARN << "STDERR read and write counts do not match,"
-                             << " r:" << readCount << " vs w:" << writeCount
-                             << std::endl;
-                  }
-
-                  logChildStdErr.write(buffer, readCount);
-                  logChildStdErr.flush();
-                }
+                fwdStdErr.forward();
               }
 
               // The child closed the pty/pipe, hung-up, or had I/O errors.
@@ -467,9 +487,16 @@ class Tool : public nmct::AbstractTool
               }
             }
 
-            logChildStdIn.flush();
-            logChildStdOut.flush();
-            logChildStdErr.flush();
+            // Forward anything still buffered from the child, without waiting
+            for (int fd : {ptmInOut, ptErr[0]}) {
+              fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            }
+            while (0 < fwdStdOut.forward()) {}
+            while (0 < fwdStdErr.forward()) {}
+
+            logChildStdIn.flush(true);
+            logChildStdOut.flush(true);
+            logChildStdErr.flush(true);
 
             logChildStdIn.close();
             logChildStdOut.close();